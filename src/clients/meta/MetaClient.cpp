@@ -35,6 +35,9 @@ DEFINE_int32(meta_client_retry_interval_secs, 1, "meta client sleep interval bet
 DEFINE_int32(meta_client_timeout_ms, 60 * 1000, "meta client timeout");
 DEFINE_string(cluster_id_path, "cluster.id", "file path saved clusterId");
 DEFINE_int32(check_plan_killed_frequency, 8, "check plan killed every 1<<n times");
+DEFINE_int32(stats_cache_expired_secs,
+             300,
+             "The statistics of space used by optimizer are refreshed after these seconds");
 DEFINE_uint32(failed_login_attempts,
               0,
               "how many consecutive incorrect passwords input to a SINGLE graph service node cause "
@@ -62,6 +65,25 @@ namespace meta {
 
 Indexes buildIndexes(std::vector<cpp2::IndexItem> indexItemVec);
 
+// Replace the entries of the concurrent map in place, the readers always see a valid entry of
+// each part during replacing
+template <typename K, typename V>
+void replaceLeaders(folly::ConcurrentHashMap<K, V>& current,
+                    const std::unordered_map<K, V>& loaded) {
+  for (const auto& entry : loaded) {
+    current.insert_or_assign(entry.first, entry.second);
+  }
+  std::vector<K> removed;
+  for (const auto& entry : current) {
+    if (loaded.find(entry.first) == loaded.end()) {
+      removed.emplace_back(entry.first);
+    }
+  }
+  for (const auto& key : removed) {
+    current.erase(key);
+  }
+}
+
 MetaClient::MetaClient(std::shared_ptr<folly::IOThreadPoolExecutor> ioThreadPool,
                        std::vector<HostAddr> addrs,
                        const MetaClientOptions& options)
@@ -285,6 +307,15 @@ bool MetaClient::loadData() {
     return false;
   }
 
+  // Snapshot the update time before loading, data changed during loading will be reloaded next
+  // time. Spaces absent in metad's update time map are always reloaded.
+  auto metadLastUpdateTime = metadLastUpdateTime_.load();
+  std::unordered_map<GraphSpaceID, int64_t> spaceUpdateTime;
+  {
+    folly::SharedMutex::ReadHolder holder(spaceUpdateTimeLock_);
+    spaceUpdateTime = metadSpaceUpdateTime_;
+  }
+
   auto ret = listSpaces().get();
   if (!ret.ok()) {
     LOG(ERROR) << "List space failed, status:" << ret.status();
@@ -301,59 +332,51 @@ bool MetaClient::loadData() {
   decltype(spaceTagIndexById_) spaceTagIndexById;
   decltype(spaceAllEdgeMap_) spaceAllEdgeMap;
 
-  for (auto space : ret.value()) {
+  // Load all spaces concurrently. An unchanged space only refreshes its parts allocation, which
+  // is changed by balance and leader terms without touching the space update time.
+  std::vector<folly::Future<Status>> futures;
+  size_t reloaded = 0;
+  for (auto& space : ret.value()) {
     auto spaceId = space.first;
-    MetaClient::PartTerms partTerms;
-    auto r = getPartsAlloc(spaceId, &partTerms).get();
-    if (!r.ok()) {
-      LOG(ERROR) << "Get parts allocation failed for spaceId " << spaceId << ", status "
-                 << r.status();
-      return false;
-    }
-
-    auto spaceCache = std::make_shared<SpaceInfoCache>();
-    auto partsAlloc = r.value();
-    auto& spaceName = space.second;
-    spaceCache->partsOnHost_ = reverse(partsAlloc);
-    spaceCache->partsAlloc_ = std::move(partsAlloc);
-    spaceCache->termOfPartition_ = std::move(partTerms);
-    VLOG(2) << "Load space " << spaceId << ", parts num:" << spaceCache->partsAlloc_.size();
-
-    // loadSchemas
-    if (!loadSchemas(spaceId,
-                     spaceCache,
-                     spaceTagIndexByName,
-                     spaceTagIndexById,
-                     spaceEdgeIndexByName,
-                     spaceEdgeIndexByType,
-                     spaceNewestTagVerMap,
-                     spaceNewestEdgeVerMap,
-                     spaceAllEdgeMap)) {
-      LOG(ERROR) << "Load Schemas Failed";
-      return false;
-    }
-
-    if (!loadIndexes(spaceId, spaceCache)) {
-      LOG(ERROR) << "Load Indexes Failed";
-      return false;
-    }
-
-    if (!loadListeners(spaceId, spaceCache)) {
-      LOG(ERROR) << "Load Listeners Failed";
-      return false;
+    std::shared_ptr<SpaceInfoCache> spaceCache;
+    auto cached = localCache_.find(spaceId);
+    auto metadTime = spaceUpdateTime.find(spaceId);
+    auto localTime = localSpaceUpdateTime_.find(spaceId);
+    if (cached != localCache_.end() && metadTime != spaceUpdateTime.end() &&
+        localTime != localSpaceUpdateTime_.end() && metadTime->second == localTime->second) {
+      // copy the cached one, the old cache is compared with the new one in diff
+      spaceCache = std::make_shared<SpaceInfoCache>(*cached->second);
+      loadSpace(spaceId, space.second, spaceCache, true, futures);
+    } else {
+      spaceCache = std::make_shared<SpaceInfoCache>();
+      loadSpace(spaceId, space.second, spaceCache, false, futures);
+      reloaded++;
     }
+    cache.emplace(spaceId, std::move(spaceCache));
+    spaceIndexByName.emplace(space.second, spaceId);
+  }
 
-    // get space properties
-    auto resp = getSpace(spaceName).get();
-    if (!resp.ok()) {
-      LOG(ERROR) << "Get space properties failed for space " << spaceId;
+  auto results = folly::collectAll(futures).get();
+  for (auto& result : results) {
+    auto status = result.hasException() ? Status::Error(result.exception().what()) : result.value();
+    if (!status.ok()) {
+      LOG(ERROR) << "Load space failed, " << status;
       return false;
     }
-    auto properties = resp.value().get_properties();
-    spaceCache->spaceDesc_ = std::move(properties);
+  }
+  VLOG(1) << "Reload " << reloaded << " of " << cache.size() << " spaces";
 
-    cache.emplace(spaceId, spaceCache);
-    spaceIndexByName.emplace(space.second, spaceId);
+  for (auto& [spaceId, spaceCache] : cache) {
+    buildSchemaNameMaps(spaceId,
+                        spaceCache,
+                        spaceTagIndexByName,
+                        spaceTagIndexById,
+                        spaceEdgeIndexByName,
+                        spaceEdgeIndexByType,
+                        spaceNewestTagVerMap,
+                        spaceNewestEdgeVerMap,
+                        spaceAllEdgeMap);
+    buildIndexNameMaps(spaceId, spaceCache);
   }
 
   auto hostsRet = listHosts().get();
@@ -385,19 +408,13 @@ bool MetaClient::loadData() {
     storageHosts_ = std::move(hosts);
   }
 
-  localDataLastUpdateTime_.store(metadLastUpdateTime_.load());
+  localDataLastUpdateTime_.store(metadLastUpdateTime);
+  localSpaceUpdateTime_ = std::move(spaceUpdateTime);
   auto newMetaData = new MetaData();
 
-  for (auto& spaceInfo : localCache_) {
-    GraphSpaceID spaceId = spaceInfo.first;
-    std::shared_ptr<SpaceInfoCache> info = spaceInfo.second;
-    std::shared_ptr<SpaceInfoCache> infoDeepCopy = std::make_shared<SpaceInfoCache>(*info);
-    infoDeepCopy->tagSchemas_ = buildTagSchemas(infoDeepCopy->tagItemVec_);
-    infoDeepCopy->edgeSchemas_ = buildEdgeSchemas(infoDeepCopy->edgeItemVec_);
-    infoDeepCopy->tagIndexes_ = buildIndexes(infoDeepCopy->tagIndexItemVec_);
-    infoDeepCopy->edgeIndexes_ = buildIndexes(infoDeepCopy->edgeIndexItemVec_);
-    newMetaData->localCache_[spaceId] = infoDeepCopy;
-  }
+  // The space caches are never modified once loaded, so the snapshot shares them with
+  // localCache_ instead of copying, and unchanged spaces share them between snapshots.
+  newMetaData->localCache_ = localCache_;
   newMetaData->spaceIndexByName_ = spaceIndexByName_;
   newMetaData->spaceTagIndexByName_ = spaceTagIndexByName_;
   newMetaData->spaceEdgeIndexByName_ = spaceEdgeIndexByName_;
@@ -484,34 +501,18 @@ void MetaClient::addSchemaField(NebulaSchemaProvider* schema, const cpp2::Column
   schema->addField(col.get_name(), colType.get_type(), len, nullable, encoded, geoShape);
 }
 
-bool MetaClient::loadSchemas(GraphSpaceID spaceId,
-                             std::shared_ptr<SpaceInfoCache> spaceInfoCache,
-                             SpaceTagNameIdMap& tagNameIdMap,
-                             SpaceTagIdNameMap& tagIdNameMap,
-                             SpaceEdgeNameTypeMap& edgeNameTypeMap,
-                             SpaceEdgeTypeNameMap& edgeTypeNameMap,
-                             SpaceNewestTagVerMap& newestTagVerMap,
-                             SpaceNewestEdgeVerMap& newestEdgeVerMap,
-                             SpaceAllEdgeMap& allEdgeMap) {
-  auto tagRet = listTagSchemas(spaceId).get();
-  if (!tagRet.ok()) {
-    LOG(ERROR) << "Get tag schemas failed for spaceId " << spaceId << ", " << tagRet.status();
-    return false;
-  }
-
-  auto edgeRet = listEdgeSchemas(spaceId).get();
-  if (!edgeRet.ok()) {
-    LOG(ERROR) << "Get edge schemas failed for spaceId " << spaceId << ", " << edgeRet.status();
-    return false;
-  }
-
-  auto tagItemVec = tagRet.value();
-  auto edgeItemVec = edgeRet.value();
+void MetaClient::buildSchemaNameMaps(GraphSpaceID spaceId,
+                                     std::shared_ptr<SpaceInfoCache> spaceInfoCache,
+                                     SpaceTagNameIdMap& tagNameIdMap,
+                                     SpaceTagIdNameMap& tagIdNameMap,
+                                     SpaceEdgeNameTypeMap& edgeNameTypeMap,
+                                     SpaceEdgeTypeNameMap& edgeTypeNameMap,
+                                     SpaceNewestTagVerMap& newestTagVerMap,
+                                     SpaceNewestEdgeVerMap& newestEdgeVerMap,
+                                     SpaceAllEdgeMap& allEdgeMap) {
+  const auto& tagItemVec = spaceInfoCache->tagItemVec_;
+  const auto& edgeItemVec = spaceInfoCache->edgeItemVec_;
   allEdgeMap[spaceId] = {};
-  spaceInfoCache->tagItemVec_ = tagItemVec;
-  spaceInfoCache->tagSchemas_ = buildTagSchemas(tagItemVec);
-  spaceInfoCache->edgeItemVec_ = edgeItemVec;
-  spaceInfoCache->edgeSchemas_ = buildEdgeSchemas(edgeItemVec);
 
   for (auto& tagIt : tagItemVec) {
     tagNameIdMap.emplace(std::make_pair(spaceId, tagIt.get_tag_name()), tagIt.get_tag_id());
@@ -554,8 +555,6 @@ bool MetaClient::loadSchemas(GraphSpaceID spaceId,
             << ", Name " << edgeIt.get_edge_name() << ", Version " << edgeIt.get_version()
             << " Successfully!";
   }
-
-  return true;
 }
 
 Indexes buildIndexes(std::vector<cpp2::IndexItem> indexItemVec) {
@@ -569,56 +568,122 @@ Indexes buildIndexes(std::vector<cpp2::IndexItem> indexItemVec) {
   return indexes;
 }
 
-bool MetaClient::loadIndexes(GraphSpaceID spaceId, std::shared_ptr<SpaceInfoCache> cache) {
-  auto tagIndexesRet = listTagIndexes(spaceId).get();
-  if (!tagIndexesRet.ok()) {
-    LOG(ERROR) << "Get tag indexes failed for spaceId " << spaceId << ", "
-               << tagIndexesRet.status();
-    return false;
-  }
-
-  auto edgeIndexesRet = listEdgeIndexes(spaceId).get();
-  if (!edgeIndexesRet.ok()) {
-    LOG(ERROR) << "Get edge indexes failed for spaceId " << spaceId << ", "
-               << edgeIndexesRet.status();
-    return false;
-  }
-
-  auto tagIndexItemVec = tagIndexesRet.value();
-  cache->tagIndexItemVec_ = tagIndexItemVec;
-  cache->tagIndexes_ = buildIndexes(tagIndexItemVec);
-  for (const auto& tagIndex : tagIndexItemVec) {
+void MetaClient::buildIndexNameMaps(GraphSpaceID spaceId, std::shared_ptr<SpaceInfoCache> cache) {
+  for (const auto& tagIndex : cache->tagIndexItemVec_) {
     auto indexName = tagIndex.get_index_name();
     auto indexID = tagIndex.get_index_id();
     std::pair<GraphSpaceID, std::string> pair(spaceId, indexName);
     tagNameIndexMap_[pair] = indexID;
   }
 
-  auto edgeIndexItemVec = edgeIndexesRet.value();
-  cache->edgeIndexItemVec_ = edgeIndexItemVec;
-  cache->edgeIndexes_ = buildIndexes(edgeIndexItemVec);
-  for (auto& edgeIndex : edgeIndexItemVec) {
+  for (auto& edgeIndex : cache->edgeIndexItemVec_) {
     auto indexName = edgeIndex.get_index_name();
     auto indexID = edgeIndex.get_index_id();
     std::pair<GraphSpaceID, std::string> pair(spaceId, indexName);
     edgeNameIndexMap_[pair] = indexID;
   }
-  return true;
 }
 
-bool MetaClient::loadListeners(GraphSpaceID spaceId, std::shared_ptr<SpaceInfoCache> cache) {
-  auto listenerRet = listListener(spaceId).get();
-  if (!listenerRet.ok()) {
-    LOG(ERROR) << "Get listeners failed for spaceId " << spaceId << ", " << listenerRet.status();
-    return false;
-  }
-  Listeners listeners;
-  for (auto& listener : listenerRet.value()) {
-    listeners[listener.get_host()].emplace_back(
-        std::make_pair(listener.get_part_id(), listener.get_type()));
+void MetaClient::loadSpace(GraphSpaceID spaceId,
+                           const std::string& spaceName,
+                           std::shared_ptr<SpaceInfoCache> cache,
+                           bool partsOnly,
+                           std::vector<folly::Future<Status>>& futures) {
+  // Each callback fills different fields of the cache, they are read after all futures finished
+  auto partTerms = std::make_shared<PartTerms>();
+  auto partsFuture = getPartsAlloc(spaceId, partTerms.get());
+  futures.emplace_back(
+      std::move(partsFuture).thenValue([this, spaceId, cache, partTerms](auto&& r) -> Status {
+        if (!r.ok()) {
+          return Status::Error("Get parts allocation failed for spaceId %d, %s",
+                               spaceId,
+                               r.status().toString().c_str());
+        }
+        auto partsAlloc = std::move(r).value();
+        cache->partsOnHost_ = reverse(partsAlloc);
+        cache->partsAlloc_ = std::move(partsAlloc);
+        cache->termOfPartition_ = std::move(*partTerms);
+        VLOG(2) << "Load space " << spaceId << ", parts num:" << cache->partsAlloc_.size();
+        return Status::OK();
+      }));
+  if (partsOnly) {
+    return;
   }
-  cache->listeners_ = std::move(listeners);
-  return true;
+
+  futures.emplace_back(
+      listTagSchemas(spaceId).thenValue([this, spaceId, cache](auto&& tagRet) -> Status {
+        if (!tagRet.ok()) {
+          return Status::Error("Get tag schemas failed for spaceId %d, %s",
+                               spaceId,
+                               tagRet.status().toString().c_str());
+        }
+        cache->tagItemVec_ = std::move(tagRet).value();
+        cache->tagSchemas_ = buildTagSchemas(cache->tagItemVec_);
+        return Status::OK();
+      }));
+
+  futures.emplace_back(
+      listEdgeSchemas(spaceId).thenValue([this, spaceId, cache](auto&& edgeRet) -> Status {
+        if (!edgeRet.ok()) {
+          return Status::Error("Get edge schemas failed for spaceId %d, %s",
+                               spaceId,
+                               edgeRet.status().toString().c_str());
+        }
+        cache->edgeItemVec_ = std::move(edgeRet).value();
+        cache->edgeSchemas_ = buildEdgeSchemas(cache->edgeItemVec_);
+        return Status::OK();
+      }));
+
+  futures.emplace_back(
+      listTagIndexes(spaceId).thenValue([spaceId, cache](auto&& tagIndexesRet) -> Status {
+        if (!tagIndexesRet.ok()) {
+          return Status::Error("Get tag indexes failed for spaceId %d, %s",
+                               spaceId,
+                               tagIndexesRet.status().toString().c_str());
+        }
+        cache->tagIndexItemVec_ = std::move(tagIndexesRet).value();
+        cache->tagIndexes_ = buildIndexes(cache->tagIndexItemVec_);
+        return Status::OK();
+      }));
+
+  futures.emplace_back(
+      listEdgeIndexes(spaceId).thenValue([spaceId, cache](auto&& edgeIndexesRet) -> Status {
+        if (!edgeIndexesRet.ok()) {
+          return Status::Error("Get edge indexes failed for spaceId %d, %s",
+                               spaceId,
+                               edgeIndexesRet.status().toString().c_str());
+        }
+        cache->edgeIndexItemVec_ = std::move(edgeIndexesRet).value();
+        cache->edgeIndexes_ = buildIndexes(cache->edgeIndexItemVec_);
+        return Status::OK();
+      }));
+
+  futures.emplace_back(
+      listListener(spaceId).thenValue([spaceId, cache](auto&& listenerRet) -> Status {
+        if (!listenerRet.ok()) {
+          return Status::Error("Get listeners failed for spaceId %d, %s",
+                               spaceId,
+                               listenerRet.status().toString().c_str());
+        }
+        Listeners listeners;
+        for (auto& listener : listenerRet.value()) {
+          listeners[listener.get_host()].emplace_back(
+              std::make_pair(listener.get_part_id(), listener.get_type()));
+        }
+        cache->listeners_ = std::move(listeners);
+        return Status::OK();
+      }));
+
+  // get space properties
+  futures.emplace_back(getSpace(spaceName).thenValue([spaceId, cache](auto&& resp) -> Status {
+    if (!resp.ok()) {
+      return Status::Error("Get space properties failed for space %d, %s",
+                           spaceId,
+                           resp.status().toString().c_str());
+    }
+    cache->spaceDesc_ = resp.value().get_properties();
+    return Status::OK();
+  }));
 }
 
 bool MetaClient::loadGlobalServiceClients() {
@@ -1714,13 +1779,15 @@ folly::Future<StatusOr<bool>> MetaClient::dropEdgeSchema(GraphSpaceID spaceId,
   return future;
 }
 
-folly::Future<StatusOr<IndexID>> MetaClient::createTagIndex(GraphSpaceID spaceID,
-                                                            std::string indexName,
-                                                            std::string tagName,
-                                                            std::vector<cpp2::IndexFieldDef> fields,
-                                                            bool ifNotExists,
-                                                            const cpp2::IndexParams* indexParams,
-                                                            const std::string* comment) {
+folly::Future<StatusOr<IndexID>> MetaClient::createTagIndex(
+    GraphSpaceID spaceID,
+    std::string indexName,
+    std::string tagName,
+    std::vector<cpp2::IndexFieldDef> fields,
+    bool ifNotExists,
+    const cpp2::IndexParams* indexParams,
+    const std::string* comment,
+    std::vector<std::string> includeFields) {
   cpp2::CreateTagIndexReq req;
   req.space_id_ref() = spaceID;
   req.index_name_ref() = std::move(indexName);
@@ -1733,6 +1800,9 @@ folly::Future<StatusOr<IndexID>> MetaClient::createTagIndex(GraphSpaceID spaceID
   if (comment != nullptr) {
     req.comment_ref() = *comment;
   }
+  if (!includeFields.empty()) {
+    req.include_fields_ref() = std::move(includeFields);
+  }
 
   folly::Promise<StatusOr<IndexID>> promise;
   auto future = promise.getFuture();
@@ -1836,7 +1906,8 @@ folly::Future<StatusOr<IndexID>> MetaClient::createEdgeIndex(
     std::vector<cpp2::IndexFieldDef> fields,
     bool ifNotExists,
     const cpp2::IndexParams* indexParams,
-    const std::string* comment) {
+    const std::string* comment,
+    std::vector<std::string> includeFields) {
   cpp2::CreateEdgeIndexReq req;
   req.space_id_ref() = spaceID;
   req.index_name_ref() = std::move(indexName);
@@ -1849,6 +1920,9 @@ folly::Future<StatusOr<IndexID>> MetaClient::createEdgeIndex(
   if (comment != nullptr) {
     req.comment_ref() = *comment;
   }
+  if (!includeFields.empty()) {
+    req.include_fields_ref() = std::move(includeFields);
+  }
 
   folly::Promise<StatusOr<IndexID>> promise;
   auto future = promise.getFuture();
@@ -2283,50 +2357,54 @@ StatusOr<HostAddr> MetaClient::getStorageLeaderFromCache(GraphSpaceID spaceId, P
     return Status::Error("Not ready!");
   }
 
-  {
-    folly::SharedMutex::ReadHolder holder(leadersLock_);
-    auto iter = leadersInfo_.leaderMap_.find({spaceId, partId});
-    if (iter != leadersInfo_.leaderMap_.end()) {
-      return iter->second;
-    }
+  auto iter = leaderMap_.find({spaceId, partId});
+  if (iter != leaderMap_.cend()) {
+    return iter->second;
   }
-  {
-    // no leader found, pick one in round-robin
-    auto partHostsRet = getPartHostsFromCache(spaceId, partId);
-    if (!partHostsRet.ok()) {
-      return partHostsRet.status();
-    }
-    auto partHosts = partHostsRet.value();
-    folly::SharedMutex::WriteHolder wh(leadersLock_);
-    VLOG(1) << "No leader exists. Choose one in round-robin.";
-    auto index = (leadersInfo_.pickedIndex_[{spaceId, partId}] + 1) % partHosts.hosts_.size();
-    auto picked = partHosts.hosts_[index];
-    leadersInfo_.leaderMap_[{spaceId, partId}] = picked;
-    leadersInfo_.pickedIndex_[{spaceId, partId}] = index;
-    return picked;
+
+  // no leader found, pick one in round-robin
+  auto partHostsRet = getPartHostsFromCache(spaceId, partId);
+  if (!partHostsRet.ok()) {
+    return partHostsRet.status();
+  }
+  auto partHosts = partHostsRet.value();
+  VLOG(1) << "No leader exists. Choose one in round-robin.";
+  size_t lastIndex = 0;
+  auto lastPicked = pickedIndex_.find({spaceId, partId});
+  if (lastPicked != pickedIndex_.cend()) {
+    lastIndex = lastPicked->second;
   }
+  auto index = (lastIndex + 1) % partHosts.hosts_.size();
+  auto picked = partHosts.hosts_[index];
+  leaderMap_.insert_or_assign(std::make_pair(spaceId, partId), picked);
+  pickedIndex_.insert_or_assign(std::make_pair(spaceId, partId), index);
+  return picked;
 }
 
 void MetaClient::updateStorageLeader(GraphSpaceID spaceId,
                                      PartitionID partId,
                                      const HostAddr& leader) {
   VLOG(1) << "Update the leader for [" << spaceId << ", " << partId << "] to " << leader;
-  folly::SharedMutex::WriteHolder holder(leadersLock_);
-  leadersInfo_.leaderMap_[{spaceId, partId}] = leader;
+  leaderMap_.insert_or_assign(std::make_pair(spaceId, partId), leader);
 }
 
 void MetaClient::invalidStorageLeader(GraphSpaceID spaceId, PartitionID partId) {
   VLOG(1) << "Invalidate the leader for [" << spaceId << ", " << partId << "]";
-  folly::SharedMutex::WriteHolder holder(leadersLock_);
-  leadersInfo_.leaderMap_.erase({spaceId, partId});
+  leaderMap_.erase({spaceId, partId});
 }
 
 StatusOr<LeaderInfo> MetaClient::getLeaderInfo() {
   if (!ready_) {
     return Status::Error("Not ready!");
   }
-  folly::SharedMutex::ReadHolder holder(leadersLock_);
-  return leadersInfo_;
+  LeaderInfo leaderInfo;
+  for (const auto& leader : leaderMap_) {
+    leaderInfo.leaderMap_.emplace(leader.first, leader.second);
+  }
+  for (const auto& index : pickedIndex_) {
+    leaderInfo.pickedIndex_.emplace(index.first, index.second);
+  }
+  return leaderInfo;
 }
 
 const std::vector<HostAddr>& MetaClient::getAddresses() {
@@ -2552,6 +2630,14 @@ folly::Future<StatusOr<bool>> MetaClient::heartbeat() {
           }
         }
         heartbeatTime_ = time::WallClock::fastNowInMilliSec();
+        {
+          folly::SharedMutex::WriteHolder holder(spaceUpdateTimeLock_);
+          if (resp.space_update_time_in_ms_ref().has_value()) {
+            metadSpaceUpdateTime_ = std::move(*resp.space_update_time_in_ms_ref());
+          } else {
+            metadSpaceUpdateTime_.clear();
+          }
+        }
         metadLastUpdateTime_ = resp.get_last_update_time_in_ms();
         VLOG(1) << "Metad last update time: " << metadLastUpdateTime_;
         metaServerVersion_ = resp.get_meta_version();
@@ -3108,8 +3194,8 @@ void MetaClient::loadLeader(const std::vector<cpp2::HostItem>& hostItems,
     // todo(doodle): in worst case, storage and meta isolated, so graph may get a outdate
     // leader info. The problem could be solved if leader term are cached as well.
     LOG(INFO) << "Load leader ok";
-    folly::SharedMutex::WriteHolder wh(leadersLock_);
-    leadersInfo_ = std::move(leaderInfo);
+    replaceLeaders(leaderMap_, leaderInfo.leaderMap_);
+    replaceLeaders(pickedIndex_, leaderInfo.pickedIndex_);
   }
 }
 
@@ -3272,6 +3358,33 @@ folly::Future<StatusOr<cpp2::StatsItem>> MetaClient::getStats(GraphSpaceID space
   return future;
 }
 
+std::shared_ptr<const cpp2::StatsItem> MetaClient::getStatsFromCache(GraphSpaceID spaceId) {
+  auto now = time::WallClock::fastNowInSec();
+  std::shared_ptr<const cpp2::StatsItem> stats;
+  {
+    std::lock_guard<std::mutex> guard(statsCacheLock_);
+    auto& entry = statsCache_[spaceId];
+    stats = entry.stats;
+    if (entry.refreshing || now - entry.updateTimeInSec < FLAGS_stats_cache_expired_secs) {
+      return stats;
+    }
+    entry.refreshing = true;
+  }
+  getStats(spaceId).thenValue([this, spaceId](StatusOr<cpp2::StatsItem>&& resp) {
+    std::lock_guard<std::mutex> guard(statsCacheLock_);
+    auto& entry = statsCache_[spaceId];
+    // Keep the old statistics when the stats job is running or failed
+    if (resp.ok() && resp.value().get_status() == cpp2::JobStatus::FINISHED) {
+      entry.stats = std::make_shared<const cpp2::StatsItem>(std::move(resp).value());
+    } else if (!resp.ok()) {
+      VLOG(2) << "Get stats of space " << spaceId << " failed: " << resp.status();
+    }
+    entry.updateTimeInSec = time::WallClock::fastNowInSec();
+    entry.refreshing = false;
+  });
+  return stats;
+}
+
 folly::Future<StatusOr<nebula::cpp2::ErrorCode>> MetaClient::reportTaskFinish(
     GraphSpaceID spaceId,
     int32_t jobId,
@@ -3626,6 +3739,10 @@ bool MetaClient::checkIsPlanKilled(SessionID sessionId, ExecutionPlanID planId)
   if (check_counter != 0) {
     return false;
   }
+  return isPlanKilled(sessionId, planId);
+}
+
+bool MetaClient::isPlanKilled(SessionID sessionId, ExecutionPlanID planId) {
   folly::rcu_reader guard;
   return metadata_.load()->killedPlans_.count({sessionId, planId});
 }
@@ -245,6 +245,12 @@ class MetaClient : public BaseMetaClient {
 
   bool isMetadReady();
 
+  // The last update time of metad when the local cache was loaded, it changes with any schema,
+  // space or role, e.g. to invalidate the plans compiled with the old metadata
+  int64_t localDataLastUpdateTime() const {
+    return localDataLastUpdateTime_.load();
+  }
+
   bool waitForMetadReady(int count = -1, int retryIntervalSecs = FLAGS_heartbeat_interval_secs);
 
   void notifyStop();
@@ -348,7 +354,8 @@ class MetaClient : public BaseMetaClient {
       std::vector<cpp2::IndexFieldDef> fields,
       bool ifNotExists = false,
       const meta::cpp2::IndexParams* indexParams = nullptr,
-      const std::string* comment = nullptr);
+      const std::string* comment = nullptr,
+      std::vector<std::string> includeFields = {});
 
   // Remove the define of tag index
   folly::Future<StatusOr<bool>> dropTagIndex(GraphSpaceID spaceId,
@@ -369,7 +376,8 @@ class MetaClient : public BaseMetaClient {
                                                    std::vector<cpp2::IndexFieldDef> fields,
                                                    bool ifNotExists = false,
                                                    const cpp2::IndexParams* indexParams = nullptr,
-                                                   const std::string* comment = nullptr);
+                                                   const std::string* comment = nullptr,
+                                                   std::vector<std::string> includeFields = {});
 
   // Remove the definition of edge index
   folly::Future<StatusOr<bool>> dropEdgeIndex(GraphSpaceID spaceId,
@@ -595,8 +603,12 @@ class MetaClient : public BaseMetaClient {
 
   StatusOr<cpp2::Session> getSessionFromCache(const nebula::SessionID& session_id);
 
+  // Sampled by check_plan_killed_frequency, for the checks in each row
   bool checkIsPlanKilled(SessionID session_id, ExecutionPlanID plan_id);
 
+  // Whether the plan is killed as of the last load of sessions
+  bool isPlanKilled(SessionID session_id, ExecutionPlanID plan_id);
+
   StatusOr<HostAddr> getStorageLeaderFromCache(GraphSpaceID spaceId, PartitionID partId);
 
   void updateStorageLeader(GraphSpaceID spaceId, PartitionID partId, const HostAddr& leader);
@@ -630,6 +642,13 @@ class MetaClient : public BaseMetaClient {
 
   folly::Future<StatusOr<cpp2::StatsItem>> getStats(GraphSpaceID spaceId);
 
+  /**
+   * @brief Get the statistics of space collected by the last finished stats job, which are used by
+   * the cost model of optimizer. It never blocks, the cache is refreshed in background after
+   * stats_cache_expired_secs, so it may return stale statistics or nullptr.
+   */
+  std::shared_ptr<const cpp2::StatsItem> getStatsFromCache(GraphSpaceID spaceId);
+
   folly::Future<StatusOr<nebula::cpp2::ErrorCode>> reportTaskFinish(
       GraphSpaceID spaceId,
       int32_t jobId,
@@ -653,6 +672,10 @@ class MetaClient : public BaseMetaClient {
     return options_.localHost_.toString();
   }
 
+  const HostAddr& getLocalHost() const {
+    return options_.localHost_;
+  }
+
  protected:
   // Return true if load succeeded.
   bool loadData();
@@ -663,21 +686,34 @@ class MetaClient : public BaseMetaClient {
   void updateGflagsValue(const cpp2::ConfigItem& item);
   void updateNestedGflags(const std::unordered_map<std::string, Value>& nameValues);
 
-  bool loadSchemas(GraphSpaceID spaceId,
-                   std::shared_ptr<SpaceInfoCache> spaceInfoCache,
-                   SpaceTagNameIdMap& tagNameIdMap,
-                   SpaceTagIdNameMap& tagIdNameMap,
-                   SpaceEdgeNameTypeMap& edgeNameTypeMap,
-                   SpaceEdgeTypeNameMap& edgeTypeNamemap,
-                   SpaceNewestTagVerMap& newestTagVerMap,
-                   SpaceNewestEdgeVerMap& newestEdgeVerMap,
-                   SpaceAllEdgeMap& allEdgemap);
+  /**
+   * @brief Send the requests to load a space into cache, the futures are appended into futures
+   *
+   * @param spaceId
+   * @param spaceName
+   * @param cache Filled when the futures finished
+   * @param partsOnly Only load the parts allocation and terms, used when the space is not changed
+   * @param futures
+   */
+  void loadSpace(GraphSpaceID spaceId,
+                 const std::string& spaceName,
+                 std::shared_ptr<SpaceInfoCache> cache,
+                 bool partsOnly,
+                 std::vector<folly::Future<Status>>& futures);
+
+  void buildSchemaNameMaps(GraphSpaceID spaceId,
+                           std::shared_ptr<SpaceInfoCache> spaceInfoCache,
+                           SpaceTagNameIdMap& tagNameIdMap,
+                           SpaceTagIdNameMap& tagIdNameMap,
+                           SpaceEdgeNameTypeMap& edgeNameTypeMap,
+                           SpaceEdgeTypeNameMap& edgeTypeNamemap,
+                           SpaceNewestTagVerMap& newestTagVerMap,
+                           SpaceNewestEdgeVerMap& newestEdgeVerMap,
+                           SpaceAllEdgeMap& allEdgemap);
 
   bool loadUsersAndRoles();
 
-  bool loadIndexes(GraphSpaceID spaceId, std::shared_ptr<SpaceInfoCache> cache);
-
-  bool loadListeners(GraphSpaceID spaceId, std::shared_ptr<SpaceInfoCache> cache);
+  void buildIndexNameMaps(GraphSpaceID spaceId, std::shared_ptr<SpaceInfoCache> cache);
 
   bool loadGlobalServiceClients();
 
@@ -760,15 +796,31 @@ class MetaClient : public BaseMetaClient {
   std::atomic<int64_t> localDataLastUpdateTime_{-1};
   std::atomic<int64_t> localCfgLastUpdateTime_{-1};
   std::atomic<int64_t> metadLastUpdateTime_{0};
+  // Last update time of each space reported by metad, protected by spaceUpdateTimeLock_
+  std::unordered_map<GraphSpaceID, int64_t> metadSpaceUpdateTime_;
+  folly::SharedMutex spaceUpdateTimeLock_;
+  // Last update time of each space in localCache_, only accessed in loadData
+  std::unordered_map<GraphSpaceID, int64_t> localSpaceUpdateTime_;
 
   int64_t metaServerVersion_{-1};
   static constexpr int64_t EXPECT_META_VERSION = 3;
 
-  // leadersLock_ is used to protect leadersInfo
-  folly::SharedMutex leadersLock_;
-  LeaderInfo leadersInfo_;
+  // Leaders are read by every storage request and updated by part, the concurrent maps are read
+  // without lock and their entries are reclaimed by hazard pointers
+  folly::ConcurrentHashMap<std::pair<GraphSpaceID, PartitionID>, HostAddr> leaderMap_;
+  // index of picked host in all peers
+  folly::ConcurrentHashMap<std::pair<GraphSpaceID, PartitionID>, size_t> pickedIndex_;
 
   LocalCache localCache_;
+
+  struct StatsCacheEntry {
+    std::shared_ptr<const cpp2::StatsItem> stats;
+    int64_t updateTimeInSec{0};
+    bool refreshing{false};
+  };
+  std::unordered_map<GraphSpaceID, StatsCacheEntry> statsCache_;
+  std::mutex statsCacheLock_;
+
   std::vector<HostAddr> addrs_;
   // The lock used to protect active_ and leader_.
   folly::SharedMutex hostLock_;
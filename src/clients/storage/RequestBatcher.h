@@ -0,0 +1,164 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef CLIENTS_STORAGE_REQUESTBATCHER_H_
+#define CLIENTS_STORAGE_REQUESTBATCHER_H_
+
+#include <folly/futures/Future.h>
+#include <folly/io/async/EventBase.h>
+#include <folly/io/async/EventBaseManager.h>
+
+#include <map>
+#include <optional>
+
+#include "common/base/Base.h"
+#include "common/datatypes/HostAddr.h"
+
+DECLARE_int32(storage_client_batch_window_us);
+DECLARE_int32(storage_client_batch_max_requests);
+
+namespace nebula {
+namespace storage {
+
+/**
+ * @brief Merge the concurrent requests to the same host into one RPC. The first request to a host
+ * opens a batch, which is sent after storage_client_batch_window_us or once it has
+ * storage_client_batch_max_requests requests, and the response is split for each request.
+ *
+ * A batch is sent by the client and in the event base of its first request, since thrift clients
+ * can only be used in their own threads.
+ */
+template <class ClientType, class Request, class Response>
+class RequestBatcher final {
+ public:
+  using SendFunc = std::function<folly::Future<Response>(ClientType*, const Request&)>;
+  // Return the key of the request, requests with the same key could be merged. Return none if the
+  // request could not be merged.
+  using KeyFunc = std::function<std::optional<std::string>(const Request&)>;
+  using MergeFunc = std::function<Request(const std::vector<const Request*>&)>;
+  // Split the response of the merged request for each request, in the same order
+  using SplitFunc =
+      std::function<std::vector<Response>(Response&&, const std::vector<const Request*>&)>;
+
+  RequestBatcher(KeyFunc keyFunc, MergeFunc mergeFunc, SplitFunc splitFunc)
+      : keyFunc_(std::move(keyFunc)),
+        mergeFunc_(std::move(mergeFunc)),
+        splitFunc_(std::move(splitFunc)) {}
+
+  std::optional<std::string> key(const Request& req) const {
+    if (FLAGS_storage_client_batch_window_us <= 0) {
+      return std::nullopt;
+    }
+    return keyFunc_(req);
+  }
+
+  /**
+   * @brief Add a request into the batch of host, must be called in the event base of client
+   *
+   * @param host
+   * @param key Return value of key()
+   * @param client
+   * @param req
+   * @param send Send the merged request
+   * @return folly::Future<Response> The response of req
+   */
+  folly::Future<Response> add(const HostAddr& host,
+                              std::string key,
+                              ClientType* client,
+                              const Request& req,
+                              SendFunc send) {
+    auto batchKey = std::make_pair(host, std::move(key));
+    std::shared_ptr<Batch> full;
+    folly::Future<Response> future = folly::Future<Response>::makeEmpty();
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      auto& batch = batches_[batchKey];
+      if (batch == nullptr) {
+        batch = std::make_shared<Batch>();
+        batch->evb = folly::EventBaseManager::get()->getExistingEventBase();
+        DCHECK(batch->evb != nullptr);
+        batch->client = client;
+        batch->send = std::move(send);
+        folly::via(batch->evb)
+            .delayed(std::chrono::microseconds(FLAGS_storage_client_batch_window_us))
+            .thenValue([this, batchKey, b = batch](auto&&) { flush(batchKey, b); });
+      }
+      batch->requests.emplace_back(req);
+      batch->promises.emplace_back();
+      future = batch->promises.back().getFuture();
+      if (batch->requests.size() >= static_cast<size_t>(FLAGS_storage_client_batch_max_requests)) {
+        full = batch;
+        batches_.erase(batchKey);
+      }
+    }
+    if (full != nullptr) {
+      full->evb->runInEventBaseThread([this, batchKey, full]() { flush(batchKey, full); });
+    }
+    return future;
+  }
+
+ private:
+  struct Batch {
+    folly::EventBase* evb{nullptr};
+    ClientType* client{nullptr};
+    SendFunc send;
+    std::vector<Request> requests;
+    std::vector<folly::Promise<Response>> promises;
+    bool flushed{false};
+  };
+
+  void flush(const std::pair<HostAddr, std::string>& batchKey, std::shared_ptr<Batch> batch) {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      if (batch->flushed) {
+        return;
+      }
+      batch->flushed = true;
+      auto iter = batches_.find(batchKey);
+      if (iter != batches_.end() && iter->second == batch) {
+        batches_.erase(iter);
+      }
+    }
+
+    std::vector<const Request*> reqs;
+    reqs.reserve(batch->requests.size());
+    for (const auto& req : batch->requests) {
+      reqs.emplace_back(&req);
+    }
+    VLOG(3) << "Send " << reqs.size() << " requests in one batch to " << batchKey.first;
+    auto merged = reqs.size() == 1 ? batch->requests.front() : mergeFunc_(reqs);
+    batch->send(batch->client, merged)
+        .thenTry([this, batch, reqs = std::move(reqs)](folly::Try<Response>&& resp) {
+          if (resp.hasException()) {
+            for (auto& promise : batch->promises) {
+              promise.setException(resp.exception());
+            }
+            return;
+          }
+          if (reqs.size() == 1) {
+            batch->promises.front().setValue(std::move(resp).value());
+            return;
+          }
+          auto resps = splitFunc_(std::move(resp).value(), reqs);
+          DCHECK_EQ(resps.size(), batch->promises.size());
+          for (size_t i = 0; i < resps.size(); i++) {
+            batch->promises[i].setValue(std::move(resps[i]));
+          }
+        });
+  }
+
+  KeyFunc keyFunc_;
+  MergeFunc mergeFunc_;
+  SplitFunc splitFunc_;
+
+  std::mutex lock_;
+  // Batches which are not sent yet
+  std::map<std::pair<HostAddr, std::string>, std::shared_ptr<Batch>> batches_;
+};
+
+}  // namespace storage
+}  // namespace nebula
+
+#endif  // CLIENTS_STORAGE_REQUESTBATCHER_H_
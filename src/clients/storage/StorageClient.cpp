@@ -58,7 +58,7 @@ StorageRpcRespFuture<cpp2::GetNeighborsResponse> StorageClient::getNeighbors(
     return folly::makeFuture<StorageRpcResponse<cpp2::GetNeighborsResponse>>(
         std::runtime_error(cbStatus.status().toString()));
   }
-  auto status = clusterIdsToHosts(param.space, vids, std::move(cbStatus).value());
+  auto status = clusterIdsToHosts(param.space, vids, std::move(cbStatus).value(), true);
   if (!status.ok()) {
     return folly::makeFuture<StorageRpcResponse<cpp2::GetNeighborsResponse>>(
         std::runtime_error(status.status().toString()));
@@ -108,7 +108,8 @@ StorageRpcRespFuture<cpp2::GetNeighborsResponse> StorageClient::getNeighbors(
                          std::move(requests),
                          [](ThriftClientType* client, const cpp2::GetNeighborsRequest& r) {
                            return client->future_getNeighbors(r);
-                         });
+                         },
+                         true);
 }
 
 StorageRpcRespFuture<cpp2::GetDstBySrcResponse> StorageClient::getDstBySrc(
@@ -121,7 +122,7 @@ StorageRpcRespFuture<cpp2::GetDstBySrcResponse> StorageClient::getDstBySrc(
         std::runtime_error(cbStatus.status().toString()));
   }
 
-  auto status = clusterIdsToHosts(param.space, vertices, std::move(cbStatus).value());
+  auto status = clusterIdsToHosts(param.space, vertices, std::move(cbStatus).value(), true);
   if (!status.ok()) {
     return folly::makeFuture<StorageRpcResponse<cpp2::GetDstBySrcResponse>>(
         std::runtime_error(status.status().toString()));
@@ -143,7 +144,8 @@ StorageRpcRespFuture<cpp2::GetDstBySrcResponse> StorageClient::getDstBySrc(
                          std::move(requests),
                          [](ThriftClientType* client, const cpp2::GetDstBySrcRequest& r) {
                            return client->future_getDstBySrc(r);
-                         });
+                         },
+                         true);
 }
 
 StorageRpcRespFuture<cpp2::ExecResponse> StorageClient::addVertices(
@@ -240,7 +242,7 @@ StorageRpcRespFuture<cpp2::GetPropResponse> StorageClient::getProps(
         std::runtime_error(cbStatus.status().toString()));
   }
 
-  auto status = clusterIdsToHosts(param.space, input.rows, std::move(cbStatus).value());
+  auto status = clusterIdsToHosts(param.space, input.rows, std::move(cbStatus).value(), true);
   if (!status.ok()) {
     return folly::makeFuture<StorageRpcResponse<cpp2::GetPropResponse>>(
         std::runtime_error(status.status().toString()));
@@ -275,9 +277,13 @@ StorageRpcRespFuture<cpp2::GetPropResponse> StorageClient::getProps(
   }
 
   return collectResponse(
-      param.evb, std::move(requests), [](ThriftClientType* client, const cpp2::GetPropRequest& r) {
+      param.evb,
+      std::move(requests),
+      [](ThriftClientType* client, const cpp2::GetPropRequest& r) {
         return client->future_getProps(r);
-      });
+      },
+      true,
+      &getPropsBatcher_);
 }
 
 StorageRpcRespFuture<cpp2::ExecResponse> StorageClient::deleteEdges(
@@ -652,7 +658,10 @@ StorageRpcRespFuture<cpp2::ScanResponse> StorageClient::scanVertex(
 folly::SemiFuture<StorageRpcResponse<cpp2::KVGetResponse>> StorageClient::get(
     GraphSpaceID space, std::vector<std::string>&& keys, bool returnPartly, folly::EventBase* evb) {
   auto status = clusterIdsToHosts(
-      space, std::move(keys), [](const std::string& v) -> const std::string& { return v; });
+      space,
+      std::move(keys),
+      [](const std::string& v) -> const std::string& { return v; },
+      true);
 
   if (!status.ok()) {
     return folly::makeFuture<StorageRpcResponse<cpp2::KVGetResponse>>(
@@ -670,9 +679,10 @@ folly::SemiFuture<StorageRpcResponse<cpp2::KVGetResponse>> StorageClient::get(
   }
 
   return collectResponse(
-      evb, std::move(requests), [](ThriftClientType* client, const cpp2::KVGetRequest& r) {
-        return client->future_get(r);
-      });
+      evb,
+      std::move(requests),
+      [](ThriftClientType* client, const cpp2::KVGetRequest& r) { return client->future_get(r); },
+      true);
 }
 
 folly::SemiFuture<StorageRpcResponse<cpp2::ExecResponse>> StorageClient::put(
@@ -725,6 +735,107 @@ folly::SemiFuture<StorageRpcResponse<cpp2::ExecResponse>> StorageClient::remove(
       });
 }
 
+std::optional<std::string> StorageClient::getPropsBatchKey(const cpp2::GetPropRequest& req) {
+  if (!req.vertex_props_ref().has_value() || req.edge_props_ref().has_value() ||
+      (req.expressions_ref().has_value() && !req.expressions_ref()->empty()) || req.get_dedup() ||
+      (req.order_by_ref().has_value() && !req.order_by_ref()->empty()) ||
+      req.limit_ref().value_or(std::numeric_limits<int64_t>::max()) !=
+          std::numeric_limits<int64_t>::max() ||
+      req.filter_ref().has_value()) {
+    return std::nullopt;
+  }
+  if (req.common_ref().has_value() && req.common_ref()->profile_detail_ref().value_or(false)) {
+    return std::nullopt;
+  }
+  // The requests of different queries are merged, each one is checked whether killed when split
+  std::string key = folly::to<std::string>(req.get_space_id());
+  for (const auto& vertexProp : *req.vertex_props_ref()) {
+    folly::toAppend("|", vertexProp.get_tag(), &key);
+    for (const auto& prop : vertexProp.get_props()) {
+      folly::toAppend(",", prop, &key);
+    }
+  }
+  return key;
+}
+
+cpp2::GetPropRequest StorageClient::mergeGetProps(
+    const std::vector<const cpp2::GetPropRequest*>& reqs) {
+  const auto& first = *reqs.front();
+  cpp2::GetPropRequest merged;
+  merged.space_id_ref() = first.get_space_id();
+  merged.vertex_props_ref() = *first.vertex_props_ref();
+  auto& parts = *merged.parts_ref();
+  std::unordered_map<PartitionID, std::unordered_set<Value>> fetched;
+  for (const auto* req : reqs) {
+    for (const auto& [partId, rows] : req->get_parts()) {
+      auto& vids = fetched[partId];
+      for (const auto& row : rows) {
+        if (vids.emplace(row.values.front()).second) {
+          parts[partId].emplace_back(row);
+        }
+      }
+    }
+  }
+  return merged;
+}
+
+std::vector<cpp2::GetPropResponse> StorageClient::splitGetProps(
+    cpp2::GetPropResponse&& merged,
+    const std::vector<const cpp2::GetPropRequest*>& reqs,
+    const std::function<bool(SessionID, ExecutionPlanID)>& isKilled) {
+  DataSet emptyProps;
+  const auto& props = merged.props_ref().has_value() ? *merged.props_ref() : emptyProps;
+  std::unordered_map<Value, const Row*> rowOfVid;
+  rowOfVid.reserve(props.rows.size());
+  for (const auto& row : props.rows) {
+    rowOfVid.emplace(row.values.front(), &row);
+  }
+
+  const auto& result = merged.get_result();
+  std::vector<cpp2::GetPropResponse> resps;
+  resps.reserve(reqs.size());
+  for (const auto* req : reqs) {
+    const auto& reqParts = req->get_parts();
+    cpp2::ResponseCommon common;
+    common.latency_in_us_ref() = result.get_latency_in_us();
+    if (req->common_ref().has_value() &&
+        isKilled(req->common_ref()->session_id_ref().value_or(0),
+                 req->common_ref()->plan_id_ref().value_or(0))) {
+      for (const auto& part : reqParts) {
+        cpp2::PartitionResult killed;
+        killed.code_ref() = nebula::cpp2::ErrorCode::E_PLAN_IS_KILLED;
+        killed.part_id_ref() = part.first;
+        common.failed_parts_ref()->emplace_back(std::move(killed));
+      }
+      cpp2::GetPropResponse resp;
+      resp.result_ref() = std::move(common);
+      resps.emplace_back(std::move(resp));
+      continue;
+    }
+    for (const auto& failedPart : result.get_failed_parts()) {
+      if (reqParts.count(failedPart.get_part_id()) != 0) {
+        common.failed_parts_ref()->emplace_back(failedPart);
+      }
+    }
+
+    DataSet ds(props.colNames);
+    for (const auto& part : reqParts) {
+      for (const auto& row : part.second) {
+        auto found = rowOfVid.find(row.values.front());
+        if (found != rowOfVid.end()) {
+          ds.rows.emplace_back(*found->second);
+        }
+      }
+    }
+
+    cpp2::GetPropResponse resp;
+    resp.result_ref() = std::move(common);
+    resp.props_ref() = std::move(ds);
+    resps.emplace_back(std::move(resp));
+  }
+  return resps;
+}
+
 StatusOr<std::function<const VertexID&(const Row&)>> StorageClient::getIdFromRow(
     GraphSpaceID space, bool isEdgeProps) const {
   auto vidTypeStatus = metaClient_->getSpaceVidType(space);
@@ -37,6 +37,9 @@ using ThriftClientManType = thrift::LocalClientManager<T>;
 class StorageClient
     : public StorageClientBase<ThriftClientType, ThriftClientManType<ThriftClientType>> {
   FRIEND_TEST(StorageClientTest, LeaderChangeTest);
+  FRIEND_TEST(StorageClientBatchTest, BatchKeyTest);
+  FRIEND_TEST(StorageClientBatchTest, MergeTest);
+  FRIEND_TEST(StorageClientBatchTest, SplitTest);
 
  public:
   struct CommonRequestParam {
@@ -60,7 +63,17 @@ class StorageClient
   StorageClient(std::shared_ptr<folly::IOThreadPoolExecutor> ioThreadPool,
                 meta::MetaClient* metaClient)
       : StorageClientBase<ThriftClientType, ThriftClientManType<ThriftClientType>>(ioThreadPool,
-                                                                                   metaClient) {}
+                                                                                   metaClient),
+        getPropsBatcher_(
+            &getPropsBatchKey,
+            &mergeGetProps,
+            [metaClient](cpp2::GetPropResponse&& merged,
+                         const std::vector<const cpp2::GetPropRequest*>& reqs) {
+              auto isKilled = [metaClient](SessionID session, ExecutionPlanID plan) {
+                return metaClient->isPlanKilled(session, plan);
+              };
+              return splitGetProps(std::move(merged), reqs, isKilled);
+            }) {}
   virtual ~StorageClient() {}
 
   StorageRpcRespFuture<cpp2::GetNeighborsResponse> getNeighbors(
@@ -193,6 +206,24 @@ class StorageClient
 
   StatusOr<std::function<const VertexID&(const cpp2::DelTags&)>> getIdFromDelTags(
       GraphSpaceID space) const;
+
+  // Only the requests fetching vertex properties without filter, limit or expressions could be
+  // merged, since the first column of the response is the vid and each vertex has one row. The
+  // requests of different queries are merged too.
+  static std::optional<std::string> getPropsBatchKey(const cpp2::GetPropRequest& req);
+
+  // Merge the vertices of requests, the same vertex of different requests is fetched only once.
+  // The merged request belongs to no query, so it's not killed by storage.
+  static cpp2::GetPropRequest mergeGetProps(const std::vector<const cpp2::GetPropRequest*>& reqs);
+
+  // Split the response for each request, the request of a query killed meanwhile fails in all of
+  // its parts with E_PLAN_IS_KILLED
+  static std::vector<cpp2::GetPropResponse> splitGetProps(
+      cpp2::GetPropResponse&& merged,
+      const std::vector<const cpp2::GetPropRequest*>& reqs,
+      const std::function<bool(SessionID, ExecutionPlanID)>& isKilled);
+
+  RequestBatcher<ThriftClientType, cpp2::GetPropRequest, cpp2::GetPropResponse> getPropsBatcher_;
 };
 
 }  // namespace storage
@@ -7,6 +7,7 @@
 #define CLIENTS_STORAGE_STORAGECLIENTBASE_INL_H
 
 #include <folly/ExceptionWrapper.h>
+#include <folly/Random.h>
 #include <folly/Try.h>
 #include <folly/futures/Future.h>
 
@@ -47,6 +48,39 @@ StatusOr<HostAddr> StorageClientBase<ClientType, ClientManagerType>::getLeader(
   return metaClient_->getStorageLeaderFromCache(spaceId, partId);
 }
 
+template <typename ClientType, typename ClientManagerType>
+StatusOr<HostAddr> StorageClientBase<ClientType, ClientManagerType>::getReadHost(
+    GraphSpaceID spaceId, PartitionID partId) const {
+  if (FLAGS_storage_client_read_policy == "leader") {
+    return getLeader(spaceId, partId);
+  }
+  auto partHosts = getPartHosts(spaceId, partId);
+  if (!partHosts.ok() || partHosts.value().hosts_.empty()) {
+    return getLeader(spaceId, partId);
+  }
+  const auto& hosts = partHosts.value().hosts_;
+  if (FLAGS_storage_client_read_policy == "nearest") {
+    const auto& localHost = metaClient_->getLocalHost();
+    for (const auto& host : hosts) {
+      if (host.host == localHost.host) {
+        return host;
+      }
+    }
+    return getLeader(spaceId, partId);
+  }
+  if (FLAGS_storage_client_read_policy == "random") {
+    return hosts[folly::Random::rand32(hosts.size())];
+  }
+  if (FLAGS_storage_client_read_policy == "least_loaded") {
+    const auto& stats = HostLoadStats::instance();
+    return *std::min_element(hosts.begin(), hosts.end(), [&stats](const auto& h1, const auto& h2) {
+      return stats.score(h1) < stats.score(h2);
+    });
+  }
+  LOG(WARNING) << "Unknown storage_client_read_policy " << FLAGS_storage_client_read_policy;
+  return getLeader(spaceId, partId);
+}
+
 template <typename ClientType, typename ClientManagerType>
 void StorageClientBase<ClientType, ClientManagerType>::updateLeader(GraphSpaceID spaceId,
                                                                     PartitionID partId,
@@ -74,7 +108,9 @@ folly::SemiFuture<StorageRpcResponse<Response>>
 StorageClientBase<ClientType, ClientManagerType>::collectResponse(
     folly::EventBase* evb,
     std::unordered_map<HostAddr, Request> requests,
-    RemoteFunc&& remoteFunc) {
+    RemoteFunc&& remoteFunc,
+    bool readOnly,
+    RequestBatcher<ClientType, Request, Response>* batcher) {
   std::vector<folly::Future<StatusOr<Response>>> respFutures;
   respFutures.reserve(requests.size());
 
@@ -89,10 +125,22 @@ StorageClientBase<ClientType, ClientManagerType>::collectResponse(
     // Future process code will be executed on the IO thread
     // Since all requests are sent using the same eventbase, all
     // then-callback will be executed on the same IO thread
-    auto fut = getResponse(evb, req.first, req.second, std::move(remoteFunc))
-                   .ensure([totalLatencies, i, start]() {
-                     (*totalLatencies)[i] = time::WallClock::fastNowInMicroSec() - start;
-                   });
+    auto batchKey = batcher != nullptr ? batcher->key(req.second) : std::nullopt;
+    auto resp = folly::Future<StatusOr<Response>>::makeEmpty();
+    if (batchKey.has_value()) {
+      auto send = [batcher, host = req.first, key = std::move(batchKey).value(), remoteFunc](
+                      ClientType* client, const Request& r) {
+        return batcher->add(host, key, client, r, remoteFunc);
+      };
+      resp = getResponse(evb, req.first, req.second, std::move(send));
+    } else if (readOnly) {
+      resp = getHedgedResponse(evb, req.first, req.second, remoteFunc);
+    } else {
+      resp = getResponse(evb, req.first, req.second, std::move(remoteFunc));
+    }
+    auto fut = std::move(resp).ensure([totalLatencies, i, start]() {
+      (*totalLatencies)[i] = time::WallClock::fastNowInMicroSec() - start;
+    });
 
     respFutures.emplace_back(std::move(fut));
   }
@@ -156,6 +204,8 @@ folly::Future<StatusOr<Response>> StorageClientBase<ClientType, ClientManagerTyp
   }
 
   auto spaceId = request.get_space_id();
+  auto start = time::WallClock::fastNowInMicroSec();
+  HostLoadStats::instance().onSend(host);
   return folly::via(evb)
       .thenValue([remoteFunc = std::move(remoteFunc), request, evb, host, this](auto&&) {
         // NOTE: Create new channel on each thread to avoid TIMEOUT RPC error
@@ -206,6 +256,125 @@ folly::Future<StatusOr<Response>> StorageClientBase<ClientType, ClientManagerTyp
           LOG(ERROR) << "Request to " << host << " failed: " << ex->what();
         }
         return Status::Error("RPC failure in StorageClient: %s", ex->what());
+      })
+      .ensure([host, start]() {
+        HostLoadStats::instance().onReceive(host, time::WallClock::fastNowInMicroSec() - start);
+      });
+}
+
+template <typename ClientType, typename ClientManagerType>
+template <class Request, class RemoteFunc, class Response>
+folly::Future<StatusOr<Response>>
+StorageClientBase<ClientType, ClientManagerType>::getHedgedResponse(folly::EventBase* evb,
+                                                                    const HostAddr& host,
+                                                                    const Request& request,
+                                                                    RemoteFunc remoteFunc) {
+  if (!FLAGS_storage_client_hedge_reads || FLAGS_storage_client_read_policy == "leader") {
+    return getResponse(evb, host, request, std::move(remoteFunc));
+  }
+  auto backup = getHedgeHost(request.get_space_id(), getReqPartsId(request), host);
+  if (!backup.ok()) {
+    VLOG(3) << "Not hedge the request to " << host << ": " << backup.status();
+    return getResponse(evb, host, request, std::move(remoteFunc));
+  }
+  if (evb == nullptr) {
+    evb = DCHECK_NOTNULL(ioThreadPool_)->getEventBase();
+  }
+
+  // All the callbacks below run in evb, so the state is not accessed concurrently
+  struct HedgeState {
+    folly::Promise<StatusOr<Response>> promise;
+    // the response with the least failed parts so far
+    folly::Optional<folly::Try<StatusOr<Response>>> best;
+    size_t pending{1};
+    bool done{false};
+  };
+  auto state = std::make_shared<HedgeState>();
+  // A failed rpc counts as failing in more parts than any response
+  auto numFailedParts = [](const folly::Try<StatusOr<Response>>& resp) {
+    if (!resp.hasValue() || !resp.value().ok()) {
+      return std::numeric_limits<size_t>::max();
+    }
+    return resp.value().value().get_result().get_failed_parts().size();
+  };
+  auto onResponse = [state, numFailedParts](folly::Try<StatusOr<Response>>&& resp) {
+    state->pending--;
+    if (state->done) {
+      return;
+    }
+    auto failed = numFailedParts(resp);
+    if (failed == 0) {
+      state->done = true;
+      state->promise.setTry(std::move(resp));
+      return;
+    }
+    if (!state->best.has_value() || failed < numFailedParts(*state->best)) {
+      state->best = std::move(resp);
+    }
+    // The partial result or failure is returned only when no other attempt is in flight
+    if (state->pending == 0) {
+      state->done = true;
+      state->promise.setTry(std::move(*state->best));
+    }
+  };
+  auto future = state->promise.getFuture();
+  getResponse(evb, host, request, RemoteFunc(remoteFunc)).thenTry(onResponse);
+
+  auto delayUs = std::max(static_cast<int64_t>(FLAGS_storage_client_hedge_min_delay_ms) * 1000,
+                          HostLoadStats::instance().p95LatencyUs(host));
+  folly::via(evb)
+      .delayed(std::chrono::microseconds(delayUs))
+      .thenValue([this,
+                  evb,
+                  state,
+                  onResponse,
+                  request,
+                  backupHost = std::move(backup).value(),
+                  remoteFunc = std::move(remoteFunc)](auto&&) mutable {
+        if (state->done) {
+          return;
+        }
+        VLOG(2) << "Hedge the request to " << backupHost;
+        stats::StatsManager::addValue(kNumHedgedRpcSentToStoraged);
+        state->pending++;
+        getResponse(evb, backupHost, request, std::move(remoteFunc)).thenTry(onResponse);
+      });
+  return future;
+}
+
+template <typename ClientType, typename ClientManagerType>
+StatusOr<HostAddr> StorageClientBase<ClientType, ClientManagerType>::getHedgeHost(
+    GraphSpaceID spaceId, const std::vector<PartitionID>& parts, const HostAddr& primary) const {
+  std::vector<HostAddr> candidates;
+  for (size_t i = 0; i < parts.size(); i++) {
+    auto partHosts = getPartHosts(spaceId, parts[i]);
+    if (!partHosts.ok()) {
+      return partHosts.status();
+    }
+    const auto& hosts = partHosts.value().hosts_;
+    if (i == 0) {
+      std::copy_if(hosts.begin(),
+                   hosts.end(),
+                   std::back_inserter(candidates),
+                   [&primary](const auto& h) { return h != primary; });
+    } else {
+      auto notHolding = [&hosts](const auto& h) {
+        return std::find(hosts.begin(), hosts.end(), h) == hosts.end();
+      };
+      candidates.erase(std::remove_if(candidates.begin(), candidates.end(), notHolding),
+                       candidates.end());
+    }
+    if (candidates.empty()) {
+      break;
+    }
+  }
+  if (candidates.empty()) {
+    return Status::Error("No other replica holds all the parts");
+  }
+  const auto& stats = HostLoadStats::instance();
+  return *std::min_element(
+      candidates.begin(), candidates.end(), [&stats](const auto& h1, const auto& h2) {
+        return stats.score(h1) < stats.score(h2);
       });
 }
 
@@ -216,7 +385,8 @@ StatusOr<std::unordered_map<
     std::unordered_map<PartitionID, std::vector<typename Container::value_type>>>>
 StorageClientBase<ClientType, ClientManagerType>::clusterIdsToHosts(GraphSpaceID spaceId,
                                                                     const Container& ids,
-                                                                    GetIdFunc f) const {
+                                                                    GetIdFunc f,
+                                                                    bool readOnly) const {
   std::unordered_map<HostAddr,
                      std::unordered_map<PartitionID, std::vector<typename Container::value_type>>>
       clusters;
@@ -228,7 +398,7 @@ StorageClientBase<ClientType, ClientManagerType>::clusterIdsToHosts(GraphSpaceID
   auto numParts = status.value();
   std::unordered_map<PartitionID, HostAddr> leaders;
   for (int32_t partId = 1; partId <= numParts; ++partId) {
-    auto leader = getLeader(spaceId, partId);
+    auto leader = readOnly ? getReadHost(spaceId, partId) : getLeader(spaceId, partId);
     if (!leader.ok()) {
       return leader.status();
     }
@@ -9,7 +9,83 @@ DEFINE_int32(storage_client_timeout_ms, 60 * 1000, "storage client timeout");
 DEFINE_uint32(storage_client_retry_interval_ms,
               1000,
               "storage client sleep interval milliseconds between retry");
+DEFINE_string(storage_client_read_policy,
+              "leader",
+              "Which replica serves reads: leader, nearest (the replica on the same host, "
+              "otherwise the leader), random (any replica) or least_loaded (the replica with "
+              "the least latency and in-flight requests). Storage must turn on "
+              "enable_follower_read for the policies except leader");
+DEFINE_bool(storage_client_hedge_reads,
+            false,
+            "Whether to send a read to another replica as well if the first one does not respond "
+            "within its p95 latency, only works when storage_client_read_policy is not leader");
+DEFINE_int32(storage_client_hedge_min_delay_ms,
+             10,
+             "The minimal delay before a read is hedged to another replica");
+DEFINE_int32(storage_client_batch_window_us,
+             0,
+             "Window to merge the concurrent batchable requests to the same storaged into one "
+             "RPC, 0 means disable. The timer resolution of io threads is about 1ms");
+DEFINE_int32(storage_client_batch_max_requests,
+             64,
+             "A batch of requests is sent immediately once it has so many requests");
 
 namespace nebula {
-namespace storage {}  // namespace storage
+namespace storage {
+
+HostLoadStats& HostLoadStats::instance() {
+  static HostLoadStats stats;
+  return stats;
+}
+
+std::shared_ptr<HostLoadStats::Stat> HostLoadStats::stat(const HostAddr& host) {
+  auto iter = stats_.find(host);
+  if (iter != stats_.cend()) {
+    return iter->second;
+  }
+  return stats_.try_emplace(host, std::make_shared<Stat>()).first->second;
+}
+
+void HostLoadStats::onSend(const HostAddr& host) {
+  stat(host)->inflight.fetch_add(1, std::memory_order_relaxed);
+}
+
+void HostLoadStats::onReceive(const HostAddr& host, int64_t latencyUs) {
+  auto s = stat(host);
+  s->inflight.fetch_sub(1, std::memory_order_relaxed);
+  // Concurrent updates may overwrite each other, which is fine for an estimation
+  auto ewma = s->ewmaUs.load(std::memory_order_relaxed);
+  auto dev = s->ewmaDevUs.load(std::memory_order_relaxed);
+  if (ewma == 0) {
+    ewma = latencyUs;
+    dev = latencyUs / 2;
+  } else {
+    dev += (std::abs(latencyUs - ewma) - dev) / 4;
+    ewma += (latencyUs - ewma) / 8;
+  }
+  s->ewmaUs.store(ewma, std::memory_order_relaxed);
+  s->ewmaDevUs.store(dev, std::memory_order_relaxed);
+}
+
+int64_t HostLoadStats::score(const HostAddr& host) const {
+  auto iter = stats_.find(host);
+  if (iter == stats_.cend()) {
+    return 0;
+  }
+  const auto& s = iter->second;
+  return s->ewmaUs.load(std::memory_order_relaxed) *
+         (s->inflight.load(std::memory_order_relaxed) + 1);
+}
+
+int64_t HostLoadStats::p95LatencyUs(const HostAddr& host) const {
+  auto iter = stats_.find(host);
+  if (iter == stats_.cend()) {
+    return 0;
+  }
+  const auto& s = iter->second;
+  return s->ewmaUs.load(std::memory_order_relaxed) +
+         2 * s->ewmaDevUs.load(std::memory_order_relaxed);
+}
+
+}  // namespace storage
 }  // namespace nebula
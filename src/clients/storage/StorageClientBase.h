@@ -6,10 +6,12 @@
 #ifndef CLIENTS_STORAGE_STORAGECLIENTBASE_H_
 #define CLIENTS_STORAGE_STORAGECLIENTBASE_H_
 
+#include <folly/concurrency/ConcurrentHashMap.h>
 #include <folly/executors/IOThreadPoolExecutor.h>
 #include <folly/futures/Future.h>
 
 #include "clients/meta/MetaClient.h"
+#include "clients/storage/RequestBatcher.h"
 #include "common/base/Base.h"
 #include "common/base/StatusOr.h"
 #include "common/datatypes/HostAddr.h"
@@ -19,6 +21,9 @@
 
 DECLARE_int32(storage_client_timeout_ms);
 DECLARE_uint32(storage_client_retry_interval_ms);
+DECLARE_string(storage_client_read_policy);
+DECLARE_bool(storage_client_hedge_reads);
+DECLARE_int32(storage_client_hedge_min_delay_ms);
 
 constexpr int32_t kInternalPortOffset = -2;
 
@@ -114,6 +119,50 @@ class StorageRpcResponse final {
   std::vector<std::tuple<HostAddr, int32_t, int32_t>> hostLatency_;
 };
 
+/**
+ * @brief Latency and in-flight requests of each storaged, shared by all storage clients in the
+ * process. The latency is an EWMA of the response time, and its p95 is estimated as the EWMA plus
+ * twice the EWMA of the deviation.
+ */
+class HostLoadStats final {
+ public:
+  static HostLoadStats& instance();
+
+  void onSend(const HostAddr& host);
+
+  /**
+   * @brief Called when the response is received or the request failed
+   *
+   * @param host
+   * @param latencyUs Time since the request was sent
+   */
+  void onReceive(const HostAddr& host, int64_t latencyUs);
+
+  /**
+   * @brief The expected time to serve a new request on host, the lower the better. A host
+   * without any response yet has score 0, so it will be tried.
+   */
+  int64_t score(const HostAddr& host) const;
+
+  /**
+   * @brief Estimated p95 latency of host, 0 if unknown
+   */
+  int64_t p95LatencyUs(const HostAddr& host) const;
+
+ private:
+  struct Stat {
+    std::atomic<int64_t> ewmaUs{0};
+    std::atomic<int64_t> ewmaDevUs{0};
+    std::atomic<int32_t> inflight{0};
+  };
+
+  HostLoadStats() = default;
+
+  std::shared_ptr<Stat> stat(const HostAddr& host);
+
+  folly::ConcurrentHashMap<HostAddr, std::shared_ptr<Stat>> stats_;
+};
+
 /**
  * A base class for all storage clients
  */
@@ -122,6 +171,10 @@ class StorageClientBase {
  public:
   StatusOr<HostAddr> getLeader(GraphSpaceID spaceId, PartitionID partId) const;
 
+  // Return the replica which serves reads of the part according to storage_client_read_policy,
+  // fall back to the leader if no other replica is eligible
+  StatusOr<HostAddr> getReadHost(GraphSpaceID spaceId, PartitionID partId) const;
+
  protected:
   StorageClientBase(std::shared_ptr<folly::IOThreadPoolExecutor> ioThreadPool,
                     meta::MetaClient* metaClient);
@@ -131,6 +184,9 @@ class StorageClientBase {
   void invalidLeader(GraphSpaceID spaceId, PartitionID partId);
   void invalidLeader(GraphSpaceID spaceId, std::vector<PartitionID>& partsId);
 
+  // If readOnly is true, a request may be hedged to another replica, see getHedgedResponse.
+  // If batcher is given, the requests it accepts are merged with the concurrent ones to the same
+  // host instead.
   template <class Request,
             class RemoteFunc,
             class Response =
@@ -138,7 +194,9 @@ class StorageClientBase {
   folly::SemiFuture<StorageRpcResponse<Response>> collectResponse(
       folly::EventBase* evb,
       std::unordered_map<HostAddr, Request> requests,
-      RemoteFunc&& remoteFunc);
+      RemoteFunc&& remoteFunc,
+      bool readOnly = false,
+      RequestBatcher<ClientType, Request, Response>* batcher = nullptr);
 
   template <class Request,
             class RemoteFunc,
@@ -149,15 +207,36 @@ class StorageClientBase {
                                                 const Request& request,
                                                 RemoteFunc&& remoteFunc);
 
+  // Send the read request to host, and send it to another replica holding all the parts as well
+  // if host does not respond within its p95 latency. The first response without failed parts is
+  // returned, otherwise the one with the least failed parts once all attempts finished.
+  template <class Request,
+            class RemoteFunc,
+            class Response = typename std::result_of<RemoteFunc(ClientType* client,
+                                                                const Request&)>::type::value_type>
+  folly::Future<StatusOr<Response>> getHedgedResponse(folly::EventBase* evb,
+                                                      const HostAddr& host,
+                                                      const Request& request,
+                                                      RemoteFunc remoteFunc);
+
+  // Return the least loaded replica other than primary which holds all the parts
+  StatusOr<HostAddr> getHedgeHost(GraphSpaceID spaceId,
+                                  const std::vector<PartitionID>& parts,
+                                  const HostAddr& primary) const;
+
   // Cluster given ids into the host they belong to
   // The method returns a map
   //  host_addr (A host, but in most case, the leader will be chosen)
   //      => (partition -> [ids that belong to the shard])
+  // If readOnly is true, the host is chosen by getReadHost, which may be a follower
   template <class Container, class GetIdFunc>
   StatusOr<std::unordered_map<
       HostAddr,
       std::unordered_map<PartitionID, std::vector<typename Container::value_type>>>>
-  clusterIdsToHosts(GraphSpaceID spaceId, const Container& ids, GetIdFunc f) const;
+  clusterIdsToHosts(GraphSpaceID spaceId,
+                    const Container& ids,
+                    GetIdFunc f,
+                    bool readOnly = false) const;
 
   StatusOr<std::unordered_map<HostAddr, std::unordered_map<PartitionID, cpp2::ScanCursor>>>
   getHostPartsWithCursor(GraphSpaceID spaceId) const;
@@ -12,6 +12,7 @@ namespace nebula {
 
 extern stats::CounterId kNumRpcSentToStoraged;
 extern stats::CounterId kNumRpcSentToStoragedFailed;
+extern stats::CounterId kNumHedgedRpcSentToStoraged;
 
 void initStorageClientStats();
 
@@ -0,0 +1,86 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_ALGORITHM_HYPERLOGLOG_H_
+#define COMMON_ALGORITHM_HYPERLOGLOG_H_
+
+#include <folly/hash/Hash.h>
+
+#include <cmath>
+
+#include "common/base/Base.h"
+
+namespace nebula {
+namespace algorithm {
+
+/**
+ * @brief Estimate the number of distinct items with fixed memory. Sketches built on different
+ * data could be merged, the estimation of merged sketch is the one of the union of data.
+ */
+class HyperLogLog final {
+ public:
+  // The standard error is about 1.04 / sqrt(kNumRegisters), 3.25% for 1024 registers
+  static constexpr uint32_t kPrecision = 10;
+  static constexpr uint32_t kNumRegisters = 1 << kPrecision;
+
+  HyperLogLog() : registers_(kNumRegisters, 0) {}
+
+  /**
+   * @brief Restore the sketch from the result of serialize(), an empty sketch is returned if raw
+   * is not a valid one.
+   */
+  static HyperLogLog deserialize(folly::StringPiece raw) {
+    HyperLogLog hll;
+    if (raw.size() == kNumRegisters) {
+      std::copy(raw.begin(), raw.end(), hll.registers_.begin());
+    }
+    return hll;
+  }
+
+  std::string serialize() const {
+    return std::string(registers_.begin(), registers_.end());
+  }
+
+  /**
+   * @brief Add an item by its hash, the hash should be well distributed in 64 bits
+   */
+  void add(uint64_t hash) {
+    hash = folly::hash::twang_mix64(hash);
+    auto index = hash >> (64 - kPrecision);
+    auto rest = hash << kPrecision;
+    uint8_t rank = rest == 0 ? 64 - kPrecision + 1 : __builtin_clzll(rest) + 1;
+    registers_[index] = std::max(registers_[index], rank);
+  }
+
+  void merge(const HyperLogLog& other) {
+    for (size_t i = 0; i < kNumRegisters; i++) {
+      registers_[i] = std::max(registers_[i], other.registers_[i]);
+    }
+  }
+
+  double estimate() const {
+    double sum = 0;
+    size_t zeros = 0;
+    for (auto r : registers_) {
+      sum += std::ldexp(1.0, -r);
+      zeros += r == 0;
+    }
+    double m = kNumRegisters;
+    double alpha = 0.7213 / (1 + 1.079 / m);
+    double e = alpha * m * m / sum;
+    if (e <= 2.5 * m && zeros > 0) {
+      // Linear counting is more accurate for small cardinalities
+      e = m * std::log(m / zeros);
+    }
+    return e;
+  }
+
+ private:
+  std::vector<uint8_t> registers_;
+};
+
+}  // namespace algorithm
+}  // namespace nebula
+#endif  // COMMON_ALGORITHM_HYPERLOGLOG_H_
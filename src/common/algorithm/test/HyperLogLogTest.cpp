@@ -0,0 +1,46 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/algorithm/HyperLogLog.h"
+
+namespace nebula {
+namespace algorithm {
+TEST(HyperLogLogTest, Estimate) {
+  {
+    HyperLogLog hll;
+    EXPECT_EQ(0, hll.estimate());
+  }
+  for (uint64_t num : {10, 1000, 100000}) {
+    HyperLogLog hll;
+    // Duplicated items are counted once
+    for (size_t round = 0; round < 3; round++) {
+      for (uint64_t i = 0; i < num; i++) {
+        hll.add(i);
+      }
+    }
+    EXPECT_NEAR(num, hll.estimate(), num * 0.1);
+  }
+}
+
+TEST(HyperLogLogTest, MergeAndSerialize) {
+  HyperLogLog a, b;
+  for (uint64_t i = 0; i < 6000; i++) {
+    a.add(i);
+  }
+  for (uint64_t i = 4000; i < 10000; i++) {
+    b.add(i);
+  }
+  auto c = HyperLogLog::deserialize(b.serialize());
+  EXPECT_EQ(b.estimate(), c.estimate());
+  a.merge(c);
+  EXPECT_NEAR(10000, a.estimate(), 1000);
+
+  // Invalid sketch
+  EXPECT_EQ(0, HyperLogLog::deserialize("abc").estimate());
+}
+}  // namespace algorithm
+}  // namespace nebula
@@ -0,0 +1,39 @@
+// Copyright (c) 2022 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include "common/base/ConcurrentArena.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace nebula {
+
+ConcurrentArena::ConcurrentArena(std::size_t numShards)
+    : numShards_(std::clamp<std::size_t>(numShards, 1, kMaxShards)),
+      shards_(new Shard[numShards_]) {}
+
+std::size_t ConcurrentArena::threadIndex() {
+  static std::atomic<std::size_t> nextIndex{0};
+  // Assign the shards to threads in turn
+  static thread_local std::size_t index =
+      nextIndex.fetch_add(1, std::memory_order_relaxed) % kMaxShards;
+  return index;
+}
+
+void *ConcurrentArena::allocateAligned(const std::size_t alloc) {
+  DCHECK_NE(alloc, 0);
+  if (UNLIKELY(alloc > kMaxShardAllocSize)) {
+    auto count = (alloc + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+    std::unique_ptr<std::max_align_t[]> block(new std::max_align_t[count]);
+    void *ptr = block.get();
+    std::lock_guard<folly::SpinLock> g(largeLock_);
+    largeBlocks_.emplace_back(std::move(block));
+    return ptr;
+  }
+  auto &shard = shards_[threadIndex() % numShards_];
+  std::lock_guard<folly::SpinLock> g(shard.lock);
+  return shard.arena.allocateAligned(alloc);
+}
+
+}  // namespace nebula
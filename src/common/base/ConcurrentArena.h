@@ -0,0 +1,92 @@
+// Copyright (c) 2022 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#pragma once
+
+#include <folly/SpinLock.h>
+
+#include <boost/core/noncopyable.hpp>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "common/base/Arena.h"
+#include "common/cpp/helpers.h"
+
+namespace nebula {
+
+// MT-safe arena allocator
+// The arena is split into shards when it's shared by threads allocating concurrently, then each
+// thread allocates from the chunks of its own shard, so the threads rarely contend with each
+// other. All memory is released together when the arena is destroyed.
+class ConcurrentArena : public boost::noncopyable, cpp::NonMovable {
+ public:
+  static constexpr std::size_t kMaxShards = 16;
+  // The larger allocation doesn't fit the chunks well, so it's allocated separately
+  static constexpr std::size_t kMaxShardAllocSize = 4096;
+
+  // numShards: The number of threads allocating without contention, at most kMaxShards
+  explicit ConcurrentArena(std::size_t numShards = 1);
+
+  void *allocateAligned(const std::size_t alloc);
+
+  std::size_t numShards() const {
+    return numShards_;
+  }
+
+  // The index of current thread, the shard of the thread is the index modulo number of shards
+  static std::size_t threadIndex();
+
+ private:
+  struct alignas(64) Shard {
+    folly::SpinLock lock;
+    Arena arena;
+  };
+
+  std::size_t numShards_;
+  std::unique_ptr<Shard[]> shards_;
+
+  folly::SpinLock largeLock_;
+  std::vector<std::unique_ptr<std::max_align_t[]>> largeBlocks_;
+};
+
+// STL allocator from the arena, which keeps the arena alive. The memory is not reused after
+// deallocated, so it suits the objects living as long as the arena, e.g. the results of a query.
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit ArenaAllocator(std::shared_ptr<ConcurrentArena> arena) : arena_(std::move(arena)) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &other) : arena_(other.arena()) {}  // NOLINT
+
+  T *allocate(std::size_t n) {
+    return static_cast<T *>(arena_->allocateAligned(n * sizeof(T)));
+  }
+
+  void deallocate(T *, std::size_t) {}
+
+  const std::shared_ptr<ConcurrentArena> &arena() const {
+    return arena_;
+  }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U> &rhs) const {
+    return arena_ == rhs.arena();
+  }
+
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U> &rhs) const {
+    return arena_ != rhs.arena();
+  }
+
+ private:
+  std::shared_ptr<ConcurrentArena> arena_;
+};
+
+}  // namespace nebula
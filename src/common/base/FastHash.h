@@ -0,0 +1,111 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#ifndef COMMON_BASE_FASTHASH_H_
+#define COMMON_BASE_FASTHASH_H_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace nebula {
+
+/**
+ * A fast non-cryptographic hash for the keys of in-memory hash tables, in the way of wyhash.
+ * Each round folds the 128-bit product of two 64-bit words, and the long input is consumed by
+ * three independent lanes of 16 bytes, like the stripes of xxh3, which keeps the multipliers of
+ * CPU busy. The strings of any length are hashed with a few multiplications, and the integers
+ * are well mixed rather than used as their own hash.
+ *
+ * The result is NOT stable across versions, never persist it or use it for partitioning.
+ */
+class FastHash {
+ public:
+  // std::string
+  size_t operator()(const std::string &str) const noexcept {
+    return hashBytes(str.data(), str.size());
+  }
+
+  // integer
+  size_t operator()(int64_t key) const noexcept {
+    return hashInt(key);
+  }
+
+  static uint64_t hashInt(int64_t key) noexcept {
+    return mix(static_cast<uint64_t>(key) ^ kSecret0, kSecret1);
+  }
+
+  static uint64_t hashBytes(const void *data, size_t size, uint64_t seed = 0) noexcept {
+    auto *p = static_cast<const uint8_t *>(data);
+    seed ^= mix(seed ^ kSecret0, kSecret1);
+    uint64_t a = 0, b = 0;
+    if (size <= 16) {
+      if (size >= 4) {
+        a = (read32(p) << 32) | read32(p + ((size >> 3) << 2));
+        b = (read32(p + size - 4) << 32) | read32(p + size - 4 - ((size >> 3) << 2));
+      } else if (size > 0) {
+        a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[size >> 1]) << 8) |
+            p[size - 1];
+      }
+    } else {
+      size_t i = size;
+      if (i > 48) {
+        uint64_t seed1 = seed, seed2 = seed;
+        do {
+          seed = mix(read64(p) ^ kSecret1, read64(p + 8) ^ seed);
+          seed1 = mix(read64(p + 16) ^ kSecret2, read64(p + 24) ^ seed1);
+          seed2 = mix(read64(p + 32) ^ kSecret3, read64(p + 40) ^ seed2);
+          p += 48;
+          i -= 48;
+        } while (i > 48);
+        seed ^= seed1 ^ seed2;
+      }
+      while (i > 16) {
+        seed = mix(read64(p) ^ kSecret1, read64(p + 8) ^ seed);
+        p += 16;
+        i -= 16;
+      }
+      // The last 16 bytes, which may overlap the consumed ones
+      a = read64(p + i - 16);
+      b = read64(p + i - 8);
+    }
+    __uint128_t r = static_cast<__uint128_t>(a ^ kSecret1) * (b ^ seed);
+    a = static_cast<uint64_t>(r);
+    b = static_cast<uint64_t>(r >> 64);
+    return mix(a ^ kSecret0 ^ size, b ^ kSecret1);
+  }
+
+  // Combine the hash of an element into the hash of a sequence
+  static uint64_t combine(uint64_t seed, uint64_t hash) noexcept {
+    return mix(seed ^ kSecret2, hash ^ kSecret1);
+  }
+
+ private:
+  static constexpr uint64_t kSecret0 = 0xa0761d6478bd642fULL;
+  static constexpr uint64_t kSecret1 = 0xe7037ed1a0b428dbULL;
+  static constexpr uint64_t kSecret2 = 0x8ebc6af09c88c6e3ULL;
+  static constexpr uint64_t kSecret3 = 0x589965cc75374cc3ULL;
+
+  // Fold the 128-bit product
+  static uint64_t mix(uint64_t a, uint64_t b) noexcept {
+    __uint128_t r = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+  }
+
+  static uint64_t read64(const uint8_t *p) noexcept {
+    uint64_t v;
+    ::memcpy(&v, p, sizeof(v));
+    return v;
+  }
+
+  static uint64_t read32(const uint8_t *p) noexcept {
+    uint32_t v;
+    ::memcpy(&v, p, sizeof(v));
+    return v;
+  }
+};
+
+}  // namespace nebula
+
+#endif  // COMMON_BASE_FASTHASH_H_
@@ -6,14 +6,12 @@
 #ifndef COMMON_BASE_OBJECTPOOL_H_
 #define COMMON_BASE_OBJECTPOOL_H_
 
-#include <folly/SpinLock.h>
-
+#include <atomic>
 #include <boost/core/noncopyable.hpp>
-#include <functional>
-#include <list>
+#include <memory>
 #include <type_traits>
 
-#include "common/base/Arena.h"
+#include "common/base/ConcurrentArena.h"
 #include "common/base/Logging.h"
 #include "common/cpp/helpers.h"
 
@@ -21,61 +19,97 @@ namespace nebula {
 
 class Expression;
 
-typedef std::lock_guard<folly::SpinLock> SLGuard;
-
+// The objects are allocated from a concurrent arena and destroyed together. The pool made
+// concurrently by threads could be sharded, then no lock is held when the threads make objects in
+// different shards of arena.
 class ObjectPool final : private boost::noncopyable, private cpp::NonMovable {
  public:
-  ObjectPool() {}
+  // numShards: The number of threads making objects without contention, see ConcurrentArena
+  explicit ObjectPool(std::size_t numShards = 1)
+      : arena_(numShards), heads_(new Head[arena_.numShards()]) {}
 
   ~ObjectPool() {
     clear();
   }
 
+  // Destroy all objects, it mustn't run concurrently with makeAndAdd.
+  // The memory is released when the pool is destroyed.
   void clear() {
-    SLGuard g(lock_);
-    objects_.clear();
+    for (std::size_t i = 0; i < arena_.numShards(); ++i) {
+      auto *holder = heads_[i].holder.exchange(nullptr, std::memory_order_acquire);
+      while (holder != nullptr) {
+        auto *next = holder->next;
+        holder->destroy(holder);
+        holder = next;
+      }
+    }
   }
 
   template <typename T, typename... Args>
   T *makeAndAdd(Args &&... args) {
-    lock_.lock();
-    void *ptr = arena_.allocateAligned(sizeof(T));
-    lock_.unlock();
-    return add(new (ptr) T(std::forward<Args>(args)...));
+    if constexpr (std::is_trivially_destructible_v<T>) {
+      void *ptr = arena_.allocateAligned(sizeof(T));
+      return new (ptr) T(std::forward<Args>(args)...);
+    } else {
+      void *ptr = arena_.allocateAligned(sizeof(TypedHolder<T>));
+      // Construct out of any lock, the constructor may make objects in the pool too
+      auto *holder = new (ptr) TypedHolder<T>(std::forward<Args>(args)...);
+      add(holder);
+      return holder->object();
+    }
   }
 
+  // Whether there is no object to destroy
   bool empty() const {
-    return objects_.empty();
+    for (std::size_t i = 0; i < arena_.numShards(); ++i) {
+      if (heads_[i].holder.load(std::memory_order_relaxed) != nullptr) {
+        return false;
+      }
+    }
+    return true;
   }
 
  private:
-  // Holder the ownership of the any object
-  class OwnershipHolder {
-   public:
-    template <typename T>
-    explicit OwnershipHolder(T *obj)
-        : obj_(obj), deleteFn_([](void *p) { reinterpret_cast<T *>(p)->~T(); }) {}
-
-    ~OwnershipHolder() {
-      deleteFn_(obj_);
-    }
+  // Holder the ownership of the any object, it's allocated together with the object
+  struct OwnershipHolder {
+    explicit OwnershipHolder(void (*fn)(OwnershipHolder *)) : destroy(fn) {}
 
-   private:
-    void *obj_;
-    std::function<void(void *)> deleteFn_;
+    OwnershipHolder *next{nullptr};
+    void (*destroy)(OwnershipHolder *);
   };
 
   template <typename T>
-  T *add(T *obj) {
-    SLGuard g(lock_);
-    objects_.emplace_back(obj);
-    return obj;
-  }
+  struct TypedHolder : OwnershipHolder {
+    template <typename... Args>
+    explicit TypedHolder(Args &&... args)
+        : OwnershipHolder(&TypedHolder::destroyHolder), obj(std::forward<Args>(args)...) {}
+
+    static void destroyHolder(OwnershipHolder *holder) {
+      static_cast<TypedHolder *>(holder)->~TypedHolder();
+    }
 
-  std::list<OwnershipHolder> objects_;
-  Arena arena_;
+    T *object() {
+      return &obj;
+    }
+
+    T obj;
+  };
+
+  struct alignas(64) Head {
+    std::atomic<OwnershipHolder *> holder{nullptr};
+  };
+
+  void add(OwnershipHolder *holder) {
+    auto &head = heads_[ConcurrentArena::threadIndex() % arena_.numShards()].holder;
+    holder->next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(
+        holder->next, holder, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+  }
 
-  folly::SpinLock lock_;
+  ConcurrentArena arena_;
+  // The objects made in each shard
+  std::unique_ptr<Head[]> heads_;
 };
 
 }  // namespace nebula
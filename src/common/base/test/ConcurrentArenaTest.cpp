@@ -0,0 +1,58 @@
+// Copyright (c) 2022 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+#include "common/base/ConcurrentArena.h"
+
+namespace nebula {
+
+TEST(ConcurrentArenaTest, Basic) {
+  ConcurrentArena a;
+
+  for (std::size_t i = 1; i < 3 * ConcurrentArena::kMaxShardAllocSize; i += 8) {
+    void *ptr = a.allocateAligned(i);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % std::alignment_of<std::max_align_t>::value, 0);
+  }
+}
+
+TEST(ConcurrentArenaTest, MultiThreads) {
+  ConcurrentArena a(ConcurrentArena::kMaxShards);
+  EXPECT_EQ(ConcurrentArena::kMaxShards, a.numShards());
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < 2 * ConcurrentArena::kMaxShards; ++t) {
+    threads.emplace_back([&a, t]() {
+      std::vector<std::size_t *> ptrs;
+      for (std::size_t i = 0; i < 1024; ++i) {
+        void *ptr = a.allocateAligned(sizeof(std::size_t));
+        ptrs.emplace_back(new (ptr) std::size_t(t * 1024 + i));
+      }
+      // Not overwritten by other threads
+      for (std::size_t i = 0; i < ptrs.size(); ++i) {
+        EXPECT_EQ(*ptrs[i], t * 1024 + i);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+TEST(ConcurrentArenaTest, Allocator) {
+  auto arena = std::make_shared<ConcurrentArena>();
+  std::weak_ptr<ConcurrentArena> weak = arena;
+  auto str = std::allocate_shared<std::string>(ArenaAllocator<std::string>(arena), "Hello World!");
+  arena.reset();
+  // Kept alive by the allocator
+  EXPECT_FALSE(weak.expired());
+  EXPECT_EQ(*str, "Hello World!");
+  str.reset();
+  EXPECT_TRUE(weak.expired());
+}
+
+}  // namespace nebula
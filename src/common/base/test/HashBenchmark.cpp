@@ -5,8 +5,10 @@
 #include <folly/Benchmark.h>
 
 #include "common/base/Base.h"
+#include "common/base/FastHash.h"
 #include "common/base/MurmurHash2.h"
 
+using nebula::FastHash;
 using nebula::MurmurHash2;
 
 std::string makeString(size_t size) {
@@ -46,47 +48,104 @@ size_t MurmurHash2Test(size_t iters, size_t size) {
   return iters * ops;
 }
 
+size_t FastHashTest(size_t iters, size_t size) {
+  constexpr size_t ops = 1000000UL;
+
+  FastHash hash;
+  auto str = makeString(size);
+  auto i = 0UL;
+  while (i++ < ops * iters) {
+    auto hv = hash(str);
+    folly::doNotOptimizeAway(hv);
+  }
+
+  return iters * ops;
+}
+
+// Hash the sequential integers as a hash table of int vids does
+size_t StdHashIntTest(size_t iters) {
+  constexpr size_t ops = 1000000UL;
+
+  std::hash<int64_t> hash;
+  size_t sum = 0;
+  for (int64_t i = 0; i < static_cast<int64_t>(ops * iters); ++i) {
+    sum += hash(i);
+  }
+  folly::doNotOptimizeAway(sum);
+
+  return iters * ops;
+}
+
+size_t FastHashIntTest(size_t iters) {
+  constexpr size_t ops = 1000000UL;
+
+  size_t sum = 0;
+  for (int64_t i = 0; i < static_cast<int64_t>(ops * iters); ++i) {
+    sum += FastHash::hashInt(i);
+  }
+  folly::doNotOptimizeAway(sum);
+
+  return iters * ops;
+}
+
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 1Byte, 1UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 1Byte, 1UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 1Byte, 1UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 2Byte, 2UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 2Byte, 2UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 2Byte, 2UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 3Byte, 3UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 3Byte, 3UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 3Byte, 3UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 4Byte, 4UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 4Byte, 4UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 4Byte, 4UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 5Byte, 5UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 5Byte, 5UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 5Byte, 5UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 6Byte, 6UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 6Byte, 6UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 6Byte, 6UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 7Byte, 7UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 7Byte, 7UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 7Byte, 7UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 8Byte, 8UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 8Byte, 8UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 8Byte, 8UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 9Byte, 9UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 9Byte, 9UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 9Byte, 9UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 10Byte, 10UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 10Byte, 10UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 10Byte, 10UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 64Byte, 64UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 64Byte, 64UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 64Byte, 64UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 256Byte, 256UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 256Byte, 256UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 256Byte, 256UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 1024Byte, 1024UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 1024Byte, 1024UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 1024Byte, 1024UL)
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM_MULTI(StdHashTest, 4096Byte, 4096UL)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MurmurHash2Test, 4096Byte, 4096UL)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(FastHashTest, 4096Byte, 4096UL)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_MULTI(StdHashIntTest)
+BENCHMARK_RELATIVE_MULTI(FastHashIntTest)
 
 int main(int argc, char **argv) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
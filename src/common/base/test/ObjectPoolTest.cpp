@@ -5,11 +5,14 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 #include "common/base/ObjectPool.h"
 
 namespace nebula {
 
-static int instances = 0;
+static std::atomic<int> instances{0};
 
 class MyClass {
  public:
@@ -22,15 +25,41 @@ class MyClass {
 };
 
 TEST(ObjectPoolTest, TestPooling) {
-  ASSERT_EQ(instances, 0);
+  ASSERT_EQ(instances.load(), 0);
 
   ObjectPool pool;
   ASSERT_NE(pool.makeAndAdd<MyClass>(), nullptr);
   ASSERT_NE(pool.makeAndAdd<MyClass>(), nullptr);
-  ASSERT_EQ(instances, 2);
+  ASSERT_EQ(instances.load(), 2);
 
   pool.clear();
-  ASSERT_EQ(instances, 0);
+  ASSERT_EQ(instances.load(), 0);
+}
+
+TEST(ObjectPoolTest, TestMultiThreads) {
+  // Not sharded by default
+  for (std::size_t numShards : {std::size_t(1), ConcurrentArena::kMaxShards}) {
+    ASSERT_EQ(instances.load(), 0);
+    {
+      ObjectPool pool(numShards);
+      std::vector<std::thread> threads;
+      for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&pool]() {
+          for (int j = 0; j < 1000; ++j) {
+            ASSERT_NE(pool.makeAndAdd<MyClass>(), nullptr);
+            // Trivially destructible
+            ASSERT_EQ(*pool.makeAndAdd<int>(j), j);
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+      ASSERT_EQ(instances.load(), 8000);
+      ASSERT_FALSE(pool.empty());
+    }
+    ASSERT_EQ(instances.load(), 0);
+  }
 }
 
 }  // namespace nebula
@@ -8,6 +8,7 @@
 
 #include <unordered_map>
 
+#include "common/datatypes/Props.h"
 #include "common/datatypes/Value.h"
 #include "common/thrift/ThriftTypes.h"
 
@@ -19,7 +20,7 @@ struct Edge {
   EdgeType type;
   std::string name;
   EdgeRanking ranking;
-  std::unordered_map<std::string, Value> props;
+  Props props;
 
   Edge() {}
   Edge(Edge&& v) noexcept
@@ -36,7 +37,7 @@ struct Edge {
        EdgeType t,
        std::string n,
        EdgeRanking r,
-       std::unordered_map<std::string, Value>&& p)
+       Props p)
       : src(std::move(s)),
         dst(std::move(d)),
         type(std::move(t)),
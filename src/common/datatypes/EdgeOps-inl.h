@@ -15,6 +15,7 @@
 
 #include "common/base/Base.h"
 #include "common/datatypes/CommonCpp2Ops.h"
+#include "common/datatypes/PropsOps-inl.h"
 #include "common/datatypes/Edge.h"
 
 namespace apache {
@@ -88,9 +89,7 @@ uint32_t Cpp2Ops<nebula::Edge>::write(Protocol* proto, nebula::Edge const* obj)
   xfer += proto->writeFieldEnd();
 
   xfer += proto->writeFieldBegin("props", apache::thrift::protocol::T_MAP, 6);
-  xfer += detail::pm::protocol_methods<
-      type_class::map<type_class::binary, type_class::structure>,
-      std::unordered_map<std::string, nebula::Value>>::write(*proto, obj->props);
+  xfer += detail::PropsOps::write(proto, obj->props);
   xfer += proto->writeFieldEnd();
 
   xfer += proto->writeFieldStop();
@@ -145,10 +144,7 @@ _readField_ranking : {
   }
 
 _readField_props : {
-  obj->props = std::unordered_map<std::string, nebula::Value>();
-  detail::pm::protocol_methods<type_class::map<type_class::binary, type_class::structure>,
-                               std::unordered_map<std::string, nebula::Value>>::read(*proto,
-                                                                                     obj->props);
+  detail::PropsOps::read(proto, obj->props);
 }
 
   if (UNLIKELY(!readState.advanceToNextField(proto, 6, 0, protocol::T_STOP))) {
@@ -248,9 +244,7 @@ uint32_t Cpp2Ops<nebula::Edge>::serializedSize(Protocol const* proto, nebula::Ed
                                                                                    obj->ranking);
 
   xfer += proto->serializedFieldSize("props", apache::thrift::protocol::T_MAP, 6);
-  xfer += detail::pm::protocol_methods<
-      type_class::map<type_class::binary, type_class::structure>,
-      std::unordered_map<std::string, nebula::Value>>::serializedSize<false>(*proto, obj->props);
+  xfer += detail::PropsOps::serializedSize(proto, obj->props);
 
   xfer += proto->serializedSizeStop();
   return xfer;
@@ -281,9 +275,7 @@ uint32_t Cpp2Ops<nebula::Edge>::serializedSizeZC(Protocol const* proto, nebula::
                                                                                    obj->ranking);
 
   xfer += proto->serializedFieldSize("props", apache::thrift::protocol::T_MAP, 6);
-  xfer += detail::pm::protocol_methods<
-      type_class::map<type_class::binary, type_class::structure>,
-      std::unordered_map<std::string, nebula::Value>>::serializedSize<false>(*proto, obj->props);
+  xfer += detail::PropsOps::serializedSize(proto, obj->props);
 
   xfer += proto->serializedSizeStop();
   return xfer;
@@ -0,0 +1,85 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_DATATYPES_KEYHASH_H_
+#define COMMON_DATATYPES_KEYHASH_H_
+
+#include "common/base/FastHash.h"
+#include "common/datatypes/List.h"
+#include "common/datatypes/Value.h"
+
+namespace nebula {
+
+/**
+ * @brief Hash and equality of the keys of hash tables in executors, e.g. vids, join keys, group
+ * keys and the rows to dedup. The keys are almost always ints or strings, e.g. the vids of a
+ * space, so these types are checked first and handled by FastHash and direct comparison. The
+ * keys of other types fall back to std::hash<Value> and Value::operator==.
+ */
+struct ValueKeyHash {
+  size_t operator()(const Value& value) const noexcept {
+    if (value.isInt()) {
+      return FastHash::hashInt(value.getInt());
+    }
+    if (value.isStr()) {
+      const auto& str = value.getStr();
+      return FastHash::hashBytes(str.data(), str.size());
+    }
+    return std::hash<Value>()(value);
+  }
+};
+
+struct ValueKeyEqual {
+  bool operator()(const Value& lhs, const Value& rhs) const {
+    if (lhs.type() == rhs.type()) {
+      if (lhs.isInt()) {
+        return lhs.getInt() == rhs.getInt();
+      }
+      if (lhs.isStr()) {
+        // The interned strings share the same block
+        const auto& lstr = lhs.getStr();
+        const auto& rstr = rhs.getStr();
+        return &lstr == &rstr || lstr == rstr;
+      }
+    }
+    return lhs == rhs;
+  }
+};
+
+// The keys of multiple columns, also the rows by pointer
+struct ListKeyHash {
+  size_t operator()(const List& list) const noexcept {
+    uint64_t seed = list.size();
+    for (const auto& value : list.values) {
+      seed = FastHash::combine(seed, ValueKeyHash()(value));
+    }
+    return seed;
+  }
+
+  size_t operator()(const List* list) const noexcept {
+    return list == nullptr ? 0 : (*this)(*list);
+  }
+};
+
+struct ListKeyEqual {
+  bool operator()(const List& lhs, const List& rhs) const {
+    if (lhs.size() != rhs.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      if (!ValueKeyEqual()(lhs.values[i], rhs.values[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool operator()(const List* lhs, const List* rhs) const {
+    return lhs == rhs || (lhs != nullptr && rhs != nullptr && (*this)(*lhs, *rhs));
+  }
+};
+
+}  // namespace nebula
+#endif  // COMMON_DATATYPES_KEYHASH_H_
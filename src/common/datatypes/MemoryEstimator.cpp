@@ -0,0 +1,134 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "common/datatypes/MemoryEstimator.h"
+
+#include <algorithm>
+
+#include "common/datatypes/Date.h"
+#include "common/datatypes/Duration.h"
+#include "common/datatypes/Edge.h"
+#include "common/datatypes/Geography.h"
+#include "common/datatypes/Map.h"
+#include "common/datatypes/Path.h"
+#include "common/datatypes/Set.h"
+#include "common/datatypes/Vertex.h"
+
+namespace nebula {
+namespace {
+
+// The memory of a node of hash table besides the element
+constexpr int64_t kHashNodeBytes = 2 * sizeof(void*);
+
+// Estimate the total of f(elements) of the range by sampling
+template <class Iter, class F>
+int64_t sampled(Iter begin, size_t size, F f) {
+  int64_t total = 0;
+  auto step = std::max<size_t>(1, size / MemoryEstimator::kSampleSize);
+  size_t sampled = 0;
+  for (size_t i = 0; i < size; i += step, ++sampled) {
+    total += f(*(begin + i));
+  }
+  return sampled == 0 ? 0 : total * static_cast<int64_t>(size) / static_cast<int64_t>(sampled);
+}
+
+}  // namespace
+
+int64_t MemoryEstimator::estimate(const Value& value) {
+  return sizeof(Value) + heapBytes(value);
+}
+
+int64_t MemoryEstimator::estimate(const DataSet& ds) {
+  int64_t bytes = sizeof(DataSet) + ds.colNames.capacity() * sizeof(std::string);
+  for (auto& name : ds.colNames) {
+    bytes += heapBytes(name);
+  }
+  return bytes + heapBytes(ds.rows);
+}
+
+int64_t MemoryEstimator::estimate(const std::vector<Value>& values) {
+  return sizeof(values) + heapBytes(values);
+}
+
+int64_t MemoryEstimator::heapBytes(const std::string& str) {
+  // The short strings are stored inline
+  return str.capacity() > 15 ? str.capacity() + 1 : 0;
+}
+
+int64_t MemoryEstimator::heapBytes(const std::vector<Value>& values) {
+  return values.capacity() * sizeof(Value) +
+         sampled(values.begin(), values.size(), [](const Value& v) { return heapBytes(v); });
+}
+
+int64_t MemoryEstimator::heapBytes(const std::vector<Row>& rows) {
+  return rows.capacity() * sizeof(Row) +
+         sampled(rows.begin(), rows.size(), [](const Row& row) { return heapBytes(row.values); });
+}
+
+int64_t MemoryEstimator::heapBytes(const Vertex& vertex) {
+  int64_t bytes = heapBytes(vertex.vid) + vertex.tags.capacity() * sizeof(Tag);
+  for (auto& tag : vertex.tags) {
+    // The names of props are shared by the tags of the same schema
+    bytes += heapBytes(tag.name) + heapBytes(tag.props.values());
+  }
+  return bytes;
+}
+
+int64_t MemoryEstimator::heapBytes(const Value& value) {
+  switch (value.type()) {
+    case Value::Type::STRING:
+      // The shared block of string
+      return sizeof(std::string) + sizeof(int64_t) + heapBytes(value.getStr());
+    case Value::Type::DATE:
+      return sizeof(Date);
+    case Value::Type::TIME:
+      return sizeof(Time);
+    case Value::Type::DATETIME:
+      return sizeof(DateTime);
+    case Value::Type::DURATION:
+      return sizeof(Duration);
+    case Value::Type::VERTEX:
+      return sizeof(Vertex) + heapBytes(value.getVertex());
+    case Value::Type::EDGE: {
+      auto& edge = value.getEdge();
+      return sizeof(Edge) + heapBytes(edge.src) + heapBytes(edge.dst) + heapBytes(edge.name) +
+             heapBytes(edge.props.values());
+    }
+    case Value::Type::PATH: {
+      auto& path = value.getPath();
+      int64_t bytes = sizeof(Path) + heapBytes(path.src) + path.steps.capacity() * sizeof(Step);
+      for (auto& step : path.steps) {
+        bytes += heapBytes(step.dst) + heapBytes(step.name) + heapBytes(step.props.values());
+      }
+      return bytes;
+    }
+    case Value::Type::LIST:
+      return sizeof(List) + heapBytes(value.getList().values);
+    case Value::Type::MAP: {
+      auto& kvs = value.getMap().kvs;
+      int64_t bytes = sizeof(Map) + kvs.bucket_count() * sizeof(void*);
+      for (auto& kv : kvs) {
+        bytes += kHashNodeBytes + sizeof(kv) + heapBytes(kv.first) + heapBytes(kv.second);
+      }
+      return bytes;
+    }
+    case Value::Type::SET: {
+      auto& values = value.getSet().values;
+      int64_t bytes = sizeof(Set) + values.bucket_count() * sizeof(void*);
+      for (auto& v : values) {
+        bytes += kHashNodeBytes + sizeof(Value) + heapBytes(v);
+      }
+      return bytes;
+    }
+    case Value::Type::DATASET:
+      return estimate(value.getDataSet());
+    case Value::Type::GEOGRAPHY:
+      return sizeof(Geography);
+    default:
+      return 0;
+  }
+}
+
+}  // namespace nebula
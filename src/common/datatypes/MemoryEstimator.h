@@ -0,0 +1,51 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_DATATYPES_MEMORYESTIMATOR_H_
+#define COMMON_DATATYPES_MEMORYESTIMATOR_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "common/datatypes/DataSet.h"
+#include "common/datatypes/Value.h"
+
+namespace nebula {
+
+struct Vertex;
+
+/**
+ * @brief Estimate the memory used by values, for the memory accounting of queries. A large list or
+ * dataset is estimated by sampling its elements, so the cost doesn't grow with its size.
+ */
+class MemoryEstimator final {
+ public:
+  // The number of elements sampled of a list or dataset
+  static constexpr size_t kSampleSize = 64;
+
+  /**
+   * @brief Estimated bytes of value, including itself
+   */
+  static int64_t estimate(const Value& value);
+
+  static int64_t estimate(const DataSet& ds);
+
+  static int64_t estimate(const std::vector<Value>& values);
+
+ private:
+  // Estimated bytes of the heap memory of value
+  static int64_t heapBytes(const Value& value);
+
+  static int64_t heapBytes(const std::string& str);
+
+  static int64_t heapBytes(const std::vector<Value>& values);
+
+  static int64_t heapBytes(const std::vector<Row>& rows);
+
+  static int64_t heapBytes(const Vertex& vertex);
+};
+
+}  // namespace nebula
+#endif  // COMMON_DATATYPES_MEMORYESTIMATOR_H_
@@ -6,6 +6,7 @@
 #ifndef COMMON_DATATYPES_PATH_H_
 #define COMMON_DATATYPES_PATH_H_
 
+#include "common/datatypes/Props.h"
 #include "common/datatypes/Value.h"
 #include "common/datatypes/Vertex.h"
 #include "common/thrift/ThriftTypes.h"
@@ -17,7 +18,7 @@ struct Step {
   EdgeType type;
   std::string name;
   EdgeRanking ranking;
-  std::unordered_map<std::string, Value> props;
+  Props props;
 
   Step() = default;
   Step(const Step& s)
@@ -32,7 +33,7 @@ struct Step {
        EdgeType t,
        std::string n,
        EdgeRanking r,
-       std::unordered_map<std::string, Value> p) noexcept
+       Props p) noexcept
       : dst(std::move(d)), type(t), name(std::move(n)), ranking(r), props(std::move(p)) {}
 
   void clear() {
@@ -15,6 +15,7 @@
 
 #include "common/base/Base.h"
 #include "common/datatypes/CommonCpp2Ops.h"
+#include "common/datatypes/PropsOps-inl.h"
 #include "common/datatypes/Path.h"
 
 namespace apache {
@@ -86,9 +87,7 @@ uint32_t Cpp2Ops<nebula::Step>::write(Protocol* proto, nebula::Step const* obj)
   xfer += proto->writeFieldEnd();
 
   xfer += proto->writeFieldBegin("props", apache::thrift::protocol::T_MAP, 5);
-  xfer += detail::pm::protocol_methods<
-      type_class::map<type_class::binary, type_class::structure>,
-      std::unordered_map<std::string, nebula::Value>>::write(*proto, obj->props);
+  xfer += detail::PropsOps::write(proto, obj->props);
   xfer += proto->writeFieldEnd();
 
   xfer += proto->writeFieldStop();
@@ -138,10 +137,7 @@ _readField_ranking : {
   }
 
 _readField_props : {
-  obj->props = std::unordered_map<std::string, nebula::Value>();
-  detail::pm::protocol_methods<type_class::map<type_class::binary, type_class::structure>,
-                               std::unordered_map<std::string, nebula::Value>>::read(*proto,
-                                                                                     obj->props);
+  detail::PropsOps::read(proto, obj->props);
 }
 
   if (UNLIKELY(!readState.advanceToNextField(proto, 5, 0, protocol::T_STOP))) {
@@ -231,9 +227,7 @@ uint32_t Cpp2Ops<nebula::Step>::serializedSize(Protocol const* proto, nebula::St
                                                                                    obj->ranking);
 
   xfer += proto->serializedFieldSize("props", apache::thrift::protocol::T_MAP, 5);
-  xfer += detail::pm::protocol_methods<
-      type_class::map<type_class::binary, type_class::structure>,
-      std::unordered_map<std::string, nebula::Value>>::serializedSize<false>(*proto, obj->props);
+  xfer += detail::PropsOps::serializedSize(proto, obj->props);
 
   xfer += proto->serializedSizeStop();
   return xfer;
@@ -261,9 +255,7 @@ uint32_t Cpp2Ops<nebula::Step>::serializedSizeZC(Protocol const* proto, nebula::
                                                                                    obj->ranking);
 
   xfer += proto->serializedFieldSize("props", apache::thrift::protocol::T_MAP, 5);
-  xfer += detail::pm::protocol_methods<
-      type_class::map<type_class::binary, type_class::structure>,
-      std::unordered_map<std::string, nebula::Value>>::serializedSize<false>(*proto, obj->props);
+  xfer += detail::PropsOps::serializedSize(proto, obj->props);
 
   xfer += proto->serializedSizeStop();
   return xfer;
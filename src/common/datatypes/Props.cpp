@@ -0,0 +1,164 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "common/datatypes/Props.h"
+
+#include <glog/logging.h>
+
+#include <stdexcept>
+
+namespace nebula {
+
+PropNames::PropNames(std::vector<std::string> names) : names_(std::move(names)) {
+  buildIndex();
+}
+
+int64_t PropNames::indexOf(folly::StringPiece name) const {
+  if (names_.size() < kIndexThreshold) {
+    for (size_t i = 0; i < names_.size(); ++i) {
+      if (name == names_[i]) {
+        return i;
+      }
+    }
+    return -1;
+  }
+  auto iter = index_.find(std::string_view(name.data(), name.size()));
+  return iter == index_.end() ? -1 : static_cast<int64_t>(iter->second);
+}
+
+void PropNames::append(std::string name) {
+  DCHECK_LT(indexOf(name), 0) << "Duplicate prop name " << name;
+  auto capacity = names_.capacity();
+  names_.emplace_back(std::move(name));
+  if (names_.capacity() != capacity) {
+    // The short names are moved by reallocation, the index refers to them
+    buildIndex();
+  } else if (names_.size() >= kIndexThreshold) {
+    index_.emplace(names_.back(), names_.size() - 1);
+  }
+}
+
+void PropNames::buildIndex() {
+  index_.clear();
+  if (names_.size() < kIndexThreshold) {
+    return;
+  }
+  index_.reserve(names_.size());
+  for (size_t i = 0; i < names_.size(); ++i) {
+    index_.emplace(names_[i], i);
+  }
+}
+
+Props::Props(std::shared_ptr<const PropNames> names, std::vector<Value> values)
+    : names_(std::move(names)), values_(std::move(values)) {
+  DCHECK_EQ(names_ == nullptr ? 0 : names_->size(), values_.size());
+}
+
+Props::Props(std::initializer_list<std::pair<const std::string, Value>> kvs) {
+  reserve(kvs.size());
+  for (const auto& kv : kvs) {
+    emplace(kv.first, kv.second);
+  }
+}
+
+Props::Props(std::unordered_map<std::string, Value> kvs) {
+  reserve(kvs.size());
+  for (auto& kv : kvs) {
+    emplace(kv.first, std::move(kv.second));
+  }
+}
+
+void Props::reserve(size_t size) {
+  mutableNames()->reserve(size);
+  values_.reserve(size);
+}
+
+Value& Props::at(folly::StringPiece name) {
+  auto i = indexOf(name);
+  if (i < 0) {
+    throw std::out_of_range("No prop " + name.str());
+  }
+  return values_[i];
+}
+
+const Value& Props::at(folly::StringPiece name) const {
+  auto i = indexOf(name);
+  if (i < 0) {
+    throw std::out_of_range("No prop " + name.str());
+  }
+  return values_[i];
+}
+
+Value& Props::operator[](folly::StringPiece name) {
+  return emplace(name.str(), Value()).first->second;
+}
+
+std::pair<Props::iterator, bool> Props::emplace(std::string name, Value value) {
+  auto i = indexOf(name);
+  if (i >= 0) {
+    return std::make_pair(iterator(this, i), false);
+  }
+  mutableNames()->append(std::move(name));
+  values_.emplace_back(std::move(value));
+  return std::make_pair(iterator(this, values_.size() - 1), true);
+}
+
+size_t Props::erase(folly::StringPiece name) {
+  auto i = indexOf(name);
+  if (i < 0) {
+    return 0;
+  }
+  std::vector<std::string> names;
+  names.reserve(names_->size() - 1);
+  for (size_t j = 0; j < names_->size(); ++j) {
+    if (j != static_cast<size_t>(i)) {
+      names.emplace_back(names_->name(j));
+    }
+  }
+  auto newNames = std::make_shared<PropNames>(std::move(names));
+  ownedNames_ = newNames.get();
+  names_ = std::move(newNames);
+  values_.erase(values_.begin() + i);
+  return 1;
+}
+
+std::unordered_map<std::string, Value> Props::toMap() const {
+  std::unordered_map<std::string, Value> kvs;
+  kvs.reserve(values_.size());
+  for (size_t i = 0; i < values_.size(); ++i) {
+    kvs.emplace(names_->name(i), values_[i]);
+  }
+  return kvs;
+}
+
+bool Props::operator==(const Props& rhs) const {
+  if (values_.size() != rhs.values_.size()) {
+    return false;
+  }
+  if (names_ == rhs.names_) {
+    return values_ == rhs.values_;
+  }
+  for (size_t i = 0; i < values_.size(); ++i) {
+    auto j = rhs.indexOf(names_->name(i));
+    if (j < 0 || !(values_[i] == rhs.values_[j])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+PropNames* Props::mutableNames() {
+  if (names_ != nullptr && names_.get() == ownedNames_ && names_.use_count() == 1) {
+    return ownedNames_;
+  }
+  // The names shared with others, or made by others as const, are copied
+  auto names = names_ == nullptr ? std::make_shared<PropNames>()
+                                 : std::make_shared<PropNames>(names_->names());
+  ownedNames_ = names.get();
+  names_ = std::move(names);
+  return ownedNames_;
+}
+
+}  // namespace nebula
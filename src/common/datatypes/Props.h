@@ -0,0 +1,270 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_DATATYPES_PROPS_H_
+#define COMMON_DATATYPES_PROPS_H_
+
+#include <folly/Range.h>
+
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "common/datatypes/Value.h"
+
+namespace nebula {
+
+/**
+ * @brief The names of properties, shared by the props of all tags or edges of the same schema.
+ * The index of a name is the position of its value in Props.
+ */
+class PropNames final {
+ public:
+  // The names are looked up by linear scan below this size, by hash index otherwise
+  static constexpr size_t kIndexThreshold = 8;
+
+  PropNames() = default;
+  explicit PropNames(std::vector<std::string> names);
+
+  // The index refers to names_
+  PropNames(const PropNames&) = delete;
+  PropNames& operator=(const PropNames&) = delete;
+
+  size_t size() const {
+    return names_.size();
+  }
+
+  const std::string& name(size_t i) const {
+    return names_[i];
+  }
+
+  const std::vector<std::string>& names() const {
+    return names_;
+  }
+
+  /**
+   * @brief The index of name, or -1 if not found
+   */
+  int64_t indexOf(folly::StringPiece name) const;
+
+  /**
+   * @brief Append a name, which shouldn't be found before
+   */
+  void append(std::string name);
+
+  void reserve(size_t size) {
+    names_.reserve(size);
+  }
+
+ private:
+  void buildIndex();
+
+  std::vector<std::string> names_;
+  std::unordered_map<std::string_view, size_t> index_;
+};
+
+/**
+ * @brief The properties of a tag, an edge or a step of path. The values are kept in a vector
+ * aligned to the shared PropNames, so props of the same schema don't allocate a map or copy the
+ * names. It has the interface of a map from name to value, and toMap() builds a real map when
+ * required. The names are copied on write when shared.
+ */
+class Props final {
+ public:
+  template <bool kConst>
+  class Iter {
+   public:
+    using ValueType = std::conditional_t<kConst, const Value, Value>;
+    using PropsType = std::conditional_t<kConst, const Props, Props>;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::pair<const std::string&, ValueType&>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+
+    struct Arrow {
+      value_type kv;
+      const value_type* operator->() const {
+        return &kv;
+      }
+    };
+    using pointer = Arrow;
+
+    Iter(PropsType* props, size_t pos) : props_(props), pos_(pos) {}
+
+    // The const iterator could be made of iterator
+    template <bool kRhsConst, typename = std::enable_if_t<kConst || !kRhsConst>>
+    Iter(const Iter<kRhsConst>& rhs) : props_(rhs.props_), pos_(rhs.pos_) {}  // NOLINT
+
+    reference operator*() const {
+      return value_type(props_->names_->name(pos_), props_->values_[pos_]);
+    }
+
+    Arrow operator->() const {
+      return Arrow{**this};
+    }
+
+    Iter& operator++() {
+      ++pos_;
+      return *this;
+    }
+
+    Iter operator++(int) {
+      auto ret = *this;
+      ++pos_;
+      return ret;
+    }
+
+    bool operator==(const Iter& rhs) const {
+      return pos_ == rhs.pos_;
+    }
+
+    bool operator!=(const Iter& rhs) const {
+      return pos_ != rhs.pos_;
+    }
+
+   private:
+    template <bool>
+    friend class Iter;
+
+    PropsType* props_;
+    size_t pos_;
+  };
+
+  using iterator = Iter<false>;
+  using const_iterator = Iter<true>;
+
+  Props() = default;
+  Props(const Props&) = default;
+  Props(Props&& rhs) noexcept = default;
+  Props& operator=(const Props&) = default;
+  Props& operator=(Props&& rhs) noexcept = default;
+
+  /**
+   * @brief Make props of the shared names, values are in the order of names
+   */
+  Props(std::shared_ptr<const PropNames> names, std::vector<Value> values);
+
+  Props(std::initializer_list<std::pair<const std::string, Value>> kvs);  // NOLINT
+
+  Props(std::unordered_map<std::string, Value> kvs);  // NOLINT
+
+  size_t size() const {
+    return values_.size();
+  }
+
+  bool empty() const {
+    return values_.empty();
+  }
+
+  void clear() {
+    names_.reset();
+    ownedNames_ = nullptr;
+    values_.clear();
+  }
+
+  void reserve(size_t size);
+
+  iterator begin() {
+    return iterator(this, 0);
+  }
+
+  iterator end() {
+    return iterator(this, values_.size());
+  }
+
+  const_iterator begin() const {
+    return const_iterator(this, 0);
+  }
+
+  const_iterator end() const {
+    return const_iterator(this, values_.size());
+  }
+
+  const_iterator cbegin() const {
+    return begin();
+  }
+
+  const_iterator cend() const {
+    return end();
+  }
+
+  iterator find(folly::StringPiece name) {
+    auto i = indexOf(name);
+    return i < 0 ? end() : iterator(this, i);
+  }
+
+  const_iterator find(folly::StringPiece name) const {
+    auto i = indexOf(name);
+    return i < 0 ? end() : const_iterator(this, i);
+  }
+
+  size_t count(folly::StringPiece name) const {
+    return indexOf(name) < 0 ? 0 : 1;
+  }
+
+  /**
+   * @brief Value of name, throw std::out_of_range if not found
+   */
+  Value& at(folly::StringPiece name);
+  const Value& at(folly::StringPiece name) const;
+
+  /**
+   * @brief Value of name, an empty value is inserted if not found
+   */
+  Value& operator[](folly::StringPiece name);
+
+  /**
+   * @brief Insert value of name if not found
+   *
+   * @return std::pair<iterator, bool> The value of name, and whether it's inserted
+   */
+  std::pair<iterator, bool> emplace(std::string name, Value value);
+
+  std::pair<iterator, bool> insert(std::pair<std::string, Value> kv) {
+    return emplace(std::move(kv.first), std::move(kv.second));
+  }
+
+  size_t erase(folly::StringPiece name);
+
+  // The shared names, maybe null if empty
+  const std::shared_ptr<const PropNames>& names() const {
+    return names_;
+  }
+
+  // The values in the order of names
+  const std::vector<Value>& values() const {
+    return values_;
+  }
+
+  /**
+   * @brief Build a map of the props
+   */
+  std::unordered_map<std::string, Value> toMap() const;
+
+  // Equal if the same names have the same values, regardless of the order
+  bool operator==(const Props& rhs) const;
+
+  bool operator!=(const Props& rhs) const {
+    return !(*this == rhs);
+  }
+
+ private:
+  int64_t indexOf(folly::StringPiece name) const {
+    return names_ == nullptr ? -1 : names_->indexOf(name);
+  }
+
+  // The names owned by this only, copied if shared
+  PropNames* mutableNames();
+
+  std::shared_ptr<const PropNames> names_;
+  // The names created by this as non-const, valid only if it's names_ itself
+  PropNames* ownedNames_{nullptr};
+  std::vector<Value> values_;
+};
+
+}  // namespace nebula
+#endif  // COMMON_DATATYPES_PROPS_H_
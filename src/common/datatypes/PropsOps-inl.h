@@ -0,0 +1,79 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_DATATYPES_PROPSOPS_H_
+#define COMMON_DATATYPES_PROPSOPS_H_
+
+#include <thrift/lib/cpp/protocol/TProtocolException.h>
+#include <thrift/lib/cpp2/GeneratedCodeHelper.h>
+
+#include "common/base/Base.h"
+#include "common/datatypes/CommonCpp2Ops.h"
+#include "common/datatypes/Props.h"
+
+namespace apache {
+namespace thrift {
+namespace detail {
+
+/**
+ * @brief Ops of Props, which is serialized as map<binary, Value> as before
+ */
+struct PropsOps {
+  template <class Protocol>
+  static uint32_t write(Protocol* proto, const nebula::Props& props) {
+    uint32_t xfer = 0;
+    xfer += proto->writeMapBegin(protocol::T_STRING, protocol::T_STRUCT, props.size());
+    for (const auto& kv : props) {
+      xfer += proto->writeBinary(kv.first);
+      xfer += Cpp2Ops<nebula::Value>::write(proto, &kv.second);
+    }
+    xfer += proto->writeMapEnd();
+    return xfer;
+  }
+
+  template <class Protocol>
+  static void read(Protocol* proto, nebula::Props& props) {
+    props.clear();
+    protocol::TType keyType;
+    protocol::TType valueType;
+    uint32_t size = 0;
+    proto->readMapBegin(keyType, valueType, size);
+    // The sizes are omitted by some protocols, e.g. json
+    bool sizeUnknown = proto->kOmitsContainerSizes();
+    if (!sizeUnknown && size > 0 &&
+        (keyType != protocol::T_STRING || valueType != protocol::T_STRUCT)) {
+      throw protocol::TProtocolException(protocol::TProtocolException::INVALID_DATA,
+                                         "Bad types of props map");
+    }
+    if (!sizeUnknown) {
+      props.reserve(size);
+    }
+    for (uint32_t i = 0; sizeUnknown ? proto->peekMap() : i < size; ++i) {
+      std::string name;
+      nebula::Value value;
+      proto->readBinary(name);
+      Cpp2Ops<nebula::Value>::read(proto, &value);
+      props.emplace(std::move(name), std::move(value));
+    }
+    proto->readMapEnd();
+  }
+
+  template <class Protocol>
+  static uint32_t serializedSize(const Protocol* proto, const nebula::Props& props) {
+    uint32_t xfer = 0;
+    xfer += proto->serializedSizeMapBegin(protocol::T_STRING, protocol::T_STRUCT, props.size());
+    for (const auto& kv : props) {
+      xfer += proto->serializedSizeBinary(kv.first);
+      xfer += Cpp2Ops<nebula::Value>::serializedSize(proto, &kv.second);
+    }
+    xfer += proto->serializedSizeMapEnd();
+    return xfer;
+  }
+};
+
+}  // namespace detail
+}  // namespace thrift
+}  // namespace apache
+#endif  // COMMON_DATATYPES_PROPSOPS_H_
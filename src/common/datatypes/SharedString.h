@@ -0,0 +1,112 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_DATATYPES_SHAREDSTRING_H_
+#define COMMON_DATATYPES_SHAREDSTRING_H_
+
+#include <atomic>
+#include <string>
+
+namespace nebula {
+
+/**
+ * @brief A string shared by reference count, the storage of string Value. Copying it only
+ * increases the count, so copies of vids and property values across rows don't allocate. It's
+ * copied on write when shared. It has the size of a pointer and could be relocated by memcpy.
+ *
+ * A reference returned by str() refers to the shared block rather than to this SharedString. Once
+ * mutableStr() copies the shared string, or this is assigned or moved out, the reference still
+ * refers to the old block and dangles when the other owners release it. So don't keep it across
+ * writes to the string.
+ */
+class SharedString final {
+ public:
+  SharedString() = default;
+
+  explicit SharedString(std::string str) : block_(new Block(std::move(str))) {}
+
+  SharedString(const SharedString& rhs) noexcept : block_(rhs.block_) {
+    if (block_ != nullptr) {
+      block_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  SharedString(SharedString&& rhs) noexcept : block_(rhs.block_) {
+    rhs.block_ = nullptr;
+  }
+
+  SharedString& operator=(const SharedString& rhs) noexcept {
+    SharedString tmp(rhs);
+    std::swap(block_, tmp.block_);
+    return *this;
+  }
+
+  SharedString& operator=(SharedString&& rhs) noexcept {
+    std::swap(block_, rhs.block_);
+    return *this;
+  }
+
+  ~SharedString() {
+    release();
+  }
+
+  bool empty() const {
+    return block_ == nullptr;
+  }
+
+  const std::string& str() const {
+    return block_->str;
+  }
+
+  /**
+   * @brief Get the string to modify, it's copied first if shared with others, then the references
+   * got from str() before don't refer to the string of this any more
+   */
+  std::string& mutableStr() {
+    if (block_->refs.load(std::memory_order_acquire) != 1) {
+      auto* copy = new Block(block_->str);
+      release();
+      block_ = copy;
+    }
+    return block_->str;
+  }
+
+  /**
+   * @brief Move out the string if not shared, otherwise copy it, then this becomes empty
+   */
+  std::string moveStr() {
+    std::string ret = block_->refs.load(std::memory_order_acquire) == 1 ? std::move(block_->str)
+                                                                        : block_->str;
+    release();
+    return ret;
+  }
+
+  // The number of SharedString of the string, for test
+  size_t useCount() const {
+    return block_ == nullptr ? 0 : block_->refs.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Block {
+    explicit Block(std::string s) : str(std::move(s)) {}
+
+    std::atomic<uint32_t> refs{1};
+    std::string str;
+  };
+
+  void release() {
+    if (block_ != nullptr && block_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete block_;
+    }
+    block_ = nullptr;
+  }
+
+  Block* block_{nullptr};
+};
+
+static_assert(sizeof(SharedString) == sizeof(void*), "SharedString should be a pointer");
+
+}  // namespace nebula
+#endif  // COMMON_DATATYPES_SHAREDSTRING_H_
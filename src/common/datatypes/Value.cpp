@@ -66,7 +66,7 @@ Value::Value(const Value& rhs) : type_(Value::Type::__EMPTY__) {
       break;
     }
     case Type::STRING: {
-      setS(*rhs.value_.sVal);
+      setS(rhs.value_.sVal);
       break;
     }
     case Type::DATE: {
@@ -192,6 +192,14 @@ Value::Value(const char* v) {
   setS(v);
 }
 
+Value::Value(const SharedString& v) {
+  setS(v);
+}
+
+Value::Value(SharedString&& v) {
+  setS(std::move(v));
+}
+
 Value::Value(const Date& v) {
   setD(v);
 }
@@ -425,6 +433,18 @@ void Value::setStr(const char* v) {
   setS(v);
 }
 
+void Value::setStr(const SharedString& v) {
+  // v may be the string of this value
+  SharedString str(v);
+  clear();
+  setS(std::move(str));
+}
+
+void Value::setStr(SharedString&& v) {
+  clear();
+  setS(std::move(v));
+}
+
 void Value::setDate(const Date& v) {
   clear();
   setD(v);
@@ -597,7 +617,12 @@ const double& Value::getFloat() const {
 
 const std::string& Value::getStr() const {
   CHECK_EQ(type_, Type::STRING);
-  return *value_.sVal;
+  return value_.sVal.str();
+}
+
+const SharedString& Value::getSharedStr() const {
+  CHECK_EQ(type_, Type::STRING);
+  return value_.sVal;
 }
 
 const Date& Value::getDate() const {
@@ -727,7 +752,7 @@ double& Value::mutableFloat() {
 
 std::string& Value::mutableStr() {
   CHECK_EQ(type_, Type::STRING);
-  return *value_.sVal;
+  return value_.sVal.mutableStr();
 }
 
 Date& Value::mutableDate() {
@@ -820,7 +845,7 @@ double Value::moveFloat() {
 
 std::string Value::moveStr() {
   CHECK_EQ(type_, Type::STRING);
-  std::string v = std::move(*value_.sVal);
+  std::string v = value_.sVal.moveStr();
   clear();
   return v;
 }
@@ -1098,7 +1123,7 @@ Value& Value::operator=(const Value& rhs) {
       break;
     }
     case Type::STRING: {
-      setS(*rhs.value_.sVal);
+      setS(rhs.value_.sVal);
       break;
     }
     case Type::DATE: {
@@ -1198,24 +1223,31 @@ void Value::setF(double&& v) {
   new (std::addressof(value_.fVal)) double(std::move(v));  // NOLINT
 }
 
-void Value::setS(std::unique_ptr<std::string> v) {
+void Value::setS(const SharedString& v) {
+  DCHECK(!v.empty());
+  type_ = Type::STRING;
+  new (std::addressof(value_.sVal)) SharedString(v);
+}
+
+void Value::setS(SharedString&& v) {
+  DCHECK(!v.empty());
   type_ = Type::STRING;
-  new (std::addressof(value_.sVal)) std::unique_ptr<std::string>(std::move(v));
+  new (std::addressof(value_.sVal)) SharedString(std::move(v));
 }
 
 void Value::setS(const std::string& v) {
   type_ = Type::STRING;
-  new (std::addressof(value_.sVal)) std::unique_ptr<std::string>(new std::string(v));
+  new (std::addressof(value_.sVal)) SharedString(v);
 }
 
 void Value::setS(std::string&& v) {
   type_ = Type::STRING;
-  new (std::addressof(value_.sVal)) std::unique_ptr<std::string>(new std::string(std::move(v)));
+  new (std::addressof(value_.sVal)) SharedString(std::move(v));
 }
 
 void Value::setS(const char* v) {
   type_ = Type::STRING;
-  new (std::addressof(value_.sVal)) std::unique_ptr<std::string>(new std::string(v));
+  new (std::addressof(value_.sVal)) SharedString(v);
 }
 
 void Value::setD(const Date& v) {
@@ -12,6 +12,7 @@
 
 #include "common/datatypes/Date.h"
 #include "common/datatypes/Duration.h"
+#include "common/datatypes/SharedString.h"
 #include "common/thrift/ThriftTypes.h"
 
 namespace apache {
@@ -110,6 +111,8 @@ struct Value {
   Value(const std::string& v);           // NOLINT
   Value(std::string&& v);                // NOLINT
   Value(const char* v);                  // NOLINT
+  Value(const SharedString& v);          // NOLINT
+  Value(SharedString&& v);               // NOLINT
   Value(const Date& v);                  // NOLINT
   Value(Date&& v);                       // NOLINT
   Value(const Time& v);                  // NOLINT
@@ -250,6 +253,8 @@ struct Value {
   void setStr(const std::string& v);
   void setStr(std::string&& v);
   void setStr(const char* v);
+  void setStr(const SharedString& v);
+  void setStr(SharedString&& v);
   void setDate(const Date& v);
   void setDate(Date&& v);
   void setTime(const Time& v);
@@ -294,7 +299,11 @@ struct Value {
     return value_.iVal;
   }
   const double& getFloat() const;
+  // The string may be shared with copies of this value, don't keep the reference across writes to
+  // this value, see SharedString
   const std::string& getStr() const;
+  // Share the string without copying it
+  const SharedString& getSharedStr() const;
   const Date& getDate() const;
   const Time& getTime() const;
   const DateTime& getDateTime() const;
@@ -339,6 +348,7 @@ struct Value {
   bool& mutableBool();
   int64_t& mutableInt();
   double& mutableFloat();
+  // Copy the string first if it's shared with copies of this value
   std::string& mutableStr();
   Date& mutableDate();
   Time& mutableTime();
@@ -385,7 +395,7 @@ struct Value {
     bool bVal;
     int64_t iVal;
     double fVal;
-    std::unique_ptr<std::string> sVal;
+    SharedString sVal;
     Date dVal;
     Time tVal;
     DateTime dtVal;
@@ -424,7 +434,8 @@ struct Value {
   void setS(const std::string& v);
   void setS(std::string&& v);
   void setS(const char* v);
-  void setS(std::unique_ptr<std::string> v);
+  void setS(const SharedString& v);
+  void setS(SharedString&& v);
   // Date value
   void setD(const Date& v);
   void setD(Date&& v);
@@ -12,6 +12,7 @@
 
 #include "common/base/Base.h"
 #include "common/datatypes/CommonCpp2Ops.h"
+#include "common/datatypes/PropsOps-inl.h"
 #include "common/datatypes/Vertex.h"
 
 namespace apache {
@@ -55,9 +56,7 @@ uint32_t Cpp2Ops<nebula::Tag>::write(Protocol* proto, nebula::Tag const* obj) {
   xfer += proto->writeFieldEnd();
 
   xfer += proto->writeFieldBegin("props", apache::thrift::protocol::T_MAP, 2);
-  xfer += detail::pm::protocol_methods<
-      type_class::map<type_class::binary, type_class::structure>,
-      std::unordered_map<std::string, nebula::Value>>::write(*proto, obj->props);
+  xfer += detail::PropsOps::write(proto, obj->props);
   xfer += proto->writeFieldEnd();
 
   xfer += proto->writeFieldStop();
@@ -84,10 +83,7 @@ _readField_name : { proto->readBinary(obj->name); }
   }
 
 _readField_props : {
-  obj->props = std::unordered_map<std::string, nebula::Value>();
-  detail::pm::protocol_methods<type_class::map<type_class::binary, type_class::structure>,
-                               std::unordered_map<std::string, nebula::Value>>::read(*proto,
-                                                                                     obj->props);
+  detail::PropsOps::read(proto, obj->props);
 }
 
   if (UNLIKELY(!readState.advanceToNextField(proto, 2, 0, protocol::T_STOP))) {
@@ -143,9 +139,7 @@ uint32_t Cpp2Ops<nebula::Tag>::serializedSize(Protocol const* proto, nebula::Tag
   xfer += proto->serializedSizeBinary(obj->name);
 
   xfer += proto->serializedFieldSize("props", apache::thrift::protocol::T_MAP, 2);
-  xfer += detail::pm::protocol_methods<
-      type_class::map<type_class::binary, type_class::structure>,
-      std::unordered_map<std::string, nebula::Value>>::serializedSize<false>(*proto, obj->props);
+  xfer += detail::PropsOps::serializedSize(proto, obj->props);
 
   xfer += proto->serializedSizeStop();
   return xfer;
@@ -160,9 +154,7 @@ uint32_t Cpp2Ops<nebula::Tag>::serializedSizeZC(Protocol const* proto, nebula::T
   xfer += proto->serializedSizeZCBinary(obj->name);
 
   xfer += proto->serializedFieldSize("props", apache::thrift::protocol::T_MAP, 2);
-  xfer += detail::pm::protocol_methods<
-      type_class::map<type_class::binary, type_class::structure>,
-      std::unordered_map<std::string, nebula::Value>>::serializedSize<false>(*proto, obj->props);
+  xfer += detail::PropsOps::serializedSize(proto, obj->props);
 
   xfer += proto->serializedSizeStop();
   return xfer;
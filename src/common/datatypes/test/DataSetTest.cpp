@@ -4,9 +4,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
 
 #include "common/base/Base.h"
+#include "common/datatypes/CommonCpp2Ops.h"
 #include "common/datatypes/DataSet.h"
+#include "common/datatypes/ValueOps-inl.h"
 
 TEST(DataSetTest, Basic) {
   nebula::DataSet data({"col1", "col2", "col3"});
@@ -39,6 +42,58 @@ TEST(DataSetTest, Basic) {
   EXPECT_EQ(data, data4);
 }
 
+template <class Protocol>
+std::string writeRows(const std::vector<nebula::Row>& rows, bool generic) {
+  Protocol writer;
+  folly::IOBufQueue queue;
+  writer.setOutput(&queue);
+  if (generic) {
+    apache::thrift::detail::pm::protocol_methods<
+        apache::thrift::type_class::list<apache::thrift::type_class::structure>,
+        std::vector<nebula::Row>>::write(writer, rows);
+  } else {
+    apache::thrift::detail::DataSetRowsOps::write(&writer, rows);
+  }
+  return queue.move()->moveToFbString().toStdString();
+}
+
+template <class Protocol>
+void checkRows(const std::vector<nebula::Row>& rows) {
+  // The same output as the generic serialization of rows
+  EXPECT_EQ(writeRows<Protocol>(rows, true), writeRows<Protocol>(rows, false));
+  Protocol writer;
+  auto size = apache::thrift::detail::pm::protocol_methods<
+      apache::thrift::type_class::list<apache::thrift::type_class::structure>,
+      std::vector<nebula::Row>>::serializedSize<false>(writer, rows);
+  EXPECT_EQ(size, apache::thrift::detail::DataSetRowsOps::serializedSize(&writer, rows));
+}
+
+TEST(DataSetTest, Serialize) {
+  using ColumnKind = apache::thrift::detail::DataSetRowsOps::ColumnKind;
+  nebula::DataSet data({"int", "str", "null", "mixed"});
+  for (int64_t i = 0; i < 100; ++i) {
+    nebula::Value mixed = i % 2 == 0 ? nebula::Value(i) : nebula::Value("mixed");
+    data.emplace_back(
+        nebula::Row({i * 1000, std::string(i, 'a'), nebula::Value::kNullValue, mixed}));
+  }
+  EXPECT_EQ(std::vector<ColumnKind>(
+                {ColumnKind::kInt, ColumnKind::kString, ColumnKind::kNull, ColumnKind::kMixed}),
+            apache::thrift::detail::DataSetRowsOps::columnKinds(data.rows));
+  checkRows<apache::thrift::CompactProtocolWriter>(data.rows);
+  checkRows<apache::thrift::BinaryProtocolWriter>(data.rows);
+
+  std::string buf;
+  apache::thrift::CompactSerializer::serialize(data, &buf);
+  nebula::DataSet decoded;
+  apache::thrift::CompactSerializer::deserialize(buf, decoded);
+  EXPECT_EQ(data, decoded);
+
+  // Rows of different sizes are written by the generic path
+  data.emplace_back(nebula::Row({1}));
+  EXPECT_TRUE(apache::thrift::detail::DataSetRowsOps::columnKinds(data.rows).empty());
+  checkRows<apache::thrift::CompactProtocolWriter>(data.rows);
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   folly::init(&argc, &argv, true);
@@ -104,4 +104,63 @@ TEST(Edge, hashEdge) {
   EXPECT_NE(edge1, edge5);
 }
 
+TEST(Edge, Props) {
+  auto names = std::make_shared<const PropNames>(std::vector<std::string>{"name", "age"});
+  Edge edge1(0, 1, 1, "like", 0, Props(names, {"Tim", 18}));
+  Edge edge2(0, 1, 1, "like", 0, Props(names, {"Tony", 20}));
+  // The names are shared
+  EXPECT_EQ(edge1.props.names(), edge2.props.names());
+  EXPECT_EQ(Value("Tim"), edge1.props.at("name"));
+  EXPECT_EQ(Value(20), edge2.props.find("age")->second);
+  EXPECT_TRUE(edge1.props.find("likeness") == edge1.props.end());
+  EXPECT_EQ(0, edge1.props.count("likeness"));
+  EXPECT_NE(edge1, edge2);
+
+  // The names are copied on write
+  edge2.props["likeness"] = 90;
+  EXPECT_NE(edge1.props.names(), edge2.props.names());
+  EXPECT_EQ(2, names->size());
+  EXPECT_EQ(3, edge2.props.size());
+  EXPECT_FALSE(edge2.props.emplace("likeness", 80).second);
+  EXPECT_EQ(Value(90), edge2.props.at("likeness"));
+  EXPECT_EQ(1, edge2.props.erase("likeness"));
+  EXPECT_EQ(2, edge2.props.size());
+
+  // The names made by others are copied even if not shared any more
+  Props sole(std::make_shared<const PropNames>(std::vector<std::string>{"name"}), {"Tim"});
+  const auto* constNames = sole.names().get();
+  sole.emplace("age", 18);
+  EXPECT_NE(constNames, sole.names().get());
+  // The names made by this are written in place if not shared
+  const auto* ownedNames = sole.names().get();
+  sole.emplace("likeness", 90);
+  EXPECT_EQ(ownedNames, sole.names().get());
+  Props copied = sole;
+  copied.emplace("start", 2020);
+  EXPECT_NE(sole.names(), copied.names());
+  EXPECT_EQ(3, sole.size());
+  EXPECT_EQ(4, copied.size());
+
+  // Equal regardless of the order of names
+  Edge edge3(0, 1, 1, "like", 0, {{"age", 18}, {"name", "Tim"}});
+  EXPECT_EQ(edge1, edge3);
+  std::unordered_map<std::string, Value> expected = {{"name", "Tim"}, {"age", 18}};
+  EXPECT_EQ(expected, edge3.props.toMap());
+  std::unordered_map<std::string, Value> kvs;
+  for (const auto& kv : edge1.props) {
+    kvs.emplace(kv.first, kv.second);
+  }
+  EXPECT_EQ(expected, kvs);
+
+  // The names are looked up by index when there are many
+  Props props;
+  for (size_t i = 0; i < 2 * PropNames::kIndexThreshold; ++i) {
+    props.emplace(folly::to<std::string>("p", i), static_cast<int64_t>(i));
+  }
+  for (size_t i = 0; i < 2 * PropNames::kIndexThreshold; ++i) {
+    EXPECT_EQ(Value(static_cast<int64_t>(i)), props.at(folly::to<std::string>("p", i)));
+  }
+  EXPECT_THROW(props.at("p"), std::out_of_range);
+}
+
 }  // namespace nebula
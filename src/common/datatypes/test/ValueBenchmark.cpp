@@ -111,6 +111,37 @@ BENCHMARK(HashIntValue, n) {
   }
 }
 
+BENCHMARK_DRAW_LINE();
+
+// Copy rows of fixed-string vids, e.g. expand the vids to their neighbors
+BENCHMARK(CopyStringValue, n) {
+  std::vector<Value> values;
+  BENCHMARK_SUSPEND {
+    values.reserve(1000);
+    for (size_t i = 0; i < 1000; i++) {
+      values.emplace_back(randomString(random(8, 32)));
+    }
+  }
+  for (size_t i = 0; i < n; i++) {
+    std::vector<Value> copies(values);
+    folly::doNotOptimizeAway(copies);
+  }
+}
+
+BENCHMARK_RELATIVE(CopyStdString, n) {
+  std::vector<std::string> values;
+  BENCHMARK_SUSPEND {
+    values.reserve(1000);
+    for (size_t i = 0; i < 1000; i++) {
+      values.emplace_back(randomString(random(8, 32)));
+    }
+  }
+  for (size_t i = 0; i < n; i++) {
+    std::vector<std::string> copies(values);
+    folly::doNotOptimizeAway(copies);
+  }
+}
+
 int main() {
   folly::runBenchmarks();
   return 0;
@@ -12,6 +12,7 @@
 #include "common/datatypes/Date.h"
 #include "common/datatypes/Edge.h"
 #include "common/datatypes/Geography.h"
+#include "common/datatypes/KeyHash.h"
 #include "common/datatypes/List.h"
 #include "common/datatypes/Map.h"
 #include "common/datatypes/Path.h"
@@ -1709,6 +1710,42 @@ TEST(Value, DedupByConstRowPointer) {
   ASSERT_EQ(unique.size(), 1);
 }
 
+TEST(Value, DedupByKeyHash) {
+  std::vector<Row> rows;
+  for (size_t i = 0; i < 10; i++) {
+    Row row;
+    row.emplace_back(Value("nebula"));
+    row.emplace_back(Value(static_cast<int64_t>(i % 3)));
+    row.emplace_back(Value(i % 2 == 0 ? Value::kNullValue : Value(1.5)));
+    rows.emplace_back(std::move(row));
+  }
+
+  robin_hood::unordered_flat_set<const Row*, ListKeyHash, ListKeyEqual> unique;
+  for (const auto& row : rows) {
+    unique.emplace(&row);
+  }
+  ASSERT_EQ(unique.size(), 6);
+
+  robin_hood::unordered_flat_set<Value, ValueKeyHash, ValueKeyEqual> values;
+  for (const auto& row : rows) {
+    for (const auto& value : row.values) {
+      values.emplace(value);
+    }
+  }
+  ASSERT_EQ(values.size(), 6);
+  EXPECT_EQ(1, values.count(Value("nebula")));
+  EXPECT_EQ(1, values.count(Value(static_cast<int64_t>(2))));
+  EXPECT_EQ(1, values.count(Value::kNullValue));
+
+  // Long strings are hashed by lanes
+  std::string str(100, 'a');
+  EXPECT_EQ(ValueKeyHash()(Value(str)), ValueKeyHash()(Value(str)));
+  auto other = str;
+  other.back() = 'b';
+  EXPECT_NE(ValueKeyHash()(Value(str)), ValueKeyHash()(Value(other)));
+  EXPECT_FALSE(ValueKeyEqual()(Value(str), Value(other)));
+}
+
 TEST(Value, Hash) {
   {
     std::vector<Row> rows;
@@ -1775,6 +1812,43 @@ TEST(Value, Hash) {
   }
 }
 
+TEST(Value, SharedString) {
+  // copies share the string
+  Value v1("hello");
+  Value v2(v1);
+  EXPECT_EQ(2, v1.getSharedStr().useCount());
+  EXPECT_EQ(&v1.getStr(), &v2.getStr());
+  EXPECT_EQ(v1, v2);
+
+  // copy on write
+  v2.mutableStr().append(" world");
+  EXPECT_EQ("hello", v1.getStr());
+  EXPECT_EQ("hello world", v2.getStr());
+  EXPECT_EQ(1, v1.getSharedStr().useCount());
+  EXPECT_EQ(1, v2.getSharedStr().useCount());
+
+  // move out the shared string copies it
+  Value v3(v1);
+  EXPECT_EQ("hello", v3.moveStr());
+  EXPECT_TRUE(v3.empty());
+  EXPECT_EQ("hello", v1.getStr());
+  EXPECT_EQ("hello", v1.moveStr());
+
+  // set the string of itself
+  v2.setStr(v2.getSharedStr());
+  EXPECT_EQ("hello world", v2.getStr());
+
+  // the reference got before copy on write refers to the string shared with the copy
+  Value v4("vid");
+  Value v5(v4);
+  const auto& shared = v5.getStr();
+  v5.mutableStr() = "other";
+  EXPECT_EQ(&shared, &v4.getStr());
+  EXPECT_EQ("vid", shared);
+  EXPECT_EQ("other", v5.getStr());
+  EXPECT_EQ(std::hash<Value>()(v4), std::hash<Value>()(Value("vid")));
+}
+
 }  // namespace nebula
 
 int main(int argc, char** argv) {
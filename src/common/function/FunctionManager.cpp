@@ -1885,7 +1885,7 @@ FunctionManager::FunctionManager() {
         }
         case Value::Type::EDGE: {
           Map props;
-          props.kvs = args[0].get().getEdge().props;
+          props.kvs = args[0].get().getEdge().props.toMap();
           return Value(std::move(props));
         }
         case Value::Type::MAP: {
@@ -2142,14 +2142,14 @@ FunctionManager::FunctionManager() {
         }
         case Value::Type::VERTEX: {
           for (auto &tag : args[0].get().getVertex().tags) {
-            for (auto &prop : tag.props) {
+            for (const auto &prop : tag.props) {
               tmp.emplace(prop.first);
             }
           }
           break;
         }
         case Value::Type::EDGE: {
-          for (auto &prop : args[0].get().getEdge().props) {
+          for (const auto &prop : args[0].get().getEdge().props) {
             tmp.emplace(prop.first);
           }
           break;
@@ -184,6 +184,7 @@
                                                                               \
   X(E_PLAN_IS_KILLED, -3060)                                                  \
   X(E_CLIENT_SERVER_INCOMPATIBLE, -3061)                                      \
+  X(E_MEMORY_QUOTA_EXCEEDED, -3063)                                           \
                                                                               \
   X(E_UNKNOWN, -8000)
 
@@ -0,0 +1,417 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "common/http/AsyncHttpClient.h"
+
+#include <folly/executors/thread_factory/NamedThreadFactory.h>
+#include <folly/io/IOBufQueue.h>
+#include <folly/io/async/HHWheelTimer.h>
+#include <folly/io/async/SSLContext.h>
+#include <proxygen/lib/http/HTTPConnector.h>
+#include <proxygen/lib/http/session/HTTPTransaction.h>
+#include <proxygen/lib/http/session/HTTPUpstreamSession.h>
+#include <proxygen/lib/utils/URL.h>
+
+DEFINE_int32(http_client_timeout_ms,
+             10000,
+             "Timeout of connecting and of waiting for response in http client");
+DEFINE_int32(http_client_max_idle_conns,
+             8,
+             "Max idle connections kept alive for each endpoint in each io thread of http client");
+DEFINE_int32(http_client_io_threads,
+             2,
+             "Number of io threads of the http client shared in process");
+
+namespace nebula {
+namespace http {
+
+struct AsyncHttpClient::Request {
+  // scheme://host:port, the connections are pooled by it
+  std::string endpoint;
+  std::string host;
+  uint16_t port{0};
+  bool secure{false};
+  proxygen::HTTPMessage message;
+  std::unique_ptr<folly::IOBuf> body;
+  folly::Promise<StatusOr<HttpResponse>> promise;
+};
+
+/**
+ * @brief Idle connections of one io thread, all methods are called in the io thread
+ */
+class AsyncHttpClient::SessionPool final : public proxygen::HTTPSessionBase::InfoCallback {
+ public:
+  SessionPool(AsyncHttpClient* client, folly::EventBase* evb)
+      : client_(client),
+        evb_(evb),
+        timer_(folly::HHWheelTimer::newTimer(
+            evb,
+            std::chrono::milliseconds(folly::HHWheelTimer::DEFAULT_TICK_INTERVAL),
+            folly::AsyncTimeout::InternalEnum::NORMAL,
+            std::chrono::milliseconds(FLAGS_http_client_timeout_ms))) {}
+
+  ~SessionPool() override {
+    for (auto& entry : idle_) {
+      for (auto* session : entry.second) {
+        session->setInfoCallback(nullptr);
+        session->dropConnection();
+      }
+    }
+  }
+
+  folly::EventBase* evb() const {
+    return evb_;
+  }
+
+  folly::HHWheelTimer* timer() const {
+    return timer_.get();
+  }
+
+  std::shared_ptr<folly::SSLContext> sslContext() {
+    if (sslContext_ == nullptr) {
+      sslContext_ = std::make_shared<folly::SSLContext>();
+      // Same as the former curl -k, servers are not verified
+      sslContext_->setVerificationOption(folly::SSLContext::SSLVerifyPeerEnum::NO_VERIFY);
+    }
+    return sslContext_;
+  }
+
+  /**
+   * @brief Send the request on an idle connection of its endpoint, or on a new one if none
+   */
+  void send(std::unique_ptr<Request> req);
+
+  /**
+   * @brief Send the request on a new connection
+   */
+  void connect(std::unique_ptr<Request> req);
+
+  void onConnected(proxygen::HTTPUpstreamSession* session, std::unique_ptr<Request> req);
+
+  /**
+   * @brief Put the connection back after its transaction is done
+   */
+  void release(const std::string& endpoint, proxygen::HTTPUpstreamSession* session);
+
+  void onDestroy(const proxygen::HTTPSessionBase& session) override;
+
+ private:
+  // Return false and leave the request untouched if the session could not start a transaction
+  bool start(proxygen::HTTPUpstreamSession* session, std::unique_ptr<Request>& req, bool reused);
+
+ private:
+  AsyncHttpClient* client_;
+  folly::EventBase* evb_;
+  folly::HHWheelTimer::UniquePtr timer_;
+  std::shared_ptr<folly::SSLContext> sslContext_;
+  std::unordered_map<std::string, std::vector<proxygen::HTTPUpstreamSession*>> idle_;
+};
+
+class AsyncHttpClient::Connector final : public proxygen::HTTPConnector::Callback {
+ public:
+  Connector(SessionPool* pool, std::unique_ptr<Request> req)
+      : pool_(pool), req_(std::move(req)), connector_(this, pool->timer()) {}
+
+  void connect(const folly::SocketAddress& addr) {
+    auto timeout = std::chrono::milliseconds(FLAGS_http_client_timeout_ms);
+    if (req_->secure) {
+      connector_.connectSSL(pool_->evb(),
+                            addr,
+                            pool_->sslContext(),
+                            nullptr,
+                            timeout,
+                            folly::emptySocketOptionMap,
+                            folly::AsyncSocket::anyAddress(),
+                            req_->host);
+    } else {
+      connector_.connect(pool_->evb(), addr, timeout);
+    }
+  }
+
+  void connectSuccess(proxygen::HTTPUpstreamSession* session) override {
+    pool_->onConnected(session, std::move(req_));
+    destroy();
+  }
+
+  void connectError(const folly::AsyncSocketException& ex) override {
+    req_->promise.setValue(
+        Status::Error("Connect to %s failed: %s", req_->endpoint.c_str(), ex.what()));
+    destroy();
+  }
+
+ private:
+  // The connector could not be deleted in its own callback
+  void destroy() {
+    pool_->evb()->runInLoop([this] { delete this; });
+  }
+
+ private:
+  SessionPool* pool_;
+  std::unique_ptr<Request> req_;
+  proxygen::HTTPConnector connector_;
+};
+
+class AsyncHttpClient::Transaction final : public proxygen::HTTPTransactionHandler {
+ public:
+  Transaction(SessionPool* pool,
+              proxygen::HTTPUpstreamSession* session,
+              std::unique_ptr<Request> req,
+              bool reused)
+      : pool_(pool),
+        session_(session),
+        endpoint_(req->endpoint),
+        req_(std::move(req)),
+        reused_(reused) {}
+
+  std::unique_ptr<Request> release() {
+    return std::move(req_);
+  }
+
+  void send() {
+    txn_->setIdleTimeout(std::chrono::milliseconds(FLAGS_http_client_timeout_ms));
+    txn_->sendHeaders(req_->message);
+    if (req_->body != nullptr) {
+      // Keep the body in case of resending
+      txn_->sendBody(req_->body->clone());
+    }
+    txn_->sendEOM();
+  }
+
+  void setTransaction(proxygen::HTTPTransaction* txn) noexcept override {
+    txn_ = txn;
+  }
+
+  void detachTransaction() noexcept override {
+    if (req_ != nullptr && !finished_) {
+      finish(Status::Error("Request to %s is aborted", endpoint_.c_str()));
+    }
+    pool_->release(endpoint_, session_);
+    delete this;
+  }
+
+  void onHeadersComplete(std::unique_ptr<proxygen::HTTPMessage> msg) noexcept override {
+    headersReceived_ = true;
+    statusCode_ = msg->getStatusCode();
+  }
+
+  void onBody(std::unique_ptr<folly::IOBuf> chain) noexcept override {
+    body_.append(std::move(chain));
+  }
+
+  void onTrailers(std::unique_ptr<proxygen::HTTPHeaders>) noexcept override {}
+
+  void onEOM() noexcept override {
+    HttpResponse resp;
+    resp.statusCode = statusCode_;
+    auto body = body_.move();
+    if (body != nullptr) {
+      resp.body = body->moveToFbString().toStdString();
+    }
+    finish(std::move(resp));
+  }
+
+  void onUpgrade(proxygen::UpgradeProtocol) noexcept override {}
+
+  void onError(const proxygen::HTTPException& error) noexcept override {
+    if (finished_) {
+      return;
+    }
+    if (reused_ && !headersReceived_) {
+      // The pooled connection may have been closed by server, resend once on a new connection
+      VLOG(2) << "Request to " << endpoint_ << " failed on a pooled connection: " << error.what()
+              << ", resend it";
+      finished_ = true;
+      pool_->connect(std::move(req_));
+      return;
+    }
+    finish(Status::Error("Request to %s failed: %s", endpoint_.c_str(), error.what()));
+  }
+
+  void onEgressPaused() noexcept override {}
+
+  void onEgressResumed() noexcept override {}
+
+ private:
+  void finish(StatusOr<HttpResponse> result) {
+    finished_ = true;
+    req_->promise.setValue(std::move(result));
+  }
+
+ private:
+  SessionPool* pool_;
+  proxygen::HTTPUpstreamSession* session_;
+  std::string endpoint_;
+  std::unique_ptr<Request> req_;
+  bool reused_;
+  proxygen::HTTPTransaction* txn_{nullptr};
+  bool headersReceived_{false};
+  bool finished_{false};
+  int32_t statusCode_{0};
+  folly::IOBufQueue body_{folly::IOBufQueue::cacheChainLength()};
+};
+
+void AsyncHttpClient::SessionPool::send(std::unique_ptr<Request> req) {
+  auto iter = idle_.find(req->endpoint);
+  while (iter != idle_.end() && !iter->second.empty()) {
+    auto* session = iter->second.back();
+    iter->second.pop_back();
+    if (start(session, req, true)) {
+      return;
+    }
+    session->closeWhenIdle();
+  }
+  connect(std::move(req));
+}
+
+void AsyncHttpClient::SessionPool::connect(std::unique_ptr<Request> req) {
+  folly::SocketAddress addr;
+  try {
+    addr.setFromHostPort(req->host, req->port);
+  } catch (const std::exception& e) {
+    req->promise.setValue(
+        Status::Error("Resolve %s failed: %s", req->endpoint.c_str(), e.what()));
+    return;
+  }
+  auto* connector = new Connector(this, std::move(req));
+  connector->connect(addr);
+}
+
+void AsyncHttpClient::SessionPool::onConnected(proxygen::HTTPUpstreamSession* session,
+                                               std::unique_ptr<Request> req) {
+  client_->numConnections_++;
+  session->setInfoCallback(this);
+  if (!start(session, req, false)) {
+    req->promise.setValue(
+        Status::Error("Failed to start request to %s", req->endpoint.c_str()));
+    session->dropConnection();
+  }
+}
+
+bool AsyncHttpClient::SessionPool::start(proxygen::HTTPUpstreamSession* session,
+                                         std::unique_ptr<Request>& req,
+                                         bool reused) {
+  if (!session->isReusable()) {
+    return false;
+  }
+  auto* handler = new Transaction(this, session, std::move(req), reused);
+  if (session->newTransaction(handler) == nullptr) {
+    req = handler->release();
+    delete handler;
+    return false;
+  }
+  handler->send();
+  return true;
+}
+
+void AsyncHttpClient::SessionPool::release(const std::string& endpoint,
+                                           proxygen::HTTPUpstreamSession* session) {
+  if (!session->isReusable()) {
+    // It will be closed by itself
+    return;
+  }
+  auto& sessions = idle_[endpoint];
+  if (sessions.size() >= static_cast<size_t>(FLAGS_http_client_max_idle_conns)) {
+    session->closeWhenIdle();
+    return;
+  }
+  sessions.emplace_back(session);
+}
+
+void AsyncHttpClient::SessionPool::onDestroy(const proxygen::HTTPSessionBase& session) {
+  for (auto& entry : idle_) {
+    auto& sessions = entry.second;
+    sessions.erase(std::remove_if(sessions.begin(),
+                                  sessions.end(),
+                                  [&session](proxygen::HTTPUpstreamSession* s) {
+                                    return static_cast<proxygen::HTTPSessionBase*>(s) == &session;
+                                  }),
+                   sessions.end());
+  }
+}
+
+AsyncHttpClient::AsyncHttpClient(std::shared_ptr<folly::IOThreadPoolExecutor> ioThreadPool)
+    : ioThreadPool_(std::move(ioThreadPool)) {
+  for (auto& evb : ioThreadPool_->getAllEventBases()) {
+    auto* base = evb.get();
+    pools_.emplace(base, nullptr);
+  }
+  // The timers must be created in their own threads
+  for (auto& entry : pools_) {
+    auto* evb = entry.first;
+    evb->runInEventBaseThreadAndWait(
+        [this, evb, &entry] { entry.second = std::make_unique<SessionPool>(this, evb); });
+  }
+}
+
+AsyncHttpClient::~AsyncHttpClient() {
+  for (auto& entry : pools_) {
+    entry.first->runInEventBaseThreadAndWait([&entry] { entry.second.reset(); });
+  }
+}
+
+AsyncHttpClient& AsyncHttpClient::instance() {
+  // Leaked on purpose, it may be still used when static objects are destroyed
+  static auto* client = new AsyncHttpClient(std::make_shared<folly::IOThreadPoolExecutor>(
+      FLAGS_http_client_io_threads, std::make_shared<folly::NamedThreadFactory>("http-client")));
+  return *client;
+}
+
+folly::Future<StatusOr<HttpResponse>> AsyncHttpClient::request(proxygen::HTTPMethod method,
+                                                               const std::string& url,
+                                                               const Headers& headers,
+                                                               std::unique_ptr<folly::IOBuf> body) {
+  proxygen::URL parsed(url);
+  if (!parsed.isValid() || !parsed.hasHost()) {
+    return folly::makeFuture<StatusOr<HttpResponse>>(
+        Status::Error("Invalid url: %s", url.c_str()));
+  }
+  auto req = std::make_unique<Request>();
+  req->host = parsed.getHost();
+  req->port = parsed.getPort();
+  req->secure = parsed.isSecure();
+  req->endpoint = parsed.getScheme() + "://" + parsed.getHostAndPort();
+
+  auto& msg = req->message;
+  msg.setMethod(method);
+  msg.setHTTPVersion(1, 1);
+  msg.setURL(parsed.makeRelativeURL());
+  msg.getHeaders().set(proxygen::HTTP_HEADER_HOST, parsed.getHostAndPort());
+  for (const auto& header : headers) {
+    msg.getHeaders().add(header.first, header.second);
+  }
+  if (body != nullptr) {
+    msg.getHeaders().set(proxygen::HTTP_HEADER_CONTENT_LENGTH,
+                         folly::to<std::string>(body->computeChainDataLength()));
+  }
+  req->body = std::move(body);
+
+  auto future = req->promise.getFuture();
+  auto* evb = ioThreadPool_->getEventBase();
+  auto* pool = pools_.at(evb).get();
+  evb->runInEventBaseThread([pool, r = std::move(req)]() mutable { pool->send(std::move(r)); });
+  return future;
+}
+
+folly::Future<StatusOr<HttpResponse>> AsyncHttpClient::get(const std::string& url,
+                                                           const Headers& headers) {
+  return request(proxygen::HTTPMethod::GET, url, headers);
+}
+
+folly::Future<StatusOr<HttpResponse>> AsyncHttpClient::post(const std::string& url,
+                                                            const Headers& headers,
+                                                            std::string body) {
+  return request(
+      proxygen::HTTPMethod::POST, url, headers, folly::IOBuf::fromString(std::move(body)));
+}
+
+folly::Future<StatusOr<HttpResponse>> AsyncHttpClient::put(const std::string& url,
+                                                           const Headers& headers,
+                                                           std::string body) {
+  return request(
+      proxygen::HTTPMethod::PUT, url, headers, folly::IOBuf::fromString(std::move(body)));
+}
+
+}  // namespace http
+}  // namespace nebula
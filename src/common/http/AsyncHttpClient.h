@@ -0,0 +1,97 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_HTTP_ASYNCHTTPCLIENT_H
+#define COMMON_HTTP_ASYNCHTTPCLIENT_H
+
+#include <folly/executors/IOThreadPoolExecutor.h>
+#include <folly/futures/Future.h>
+#include <folly/io/IOBuf.h>
+#include <proxygen/lib/http/HTTPMethod.h>
+
+#include "common/base/Base.h"
+#include "common/base/StatusOr.h"
+
+DECLARE_int32(http_client_timeout_ms);
+DECLARE_int32(http_client_max_idle_conns);
+
+namespace nebula {
+namespace http {
+
+struct HttpResponse {
+  int32_t statusCode{0};
+  std::string body;
+};
+
+/**
+ * @brief Asynchronous HTTP/1.1 client running in io threads. Connections are kept alive and
+ * pooled per endpoint in each io thread, so requests to the same server reuse them instead of
+ * reconnecting. HTTP/1.1 connections don't serve requests concurrently, the concurrent requests
+ * to one endpoint are spread over several pooled connections.
+ */
+class AsyncHttpClient final {
+ public:
+  using Headers = std::vector<std::pair<std::string, std::string>>;
+
+  explicit AsyncHttpClient(std::shared_ptr<folly::IOThreadPoolExecutor> ioThreadPool);
+
+  /**
+   * @brief All requests must have been finished before the client is destroyed
+   */
+  ~AsyncHttpClient();
+
+  /**
+   * @brief Return the client shared in process, which has its own io threads
+   */
+  static AsyncHttpClient& instance();
+
+  /**
+   * @brief Send a http request
+   *
+   * @param method
+   * @param url Absolute url, such as http://127.0.0.1:9200/_bulk
+   * @param headers
+   * @param body Request body, a chain of buffers is sent without being coalesced
+   * @return folly::Future<StatusOr<HttpResponse>> Error if the request failed to be sent or the
+   * response is broken, the http status code of server is returned in response
+   */
+  folly::Future<StatusOr<HttpResponse>> request(proxygen::HTTPMethod method,
+                                                const std::string& url,
+                                                const Headers& headers = {},
+                                                std::unique_ptr<folly::IOBuf> body = nullptr);
+
+  folly::Future<StatusOr<HttpResponse>> get(const std::string& url, const Headers& headers = {});
+
+  folly::Future<StatusOr<HttpResponse>> post(const std::string& url,
+                                             const Headers& headers,
+                                             std::string body);
+
+  folly::Future<StatusOr<HttpResponse>> put(const std::string& url,
+                                            const Headers& headers,
+                                            std::string body);
+
+  /**
+   * @brief Return the number of connections established so far
+   */
+  size_t numConnections() const {
+    return numConnections_.load();
+  }
+
+ private:
+  struct Request;
+  class SessionPool;
+  class Connector;
+  class Transaction;
+
+  std::shared_ptr<folly::IOThreadPoolExecutor> ioThreadPool_;
+  // One pool for each io thread, a pool is only accessed in its own thread
+  std::unordered_map<folly::EventBase*, std::unique_ptr<SessionPool>> pools_;
+  std::atomic<size_t> numConnections_{0};
+};
+
+}  // namespace http
+}  // namespace nebula
+
+#endif  // COMMON_HTTP_ASYNCHTTPCLIENT_H
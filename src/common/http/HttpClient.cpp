@@ -5,12 +5,22 @@
 
 #include "common/http/HttpClient.h"
 
+#include "common/http/AsyncHttpClient.h"
 #include "common/process/ProcessUtils.h"
 
 namespace nebula {
 namespace http {
 
 StatusOr<std::string> HttpClient::get(const std::string& path, const std::string& options) {
+  if (options == "-G") {
+    // Plain GET doesn't need curl
+    auto result = AsyncHttpClient::instance().get(path).get();
+    if (!result.ok()) {
+      LOG(ERROR) << "Http Get Failed: " << result.status();
+      return Status::Error(folly::stringPrintf("Http Get Failed: %s", path.c_str()));
+    }
+    return std::move(result).value().body;
+  }
   auto command = folly::stringPrintf("/usr/bin/curl %s \"%s\"", options.c_str(), path.c_str());
   LOG(INFO) << "HTTP Get Command: " << command;
   auto result = nebula::ProcessUtils::runCommand(command.c_str());
@@ -76,21 +86,19 @@ StatusOr<std::string> HttpClient::put(const std::string& path, const folly::dyna
 StatusOr<std::string> HttpClient::sendRequest(const std::string& path,
                                               const folly::dynamic& data,
                                               const std::string& reqType) {
-  std::string command;
-  if (data.empty()) {
-    command = folly::stringPrintf("curl -X %s -s \"%s\"", reqType.c_str(), path.c_str());
-  } else {
-    command =
-        folly::stringPrintf("curl -X %s -H \"Content-Type: application/json\" -d'%s' -s \"%s\"",
-                            reqType.c_str(),
-                            folly::toJson(data).c_str(),
-                            path.c_str());
+  AsyncHttpClient::Headers headers;
+  std::unique_ptr<folly::IOBuf> body;
+  if (!data.empty()) {
+    headers.emplace_back("Content-Type", "application/json");
+    body = folly::IOBuf::fromString(folly::toJson(data));
   }
-  LOG(INFO) << folly::stringPrintf("HTTP %s Command: %s", reqType.c_str(), command.c_str());
-  auto result = nebula::ProcessUtils::runCommand(command.c_str());
+  auto method = reqType == "PUT" ? proxygen::HTTPMethod::PUT : proxygen::HTTPMethod::POST;
+  VLOG(2) << folly::stringPrintf("HTTP %s: %s", reqType.c_str(), path.c_str());
+  auto result = AsyncHttpClient::instance().request(method, path, headers, std::move(body)).get();
   if (result.ok()) {
-    return result.value();
+    return std::move(result).value().body;
   } else {
+    LOG(ERROR) << result.status();
     return Status::Error(folly::stringPrintf("Http %s Failed: %s", reqType.c_str(), path.c_str()));
   }
 }
@@ -7,7 +7,9 @@
 #include <proxygen/httpserver/RequestHandler.h>
 #include <proxygen/httpserver/ResponseBuilder.h>
 
+#include "common/http/AsyncHttpClient.h"
 #include "common/http/HttpClient.h"
+#include "common/network/NetworkUtils.h"
 #include "webservice/Common.h"
 #include "webservice/Router.h"
 #include "webservice/WebService.h"
@@ -41,6 +43,44 @@ class HttpClientHandler : public proxygen::RequestHandler {
     LOG(ERROR) << "HttpClientHandler Error: " << proxygen::getErrorString(error);
   }
 };
+
+// Reply the method and the request body
+class EchoHandler : public proxygen::RequestHandler {
+ public:
+  EchoHandler() = default;
+
+  void onRequest(std::unique_ptr<proxygen::HTTPMessage> headers) noexcept override {
+    method_ = headers->getMethodString();
+  }
+
+  void onBody(std::unique_ptr<folly::IOBuf> body) noexcept override {
+    body_.append(std::move(body));
+  }
+
+  void onEOM() noexcept override {
+    auto body = body_.move();
+    proxygen::ResponseBuilder(downstream_)
+        .status(WebServiceUtils::to(HttpStatusCode::OK),
+                WebServiceUtils::toString(HttpStatusCode::OK))
+        .body(method_ + ":" + (body ? body->moveToFbString().toStdString() : ""))
+        .sendWithEOM();
+  }
+
+  void onUpgrade(proxygen::UpgradeProtocol) noexcept override {}
+
+  void requestComplete() noexcept override {
+    delete this;
+  }
+
+  void onError(proxygen::ProxygenError error) noexcept override {
+    LOG(ERROR) << "EchoHandler Error: " << proxygen::getErrorString(error);
+  }
+
+ private:
+  std::string method_;
+  folly::IOBufQueue body_{folly::IOBufQueue::cacheChainLength()};
+};
+
 class HttpClientTestEnv : public ::testing::Environment {
  public:
   void SetUp() override {
@@ -51,6 +91,9 @@ class HttpClientTestEnv : public ::testing::Environment {
 
     auto& router = webSvc_->router();
     router.get("/path").handler([](auto&&) { return new HttpClientHandler(); });
+    router.get("/echo").handler([](auto&&) { return new EchoHandler(); });
+    router.post("/echo").handler([](auto&&) { return new EchoHandler(); });
+    router.put("/echo").handler([](auto&&) { return new EchoHandler(); });
 
     auto status = webSvc_->start();
     ASSERT_TRUE(status.ok()) << status;
@@ -82,6 +125,73 @@ TEST(HttpClient, get) {
   }
 }
 
+TEST(AsyncHttpClient, request) {
+  auto url = folly::stringPrintf("http://%s:%d/echo", FLAGS_ws_ip.c_str(), FLAGS_ws_http_port);
+  AsyncHttpClient client(std::make_shared<folly::IOThreadPoolExecutor>(1));
+  {
+    auto result = client.get(url).get();
+    ASSERT_TRUE(result.ok()) << result.status();
+    EXPECT_EQ(200, result.value().statusCode);
+    EXPECT_EQ("GET:", result.value().body);
+  }
+  {
+    auto result = client.post(url, {{"Content-Type", "application/json"}}, "{}").get();
+    ASSERT_TRUE(result.ok()) << result.status();
+    EXPECT_EQ("POST:{}", result.value().body);
+  }
+  {
+    // body in a chain of buffers
+    auto body = folly::IOBuf::copyBuffer("hello ");
+    body->prependChain(folly::IOBuf::copyBuffer("world"));
+    auto result = client.request(proxygen::HTTPMethod::PUT, url, {}, std::move(body)).get();
+    ASSERT_TRUE(result.ok()) << result.status();
+    EXPECT_EQ("PUT:hello world", result.value().body);
+  }
+  {
+    auto notExist = folly::stringPrintf(
+        "http://%s:%d/not_exist", FLAGS_ws_ip.c_str(), FLAGS_ws_http_port);
+    auto result = client.get(notExist).get();
+    ASSERT_TRUE(result.ok()) << result.status();
+    EXPECT_EQ(404, result.value().statusCode);
+  }
+  // All requests are sent on the same connection
+  EXPECT_EQ(1, client.numConnections());
+}
+
+TEST(AsyncHttpClient, concurrentRequests) {
+  auto url = folly::stringPrintf("http://%s:%d/echo", FLAGS_ws_ip.c_str(), FLAGS_ws_http_port);
+  AsyncHttpClient client(std::make_shared<folly::IOThreadPoolExecutor>(2));
+  for (int32_t round = 0; round < 3; round++) {
+    std::vector<folly::Future<StatusOr<HttpResponse>>> futures;
+    for (int32_t i = 0; i < 10; i++) {
+      futures.emplace_back(client.post(url, {}, folly::to<std::string>(i)));
+    }
+    auto results = folly::collectAll(futures).get();
+    for (int32_t i = 0; i < 10; i++) {
+      ASSERT_TRUE(results[i].value().ok());
+      EXPECT_EQ(folly::stringPrintf("POST:%d", i), results[i].value().value().body);
+    }
+  }
+  // Connections are reused in later rounds
+  EXPECT_LE(client.numConnections(), 10);
+}
+
+TEST(AsyncHttpClient, error) {
+  AsyncHttpClient client(std::make_shared<folly::IOThreadPoolExecutor>(1));
+  {
+    auto result = client.get("not a url").get();
+    EXPECT_FALSE(result.ok());
+  }
+  {
+    // nobody listens on the port
+    auto url = folly::stringPrintf("http://%s:%d/echo",
+                                   FLAGS_ws_ip.c_str(),
+                                   network::NetworkUtils::getAvailablePort());
+    auto result = client.get(url).get();
+    EXPECT_FALSE(result.ok());
+  }
+}
+
 }  // namespace http
 }  // namespace nebula
 
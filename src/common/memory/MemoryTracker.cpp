@@ -0,0 +1,84 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "common/memory/MemoryTracker.h"
+
+#include <glog/logging.h>
+
+namespace nebula {
+
+MemoryTracker::MemoryTracker(std::string name,
+                             int64_t limit,
+                             std::shared_ptr<MemoryTracker> parent)
+    : name_(std::move(name)), limit_(limit), parent_(std::move(parent)) {}
+
+MemoryTracker::~MemoryTracker() {
+  auto used = used_.load();
+  if (parent_ != nullptr && used > 0) {
+    parent_->free(used);
+  }
+}
+
+Status MemoryTracker::alloc(int64_t bytes) {
+  if (bytes <= 0) {
+    free(-bytes);
+    return Status::OK();
+  }
+  for (auto* tracker = this; tracker != nullptr; tracker = tracker->parent_.get()) {
+    if (!tracker->tryAlloc(bytes)) {
+      // Roll back the allocated ones
+      for (auto* allocated = this; allocated != tracker; allocated = allocated->parent_.get()) {
+        allocated->used_.fetch_sub(bytes, std::memory_order_relaxed);
+      }
+      return Status::Error("Used memory exceeds the quota(%ld bytes) of %s",
+                           tracker->limit(),
+                           tracker->name().c_str());
+    }
+  }
+  return Status::OK();
+}
+
+void MemoryTracker::free(int64_t bytes) {
+  if (bytes <= 0) {
+    return;
+  }
+  for (auto* tracker = this; tracker != nullptr; tracker = tracker->parent_.get()) {
+    auto used = tracker->used_.fetch_sub(bytes, std::memory_order_relaxed);
+    DCHECK_GE(used, bytes) << "Free more memory than allocated in " << tracker->name();
+  }
+}
+
+bool MemoryTracker::tryAlloc(int64_t bytes) {
+  auto used = used_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  auto limit = limit_.load(std::memory_order_relaxed);
+  if (limit > 0 && used > limit) {
+    used_.fetch_sub(bytes, std::memory_order_relaxed);
+    return false;
+  }
+  auto peak = peak_.load(std::memory_order_relaxed);
+  while (used > peak && !peak_.compare_exchange_weak(peak, used, std::memory_order_relaxed)) {
+  }
+  return true;
+}
+
+Status MemoryReservation::resize(int64_t bytes) {
+  if (tracker_ == nullptr) {
+    return Status::OK();
+  }
+  auto status = tracker_->alloc(bytes - bytes_);
+  if (status.ok()) {
+    bytes_ = bytes;
+  }
+  return status;
+}
+
+void MemoryReservation::reset() {
+  if (tracker_ != nullptr && bytes_ > 0) {
+    tracker_->free(bytes_);
+  }
+  bytes_ = 0;
+}
+
+}  // namespace nebula
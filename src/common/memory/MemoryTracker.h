@@ -0,0 +1,139 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_MEMORY_MEMORYTRACKER_H
+#define COMMON_MEMORY_MEMORYTRACKER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "common/base/Status.h"
+
+namespace nebula {
+
+/**
+ * @brief Account the memory used by a query, a session or a request. The trackers form a tree,
+ * the memory allocated in a tracker is also allocated in its ancestors, so a quota could be set on
+ * every level. The memory is estimated by the callers, e.g. the size of results and hash tables,
+ * it's not the exact memory allocated by malloc.
+ */
+class MemoryTracker final {
+ public:
+  /**
+   * @param name Name of tracker, used in error messages
+   * @param limit Quota of memory in bytes, 0 means unlimited
+   * @param parent
+   */
+  MemoryTracker(std::string name, int64_t limit, std::shared_ptr<MemoryTracker> parent = nullptr);
+
+  // The memory not freed is returned to parent
+  ~MemoryTracker();
+
+  MemoryTracker(const MemoryTracker&) = delete;
+  MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+  /**
+   * @brief Allocate bytes in the tracker and its ancestors. Nothing is allocated if any quota is
+   * exceeded.
+   */
+  Status alloc(int64_t bytes);
+
+  /**
+   * @brief Free bytes allocated before
+   */
+  void free(int64_t bytes);
+
+  int64_t used() const {
+    return used_.load(std::memory_order_relaxed);
+  }
+
+  // The max memory used ever
+  int64_t peak() const {
+    return peak_.load(std::memory_order_relaxed);
+  }
+
+  int64_t limit() const {
+    return limit_.load(std::memory_order_relaxed);
+  }
+
+  void setLimit(int64_t limit) {
+    limit_.store(limit, std::memory_order_relaxed);
+  }
+
+  const std::string& name() const {
+    return name_;
+  }
+
+  const std::shared_ptr<MemoryTracker>& parent() const {
+    return parent_;
+  }
+
+ private:
+  // Allocate in this tracker only
+  bool tryAlloc(int64_t bytes);
+
+  std::string name_;
+  std::atomic<int64_t> limit_{0};
+  std::atomic<int64_t> used_{0};
+  std::atomic<int64_t> peak_{0};
+  std::shared_ptr<MemoryTracker> parent_;
+};
+
+/**
+ * @brief The memory allocated in a tracker by an object, e.g. a result or a hash table. It's freed
+ * when the reservation is destroyed or reset.
+ */
+class MemoryReservation final {
+ public:
+  MemoryReservation() = default;
+
+  explicit MemoryReservation(std::shared_ptr<MemoryTracker> tracker)
+      : tracker_(std::move(tracker)) {}
+
+  ~MemoryReservation() {
+    reset();
+  }
+
+  MemoryReservation(const MemoryReservation&) = delete;
+  MemoryReservation& operator=(const MemoryReservation&) = delete;
+
+  MemoryReservation(MemoryReservation&& rhs) noexcept
+      : tracker_(std::move(rhs.tracker_)), bytes_(rhs.bytes_) {
+    rhs.bytes_ = 0;
+  }
+
+  MemoryReservation& operator=(MemoryReservation&& rhs) noexcept {
+    if (this != &rhs) {
+      reset();
+      tracker_ = std::move(rhs.tracker_);
+      bytes_ = rhs.bytes_;
+      rhs.bytes_ = 0;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Resize the reserved memory to bytes, keep the size if failed
+   */
+  Status resize(int64_t bytes);
+
+  /**
+   * @brief Free the reserved memory
+   */
+  void reset();
+
+  int64_t bytes() const {
+    return bytes_;
+  }
+
+ private:
+  std::shared_ptr<MemoryTracker> tracker_;
+  int64_t bytes_{0};
+};
+
+}  // namespace nebula
+#endif
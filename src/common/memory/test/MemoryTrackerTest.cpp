@@ -0,0 +1,76 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/memory/MemoryTracker.h"
+
+namespace nebula {
+
+TEST(MemoryTrackerTest, Quota) {
+  MemoryTracker tracker("query", 100);
+  EXPECT_TRUE(tracker.alloc(60).ok());
+  EXPECT_FALSE(tracker.alloc(60).ok());
+  EXPECT_EQ(60, tracker.used());
+  EXPECT_TRUE(tracker.alloc(40).ok());
+  EXPECT_EQ(100, tracker.used());
+  tracker.free(70);
+  EXPECT_EQ(30, tracker.used());
+  EXPECT_EQ(100, tracker.peak());
+
+  // Unlimited
+  tracker.setLimit(0);
+  EXPECT_TRUE(tracker.alloc(1000).ok());
+  EXPECT_EQ(1030, tracker.used());
+}
+
+TEST(MemoryTrackerTest, Parent) {
+  auto session = std::make_shared<MemoryTracker>("session", 100);
+  {
+    MemoryTracker query1("query1", 80, session);
+    MemoryTracker query2("query2", 80, session);
+    EXPECT_TRUE(query1.alloc(60).ok());
+    // Exceeds the quota of session, nothing is allocated
+    auto status = query2.alloc(60);
+    EXPECT_FALSE(status.ok());
+    EXPECT_NE(std::string::npos, status.toString().find("session"));
+    EXPECT_EQ(0, query2.used());
+    EXPECT_EQ(60, session->used());
+
+    EXPECT_TRUE(query2.alloc(40).ok());
+    EXPECT_EQ(100, session->used());
+  }
+  // Returned to the parent when the children are destroyed
+  EXPECT_EQ(0, session->used());
+  EXPECT_EQ(100, session->peak());
+}
+
+TEST(MemoryTrackerTest, Reservation) {
+  auto tracker = std::make_shared<MemoryTracker>("query", 100);
+  {
+    MemoryReservation reservation(tracker);
+    EXPECT_TRUE(reservation.resize(50).ok());
+    EXPECT_EQ(50, tracker->used());
+    EXPECT_TRUE(reservation.resize(20).ok());
+    EXPECT_EQ(20, tracker->used());
+    // Keep the size if failed
+    EXPECT_FALSE(reservation.resize(200).ok());
+    EXPECT_EQ(20, reservation.bytes());
+    EXPECT_EQ(20, tracker->used());
+
+    MemoryReservation other(std::move(reservation));
+    EXPECT_EQ(0, reservation.bytes());
+    EXPECT_EQ(20, other.bytes());
+    EXPECT_EQ(20, tracker->used());
+  }
+  EXPECT_EQ(0, tracker->used());
+
+  // Nothing is tracked without tracker
+  MemoryReservation reservation;
+  EXPECT_TRUE(reservation.resize(1000).ok());
+  EXPECT_EQ(0, reservation.bytes());
+}
+
+}  // namespace nebula
@@ -23,6 +23,8 @@
 #define CURL_CONTENT_JSON " -H \"Content-Type: application/json; charset=utf-8\""
 #define CURL_CONTENT_NDJSON " -H \"Content-Type: application/x-ndjson; charset=utf-8\""
 #define ESCAPE_SINGLE_QUOTE "\'\\\'\'"
+#define CONTENT_TYPE_JSON "application/json; charset=utf-8"
+#define CONTENT_TYPE_NDJSON "application/x-ndjson; charset=utf-8"
 
 namespace nebula {
 namespace plugin {
@@ -89,6 +91,24 @@ struct HttpClient {
     os << " -k \"" << connType << "://" << host.host << ":" << host.port << "/";
     return os.str();
   }
+
+  // Url of the path on the full-text server
+  std::string url(const std::string& path) const {
+    std::stringstream os;
+    os << connType << "://" << host.host << ":" << host.port << "/" << path;
+    return os.str();
+  }
+
+  // Request headers, with the basic authorization if user is set
+  std::vector<std::pair<std::string, std::string>> headers(const std::string& contentType) const {
+    std::vector<std::pair<std::string, std::string>> result;
+    result.emplace_back("Content-Type", contentType);
+    if (!user.empty()) {
+      auto auth = proxygen::base64Encode(folly::StringPiece(user + ":" + password));
+      result.emplace_back("Authorization", "Basic " + auth);
+    }
+    return result;
+  }
 };
 
 struct DocItem {
@@ -5,6 +5,7 @@
 
 #include "common/plugin/fulltext/elasticsearch/ESGraphAdapter.h"
 
+#include "common/http/AsyncHttpClient.h"
 #include "common/process/ProcessUtils.h"
 
 namespace nebula {
@@ -17,40 +18,21 @@ StatusOr<bool> ESGraphAdapter::prefix(const HttpClient& client,
                                       const DocItem& item,
                                       const LimitItem& limit,
                                       std::vector<std::string>& rows) const {
-  std::string cmd = header(client, item, limit) + body(item, limit.maxRows_, FT_SEARCH_OP::kPrefix);
-  auto ret = nebula::ProcessUtils::runCommand(cmd.c_str());
-  if (!ret.ok() || ret.value().empty()) {
-    LOG(ERROR) << "Http GET Failed: " << cmd;
-    return Status::Error("command failed : %s", cmd.c_str());
-  }
-  return result(ret.value(), rows);
+  return search(client, item, limit, body(item, limit.maxRows_, FT_SEARCH_OP::kPrefix), rows);
 }
 
 StatusOr<bool> ESGraphAdapter::wildcard(const HttpClient& client,
                                         const DocItem& item,
                                         const LimitItem& limit,
                                         std::vector<std::string>& rows) const {
-  std::string cmd =
-      header(client, item, limit) + body(item, limit.maxRows_, FT_SEARCH_OP::kWildcard);
-  auto ret = nebula::ProcessUtils::runCommand(cmd.c_str());
-  if (!ret.ok() || ret.value().empty()) {
-    LOG(ERROR) << "Http GET Failed: " << cmd;
-    return Status::Error("command failed : %s", cmd.c_str());
-  }
-  return result(ret.value(), rows);
+  return search(client, item, limit, body(item, limit.maxRows_, FT_SEARCH_OP::kWildcard), rows);
 }
 
 StatusOr<bool> ESGraphAdapter::regexp(const HttpClient& client,
                                       const DocItem& item,
                                       const LimitItem& limit,
                                       std::vector<std::string>& rows) const {
-  std::string cmd = header(client, item, limit) + body(item, limit.maxRows_, FT_SEARCH_OP::kRegexp);
-  auto ret = nebula::ProcessUtils::runCommand(cmd.c_str());
-  if (!ret.ok() || ret.value().empty()) {
-    LOG(ERROR) << "Http GET Failed: " << cmd;
-    return Status::Error("command failed : %s", cmd.c_str());
-  }
-  return result(ret.value(), rows);
+  return search(client, item, limit, body(item, limit.maxRows_, FT_SEARCH_OP::kRegexp), rows);
 }
 
 StatusOr<bool> ESGraphAdapter::fuzzy(const HttpClient& client,
@@ -59,14 +41,30 @@ StatusOr<bool> ESGraphAdapter::fuzzy(const HttpClient& client,
                                      const folly::dynamic& fuzziness,
                                      const std::string& op,
                                      std::vector<std::string>& rows) const {
-  std::string cmd =
-      header(client, item, limit) + body(item, limit.maxRows_, FT_SEARCH_OP::kFuzzy, fuzziness, op);
-  auto ret = nebula::ProcessUtils::runCommand(cmd.c_str());
-  if (!ret.ok() || ret.value().empty()) {
-    LOG(ERROR) << "Http GET Failed: " << cmd;
-    return Status::Error("command failed : %s", cmd.c_str());
+  return search(client,
+                item,
+                limit,
+                body(item, limit.maxRows_, FT_SEARCH_OP::kFuzzy, fuzziness, op),
+                rows);
+}
+
+StatusOr<bool> ESGraphAdapter::search(const HttpClient& client,
+                                      const DocItem& item,
+                                      const LimitItem& limit,
+                                      const folly::dynamic& query,
+                                      std::vector<std::string>& rows) const {
+  auto url = client.url(searchPath(item, limit));
+  auto ret = http::AsyncHttpClient::instance()
+                 .request(proxygen::HTTPMethod::GET,
+                          url,
+                          client.headers(CONTENT_TYPE_JSON),
+                          folly::IOBuf::fromString(folly::toJson(query)))
+                 .get();
+  if (!ret.ok() || ret.value().body.empty()) {
+    LOG(ERROR) << "Http GET Failed: " << url;
+    return Status::Error("Http GET failed : %s", url.c_str());
   }
-  return result(ret.value(), rows);
+  return result(ret.value().body, rows);
 }
 
 std::string ESGraphAdapter::header() const noexcept {
@@ -75,15 +73,11 @@ std::string ESGraphAdapter::header() const noexcept {
   return os.str();
 }
 
-std::string ESGraphAdapter::header(const HttpClient& client,
-                                   const DocItem& item,
-                                   const LimitItem& limit) const noexcept {
-  //    curl -H "Content-Type: application/json; charset=utf-8"
-  //    -XGET http://127.0.0.1:9200/my_temp_index_3/_search?timeout=10ms
+std::string ESGraphAdapter::searchPath(const DocItem& item,
+                                       const LimitItem& limit) const noexcept {
+  //    my_temp_index_3/_search?timeout=10ms
   std::stringstream os;
-  os << CURL << CURL_CONTENT_JSON << XGET;
-  os << client.toString() << item.index << "/_search?timeout=" << limit.timeout_ << "ms"
-     << "\"";
+  os << item.index << "/_search?timeout=" << limit.timeout_ << "ms";
   return os.str();
 }
 
@@ -93,11 +87,11 @@ folly::dynamic ESGraphAdapter::columnBody(const std::string& col) const noexcept
   return folly::dynamic::object("term", itemColumn);
 }
 
-std::string ESGraphAdapter::body(const DocItem& item,
-                                 int32_t maxRows,
-                                 FT_SEARCH_OP type,
-                                 const folly::dynamic& fuzziness,
-                                 const std::string& op) const noexcept {
+folly::dynamic ESGraphAdapter::body(const DocItem& item,
+                                    int32_t maxRows,
+                                    FT_SEARCH_OP type,
+                                    const folly::dynamic& fuzziness,
+                                    const std::string& op) const noexcept {
   folly::dynamic obj;
   switch (type) {
     case FT_SEARCH_OP::kPrefix: {
@@ -121,9 +115,7 @@ std::string ESGraphAdapter::body(const DocItem& item,
   folly::dynamic itemBool = folly::dynamic::object("bool", itemMust);
   folly::dynamic itemQuery =
       folly::dynamic::object("query", itemBool)("_source", "value")("size", maxRows)("from", 0);
-  std::stringstream os;
-  os << " -d'" << DocIDTraits::normalizedJson(folly::toJson(itemQuery)) << "'";
-  return os.str();
+  return itemQuery;
 }
 
 folly::dynamic ESGraphAdapter::prefixBody(const std::string& prefix) const noexcept {
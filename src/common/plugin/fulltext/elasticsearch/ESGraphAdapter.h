@@ -66,17 +66,21 @@ class ESGraphAdapter final : public FTGraphAdapter {
 
   std::string header() const noexcept;
 
-  std::string header(const HttpClient& client,
-                     const DocItem& item,
-                     const LimitItem& limit) const noexcept;
+  std::string searchPath(const DocItem& item, const LimitItem& limit) const noexcept;
+
+  StatusOr<bool> search(const HttpClient& client,
+                        const DocItem& item,
+                        const LimitItem& limit,
+                        const folly::dynamic& query,
+                        std::vector<std::string>& rows) const;
 
   folly::dynamic columnBody(const std::string& col) const noexcept;
 
-  std::string body(const DocItem& item,
-                   int32_t maxRows,
-                   FT_SEARCH_OP type,
-                   const folly::dynamic& fuzziness = nullptr,
-                   const std::string& op = "") const noexcept;
+  folly::dynamic body(const DocItem& item,
+                      int32_t maxRows,
+                      FT_SEARCH_OP type,
+                      const folly::dynamic& fuzziness = nullptr,
+                      const std::string& op = "") const noexcept;
 
   folly::dynamic prefixBody(const std::string& prefix) const noexcept;
 
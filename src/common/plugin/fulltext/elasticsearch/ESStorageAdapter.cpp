@@ -5,25 +5,26 @@
 
 #include "common/plugin/fulltext/elasticsearch/ESStorageAdapter.h"
 
+#include <folly/io/IOBufQueue.h>
+
+#include "common/http/AsyncHttpClient.h"
 #include "common/plugin/fulltext/FTUtils.h"
-#include "common/process/ProcessUtils.h"
 
 namespace nebula {
 namespace plugin {
 std::unique_ptr<FTStorageAdapter> ESStorageAdapter::kAdapter =
     std::unique_ptr<ESStorageAdapter>(new ESStorageAdapter());
 
-bool ESStorageAdapter::checkPut(const std::string& ret, const std::string& cmd) const {
+bool ESStorageAdapter::checkPut(const std::string& ret, const std::string& url) const {
   // For example :
   //     HostAddr localHost_{"127.0.0.1", 9200};
   //     DocItem item("index1", "col1", 1, 2, "aaaa");
   //
-  // Command should be :
-  //    /usr/bin/curl -H "Content-Type: application/json; charset=utf-8"
-  //    -XPUT
+  // Request should be :
+  //    PUT
   //    "http://127.0.0.1:9200/index1/_doc/0000000001_0000000002_8c43de7b01bca674276c43e09b3ec5ba_aaaa"
   //    // NOLINT
-  //    -d'{"value":"aaaa","schema_id":2,"column_id":"8c43de7b01bca674276c43e09b3ec5ba"}'
+  //    {"value":"aaaa","schema_id":2,"column_id":"8c43de7b01bca674276c43e09b3ec5ba"}
   //
   // If successful, the result is returned:
   //    {
@@ -51,7 +52,7 @@ bool ESStorageAdapter::checkPut(const std::string& ret, const std::string& cmd)
   } catch (std::exception& e) {
     LOG(ERROR) << "result error : " << e.what();
   }
-  VLOG(3) << "Command : " << cmd << "failed : " << ret;
+  VLOG(3) << "Put " << url << " failed : " << ret;
   return false;
 }
 
@@ -61,13 +62,12 @@ bool ESStorageAdapter::checkBulk(const std::string& ret) const {
   //     DocItem item("bulk_index", "col1", 1, 2, "row_1")
   //                 ("bulk_index", "col1", 1, 2, "row_2")
   //
-  // Command should be :
-  //    curl  -H "Content-Type: application/x-ndjson" -XPOST
-  //    localhost:9200/_bulk -d ' { "index" : { "_index" : "bulk_index", "_id" :
-  //    "1" } } { "schema_id" : 1 , "column_id" : "col1", "value" : "row_1"} {
-  //    "index" : { "_index" : "bulk_index", "_id" : "2" } } { "schema_id" : 1 ,
-  //    "column_id" : "col1", "value" : "row_2"}
-  //    '
+  // Request should be :
+  //    POST localhost:9200/_bulk
+  //    { "index" : { "_index" : "bulk_index", "_id" : "1" } }
+  //    { "schema_id" : 1 , "column_id" : "col1", "value" : "row_1"}
+  //    { "index" : { "_index" : "bulk_index", "_id" : "2" } }
+  //    { "schema_id" : 1 , "column_id" : "col1", "value" : "row_2"}
   //
   // If successful, the result is returned:
   //    {
@@ -122,98 +122,68 @@ bool ESStorageAdapter::checkBulk(const std::string& ret) const {
 }
 
 StatusOr<bool> ESStorageAdapter::put(const HttpClient& client, const DocItem& item) const {
-  auto command = putCmd(client, item);
-  auto ret = nebula::ProcessUtils::runCommand(command.c_str());
-  if (!ret.ok() || ret.value().empty()) {
-    LOG(ERROR) << "Http PUT Failed: " << command;
-    return Status::Error("command failed : %s", command.c_str());
+  auto url = client.url(putPath(item));
+  auto ret =
+      http::AsyncHttpClient::instance().put(url, client.headers(CONTENT_TYPE_JSON), putBody(item))
+          .get();
+  if (!ret.ok() || ret.value().body.empty()) {
+    LOG(ERROR) << "Http PUT Failed: " << url;
+    return Status::Error("Http PUT failed : %s", url.c_str());
   }
-  return checkPut(ret.value(), command);
+  return checkPut(ret.value().body, url);
 }
 
 StatusOr<bool> ESStorageAdapter::bulk(const HttpClient& client,
                                       const std::vector<DocItem>& items) const {
-  auto command = bulkCmd(client, items);
-  if (command.empty()) {
+  if (items.empty()) {
     return true;
   }
-  auto ret = nebula::ProcessUtils::runCommand(command.c_str());
-  if (!ret.ok() || ret.value().empty()) {
-    VLOG(3) << "Http PUT Failed";
-    VLOG(3) << command;
-    return Status::Error("bulk command failed");
+  auto ret = http::AsyncHttpClient::instance()
+                 .request(proxygen::HTTPMethod::POST,
+                          client.url("_bulk"),
+                          client.headers(CONTENT_TYPE_NDJSON),
+                          bulkBody(items))
+                 .get();
+  if (!ret.ok() || ret.value().body.empty()) {
+    VLOG(3) << "Http POST Failed";
+    return Status::Error("bulk request failed");
   }
-  return checkBulk(ret.value());
+  return checkBulk(ret.value().body);
 }
 
-std::string ESStorageAdapter::putHeader(const HttpClient& client,
-                                        const DocItem& item) const noexcept {
-  //    curl -H "Content-Type: application/json; charset=utf-8"
-  //    -XPUT "http://127.0.0.1:9200/my_temp_index_3/_doc/part1|tag4|col4|hello"
+std::string ESStorageAdapter::putPath(const DocItem& item) const noexcept {
+  //    my_temp_index_3/_doc/part1|tag4|col4|hello
   std::stringstream os;
-  os << CURL << CURL_CONTENT_JSON << XPUT;
-  os << client.toString() << item.index << "/_doc/" << DocIDTraits::docId(item) << "\"";
+  os << item.index << "/_doc/" << DocIDTraits::docId(item);
   return os.str();
 }
 
 std::string ESStorageAdapter::putBody(const DocItem& item) const noexcept {
-  //    -d'{"column_id" : "col4", "value" : "hello"}'
+  //    {"column_id" : "col4", "value" : "hello"}
   folly::dynamic d = folly::dynamic::object("column_id", DocIDTraits::column(item.column))(
       "value", DocIDTraits::val(item.val));
-  std::stringstream os;
-  os << " -d'" << DocIDTraits::normalizedJson(folly::toJson(d)) << "'";
-  return os.str();
+  return folly::toJson(d);
 }
 
-std::string ESStorageAdapter::putCmd(const HttpClient& client, const DocItem& item) const noexcept {
-  std::stringstream os;
-  os << putHeader(client, item) << putBody(item);
-  return os.str();
-}
-
-std::string ESStorageAdapter::bulkHeader(const HttpClient& client) const noexcept {
-  // curl  -H "Content-Type: application/x-ndjson; charset=utf-8"
-  // http://127.0.0.1:9200/_bulk
-  std::stringstream os;
-  os << CURL << CURL_CONTENT_NDJSON << XPOST;
-  os << client.toString() << "_bulk\"";
-  return os.str();
-}
-
-std::string ESStorageAdapter::bulkBody(const std::vector<DocItem>& items) const noexcept {
-  //    -d '
+std::unique_ptr<folly::IOBuf> ESStorageAdapter::bulkBody(
+    const std::vector<DocItem>& items) const noexcept {
   //    { "index" : { "_index" : "bulk_index", "_id" : "1" } }
   //    { "column_id" : "col1", "value" : "row_1"}
   //    { "index" : { "_index" : "bulk_index", "_id" : "2" } }
   //    { "column_id" : "col1", "value" : "row_2"}
-  //    '
-  if (items.empty()) {
-    return "";
-  }
-  std::stringstream os;
-  os << " -d '"
-     << "\n";
+  // The lines are appended into a chain of buffers, which is sent without being coalesced
+  folly::IOBufQueue body(folly::IOBufQueue::cacheChainLength());
   for (const auto& item : items) {
     folly::dynamic meta =
         folly::dynamic::object("_id", DocIDTraits::docId(item))("_index", item.index);
     folly::dynamic data = folly::dynamic::object("value", DocIDTraits::val(item.val))(
         "column_id", DocIDTraits::column(item.column));
-    os << folly::toJson(folly::dynamic::object("index", meta)) << "\n";
-    os << DocIDTraits::normalizedJson(folly::toJson(data)) << "\n";
+    body.append(folly::toJson(folly::dynamic::object("index", meta)));
+    body.append("\n");
+    body.append(folly::toJson(data));
+    body.append("\n");
   }
-  os << "'";
-  return os.str();
-}
-
-std::string ESStorageAdapter::bulkCmd(const HttpClient& client,
-                                      const std::vector<DocItem>& items) const noexcept {
-  auto body = bulkBody(items);
-  if (body.empty()) {
-    return "";
-  }
-  std::stringstream os;
-  os << bulkHeader(client) << body;
-  return os.str();
+  return body.move();
 }
 
 }  // namespace plugin
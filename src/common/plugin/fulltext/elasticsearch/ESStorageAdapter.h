@@ -6,6 +6,7 @@
 #ifndef NEBULA_PLUGIN_ESSTORAGEADAPTER_H
 #define NEBULA_PLUGIN_ESSTORAGEADAPTER_H
 
+#include <folly/io/IOBuf.h>
 #include <gtest/gtest_prod.h>
 
 #include "common/base/StatusOr.h"
@@ -28,19 +29,13 @@ class ESStorageAdapter final : public FTStorageAdapter {
  private:
   ESStorageAdapter() {}
 
-  std::string putHeader(const HttpClient& client, const DocItem& item) const noexcept;
+  std::string putPath(const DocItem& item) const noexcept;
 
   std::string putBody(const DocItem& item) const noexcept;
 
-  std::string putCmd(const HttpClient& client, const DocItem& item) const noexcept;
+  std::unique_ptr<folly::IOBuf> bulkBody(const std::vector<DocItem>& items) const noexcept;
 
-  std::string bulkHeader(const HttpClient& client) const noexcept;
-
-  std::string bulkBody(const std::vector<DocItem>& items) const noexcept;
-
-  std::string bulkCmd(const HttpClient& client, const std::vector<DocItem>& items) const noexcept;
-
-  bool checkPut(const std::string& ret, const std::string& cmd) const;
+  bool checkPut(const std::string& ret, const std::string& url) const;
 
   bool checkBulk(const std::string& ret) const;
 };
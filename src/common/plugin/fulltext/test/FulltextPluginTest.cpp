@@ -14,23 +14,13 @@
 namespace nebula {
 namespace plugin {
 
-void verifyBodyStr(const std::string& actual, const folly::dynamic& expect) {
-  ASSERT_EQ(" -d'", actual.substr(0, 4));
-  ASSERT_EQ("'", actual.substr(actual.size() - 1, 1));
-  auto body = folly::parseJson(actual.substr(4, actual.size() - 5));
-  ASSERT_EQ(expect, body);
-}
-
 void verifyBodyStr(const std::string& actual, const std::vector<folly::dynamic>& expect) {
   std::vector<std::string> lines;
   folly::split("\n", actual, lines, true);
-  if (lines.size() > 0) {
-    ASSERT_LE(2, lines.size());
-    ASSERT_EQ("'", lines[lines.size() - 1]);
-    for (size_t i = 1; i < lines.size() - 1; i++) {
-      auto body = folly::parseJson(lines[i]);
-      ASSERT_EQ(expect[i - 1], body);
-    }
+  ASSERT_EQ(expect.size(), lines.size());
+  for (size_t i = 0; i < lines.size(); i++) {
+    auto body = folly::parseJson(lines[i]);
+    ASSERT_EQ(expect[i], body);
   }
 }
 
@@ -79,36 +69,32 @@ TEST(FulltextPluginTest, ESPutTest) {
   HostAddr localHost_{"127.0.0.1", 9200};
   HttpClient hc(localHost_);
   DocItem item("index1", "col1", 1, "aaaa");
-  auto header = ESStorageAdapter().putHeader(hc, item);
+  auto url = hc.url(ESStorageAdapter().putPath(item));
   std::string expected =
-      "/usr/bin/curl -H \"Content-Type: application/json; charset=utf-8\" "
-      "-XPUT -k \"http://127.0.0.1:9200/index1/_doc/"
-      "00000000018c43de7b01bca674276c43e09b3ec5baYWFhYQ==\"";
-  ASSERT_EQ(expected, header);
+      "http://127.0.0.1:9200/index1/_doc/"
+      "00000000018c43de7b01bca674276c43e09b3ec5baYWFhYQ==";
+  ASSERT_EQ(expected, url);
 
   auto body = ESStorageAdapter().putBody(item);
 
   folly::dynamic d = folly::dynamic::object("column_id", DocIDTraits::column(item.column))(
       "value", DocIDTraits::val(item.val));
-  verifyBodyStr(std::move(body), std::move(d));
+  ASSERT_EQ(d, folly::parseJson(body));
 }
 
 TEST(FulltextPluginTest, ESBulkTest) {
   HostAddr localHost_{"127.0.0.1", 9200};
-  HttpClient hc(localHost_);
-  DocItem item1("index1", "col1", 1, "aaaa");
-  DocItem item2("index1", "col1", 1, "bbbb");
-  std::set<std::string> strs;
-  strs.emplace("aaa");
-  strs.emplace("bbb");
+  HttpClient hc(localHost_, "user", "pwd");
   std::vector<DocItem> items;
   items.emplace_back(DocItem("index1", "col1", 1, "aaaa"));
   items.emplace_back(DocItem("index1", "col1", 1, "bbbb"));
-  auto header = ESStorageAdapter().bulkHeader(hc);
-  std::string expected =
-      "/usr/bin/curl -H \"Content-Type: application/x-ndjson; "
-      "charset=utf-8\" -XPOST -k \"http://127.0.0.1:9200/_bulk\"";
-  ASSERT_EQ(expected, header);
+  ASSERT_EQ("http://127.0.0.1:9200/_bulk", hc.url("_bulk"));
+  auto headers = hc.headers(CONTENT_TYPE_NDJSON);
+  ASSERT_EQ(2, headers.size());
+  ASSERT_EQ(std::make_pair(std::string("Content-Type"), std::string(CONTENT_TYPE_NDJSON)),
+            headers[0]);
+  ASSERT_EQ(std::make_pair(std::string("Authorization"), std::string("Basic dXNlcjpwd2Q=")),
+            headers[1]);
 
   std::vector<folly::dynamic> bodies;
   for (const auto& item : items) {
@@ -121,7 +107,7 @@ TEST(FulltextPluginTest, ESBulkTest) {
   }
 
   auto body = ESStorageAdapter().bulkBody(items);
-  verifyBodyStr(body, std::move(bodies));
+  verifyBodyStr(body->moveToFbString().toStdString(), std::move(bodies));
 }
 
 TEST(FulltextPluginTest, ESPutToTest) {
@@ -258,11 +244,9 @@ TEST(FulltextPluginTest, ESPrefixTest) {
   HttpClient client(localHost_);
   DocItem item("index1", "col1", 1, "aa");
   LimitItem limit(10, 100);
-  auto header = ESGraphAdapter().header(client, item, limit);
-  std::string expected =
-      "/usr/bin/curl -H \"Content-Type: application/json; charset=utf-8\" "
-      "-XGET -k \"http://127.0.0.1:9200/index1/_search?timeout=10ms\"";
-  ASSERT_EQ(expected, header);
+  auto url = client.url(ESGraphAdapter().searchPath(item, limit));
+  std::string expected = "http://127.0.0.1:9200/index1/_search?timeout=10ms";
+  ASSERT_EQ(expected, url);
 
   auto body = ESGraphAdapter().prefixBody("aa");
   ASSERT_EQ("{\"prefix\":{\"value\":\"aa\"}}", folly::toJson(body));
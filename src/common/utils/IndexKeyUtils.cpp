@@ -162,6 +162,13 @@ std::string IndexKeyUtils::indexVal(const Value& v) {
   return val;
 }
 
+// static
+std::string IndexKeyUtils::indexVal(const Value& ttl, std::vector<Value> includeValues) {
+  auto val = indexVal(ttl);
+  val.append(indexVal(Value(List(std::move(includeValues)))));
+  return val;
+}
+
 // static
 Value IndexKeyUtils::parseIndexTTL(const folly::StringPiece& raw) {
   Value value;
@@ -170,6 +177,26 @@ Value IndexKeyUtils::parseIndexTTL(const folly::StringPiece& raw) {
   return value;
 }
 
+// static
+std::optional<std::vector<Value>> IndexKeyUtils::parseIndexIncludes(
+    const folly::StringPiece& raw) {
+  if (raw.size() < sizeof(size_t)) {
+    return std::nullopt;
+  }
+  auto ttlLen = *reinterpret_cast<const size_t*>(raw.data());
+  auto offset = sizeof(size_t) + ttlLen;
+  if (raw.size() < offset + sizeof(size_t)) {
+    return std::nullopt;
+  }
+  auto len = *reinterpret_cast<const size_t*>(raw.data() + offset);
+  Value value;
+  apache::thrift::CompactSerializer::deserialize(raw.subpiece(offset + sizeof(size_t), len), value);
+  if (!value.isList()) {
+    return std::nullopt;
+  }
+  return std::move(value.moveList().values);
+}
+
 // static
 StatusOr<std::vector<std::string>> IndexKeyUtils::collectIndexValues(
     RowReader* reader,
@@ -199,6 +226,30 @@ StatusOr<std::vector<std::string>> IndexKeyUtils::collectIndexValues(
   return encodeValues(std::move(values), indexItem);
 }
 
+// static
+StatusOr<std::vector<Value>> IndexKeyUtils::collectIncludeValues(
+    RowReader* reader,
+    const meta::cpp2::IndexItem* indexItem,
+    const meta::SchemaProviderIf* latestSchema) {
+  if (reader == nullptr) {
+    return Status::Error("Invalid row reader");
+  }
+  std::vector<Value> values;
+  if (!indexItem->include_fields_ref().has_value()) {
+    return values;
+  }
+  for (const auto& col : *indexItem->include_fields_ref()) {
+    auto propName = col.get_name();
+    auto val = readValueWithLatestSche(reader, propName, latestSchema);
+    if (!val.ok()) {
+      LOG(ERROR) << "prop error by : " << propName << ". status : " << val.status();
+      return val.status();
+    }
+    values.emplace_back(std::move(val).value());
+  }
+  return values;
+}
+
 // static
 StatusOr<Value> IndexKeyUtils::readValueWithLatestSche(RowReader* reader,
                                                        const std::string propName,
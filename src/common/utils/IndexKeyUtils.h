@@ -8,6 +8,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <optional>
 
 #include "codec/RowReader.h"
 #include "common/base/Base.h"
@@ -542,13 +543,34 @@ class IndexKeyUtils final {
 
   static std::string indexVal(const Value& v);
 
+  /**
+   * @brief Index value of a covering index, the values of the included columns are stored after
+   * the ttl value. An empty value is stored as the ttl value if there is no ttl.
+   */
+  static std::string indexVal(const Value& ttl, std::vector<Value> includeValues);
+
   static Value parseIndexTTL(const folly::StringPiece& raw);
 
+  /**
+   * @brief Parse the values of the included columns from index value, in the order of
+   * include_fields of index. Return none if they are not stored, e.g. the index value was written
+   * before the index had included columns, then they need to be read from the data.
+   */
+  static std::optional<std::vector<Value>> parseIndexIncludes(const folly::StringPiece& raw);
+
   static StatusOr<std::vector<std::string>> collectIndexValues(
       RowReader* reader,
       const meta::cpp2::IndexItem* indexItem,
       const meta::SchemaProviderIf* latestSchema = nullptr);
 
+  /**
+   * @brief Read the values of include_fields of index from row
+   */
+  static StatusOr<std::vector<Value>> collectIncludeValues(
+      RowReader* reader,
+      const meta::cpp2::IndexItem* indexItem,
+      const meta::SchemaProviderIf* latestSchema = nullptr);
+
  private:
   IndexKeyUtils() = delete;
 
@@ -0,0 +1,119 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "common/utils/IndexStatsUtils.h"
+
+namespace nebula {
+
+namespace {
+
+// Append bucket into an equi-depth histogram sorted by upper bound, it's merged into the last
+// bucket if the last one has less than depth values
+void appendBucket(std::vector<meta::cpp2::HistogramBucket>& buckets,
+                  const meta::cpp2::HistogramBucket& bucket,
+                  int64_t depth) {
+  if (buckets.empty() || buckets.back().get_count() >= depth) {
+    buckets.emplace_back(bucket);
+    return;
+  }
+  auto& last = buckets.back();
+  last.upper_ref() = bucket.get_upper();
+  *last.count_ref() += bucket.get_count();
+}
+
+}  // namespace
+
+IndexStatsBuilder::IndexStatsBuilder(size_t numBuckets) : numBuckets_(numBuckets) {
+  buckets_.reserve(numBuckets_ * 2 + 1);
+}
+
+void IndexStatsBuilder::add(const Value& value) {
+  numKeys_++;
+  if (value.isNull()) {
+    numNulls_++;
+    return;
+  }
+  sketch_.add(std::hash<Value>()(value));
+  meta::cpp2::HistogramBucket bucket;
+  bucket.upper_ref() = value;
+  bucket.count_ref() = 1;
+  appendBucket(buckets_, bucket, depth_);
+  if (buckets_.size() > numBuckets_ * 2) {
+    // Merge adjacent buckets, the number of buckets is between numBuckets and 2 * numBuckets
+    std::vector<meta::cpp2::HistogramBucket> merged;
+    merged.reserve(numBuckets_ * 2 + 1);
+    depth_ *= 2;
+    for (auto& b : buckets_) {
+      appendBucket(merged, b, depth_);
+    }
+    buckets_ = std::move(merged);
+  }
+}
+
+meta::cpp2::IndexStats IndexStatsBuilder::finish() {
+  meta::cpp2::IndexStats stats;
+  stats.num_keys_ref() = numKeys_;
+  stats.num_nulls_ref() = numNulls_;
+  stats.ndv_sketch_ref() = sketch_.serialize();
+  stats.histogram_ref() = std::move(buckets_);
+  return stats;
+}
+
+// static
+void IndexStatsUtils::merge(meta::cpp2::IndexStats& lhs, const meta::cpp2::IndexStats& rhs) {
+  *lhs.num_keys_ref() += rhs.get_num_keys();
+  *lhs.num_nulls_ref() += rhs.get_num_nulls();
+
+  auto sketch = algorithm::HyperLogLog::deserialize(lhs.get_ndv_sketch());
+  sketch.merge(algorithm::HyperLogLog::deserialize(rhs.get_ndv_sketch()));
+  lhs.ndv_sketch_ref() = sketch.serialize();
+
+  // Sort the buckets of both histograms by upper bound, and rebuild the equi-depth histogram
+  std::vector<meta::cpp2::HistogramBucket> all = lhs.get_histogram();
+  all.insert(all.end(), rhs.get_histogram().begin(), rhs.get_histogram().end());
+  std::stable_sort(all.begin(), all.end(), [](const auto& l, const auto& r) {
+    return l.get_upper() < r.get_upper();
+  });
+  int64_t total = 0;
+  for (auto& b : all) {
+    total += b.get_count();
+  }
+  auto depth = std::max<int64_t>(1, (total + kNumBuckets - 1) / kNumBuckets);
+  std::vector<meta::cpp2::HistogramBucket> merged;
+  merged.reserve(kNumBuckets + 1);
+  for (auto& b : all) {
+    appendBucket(merged, b, depth);
+  }
+  lhs.histogram_ref() = std::move(merged);
+}
+
+// static
+void IndexStatsUtils::merge(meta::cpp2::DegreeStats& lhs, const meta::cpp2::DegreeStats& rhs) {
+  *lhs.num_sources_ref() += rhs.get_num_sources();
+  lhs.max_degree_ref() = std::max(lhs.get_max_degree(), rhs.get_max_degree());
+}
+
+// static
+void IndexStatsUtils::mergeStatsItem(meta::cpp2::StatsItem& lhs,
+                                     const meta::cpp2::StatsItem& rhs) {
+  if (rhs.index_stats_ref().has_value()) {
+    if (!lhs.index_stats_ref().has_value()) {
+      lhs.index_stats_ref() = {};
+    }
+    for (auto& it : *rhs.index_stats_ref()) {
+      merge((*lhs.index_stats_ref())[it.first], it.second);
+    }
+  }
+  if (rhs.edge_degrees_ref().has_value()) {
+    if (!lhs.edge_degrees_ref().has_value()) {
+      lhs.edge_degrees_ref() = {};
+    }
+    for (auto& it : *rhs.edge_degrees_ref()) {
+      merge((*lhs.edge_degrees_ref())[it.first], it.second);
+    }
+  }
+}
+
+}  // namespace nebula
@@ -0,0 +1,63 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_UTILS_INDEXSTATSUTILS_H_
+#define COMMON_UTILS_INDEXSTATSUTILS_H_
+
+#include "common/algorithm/HyperLogLog.h"
+#include "common/base/Base.h"
+#include "common/datatypes/Value.h"
+#include "interface/gen-cpp2/meta_types.h"
+
+namespace nebula {
+
+/**
+ * @brief Build the statistics of the first column of an index while its keys are scanned.
+ */
+class IndexStatsBuilder final {
+ public:
+  explicit IndexStatsBuilder(size_t numBuckets);
+
+  /**
+   * @brief Add the first column of an index key, the keys must be added in the order of index, so
+   * the histogram is built in one pass without knowing the number of keys
+   */
+  void add(const Value& value);
+
+  meta::cpp2::IndexStats finish();
+
+ private:
+  size_t numBuckets_;
+  // The number of values of a full bucket, doubled when adjacent buckets are merged
+  int64_t depth_{1};
+  int64_t numKeys_{0};
+  int64_t numNulls_{0};
+  algorithm::HyperLogLog sketch_;
+  std::vector<meta::cpp2::HistogramBucket> buckets_;
+};
+
+/**
+ * @brief Merge the statistics of indexes and edge degrees collected on different parts.
+ */
+class IndexStatsUtils final {
+ public:
+  // The number of buckets of the histogram of an index
+  static constexpr size_t kNumBuckets = 64;
+
+  static void merge(meta::cpp2::IndexStats& lhs, const meta::cpp2::IndexStats& rhs);
+
+  static void merge(meta::cpp2::DegreeStats& lhs, const meta::cpp2::DegreeStats& rhs);
+
+  /**
+   * @brief Merge index_stats and edge_degrees of rhs into lhs
+   */
+  static void mergeStatsItem(meta::cpp2::StatsItem& lhs, const meta::cpp2::StatsItem& rhs);
+
+ private:
+  IndexStatsUtils() = delete;
+};
+
+}  // namespace nebula
+#endif  // COMMON_UTILS_INDEXSTATSUTILS_H_
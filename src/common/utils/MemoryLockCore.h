@@ -6,16 +6,43 @@
 #ifndef COMMON_UTILS_MEMORYLOCKCORE_H
 #define COMMON_UTILS_MEMORYLOCKCORE_H
 
-#include <folly/concurrency/ConcurrentHashMap.h>
+#include <folly/hash/Hash.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 
 #include "common/base/Base.h"
 
 namespace nebula {
 
+/**
+ * @brief In-memory locks of keys. The keys are sharded by hash, every shard has its own mutex.
+ * A lock either fails at once when the key is held (try_lock, lockBatch without wait), or waits
+ * in the FIFO queue of the key for a bounded time. Batches with wait are acquired in the order of
+ * keys, so they never deadlock each other.
+ */
 template <typename Key>
 class MemoryLockCore {
  public:
-  MemoryLockCore() = default;
+  static constexpr size_t kDefaultShards = 32;
+
+  // Counters of a shard
+  struct Stats {
+    // Number of locks acquired, with or without wait
+    int64_t acquired{0};
+    // Number of locks failed at once
+    int64_t conflicts{0};
+    // Number of locks waited in queue
+    int64_t waits{0};
+    // Number of waits timed out
+    int64_t timeouts{0};
+    // Total time of waits in microseconds
+    int64_t waitUs{0};
+  };
+
+  explicit MemoryLockCore(size_t numShards = kDefaultShards)
+      : shards_(std::max<size_t>(1, numShards)) {}
 
   ~MemoryLockCore() = default;
 
@@ -28,20 +55,42 @@ class MemoryLockCore {
   }
 
   bool try_lock(const Key& key) {
-    return hashMap_.insert(std::make_pair(key, 0)).second;
+    return lock(key, std::chrono::microseconds(0));
+  }
+
+  /**
+   * @brief Lock key, wait at most `wait` in the queue of key if it's held
+   */
+  bool lock(const Key& key, std::chrono::microseconds wait) {
+    return lockUntil(key, std::chrono::steady_clock::now() + wait);
   }
 
+  /**
+   * @brief Unlock key, the lock is handed over to the first waiter of key if any
+   */
   void unlock(const Key& key) {
-    hashMap_.erase(key);
+    auto& shard = shardOf(key);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    auto iter = shard.entries.find(key);
+    if (iter == shard.entries.end()) {
+      return;
+    }
+    auto& waiters = iter->second;
+    if (waiters.empty()) {
+      shard.entries.erase(iter);
+      return;
+    }
+    auto* waiter = waiters.front();
+    waiters.pop_front();
+    waiter->granted = true;
+    waiter->cv.notify_one();
   }
 
   template <class Iter>
   std::pair<Iter, bool> lockBatch(Iter begin, Iter end) {
     Iter curr = begin;
-    bool inserted = false;
     while (curr != end) {
-      std::tie(std::ignore, inserted) = hashMap_.insert(std::make_pair(*curr, 0));
-      if (!inserted) {
+      if (!try_lock(*curr)) {
         unlockBatch(begin, curr);
         return std::make_pair(curr, false);
       }
@@ -55,10 +104,41 @@ class MemoryLockCore {
     return lockBatch(collection.begin(), collection.end());
   }
 
+  /**
+   * @brief Lock all keys in [begin, end), wait at most `wait` in total. The keys are locked in
+   * order, and all locked keys are released if any key failed.
+   *
+   * @return std::pair<Iter, bool> The first conflict key if failed, duplicated keys conflict
+   */
+  template <class Iter>
+  std::pair<Iter, bool> lockBatch(Iter begin, Iter end, std::chrono::microseconds wait) {
+    std::vector<Iter> sorted;
+    for (auto iter = begin; iter != end; ++iter) {
+      sorted.emplace_back(iter);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](Iter lhs, Iter rhs) { return *lhs < *rhs; });
+    for (size_t i = 1; i < sorted.size(); ++i) {
+      if (!(*sorted[i - 1] < *sorted[i])) {
+        return std::make_pair(sorted[i], false);
+      }
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + wait;
+    for (size_t i = 0; i < sorted.size(); ++i) {
+      if (!lockUntil(*sorted[i], deadline)) {
+        for (size_t j = 0; j < i; ++j) {
+          unlock(*sorted[j]);
+        }
+        return std::make_pair(sorted[i], false);
+      }
+    }
+    return std::make_pair(end, true);
+  }
+
   template <class Iter>
   void unlockBatch(Iter begin, Iter end) {
     for (; begin != end; ++begin) {
-      hashMap_.erase(*begin);
+      unlock(*begin);
     }
   }
 
@@ -68,19 +148,93 @@ class MemoryLockCore {
   }
 
   void clear() {
-    hashMap_.clear();
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> guard(shard.lock);
+      shard.entries.clear();
+    }
   }
 
   size_t size() {
-    return hashMap_.size();
+    size_t total = 0;
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> guard(shard.lock);
+      total += shard.entries.size();
+    }
+    return total;
   }
 
   bool contains(const Key& key) {
-    return hashMap_.find(key) == hashMap_.end();
+    auto& shard = shardOf(key);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    return shard.entries.find(key) != shard.entries.end();
+  }
+
+  /**
+   * @brief Counters of every shard
+   */
+  std::vector<Stats> stats() {
+    std::vector<Stats> ret;
+    ret.reserve(shards_.size());
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> guard(shard.lock);
+      ret.emplace_back(shard.stats);
+    }
+    return ret;
   }
 
  protected:
-  folly::ConcurrentHashMap<Key, int> hashMap_;
+  struct Waiter {
+    std::condition_variable cv;
+    bool granted{false};
+  };
+
+  struct Shard {
+    std::mutex lock;
+    // A key is held iff it's in entries, with the queue of its waiters
+    std::unordered_map<Key, std::deque<Waiter*>> entries;
+    Stats stats;
+  };
+
+  Shard& shardOf(const Key& key) {
+    return shards_[std::hash<Key>()(key) % shards_.size()];
+  }
+
+  bool lockUntil(const Key& key, std::chrono::steady_clock::time_point deadline) {
+    auto& shard = shardOf(key);
+    std::unique_lock<std::mutex> guard(shard.lock);
+    auto [iter, inserted] = shard.entries.try_emplace(key);
+    if (inserted) {
+      shard.stats.acquired++;
+      return true;
+    }
+    auto start = std::chrono::steady_clock::now();
+    if (deadline <= start) {
+      shard.stats.conflicts++;
+      return false;
+    }
+
+    Waiter waiter;
+    iter->second.emplace_back(&waiter);
+    shard.stats.waits++;
+    auto granted = waiter.cv.wait_until(guard, deadline, [&waiter] { return waiter.granted; });
+    shard.stats.waitUs += std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+    if (granted) {
+      shard.stats.acquired++;
+      return true;
+    }
+    // Leave the queue, which may have been cleared
+    shard.stats.timeouts++;
+    iter = shard.entries.find(key);
+    if (iter != shard.entries.end()) {
+      auto& waiters = iter->second;
+      waiters.erase(std::remove(waiters.begin(), waiters.end(), &waiter), waiters.end());
+    }
+    return false;
+  }
+
+  std::vector<Shard> shards_;
 };
 
 }  // namespace nebula
@@ -13,22 +13,29 @@
 namespace nebula {
 
 // RAII style to easily control the lock acquire / release
+// If wait is positive, the keys are locked in order and wait at most that long for the holders,
+// otherwise the guard fails at once when any key is held.
 template <class Key>
 class MemoryLockGuard {
  public:
-  MemoryLockGuard(MemoryLockCore<Key>* lock, const Key& key)
-      : MemoryLockGuard(lock, std::vector<Key>{key}) {}
+  MemoryLockGuard(MemoryLockCore<Key>* lock,
+                  const Key& key,
+                  std::chrono::microseconds wait = std::chrono::microseconds(0))
+      : MemoryLockGuard(lock, std::vector<Key>{key}, false, true, wait) {}
 
   MemoryLockGuard(MemoryLockCore<Key>* lock,
                   const std::vector<Key>& keys,
                   bool dedup = false,
-                  bool prepCheck = true)
+                  bool prepCheck = true,
+                  std::chrono::microseconds wait = std::chrono::microseconds(0))
       : lock_(lock), keys_(keys) {
     if (dedup) {
       std::sort(keys_.begin(), keys_.end());
       keys_.erase(unique(keys_.begin(), keys_.end()), keys_.end());
     }
-    if (prepCheck) {
+    if (prepCheck && wait.count() > 0) {
+      std::tie(iter_, locked_) = lock_->lockBatch(keys_.begin(), keys_.end(), wait);
+    } else if (prepCheck) {
       std::tie(iter_, locked_) = lock_->lockBatch(keys_);
     } else {
       locked_ = true;
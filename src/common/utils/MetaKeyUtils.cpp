@@ -56,7 +56,8 @@ static const std::unordered_map<
                  {"ft_index", {"__ft_index__", nullptr}},
                  {"local_id", {"__local_id__", MetaKeyUtils::parseLocalIdSpace}},
                  {"disk_parts", {"__disk_parts__", MetaKeyUtils::parseDiskPartsSpace}},
-                 {"job_manager", {"__job_mgr__", nullptr}}};
+                 {"job_manager", {"__job_mgr__", nullptr}},
+                 {"space_update_time", {"__space_update_time__", nullptr}}};
 
 // clang-format off
 static const std::string kSpacesTable         = tableMaps.at("spaces").first;         // NOLINT
@@ -100,6 +101,7 @@ static const std::string kStatsTable          = tableMaps.at("stats").first;
 static const std::string kBalanceTaskTable    = tableMaps.at("balance_task").first;     // NOLINT
 static const std::string kBalancePlanTable    = tableMaps.at("balance_plan").first;     // NOLINT
 static const std::string kLocalIdTable        = tableMaps.at("local_id").first;         // NOLINT
+static const std::string kSpaceUpdateTimeTable = tableMaps.at("space_update_time").first; // NOLINT
 
 const std::string kFTIndexTable        = tableMaps.at("ft_index").first;         // NOLINT
 const std::string kServicesTable  = systemTableMaps.at("services").first;        // NOLINT
@@ -144,6 +146,22 @@ std::string MetaKeyUtils::lastUpdateTimeVal(const int64_t timeInMilliSec) {
   return val;
 }
 
+std::string MetaKeyUtils::spaceLastUpdateTimeKey(GraphSpaceID spaceId) {
+  std::string key;
+  key.reserve(kSpaceUpdateTimeTable.size() + sizeof(GraphSpaceID));
+  key.append(kSpaceUpdateTimeTable.data(), kSpaceUpdateTimeTable.size())
+      .append(reinterpret_cast<const char*>(&spaceId), sizeof(GraphSpaceID));
+  return key;
+}
+
+const std::string& MetaKeyUtils::spaceLastUpdateTimePrefix() {
+  return kSpaceUpdateTimeTable;
+}
+
+GraphSpaceID MetaKeyUtils::parseSpaceLastUpdateTimeKeySpaceId(folly::StringPiece rawKey) {
+  return *reinterpret_cast<const GraphSpaceID*>(rawKey.data() + kSpaceUpdateTimeTable.size());
+}
+
 std::string MetaKeyUtils::spaceKey(GraphSpaceID spaceId) {
   std::string key;
   key.reserve(kSpacesTable.size() + sizeof(GraphSpaceID));
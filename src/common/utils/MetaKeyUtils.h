@@ -72,6 +72,20 @@ class MetaKeyUtils final {
 
   static std::string lastUpdateTimeVal(const int64_t timeInMilliSec);
 
+  /**
+   * @brief Key of the last update time of one space, it is updated together with the global
+   * last update time when the schemas, indexes, listeners or properties of the space change. The
+   * value is encoded by lastUpdateTimeVal.
+   *
+   * @param spaceId
+   * @return
+   */
+  static std::string spaceLastUpdateTimeKey(GraphSpaceID spaceId);
+
+  static const std::string& spaceLastUpdateTimePrefix();
+
+  static GraphSpaceID parseSpaceLastUpdateTimeKeySpaceId(folly::StringPiece rawKey);
+
   static std::string spaceKey(GraphSpaceID spaceId);
 
   static std::string spaceVal(const meta::cpp2::SpaceDesc& spaceDesc);
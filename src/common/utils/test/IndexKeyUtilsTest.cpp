@@ -12,6 +12,7 @@
 #include "common/datatypes/Geography.h"
 #include "common/geo/GeoIndex.h"
 #include "common/utils/IndexKeyUtils.h"
+#include "common/utils/IndexStatsUtils.h"
 
 namespace nebula {
 
@@ -204,6 +205,33 @@ TEST(IndexKeyUtilsTest, encodeDouble) {
   EXPECT_TRUE(evalDouble(600.5));
 }
 
+TEST(IndexKeyUtilsTest, indexValWithIncludes) {
+  {
+    // ttl value only
+    auto val = IndexKeyUtils::indexVal(Value(100L));
+    ASSERT_EQ(Value(100L), IndexKeyUtils::parseIndexTTL(val));
+    ASSERT_FALSE(IndexKeyUtils::parseIndexIncludes(val).has_value());
+    ASSERT_FALSE(IndexKeyUtils::parseIndexIncludes("").has_value());
+  }
+  {
+    std::vector<Value> includes = {Value(1L), Value("Tim"), Value(NullType::__NULL__)};
+    auto val = IndexKeyUtils::indexVal(Value(100L), includes);
+    ASSERT_EQ(Value(100L), IndexKeyUtils::parseIndexTTL(val));
+    auto ret = IndexKeyUtils::parseIndexIncludes(val);
+    ASSERT_TRUE(ret.has_value());
+    ASSERT_EQ(includes, ret.value());
+  }
+  {
+    // no ttl
+    std::vector<Value> includes = {Value(1.5)};
+    auto val = IndexKeyUtils::indexVal(Value(), includes);
+    ASSERT_TRUE(IndexKeyUtils::parseIndexTTL(val).empty());
+    auto ret = IndexKeyUtils::parseIndexIncludes(val);
+    ASSERT_TRUE(ret.has_value());
+    ASSERT_EQ(includes, ret.value());
+  }
+}
+
 TEST(IndexKeyUtilsTest, vertexIndexKeyV1) {
   auto values = getIndexValues();
   auto key = IndexKeyUtils::vertexIndexKeys(8, 1, 1, getStringId(1), {std::move(values)})[0];
@@ -597,6 +625,47 @@ TEST(IndexKeyUtilsTest, getValueFromIndexKeyTest) {
   }
 }
 
+TEST(IndexKeyUtilsTest, indexStats) {
+  auto build = [](int64_t begin, int64_t end) {
+    IndexStatsBuilder builder(IndexStatsUtils::kNumBuckets);
+    builder.add(Value::kNullValue);
+    for (auto i = begin; i < end; i++) {
+      builder.add(Value(i));
+    }
+    return builder.finish();
+  };
+
+  auto stats = build(0, 1000);
+  EXPECT_EQ(1001, stats.get_num_keys());
+  EXPECT_EQ(1, stats.get_num_nulls());
+  EXPECT_NEAR(1000, algorithm::HyperLogLog::deserialize(stats.get_ndv_sketch()).estimate(), 100);
+  const auto& histogram = stats.get_histogram();
+  EXPECT_GE(histogram.size(), IndexStatsUtils::kNumBuckets);
+  EXPECT_LE(histogram.size(), IndexStatsUtils::kNumBuckets * 2);
+  EXPECT_EQ(Value(999), histogram.back().get_upper());
+  int64_t total = 0;
+  for (size_t i = 0; i < histogram.size(); i++) {
+    total += histogram[i].get_count();
+    if (i > 0) {
+      EXPECT_LT(histogram[i - 1].get_upper(), histogram[i].get_upper());
+    }
+  }
+  EXPECT_EQ(1000, total);
+
+  // Merge the statistics of overlapped parts
+  IndexStatsUtils::merge(stats, build(500, 1500));
+  EXPECT_EQ(2002, stats.get_num_keys());
+  EXPECT_EQ(2, stats.get_num_nulls());
+  EXPECT_NEAR(1500, algorithm::HyperLogLog::deserialize(stats.get_ndv_sketch()).estimate(), 150);
+  EXPECT_LE(stats.get_histogram().size(), IndexStatsUtils::kNumBuckets + 1);
+  EXPECT_EQ(Value(1499), stats.get_histogram().back().get_upper());
+  total = 0;
+  for (auto& bucket : stats.get_histogram()) {
+    total += bucket.get_count();
+  }
+  EXPECT_EQ(2000, total);
+}
+
 }  // namespace nebula
 
 int main(int argc, char** argv) {
@@ -54,6 +54,9 @@ void ExecutionContext::truncHistory(const std::string& name, size_t numVersionsT
 
 // Get the latest version of the value
 const Value& ExecutionContext::getValue(const std::string& name) const {
+  if (UNLIKELY(trackReads_)) {
+    reads_.emplace(name);
+  }
   return getResult(name).value();
 }
 
@@ -90,6 +93,9 @@ void ExecutionContext::setVersionedResult(const std::string& name,
 }
 
 const Result& ExecutionContext::getVersionedResult(const std::string& name, int64_t version) const {
+  if (UNLIKELY(trackReads_)) {
+    reads_.emplace(name);
+  }
   auto& result = getHistory(name);
   auto size = result.size();
   if (static_cast<size_t>(std::abs(version)) >= size) {
@@ -99,6 +105,23 @@ const Result& ExecutionContext::getVersionedResult(const std::string& name, int6
   }
 }
 
+void ExecutionContext::copyFrom(const ExecutionContext& other) {
+  for (const auto& var : other.valueMap_) {
+    if (exist(var.first)) {
+      continue;
+    }
+    auto& hist = valueMap_[var.first];
+    hist.reserve(var.second.size());
+    for (const auto& result : var.second) {
+      hist.emplace_back(ResultBuilder()
+                            .value(Value(result.value()))
+                            .iter(result.iterRef()->kind())
+                            .state(result.state())
+                            .build());
+    }
+  }
+}
+
 const std::vector<Result>& ExecutionContext::getHistory(const std::string& name) const {
   auto it = valueMap_.find(name);
   if (it != valueMap_.end()) {
@@ -72,12 +72,30 @@ class ExecutionContext {
     return valueMap_.find(name) != valueMap_.end();
   }
 
+  // Deep copies the variables of other, e.g. the ones initialized while a prepared statement
+  // was compiled, the variables already set in this context are kept.
+  void copyFrom(const ExecutionContext& other);
+
+  // Records the names of values read since then, e.g. the parameters folded into the plan
+  // while compiling
+  void trackReads(bool track) {
+    trackReads_ = track;
+    reads_.clear();
+  }
+
+  const std::unordered_set<std::string>& reads() const {
+    return reads_;
+  }
+
  private:
   friend class QueryInstance;
   Value moveValue(const std::string& name);
 
   // name -> Value with multiple versions
   std::unordered_map<std::string, std::vector<Result>> valueMap_;
+
+  bool trackReads_{false};
+  mutable std::unordered_set<std::string> reads_;
 };
 
 }  // namespace graph
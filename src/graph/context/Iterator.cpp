@@ -52,7 +52,7 @@ GetNeighborsIter::GetNeighborsIter(std::shared_ptr<Value> value, bool checkMemor
 
 void GetNeighborsIter::goToFirstEdge() {
   // Go to first edge
-  for (currentDs_ = dsIndices_.begin(); currentDs_ < dsIndices_.end(); ++currentDs_) {
+  for (currentDs_ = dsIndices_->begin(); currentDs_ < dsIndices_->end(); ++currentDs_) {
     if (noEdge_) {
       currentRow_ = currentDs_->ds->rows.begin();
       valid_ = true;
@@ -110,6 +110,7 @@ Status GetNeighborsIter::processList(std::shared_ptr<Value> value) {
     ss << "Value type is not list, type: " << value->type();
     return Status::Error(ss.str());
   }
+  std::vector<DataSetIndex> dsIndices;
   for (auto& val : value->getList().values) {
     if (UNLIKELY(!val.isDataSet())) {
       return Status::Error("There is a value in list which is not a data set.");
@@ -118,9 +119,10 @@ Status GetNeighborsIter::processList(std::shared_ptr<Value> value) {
     if (dataSet.rowSize() != 0) {
       auto status = makeDataSetIndex(dataSet);
       NG_RETURN_IF_ERROR(status);
-      dsIndices_.emplace_back(std::move(status).value());
+      dsIndices.emplace_back(std::move(status).value());
     }
   }
+  dsIndices_ = std::make_shared<const std::vector<DataSetIndex>>(std::move(dsIndices));
   return Status::OK();
 }
 
@@ -186,6 +188,16 @@ Status GetNeighborsIter::buildPropIndex(const std::string& props,
   propIdx.colIdx = columnId;
   propIdx.propList.resize(pieces.size() - 2);
   std::move(pieces.begin() + 2, pieces.end(), propIdx.propList.begin());
+  std::vector<std::string> propNames;
+  for (size_t i = 0; i < propIdx.propList.size(); ++i) {
+    auto& prop = propIdx.propList[i];
+    if (isEdge ? (prop == kSrc || prop == kDst || prop == kRank || prop == kType) : prop == kTag) {
+      continue;
+    }
+    propNames.emplace_back(prop);
+    propIdx.namedProps.emplace_back(i);
+  }
+  propIdx.propNames = std::make_shared<const PropNames>(std::move(propNames));
   std::string name = pieces[1];
   if (isEdge) {
     // The first character of the edge name is +/-.
@@ -203,7 +215,7 @@ Status GetNeighborsIter::buildPropIndex(const std::string& props,
 }
 
 bool GetNeighborsIter::valid() const {
-  return Iterator::valid() && valid_ && currentDs_ < dsIndices_.end() &&
+  return Iterator::valid() && valid_ && currentDs_ < dsIndices_->end() &&
          currentRow_ < rowsUpperBound_ && colIdx_ < currentDs_->colUpperBound;
 }
 
@@ -220,7 +232,7 @@ void GetNeighborsIter::next() {
     }
 
     // go to next dataset
-    if (++currentDs_ < dsIndices_.end()) {
+    if (++currentDs_ < dsIndices_->end()) {
       currentRow_ = currentDs_->ds->begin();
       rowsUpperBound_ = currentDs_->ds->end();
     }
@@ -266,7 +278,7 @@ void GetNeighborsIter::next() {
       }
 
       // go to next dataset
-      if (++currentDs_ < dsIndices_.end()) {
+      if (++currentDs_ < dsIndices_->end()) {
         colIdx_ = currentDs_->colLowerBound;
         currentRow_ = currentDs_->ds->begin();
         rowsUpperBound_ = currentDs_->ds->end();
@@ -274,7 +286,7 @@ void GetNeighborsIter::next() {
       }
       break;
     }
-    if (currentDs_ == dsIndices_.end()) {
+    if (currentDs_ == dsIndices_->end()) {
       break;
     }
   }
@@ -282,7 +294,7 @@ void GetNeighborsIter::next() {
 
 size_t GetNeighborsIter::size() const {
   size_t count = 0;
-  for (const auto& dsIdx : dsIndices_) {
+  for (const auto& dsIdx : *dsIndices_) {
     for (const auto& row : dsIdx.ds->rows) {
       for (const auto& edgeIdx : dsIdx.edgePropsMap) {
         const auto& cell = row[edgeIdx.second.colIdx];
@@ -297,7 +309,7 @@ size_t GetNeighborsIter::size() const {
 
 size_t GetNeighborsIter::numRows() const {
   size_t count = 0;
-  for (const auto& dsIdx : dsIndices_) {
+  for (const auto& dsIdx : *dsIndices_) {
     count += dsIdx.ds->size();
   }
   return count;
@@ -460,15 +472,12 @@ Value GetNeighborsIter::getVertex(const std::string& name) const {
     DCHECK_GE(row.size(), tagColId);
     auto& propList = row[tagColId].getList();
     DCHECK_EQ(tagPropNameList.size(), propList.values.size());
-    Tag tag;
-    tag.name = tagProp.first;
-    for (size_t i = 0; i < propList.size(); ++i) {
-      if (tagPropNameList[i] == nebula::kTag) {
-        continue;
-      }
-      tag.props.emplace(tagPropNameList[i], propList[i]);
+    std::vector<Value> values;
+    values.reserve(tagProp.second.namedProps.size());
+    for (auto i : tagProp.second.namedProps) {
+      values.emplace_back(propList[i]);
     }
-    vertex.tags.emplace_back(std::move(tag));
+    vertex.tags.emplace_back(tagProp.first, Props(tagProp.second.propNames, std::move(values)));
   }
   return Value(std::move(vertex));
 }
@@ -478,7 +487,7 @@ std::vector<Value> GetNeighborsIter::vids() {
   vids.reserve(numRows());
   valid_ = true;
   colIdx_ = -2;
-  for (currentDs_ = dsIndices_.begin(); currentDs_ < dsIndices_.end(); ++currentDs_) {
+  for (currentDs_ = dsIndices_->begin(); currentDs_ < dsIndices_->end(); ++currentDs_) {
     rowsUpperBound_ = currentDs_->ds->rows.end();
     for (currentRow_ = currentDs_->ds->rows.begin(); currentRow_ < currentDs_->ds->rows.end();
          ++currentRow_) {
@@ -494,7 +503,7 @@ List GetNeighborsIter::getVertices() {
   vertices.reserve(numRows());
   valid_ = true;
   colIdx_ = -2;
-  for (currentDs_ = dsIndices_.begin(); currentDs_ < dsIndices_.end(); ++currentDs_) {
+  for (currentDs_ = dsIndices_->begin(); currentDs_ < dsIndices_->end(); ++currentDs_) {
     rowsUpperBound_ = currentDs_->ds->rows.end();
     for (currentRow_ = currentDs_->ds->rows.begin(); currentRow_ < currentDs_->ds->rows.end();
          ++currentRow_) {
@@ -549,16 +558,14 @@ Value GetNeighborsIter::getEdge() const {
   if (edgeProp == edgePropMap.end()) {
     return Value::kNullValue;
   }
-  auto& edgeNamePropList = edgeProp->second.propList;
   auto& propList = currentEdge_->values;
-  DCHECK_EQ(edgeNamePropList.size(), propList.size());
-  for (size_t i = 0; i < propList.size(); ++i) {
-    auto propName = edgeNamePropList[i];
-    if (propName == kDst || propName == kRank || propName == kType || propName == kSrc) {
-      continue;
-    }
-    edge.props.emplace(edgeNamePropList[i], propList[i]);
+  DCHECK_EQ(edgeProp->second.propList.size(), propList.size());
+  std::vector<Value> values;
+  values.reserve(edgeProp->second.namedProps.size());
+  for (auto i : edgeProp->second.namedProps) {
+    values.emplace_back(propList[i]);
   }
+  edge.props = Props(edgeProp->second.propNames, std::move(values));
   return Value(std::move(edge));
 }
 
@@ -602,7 +609,7 @@ void GetNeighborsIter::nextCol() {
     }
 
     // go to next dataset
-    if (++currentDs_ < dsIndices_.end()) {
+    if (++currentDs_ < dsIndices_->end()) {
       colIdx_ = currentDs_->colLowerBound;
       currentRow_ = currentDs_->ds->begin();
       rowsUpperBound_ = currentDs_->ds->end();
@@ -610,7 +617,7 @@ void GetNeighborsIter::nextCol() {
     }
     break;
   }
-  if (currentDs_ == dsIndices_.end()) {
+  if (currentDs_ == dsIndices_->end()) {
     return;
   }
 }
@@ -627,7 +634,7 @@ SequentialIter::SequentialIter(const SequentialIter& iter)
   auto& ds = valuePtr->mutableDataSet();
   iter_ = ds.rows.begin();
   rows_ = &ds.rows;
-  colIndices_ = iter.getColIndices();
+  colIndices_ = iter.colIndices_;
 }
 
 SequentialIter::SequentialIter(std::shared_ptr<Value> value, bool checkMemory)
@@ -636,9 +643,11 @@ SequentialIter::SequentialIter(std::shared_ptr<Value> value, bool checkMemory)
   auto& ds = value->mutableDataSet();
   iter_ = ds.rows.begin();
   rows_ = &ds.rows;
+  auto colIndices = std::make_shared<std::unordered_map<std::string, size_t>>();
   for (size_t i = 0; i < ds.colNames.size(); ++i) {
-    colIndices_.emplace(ds.colNames[i], i);
+    colIndices->emplace(ds.colNames[i], i);
   }
+  colIndices_ = std::move(colIndices);
 }
 
 SequentialIter::SequentialIter(std::unique_ptr<Iterator> left, std::unique_ptr<Iterator> right)
@@ -658,7 +667,7 @@ void SequentialIter::init(std::vector<std::unique_ptr<Iterator>>&& iterators) {
   DCHECK(!iterators.empty());
   const auto& firstIter = iterators.front();
   DCHECK(firstIter->isSequentialIter());
-  colIndices_ = static_cast<const SequentialIter*>(firstIter.get())->getColIndices();
+  colIndices_ = static_cast<const SequentialIter*>(firstIter.get())->colIndices_;
   DataSet ds;
   for (auto& iter : iterators) {
     DCHECK(iter->isSequentialIter());
@@ -714,8 +723,8 @@ const Value& SequentialIter::getColumn(const std::string& col) const {
     return Value::kNullValue;
   }
   auto& row = *iter_;
-  auto index = colIndices_.find(col);
-  if (index == colIndices_.end()) {
+  auto index = colIndices_->find(col);
+  if (index == colIndices_->end()) {
     return Value::kNullValue;
   }
 
@@ -728,8 +737,8 @@ const Value& SequentialIter::getColumn(int32_t index) const {
 }
 
 StatusOr<std::size_t> SequentialIter::getColumnIndex(const std::string& col) const {
-  auto index = colIndices_.find(col);
-  if (index == colIndices_.end()) {
+  auto index = colIndices_->find(col);
+  if (index == colIndices_->end()) {
     return Status::Error("Don't exist column `%s'.", col.c_str());
   }
   return index->second;
@@ -743,8 +752,7 @@ Value SequentialIter::getEdge() const {
   return getColumn("EDGE");
 }
 
-PropIter::PropIter(const PropIter& iter) : SequentialIter(iter) {
-  dsIndex_ = iter.dsIndex_;
+PropIter::PropIter(const PropIter& iter) : SequentialIter(iter), dsIndex_(iter.dsIndex_) {
   kind_ = Kind::kProp;
 }
 
@@ -762,26 +770,55 @@ PropIter::PropIter(std::shared_ptr<Value> value, bool checkMemory)
 }
 
 Status PropIter::makeDataSetIndex(const DataSet& ds) {
-  dsIndex_.ds = &ds;
+  auto dsIndex = std::make_shared<DataSetIndex>();
+  dsIndex_ = dsIndex;
+  dsIndex->ds = &ds;
   auto& colNames = ds.colNames;
   for (size_t i = 0; i < colNames.size(); ++i) {
-    dsIndex_.colIndices.emplace(colNames[i], i);
+    dsIndex->colIndices.emplace(colNames[i], i);
     auto& colName = colNames[i];
     if (colName.find(".") != std::string::npos) {
-      NG_RETURN_IF_ERROR(buildPropIndex(colName, i));
+      NG_RETURN_IF_ERROR(buildPropIndex(colName, i, dsIndex.get()));
     }
   }
+  buildPropNames(dsIndex.get());
   return Status::OK();
 }
 
-Status PropIter::buildPropIndex(const std::string& props, size_t columnId) {
+void PropIter::buildPropNames(DataSetIndex* dsIndex) {
+  for (auto& propIndices : dsIndex->propsMap) {
+    std::vector<std::string> tagProps;
+    std::vector<std::string> edgeProps;
+    NamedProps tagNamed;
+    NamedProps edgeNamed;
+    for (auto& propIndex : propIndices.second) {
+      auto& prop = propIndex.first;
+      if (prop != kTag) {
+        tagProps.emplace_back(prop);
+        tagNamed.cols.emplace_back(propIndex.second);
+      }
+      if (prop != kSrc && prop != kDst && prop != kType && prop != kRank) {
+        edgeProps.emplace_back(prop);
+        edgeNamed.cols.emplace_back(propIndex.second);
+      }
+    }
+    tagNamed.names = std::make_shared<const PropNames>(std::move(tagProps));
+    edgeNamed.names = std::make_shared<const PropNames>(std::move(edgeProps));
+    dsIndex->tagPropNames.emplace(propIndices.first, std::move(tagNamed));
+    dsIndex->edgePropNames.emplace(propIndices.first, std::move(edgeNamed));
+  }
+}
+
+Status PropIter::buildPropIndex(const std::string& props,
+                                size_t columnId,
+                                DataSetIndex* dsIndex) {
   std::vector<std::string> pieces;
   folly::split(".", props, pieces);
   if (UNLIKELY(pieces.size() != 2)) {
     return Status::Error("Bad column name format: %s", props.c_str());
   }
   std::string name = pieces[0];
-  auto& propsMap = dsIndex_.propsMap;
+  auto& propsMap = dsIndex->propsMap;
   if (propsMap.find(name) != propsMap.end()) {
     propsMap[name].emplace(pieces[1], columnId);
   } else {
@@ -797,8 +834,8 @@ const Value& PropIter::getColumn(const std::string& col) const {
     return Value::kNullValue;
   }
 
-  auto index = dsIndex_.colIndices.find(col);
-  if (index == dsIndex_.colIndices.end()) {
+  auto index = dsIndex_->colIndices.find(col);
+  if (index == dsIndex_->colIndices.end()) {
     return Value::kNullValue;
   }
   auto& row = *iter_;
@@ -807,8 +844,8 @@ const Value& PropIter::getColumn(const std::string& col) const {
 }
 
 StatusOr<std::size_t> PropIter::getColumnIndex(const std::string& col) const {
-  auto index = dsIndex_.colIndices.find(col);
-  if (index == dsIndex_.colIndices.end()) {
+  auto index = dsIndex_->colIndices.find(col);
+  if (index == dsIndex_->colIndices.end()) {
     return Status::Error("Don't exist column `%s'.", col.c_str());
   }
   return index->second;
@@ -818,7 +855,7 @@ const Value& PropIter::getProp(const std::string& name, const std::string& prop)
   if (!valid()) {
     return Value::kNullValue;
   }
-  auto& propsMap = dsIndex_.propsMap;
+  auto& propsMap = dsIndex_->propsMap;
   size_t colId = 0;
   auto& row = *iter_;
   if (name == "*") {
@@ -864,7 +901,7 @@ Value PropIter::getVertex(const std::string& name) const {
   }
   Vertex vertex;
   vertex.vid = vidVal;
-  auto& tagPropsMap = dsIndex_.propsMap;
+  auto& tagPropsMap = dsIndex_->propsMap;
   bool isVertexProps = true;
   auto& row = *iter_;
   // tagPropsMap -> <std::string, std::unordered_map<std::string, size_t> >
@@ -881,16 +918,13 @@ Value PropIter::getVertex(const std::string& name) const {
       isVertexProps = true;
       continue;
     }
-    Tag tag;
-    tag.name = tagProp.first;
-    for (auto& propIndex : tagProp.second) {
-      if (propIndex.first == nebula::kTag) {  // "_tag"
-        continue;
-      } else {
-        tag.props.emplace(propIndex.first, row[propIndex.second]);
-      }
+    auto& namedProps = dsIndex_->tagPropNames.at(tagProp.first);
+    std::vector<Value> values;
+    values.reserve(namedProps.cols.size());
+    for (auto col : namedProps.cols) {
+      values.emplace_back(row[col]);
     }
-    vertex.tags.emplace_back(std::move(tag));
+    vertex.tags.emplace_back(tagProp.first, Props(namedProps.names, std::move(values)));
   }
   return Value(std::move(vertex));
 }
@@ -900,7 +934,7 @@ Value PropIter::getEdge() const {
     return Value::kNullValue;
   }
   Edge edge;
-  auto& edgePropsMap = dsIndex_.propsMap;
+  auto& edgePropsMap = dsIndex_->propsMap;
   bool isEdgeProps = true;
   auto& row = *iter_;
   for (auto& edgeProp : edgePropsMap) {
@@ -942,13 +976,13 @@ Value PropIter::getEdge() const {
     }
     edge.ranking = rank.getInt();
 
-    for (auto& propIndex : edgeProp.second) {
-      if (propIndex.first == kSrc || propIndex.first == kDst || propIndex.first == kType ||
-          propIndex.first == kRank) {
-        continue;
-      }
-      edge.props.emplace(propIndex.first, row[propIndex.second]);
+    auto& namedProps = dsIndex_->edgePropNames.at(edgeProp.first);
+    std::vector<Value> values;
+    values.reserve(namedProps.cols.size());
+    for (auto col : namedProps.cols) {
+      values.emplace_back(row[col]);
     }
+    edge.props = Props(namedProps.names, std::move(values));
     return Value(std::move(edge));
   }
   return Value::kNullValue;
@@ -13,6 +13,7 @@
 #include "common/algorithm/ReservoirSampling.h"
 #include "common/datatypes/DataSet.h"
 #include "common/datatypes/List.h"
+#include "common/datatypes/Props.h"
 #include "common/datatypes/Value.h"
 #include "parser/TraverseSentences.h"
 
@@ -268,7 +269,7 @@ class GetNeighborsIter final : public Iterator {
 
   void clear() override {
     valid_ = false;
-    dsIndices_.clear();
+    dsIndices_ = std::make_shared<const std::vector<DataSetIndex>>();
     reset();
   }
 
@@ -368,6 +369,10 @@ class GetNeighborsIter final : public Iterator {
     size_t colIdx;
     std::vector<std::string> propList;
     std::unordered_map<std::string, size_t> propIndices;
+    // Names of the props of tag or edge, shared by all vertices or edges built from the dataset
+    std::shared_ptr<const PropNames> propNames;
+    // Indices in propList of propNames
+    std::vector<size_t> namedProps;
   };
 
   struct DataSetIndex {
@@ -403,9 +408,11 @@ class GetNeighborsIter final : public Iterator {
   FRIEND_TEST(IteratorTest, TestHead);
 
   bool valid_{false};
-  std::vector<DataSetIndex> dsIndices_;
+  // The indices are immutable once built, so they're shared by the copies of iterator
+  std::shared_ptr<const std::vector<DataSetIndex>> dsIndices_{
+      std::make_shared<const std::vector<DataSetIndex>>()};
 
-  std::vector<DataSetIndex>::iterator currentDs_;
+  std::vector<DataSetIndex>::const_iterator currentDs_;
 
   std::vector<Row>::const_iterator currentRow_;
   std::vector<Row>::const_iterator rowsUpperBound_;
@@ -484,7 +491,7 @@ class SequentialIter : public Iterator {
   }
 
   const std::unordered_map<std::string, size_t>& getColIndices() const {
-    return colIndices_;
+    return *colIndices_;
   }
 
   size_t size() const override {
@@ -524,7 +531,8 @@ class SequentialIter : public Iterator {
  private:
   void init(std::vector<std::unique_ptr<Iterator>>&& iterators);
 
-  std::unordered_map<std::string, size_t> colIndices_;
+  // Shared by the copies of iterator
+  std::shared_ptr<const std::unordered_map<std::string, size_t>> colIndices_;
 };
 
 class PropIter final : public SequentialIter {
@@ -539,7 +547,7 @@ class PropIter final : public SequentialIter {
   }
 
   const std::unordered_map<std::string, size_t>& getColIndices() const {
-    return dsIndex_.colIndices;
+    return dsIndex_->colIndices;
   }
 
   const Value& getColumn(const std::string& col) const override;
@@ -569,7 +577,17 @@ class PropIter final : public SequentialIter {
  private:
   Status makeDataSetIndex(const DataSet& ds);
 
-  Status buildPropIndex(const std::string& props, size_t columnIdx);
+  struct DataSetIndex;
+
+  static Status buildPropIndex(const std::string& props, size_t columnIdx, DataSetIndex* dsIndex);
+
+  static void buildPropNames(DataSetIndex* dsIndex);
+
+  struct NamedProps {
+    std::shared_ptr<const PropNames> names;
+    // Columns of the props in the order of names
+    std::vector<size_t> cols;
+  };
 
   struct DataSetIndex {
     const DataSet* ds;
@@ -582,10 +600,15 @@ class PropIter final : public SequentialIter {
     // {tag1 : {prop1 : 1, prop2 : 2}
     // {edge1 : {prop1 : 4, prop2 : 5}
     std::unordered_map<std::string, std::unordered_map<std::string, size_t>> propsMap;
+    // {tag1 : [names of the props of tag1 in propsMap, columns of the props]}
+    std::unordered_map<std::string, NamedProps> tagPropNames;
+    // {edge1 : [names of the props of edge1 in propsMap, columns of the props]}
+    std::unordered_map<std::string, NamedProps> edgePropNames;
   };
 
  private:
-  DataSetIndex dsIndex_;
+  // Shared by the copies of iterator
+  std::shared_ptr<const DataSetIndex> dsIndex_;
 };
 
 std::ostream& operator<<(std::ostream& os, Iterator::Kind kind);
@@ -5,8 +5,18 @@
 
 #include "graph/context/QueryContext.h"
 
+#include "graph/service/GraphFlags.h"
+
 namespace nebula {
 namespace graph {
+namespace {
+
+// The objects of a query are made by its executors running concurrently
+std::unique_ptr<ObjectPool> makeObjPool() {
+  return std::make_unique<ObjectPool>(ConcurrentArena::kMaxShards);
+}
+
+}  // namespace
 
 QueryContext::QueryContext(RequestContextPtr rctx,
                            meta::SchemaManager* sm,
@@ -28,8 +38,16 @@ QueryContext::QueryContext() {
 }
 
 void QueryContext::init() {
-  objPool_ = std::make_unique<ObjectPool>();
+  objPool_ = makeObjPool();
   ep_ = std::make_unique<ExecutionPlan>();
+  idGen_ = std::make_unique<IdGenerator>(0);
+  symTable_ = std::make_unique<SymbolTable>(objPool_.get());
+  vctx_ = std::make_unique<ValidateContext>(std::make_unique<AnonVarGenerator>(symTable_.get()));
+  initExecution();
+}
+
+void QueryContext::initExecution() {
+  renewArena();
   ectx_ = std::make_unique<ExecutionContext>();
   // copy parameterMap into ExecutionContext
   if (rctx_) {
@@ -37,9 +55,47 @@ void QueryContext::init() {
       ectx_->setValue(std::move(item.first), std::move(item.second));
     }
   }
-  idGen_ = std::make_unique<IdGenerator>(0);
-  symTable_ = std::make_unique<SymbolTable>(objPool_.get());
-  vctx_ = std::make_unique<ValidateContext>(std::make_unique<AnonVarGenerator>(symTable_.get()));
+
+  std::shared_ptr<MemoryTracker> sessionTracker;
+  if (rctx_ && rctx_->session()) {
+    sessionTracker = rctx_->session()->memoryTracker();
+  }
+  memTracker_ = std::make_shared<MemoryTracker>(
+      "query", FLAGS_query_memory_quota_mb * 1024 * 1024, std::move(sessionTracker));
+  killed_ = false;
+  memoryKilled_ = false;
+}
+
+void QueryContext::renewArena() {
+  // The results of a query are built by its executors running concurrently
+  std::atomic_store(&arena_, std::make_shared<ConcurrentArena>(ConcurrentArena::kMaxShards));
+}
+
+void QueryContext::keepCompiled() {
+  DCHECK(compiledPool_ == nullptr);
+  compiledPool_ = std::move(objPool_);
+  objPool_ = makeObjPool();
+  compiledVars_ = std::make_unique<ExecutionContext>();
+  compiledVars_->copyFrom(*ectx_);
+}
+
+void QueryContext::reuse(RequestContextPtr rctx) {
+  DCHECK(compiledVars_ != nullptr);
+  rctx_ = std::move(rctx);
+  objPool_ = makeObjPool();
+  initExecution();
+  // The parameters of this execution are kept
+  ectx_->copyFrom(*compiledVars_);
+  // The scheduler only adds up the users of variables, the counts left by the last execution,
+  // e.g. of an untaken branch of Select or a killed query, would keep the results from dropping
+  symTable_->resetUserCounts();
+}
+
+QueryContext::RequestContextPtr QueryContext::releaseExecution() {
+  ectx_ = std::make_unique<ExecutionContext>();
+  objPool_ = std::make_unique<ObjectPool>();
+  std::atomic_store(&arena_, std::shared_ptr<ConcurrentArena>());
+  return std::move(rctx_);
 }
 
 }  // namespace graph
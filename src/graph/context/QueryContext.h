@@ -8,10 +8,12 @@
 
 #include "clients/meta/MetaClient.h"
 #include "clients/storage/StorageClient.h"
+#include "common/base/ConcurrentArena.h"
 #include "common/base/ObjectPool.h"
 #include "common/charset/Charset.h"
 #include "common/cpp/helpers.h"
 #include "common/datatypes/Value.h"
+#include "common/memory/MemoryTracker.h"
 #include "common/meta/IndexManager.h"
 #include "common/meta/SchemaManager.h"
 #include "graph/context/ExecutionContext.h"
@@ -115,6 +117,15 @@ class QueryContext {
     return objPool_.get();
   }
 
+  // The arena of the intermediate results
+  std::shared_ptr<ConcurrentArena> arena() const {
+    return std::atomic_load(&arena_);
+  }
+
+  // Allocate the results from a new arena, e.g. in each iteration of loop. The arena before is
+  // released once its results are dropped, rather than when the query ends.
+  void renewArena();
+
   int64_t genId() const {
     return idGen_->id();
   }
@@ -136,12 +147,44 @@ class QueryContext {
     return killed_.load();
   }
 
+  // Kill the query to release memory when the system memory hits the high watermark
+  void markMemoryKilled() {
+    memoryKilled_.exchange(true);
+    markKilled();
+  }
+
+  bool isMemoryKilled() const {
+    return memoryKilled_.load();
+  }
+
+  // Tracks the memory of the results and hash tables of the query
+  const std::shared_ptr<MemoryTracker>& memoryTracker() const {
+    return memTracker_;
+  }
+
+  /**
+   * @brief Keeps the plan and the variables initialized while compiling, so the query could be
+   * executed again by reuse(), e.g. a prepared statement. The objects made after it, e.g. the
+   * executors, are released after each execution.
+   */
+  void keepCompiled();
+
+  // Starts another execution of the compiled query with the request
+  void reuse(RequestContextPtr rctx);
+
+  // Releases the results of the execution and returns the request, while the compiled query is
+  // kept
+  RequestContextPtr releaseExecution();
+
   bool existParameter(const std::string& param) const {
-    return ectx_->exist(param) && (ectx_->getValue(param).type() != Value::Type::DATASET);
+    return ectx_->exist(param) &&
+           (ectx_->getResult(param).value().type() != Value::Type::DATASET);
   }
 
  private:
   void init();
+  // The states of each execution
+  void initExecution();
 
   RequestContextPtr rctx_;
   std::unique_ptr<ValidateContext> vctx_;
@@ -153,13 +196,21 @@ class QueryContext {
   meta::MetaClient* metaClient_{nullptr};
   CharsetInfo* charsetInfo_{nullptr};
 
+  // The objects made while compiling, e.g. expressions and plan nodes, if the compiled query is
+  // kept. It outlives objPool_, whose objects may refer to them.
+  std::unique_ptr<ObjectPool> compiledPool_;
+  // The variables initialized while compiling
+  std::unique_ptr<ExecutionContext> compiledVars_;
   // The Object Pool holds all internal generated objects.
   // e.g. expressions, plan nodes, executors
   std::unique_ptr<ObjectPool> objPool_;
+  std::shared_ptr<ConcurrentArena> arena_;
   std::unique_ptr<IdGenerator> idGen_;
   std::unique_ptr<SymbolTable> symTable_;
 
   std::atomic<bool> killed_{false};
+  std::atomic<bool> memoryKilled_{false};
+  std::shared_ptr<MemoryTracker> memTracker_;
 };
 
 }  // namespace graph
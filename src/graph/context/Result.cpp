@@ -7,10 +7,31 @@
 
 namespace nebula {
 namespace graph {
+namespace {
+
+thread_local const std::shared_ptr<ConcurrentArena>* currentArena = nullptr;
+
+}  // namespace
+
+ResultArenaGuard::ResultArenaGuard(std::shared_ptr<ConcurrentArena> arena)
+    : arena_(std::move(arena)), prev_(currentArena) {
+  currentArena = arena_ == nullptr ? nullptr : &arena_;
+}
+
+ResultArenaGuard::~ResultArenaGuard() {
+  currentArena = prev_;
+}
+
+const std::shared_ptr<ConcurrentArena>* ResultArenaGuard::current() {
+  return currentArena;
+}
 
 const Result& Result::EmptyResult() {
-  static Result kEmptyResult =
-      ResultBuilder().value(Value()).iter(Iterator::Kind::kDefault).build();
+  // Never allocated from the arena of any query
+  static Result kEmptyResult = ResultBuilder()
+                                   .value(std::make_shared<Value>())
+                                   .iter(Iterator::Kind::kDefault)
+                                   .build();
   return kEmptyResult;
 }
 
@@ -19,6 +40,22 @@ const std::vector<Result>& Result::EmptyResultList() {
   return kEmptyResultList;
 }
 
+void Result::detach() {
+  auto kind = core_.iter->kind();
+  // The iterators of other kinds never modify the value
+  if (kind != Iterator::Kind::kSequential && kind != Iterator::Kind::kProp) {
+    return;
+  }
+  // The iterator may view the rows merged from several results
+  auto copy = ResultBuilder()
+                  .checkMemory(core_.checkMemory)
+                  .value(Value(*core_.iter->valuePtr()))
+                  .iter(kind)
+                  .build();
+  core_.value = std::move(copy.core_.value);
+  core_.iter = std::move(copy.core_.iter);
+}
+
 ResultBuilder& ResultBuilder::iter(Iterator::Kind kind) {
   DCHECK(kind == Iterator::Kind::kDefault || core_.value)
       << "Must set value when creating non-default iterator";
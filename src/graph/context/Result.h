@@ -8,6 +8,7 @@
 
 #include <vector>
 
+#include "common/base/ConcurrentArena.h"
 #include "graph/context/Iterator.h"
 
 namespace nebula {
@@ -16,6 +17,30 @@ namespace graph {
 class ExecutionContext;
 class ResultBuilder;
 
+/**
+ * @brief The values of the results built on current thread in the scope of guard are allocated
+ * from the arena of query instead of the heap, by ArenaAllocator. The rows, lists and strings
+ * inside the values are still from the heap. The arena is released together when the query and
+ * all of the values allocated from it are destroyed.
+ */
+class ResultArenaGuard final {
+ public:
+  // arena: nullptr to allocate from the heap
+  explicit ResultArenaGuard(std::shared_ptr<ConcurrentArena> arena);
+
+  ~ResultArenaGuard();
+
+  ResultArenaGuard(const ResultArenaGuard&) = delete;
+  ResultArenaGuard& operator=(const ResultArenaGuard&) = delete;
+
+  // The arena of current thread, nullptr if out of any guard
+  static const std::shared_ptr<ConcurrentArena>* current();
+
+ private:
+  std::shared_ptr<ConcurrentArena> arena_;
+  const std::shared_ptr<ConcurrentArena>* prev_{nullptr};
+};
+
 // An executor will produce a result.
 class Result final {
  public:
@@ -72,6 +97,12 @@ class Result final {
     return {};
   }
 
+  /**
+   * @brief Copy on write, replace the value shared with others by a deep copy of the rows viewed by
+   * iterator, then the value could be modified in place. The iterator keeps its kind.
+   */
+  void detach();
+
  private:
   friend class ResultBuilder;
   friend class ExecutionContext;
@@ -128,7 +159,12 @@ class ResultBuilder final {
   }
 
   ResultBuilder& value(Value&& value) {
-    core_.value = std::make_shared<Value>(std::move(value));
+    auto* arena = ResultArenaGuard::current();
+    if (arena != nullptr) {
+      core_.value = std::allocate_shared<Value>(ArenaAllocator<Value>(*arena), std::move(value));
+    } else {
+      core_.value = std::make_shared<Value>(std::move(value));
+    }
     return *this;
   }
 
@@ -0,0 +1,82 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "graph/context/ResultStream.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "common/base/Base.h"
+#include "common/datatypes/MemoryEstimator.h"
+
+namespace nebula {
+namespace graph {
+
+Status ResultStream::reset(ExecutionPlanID id,
+                           std::string query,
+                           DataSet data,
+                           std::shared_ptr<MemoryTracker> tracker) {
+  std::lock_guard<std::mutex> g(lock_);
+  id_ = id;
+  query_ = std::move(query);
+  MemoryReservation memory(std::move(tracker));
+  auto bytes = MemoryEstimator::estimate(data);
+  NG_RETURN_IF_ERROR(memory.resize(bytes));
+  memory_ = std::move(memory);
+  totalBytes_ = bytes;
+  numRows_ = data.rows.size();
+  data_ = std::move(data);
+  offset_ = 0;
+  return Status::OK();
+}
+
+DataSet ResultStream::next() {
+  std::lock_guard<std::mutex> g(lock_);
+  DataSet batch(data_.colNames);
+  if (killed_) {
+    return batch;
+  }
+  auto begin = data_.rows.begin() + offset_;
+  auto end = data_.rows.begin() + std::min(data_.rows.size(), offset_ + batchSize_);
+  batch.rows.reserve(std::distance(begin, end));
+  std::move(begin, end, std::back_inserter(batch.rows));
+  offset_ += batch.rows.size();
+
+  // Drop the fetched rows once they take half of the vector, so each row is shifted at most
+  // once on average
+  if (offset_ * 2 >= data_.rows.size()) {
+    data_.rows.erase(data_.rows.begin(), data_.rows.begin() + offset_);
+    data_.rows.shrink_to_fit();
+    offset_ = 0;
+  }
+  // Shrinking never exceeds the quota
+  if (numRows_ > 0) {
+    auto rest = static_cast<int64_t>(data_.rows.size() - offset_);
+    UNUSED(memory_.resize(totalBytes_ / static_cast<int64_t>(numRows_) * rest));
+  }
+  return batch;
+}
+
+bool ResultStream::hasMore() const {
+  std::lock_guard<std::mutex> g(lock_);
+  return !killed_ && offset_ < data_.rows.size();
+}
+
+void ResultStream::markKilled() {
+  std::lock_guard<std::mutex> g(lock_);
+  killed_ = true;
+  data_.rows.clear();
+  data_.rows.shrink_to_fit();
+  offset_ = 0;
+  memory_.reset();
+}
+
+bool ResultStream::isKilled() const {
+  std::lock_guard<std::mutex> g(lock_);
+  return killed_;
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,87 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef GRAPH_CONTEXT_RESULTSTREAM_H_
+#define GRAPH_CONTEXT_RESULTSTREAM_H_
+
+#include <mutex>
+
+#include "common/base/Status.h"
+#include "common/datatypes/DataSet.h"
+#include "common/memory/MemoryTracker.h"
+#include "common/thrift/ThriftTypes.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * @brief The result of a query fetched by the client in batches, see
+ * GraphService::future_executeStream. The client pulls the next batch only when it's ready to
+ * consume it, so no single response of millions of rows is serialized or held by the client.
+ * The graph still builds the whole result of the query before the first batch, and keeps the
+ * rows not fetched yet until the stream is drained, only the fetched rows are released batch by
+ * batch. The stream is identified by the plan id of the query, and it keeps visible to
+ * SHOW QUERIES and KILL QUERY until it's drained.
+ */
+class ResultStream final {
+ public:
+  explicit ResultStream(size_t batchSize) : batchSize_(batchSize == 0 ? 1 : batchSize) {}
+
+  ResultStream(const ResultStream&) = delete;
+  ResultStream& operator=(const ResultStream&) = delete;
+
+  /**
+   * @brief Takes the result of the query, whose memory is reserved from tracker rather than
+   * the query, which is finished before the result is drained.
+   */
+  Status reset(ExecutionPlanID id,
+               std::string query,
+               DataSet data,
+               std::shared_ptr<MemoryTracker> tracker);
+
+  ExecutionPlanID id() const {
+    return id_;
+  }
+
+  const std::string& query() const {
+    return query_;
+  }
+
+  size_t batchSize() const {
+    return batchSize_;
+  }
+
+  /**
+   * @brief Moves out the next batch of at most batchSize rows with the column names, it's empty
+   * if there are no more rows.
+   */
+  DataSet next();
+
+  bool hasMore() const;
+
+  // Releases the rest rows, the next fetch reports the query killed
+  void markKilled();
+
+  bool isKilled() const;
+
+ private:
+  const size_t batchSize_;
+  ExecutionPlanID id_{-1};
+  std::string query_;
+
+  mutable std::mutex lock_;
+  DataSet data_;
+  // The rows before offset_ were fetched
+  size_t offset_{0};
+  size_t numRows_{0};
+  int64_t totalBytes_{0};
+  bool killed_{false};
+  MemoryReservation memory_;
+};
+
+}  // namespace graph
+}  // namespace nebula
+
+#endif  // GRAPH_CONTEXT_RESULTSTREAM_H_
@@ -72,6 +72,9 @@ class SymbolTable final {
 
   Variable* getVar(const std::string& varName);
 
+  // Reset the user count of all variables, which is counted again when the plan is scheduled
+  void resetUserCounts();
+
   void setAliasGeneratedBy(const std::vector<std::string>& aliases, const std::string& varName);
 
   StatusOr<std::string> getAliasGeneratedBy(const std::string& alias);
@@ -205,6 +205,8 @@ struct CypherContext final : AstContext {
 
 struct PatternContext {
   explicit PatternContext(PatternKind k) : kind(k) {}
+  virtual ~PatternContext() = default;
+
   const PatternKind kind;
 };
 
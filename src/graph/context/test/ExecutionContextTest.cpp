@@ -59,5 +59,95 @@ TEST(ExecutionContextTest, TestResult) {
   EXPECT_TRUE(result.valuePtr()->isDataSet());
 }
 
+TEST(ExecutionContextTest, TestResultArena) {
+  auto arena = std::make_shared<ConcurrentArena>();
+  ExecutionContext ctx;
+  {
+    ResultArenaGuard guard(arena);
+    ctx.setValue("v1", "Hello world");
+    DataSet ds({"col"});
+    for (int64_t i = 0; i < 4; ++i) {
+      ds.rows.emplace_back(Row({i}));
+    }
+    ctx.setValue("v3", Value(std::move(ds)));
+  }
+  ctx.setValue("v2", 10);
+  // The results built in the guard refer to the arena
+  EXPECT_EQ(3, arena.use_count());
+  EXPECT_EQ(Value("Hello world"), ctx.getValue("v1"));
+  EXPECT_EQ(Value(10), ctx.getValue("v2"));
+  EXPECT_EQ(nullptr, ResultArenaGuard::current());
+
+  // The arena lives until the results are destroyed
+  std::weak_ptr<ConcurrentArena> weak = arena;
+  arena.reset();
+  EXPECT_FALSE(weak.expired());
+  // The rows moved out of the results are from the heap, they don't keep the arena
+  auto ds = ctx.moveValue("v3").moveDataSet();
+  ctx.dropResult("v1");
+  ctx.dropResult("v3");
+  EXPECT_TRUE(weak.expired());
+  EXPECT_EQ(4, ds.rows.size());
+  EXPECT_EQ(Value(3), ds.rows[3].values[0]);
+}
+
+TEST(ExecutionContextTest, TestResultCopyOnWrite) {
+  DataSet ds({"col"});
+  for (int64_t i = 0; i < 4; ++i) {
+    ds.rows.emplace_back(Row({i}));
+  }
+  auto shared = ResultBuilder().value(Value(std::move(ds))).iter(Iterator::Kind::kProp).build();
+
+  // The copies of result and iterator share the value and indices
+  Result copy = shared;
+  EXPECT_EQ(shared.valuePtr(), copy.valuePtr());
+  auto iter = shared.iter();
+  EXPECT_EQ(&static_cast<PropIter*>(shared.iterRef())->getColIndices(),
+            &static_cast<PropIter*>(iter.get())->getColIndices());
+
+  copy.detach();
+  EXPECT_NE(shared.valuePtr(), copy.valuePtr());
+  EXPECT_TRUE(copy.iterRef()->isPropIter());
+  copy.iterRef()->erase();
+  EXPECT_EQ(3, copy.size());
+  EXPECT_EQ(Value(1), copy.iterRef()->getColumn("col"));
+  // Not modified by the writes of copy
+  EXPECT_EQ(4, shared.size());
+  EXPECT_EQ(Value(0), shared.iterRef()->getColumn("col"));
+}
+
+TEST(ExecutionContextTest, TestCopyFrom) {
+  ExecutionContext compiled;
+  compiled.setValue("v1", 10);
+  compiled.setValue("v2", "compiled");
+
+  ExecutionContext ctx;
+  ctx.setValue("v2", "param");
+  ctx.copyFrom(compiled);
+  EXPECT_EQ(Value(10), ctx.getValue("v1"));
+  // Not overwritten by the compiled one
+  EXPECT_EQ(Value("param"), ctx.getValue("v2"));
+  // The values are copied rather than shared
+  EXPECT_NE(ctx.getResult("v1").valuePtr(), compiled.getResult("v1").valuePtr());
+}
+
+TEST(ExecutionContextTest, TestTrackReads) {
+  ExecutionContext ctx;
+  ctx.setValue("v1", 10);
+  ctx.setValue("v2", 20);
+  ctx.getValue("v1");
+  EXPECT_TRUE(ctx.reads().empty());
+
+  ctx.trackReads(true);
+  ctx.getValue("v1");
+  ctx.getVersionedResult("v2", 0);
+  ctx.getValue("v1");
+  EXPECT_EQ((std::unordered_set<std::string>{"v1", "v2"}), ctx.reads());
+
+  ctx.trackReads(false);
+  ctx.getValue("v1");
+  EXPECT_TRUE(ctx.reads().empty());
+}
+
 }  // namespace graph
 }  // namespace nebula
@@ -0,0 +1,71 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "graph/context/ResultStream.h"
+
+namespace nebula {
+namespace graph {
+
+static DataSet makeDataSet(int64_t numRows) {
+  DataSet ds({"id", "name"});
+  for (int64_t i = 0; i < numRows; ++i) {
+    ds.rows.emplace_back(Row({i, folly::sformat("name_{}", i)}));
+  }
+  return ds;
+}
+
+TEST(ResultStreamTest, Batches) {
+  auto tracker = std::make_shared<MemoryTracker>("session", 0);
+  ResultStream stream(4);
+  EXPECT_FALSE(stream.hasMore());
+  ASSERT_TRUE(stream.reset(1, "GO FROM 1 OVER e", makeDataSet(10), tracker).ok());
+  EXPECT_EQ(1, stream.id());
+  EXPECT_GT(tracker->used(), 0);
+
+  std::vector<size_t> sizes;
+  int64_t expected = 0;
+  auto prevUsed = tracker->used();
+  while (stream.hasMore()) {
+    auto batch = stream.next();
+    EXPECT_EQ(std::vector<std::string>({"id", "name"}), batch.colNames);
+    for (const auto& row : batch.rows) {
+      EXPECT_EQ(Value(expected), row.values[0]);
+      EXPECT_EQ(Value(folly::sformat("name_{}", expected)), row.values[1]);
+      ++expected;
+    }
+    sizes.emplace_back(batch.rows.size());
+    // The memory is released as the rows are fetched
+    EXPECT_LT(tracker->used(), prevUsed);
+    prevUsed = tracker->used();
+  }
+  EXPECT_EQ(std::vector<size_t>({4, 4, 2}), sizes);
+  EXPECT_EQ(0, tracker->used());
+  EXPECT_TRUE(stream.next().rows.empty());
+}
+
+TEST(ResultStreamTest, Kill) {
+  auto tracker = std::make_shared<MemoryTracker>("session", 0);
+  ResultStream stream(4);
+  ASSERT_TRUE(stream.reset(1, "GO FROM 1 OVER e", makeDataSet(10), tracker).ok());
+  EXPECT_EQ(4, stream.next().rows.size());
+  stream.markKilled();
+  EXPECT_TRUE(stream.isKilled());
+  EXPECT_FALSE(stream.hasMore());
+  EXPECT_TRUE(stream.next().rows.empty());
+  EXPECT_EQ(0, tracker->used());
+}
+
+TEST(ResultStreamTest, Quota) {
+  auto tracker = std::make_shared<MemoryTracker>("session", 16);
+  ResultStream stream(4);
+  EXPECT_FALSE(stream.reset(1, "GO FROM 1 OVER e", makeDataSet(10), tracker).ok());
+  EXPECT_FALSE(stream.hasMore());
+  EXPECT_EQ(0, tracker->used());
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -582,6 +582,12 @@ Status Executor::open() {
   if (qctx_->isKilled()) {
     VLOG(1) << "Execution is being killed. session: " << qctx()->rctx()->session()->id()
             << "ep: " << qctx()->plan()->id() << "query: " << qctx()->rctx()->query();
+    if (qctx_->isMemoryKilled()) {
+      return Status::Error(
+          "Execution had been killed since it used the most memory when the system memory hits "
+          "the high watermark(%lf)",
+          FLAGS_system_memory_high_watermark_ratio);
+    }
     return Status::Error("Execution had been killed");
   }
 
@@ -598,6 +604,11 @@ Status Executor::close() {
   stats.totalDurationInUs = totalDuration_.elapsedInUSec();
   stats.rows = numRows_;
   stats.execDurationInUs = execTime_;
+  // The peak memory of the query is reported once by the root
+  if (qctx()->plan()->isProfileEnabled() && node_ == qctx()->plan()->root()) {
+    otherStats_.emplace("query_peak_memory",
+                        folly::sformat("{}(bytes)", qctx()->memoryTracker()->peak()));
+  }
   if (!otherStats_.empty()) {
     stats.otherStats =
         std::make_unique<std::unordered_map<std::string, std::string>>(std::move(otherStats_));
@@ -715,6 +726,22 @@ bool Executor::movable(const Variable *var) {
   return var->userCount.load(std::memory_order_acquire) == 1;
 }
 
+bool Executor::sharedInput(const std::string &var) const {
+  if (!FLAGS_enable_lifetime_optimize || node()->loopLayers() != 0) {
+    return false;
+  }
+  const auto *variable = qctx_->symTable()->getVar(var);
+  return variable != nullptr && variable->userCount.load(std::memory_order_acquire) > 1;
+}
+
+Result Executor::mutableResult(const std::string &var) const {
+  Result result = ectx_->getResult(var);
+  if (sharedInput(var)) {
+    result.detach();
+  }
+  return result;
+}
+
 Status Executor::finish(Result &&result) {
   if (!FLAGS_enable_lifetime_optimize ||
       node()->outputVarPtr()->userCount.load(std::memory_order_relaxed) != 0) {
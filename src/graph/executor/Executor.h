@@ -101,6 +101,14 @@ class Executor : private boost::noncopyable, private cpp::NonMovable {
     return movable(qctx_->symTable()->getVar(var));
   }
 
+  // Check whether the input variable will still be read by other executors, so its value must be
+  // copied before modified in place. The variables in loops are managed by the Loop node.
+  bool sharedInput(const std::string &var) const;
+
+  // Get the result of input variable to modify in place, its value is copied on write if shared
+  // with other executors, otherwise it's modified without copy.
+  Result mutableResult(const std::string &var) const;
+
   // Store the result of this executor to execution context
   Status finish(Result &&result);
   // Store the default result which not used for later executor
@@ -128,6 +128,9 @@ class StorageAccessExecutor : public Executor {
             "Storage Error: Part {} raft buffer is full. Please retry later.", partId));
       case nebula::cpp2::ErrorCode::E_RAFT_ATOMIC_OP_FAILED:
         return Status::Error("Storage Error: Atomic operation failed.");
+      case nebula::cpp2::ErrorCode::E_MEMORY_QUOTA_EXCEEDED:
+        return Status::Error(
+            "Storage Error: The request used more memory than storage_request_memory_quota_mb.");
       default:
         auto status = Status::Error("Storage Error: part: %d, error: %s(%d).",
                                     partId,
@@ -6,6 +6,7 @@
 #define GRAPH_EXECUTOR_ALGO_BFSSHORTESTPATHEXECUTOR_H_
 #include <robin_hood.h>
 
+#include "common/datatypes/KeyHash.h"
 #include "graph/executor/Executor.h"
 
 // BFSShortestPath has two inputs.  GetNeighbors(From) & GetNeighbors(To)
@@ -44,7 +45,7 @@ namespace graph {
 class BFSShortestPath;
 class BFSShortestPathExecutor final : public Executor {
  public:
-  using HashSet = robin_hood::unordered_flat_set<Value, std::hash<Value>>;
+  using HashSet = robin_hood::unordered_flat_set<Value, ValueKeyHash, ValueKeyEqual>;
   BFSShortestPathExecutor(const PlanNode* node, QueryContext* qctx)
       : Executor("BFSShortestPath", node, qctx) {}
 
@@ -7,6 +7,7 @@
 
 #include <robin_hood.h>
 
+#include "common/datatypes/KeyHash.h"
 #include "graph/executor/Executor.h"
 
 // MultiShortestPath has two inputs.  GetNeighbors(From) & GetNeighbors(To)
@@ -63,8 +64,9 @@ class MultiShortestPathExecutor final : public Executor {
   // key: dst, value: {key : src, value: paths}
   using Interims = robin_hood::unordered_flat_map<
       Value,
-      robin_hood::unordered_flat_map<Value, std::vector<Path>, std::hash<Value>>,
-      std::hash<Value>>;
+      robin_hood::unordered_flat_map<Value, std::vector<Path>, ValueKeyHash, ValueKeyEqual>,
+      ValueKeyHash,
+      ValueKeyEqual>;
 
   void init();
   std::vector<Path> createPaths(const std::vector<Path>& paths, const Edge& edge);
@@ -17,7 +17,7 @@ folly::Future<Status> ProduceAllPathsExecutor::execute() {
 
   if (step_ == 1) {
     auto rIter = ectx_->getResult(pathNode_->rightVidVar()).iter();
-    using HashSet = robin_hood::unordered_flat_set<Value, std::hash<Value>>;
+    using HashSet = robin_hood::unordered_flat_set<Value, ValueKeyHash, ValueKeyEqual>;
     HashSet rightVids;
     for (; rIter->valid(); rIter->next()) {
       auto& vid = rIter->getColumn(0);
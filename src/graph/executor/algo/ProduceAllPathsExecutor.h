@@ -7,6 +7,7 @@
 
 #include <robin_hood.h>
 
+#include "common/datatypes/KeyHash.h"
 #include "graph/executor/Executor.h"
 
 // ProduceAllPath has two inputs.  GetNeighbors(From) & GetNeighbors(To)
@@ -54,7 +55,8 @@ class ProduceAllPathsExecutor final : public Executor {
 
  private:
   // k: dst, v: paths to dst
-  using Interims = robin_hood::unordered_flat_map<Value, std::vector<Path>, std::hash<Value>>;
+  using Interims =
+      robin_hood::unordered_flat_map<Value, std::vector<Path>, ValueKeyHash, ValueKeyEqual>;
 
   Status buildPath(bool reverse);
   folly::Future<Status> conjunctPath();
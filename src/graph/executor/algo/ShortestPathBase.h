@@ -6,6 +6,7 @@
 
 #include <robin_hood.h>
 
+#include "common/datatypes/KeyHash.h"
 #include "graph/planner/plan/Algo.h"
 
 using nebula::storage::StorageRpcResponse;
@@ -16,7 +17,7 @@ namespace nebula {
 namespace graph {
 class ShortestPathBase {
  public:
-  using HashSet = robin_hood::unordered_flat_set<Value, std::hash<Value>>;
+  using HashSet = robin_hood::unordered_flat_set<Value, ValueKeyHash, ValueKeyEqual>;
   ShortestPathBase(const ShortestPath* node,
                    QueryContext* qctx,
                    std::unordered_map<std::string, std::string>* stats)
@@ -6,6 +6,7 @@
 
 #include <robin_hood.h>
 
+#include "common/datatypes/KeyHash.h"
 #include "graph/executor/Executor.h"
 #include "graph/planner/plan/Algo.h"
 
@@ -13,7 +14,7 @@ namespace nebula {
 namespace graph {
 class ShortestPathExecutor final : public Executor {
  public:
-  using HashSet = robin_hood::unordered_flat_set<Value, std::hash<Value>>;
+  using HashSet = robin_hood::unordered_flat_set<Value, ValueKeyHash, ValueKeyEqual>;
   ShortestPathExecutor(const PlanNode* node, QueryContext* qctx)
       : Executor("ShortestPath", node, qctx) {
     pathNode_ = asNode<ShortestPath>(node);
@@ -48,7 +48,7 @@ void SingleShortestPath::init(const HashSet& startVids, const HashSet& endVids,
   for (const auto& startVid : startVids) {
     HashSet srcVid({startVid});
     for (const auto& endVid : endVids) {
-      robin_hood::unordered_flat_map<Value, std::vector<Row>, std::hash<Value>> steps;
+      robin_hood::unordered_flat_map<Value, std::vector<Row>, ValueKeyHash, ValueKeyEqual> steps;
       std::vector<Row> dummy;
       steps.emplace(endVid, std::move(dummy));
       HalfPath originRightPath({std::move(steps)});
@@ -11,7 +11,7 @@ namespace nebula {
 namespace graph {
 class SingleShortestPath final : public ShortestPathBase {
  public:
-  using HashSet = robin_hood::unordered_flat_set<Value, std::hash<Value>>;
+  using HashSet = robin_hood::unordered_flat_set<Value, ValueKeyHash, ValueKeyEqual>;
   SingleShortestPath(const ShortestPath* node,
                      QueryContext* qctx,
                      std::unordered_map<std::string, std::string>* stats)
@@ -22,7 +22,7 @@ class SingleShortestPath final : public ShortestPathBase {
                                 DataSet* result) override;
 
   using HalfPath = std::vector<
-      robin_hood::unordered_flat_map<DstVid, std::vector<CustomStep>, std::hash<Value>>>;
+      robin_hood::unordered_flat_map<DstVid, std::vector<CustomStep>, ValueKeyHash, ValueKeyEqual>>;
 
  private:
   void init(const HashSet& startVids, const HashSet& endVids, size_t rowSize);
@@ -7,6 +7,7 @@
 
 #include <robin_hood.h>
 
+#include "common/datatypes/KeyHash.h"
 #include "graph/executor/StorageAccessExecutor.h"
 #include "graph/planner/plan/Algo.h"
 
@@ -44,8 +45,8 @@ using RpcResponse = storage::StorageRpcResponse<storage::cpp2::GetNeighborsRespo
 
 class SubgraphExecutor : public StorageAccessExecutor {
  public:
-  using HashMap = robin_hood::unordered_flat_map<Value, size_t, std::hash<Value>>;
-  using HashSet = robin_hood::unordered_flat_set<Value, std::hash<Value>>;
+  using HashMap = robin_hood::unordered_flat_map<Value, size_t, ValueKeyHash, ValueKeyEqual>;
+  using HashSet = robin_hood::unordered_flat_set<Value, ValueKeyHash, ValueKeyEqual>;
 
   SubgraphExecutor(const PlanNode* node, QueryContext* qctx)
       : StorageAccessExecutor("SubgraphExecutor", node, qctx) {
@@ -23,7 +23,8 @@ folly::Future<Status> CreateTagIndexExecutor::execute() {
                        ctiNode->getFields(),
                        ctiNode->getIfNotExists(),
                        ctiNode->getIndexParams(),
-                       ctiNode->getComment())
+                       ctiNode->getComment(),
+                       ctiNode->getIncludeFields())
       .via(runner())
       .thenValue([ctiNode, spaceId](StatusOr<IndexID> resp) {
         if (!resp.ok()) {
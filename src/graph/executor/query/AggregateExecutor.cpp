@@ -4,6 +4,7 @@
 
 #include "graph/executor/query/AggregateExecutor.h"
 
+#include "common/datatypes/KeyHash.h"
 #include "graph/planner/plan/Query.h"
 
 namespace nebula {
@@ -29,7 +30,7 @@ folly::Future<Status> AggregateExecutor::execute() {
     }
   }
 
-  std::unordered_map<List, std::vector<std::unique_ptr<AggData>>, std::hash<nebula::List>> result;
+  std::unordered_map<List, std::vector<std::unique_ptr<AggData>>, ListKeyHash, ListKeyEqual> result;
 
   // generate default result when input dataset is empty
   if (UNLIKELY(!iter->valid())) {
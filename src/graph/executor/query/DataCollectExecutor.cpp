@@ -107,10 +107,12 @@ Status DataCollectExecutor::rowBasedMove(const std::vector<std::string>& vars) {
   for (auto& var : vars) {
     auto& result = ectx_->getResult(var);
     auto iter = result.iter();
+    // Copy the rows still read by other executors
+    bool shared = sharedInput(var);
     if (iter->isSequentialIter() || iter->isPropIter()) {
       auto* seqIter = static_cast<SequentialIter*>(iter.get());
       for (; seqIter->valid(); seqIter->next()) {
-        ds.rows.emplace_back(seqIter->moveRow());
+        ds.rows.emplace_back(shared ? *seqIter->row() : seqIter->moveRow());
       }
     } else {
       return Status::Error("Iterator should be kind of SequentialIter.");
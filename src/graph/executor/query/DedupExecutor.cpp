@@ -6,6 +6,7 @@
 
 #include <robin_hood.h>
 
+#include "common/datatypes/KeyHash.h"
 #include "graph/planner/plan/Query.h"
 namespace nebula {
 namespace graph {
@@ -13,7 +14,7 @@ folly::Future<Status> DedupExecutor::execute() {
   SCOPED_TIMER(&execTime_);
   auto* dedup = asNode<Dedup>(node());
   DCHECK(!dedup->inputVar().empty());
-  Result result = ectx_->getResult(dedup->inputVar());
+  Result result = mutableResult(dedup->inputVar());
   auto* iter = result.iterRef();
 
   if (UNLIKELY(iter == nullptr)) {
@@ -23,7 +24,7 @@ folly::Future<Status> DedupExecutor::execute() {
   if (UNLIKELY(iter->isGetNeighborsIter() || iter->isDefaultIter())) {
     return Status::Error("Invalid iterator kind, %d", static_cast<uint16_t>(iter->kind()));
   }
-  robin_hood::unordered_flat_set<const Row*, std::hash<const Row*>> unique;
+  robin_hood::unordered_flat_set<const Row*, ListKeyHash, ListKeyEqual> unique;
   unique.reserve(iter->size());
   while (iter->valid()) {
     if (!unique.emplace(iter->row()).second) {
@@ -39,40 +39,41 @@ folly::Future<Status> InnerJoinExecutor::join(const std::vector<Expression*>& ha
   }
 
   if (hashKeys.size() == 1 && probeKeys.size() == 1) {
-    std::unordered_map<Value, std::vector<const Row*>> hashTable;
+    HashTable hashTable;
     hashTable.reserve(bucketSize);
     if (lhsIter_->size() < rhsIter_->size()) {
-      buildSingleKeyHashTable(hashKeys.front(), lhsIter_.get(), hashTable);
+      NG_RETURN_IF_ERROR(buildSingleKeyHashTable(hashKeys.front(), lhsIter_.get(), hashTable));
       mv_ = movable(rightVar());
       result = singleKeyProbe(probeKeys.front(), rhsIter_.get(), hashTable);
     } else {
       exchange_ = true;
-      buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), hashTable);
+      NG_RETURN_IF_ERROR(buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), hashTable));
       mv_ = movable(leftVar());
       result = singleKeyProbe(hashKeys.front(), lhsIter_.get(), hashTable);
     }
   } else {
-    std::unordered_map<List, std::vector<const Row*>> hashTable;
+    ListHashTable hashTable;
     hashTable.reserve(bucketSize);
     if (lhsIter_->size() < rhsIter_->size()) {
-      buildHashTable(hashKeys, lhsIter_.get(), hashTable);
+      NG_RETURN_IF_ERROR(buildHashTable(hashKeys, lhsIter_.get(), hashTable));
       mv_ = movable(rightVar());
       result = probe(probeKeys, rhsIter_.get(), hashTable);
     } else {
       exchange_ = true;
-      buildHashTable(probeKeys, rhsIter_.get(), hashTable);
+      NG_RETURN_IF_ERROR(buildHashTable(probeKeys, rhsIter_.get(), hashTable));
       mv_ = movable(leftVar());
       result = probe(hashKeys, lhsIter_.get(), hashTable);
     }
   }
+  // The local hash table is destroyed
+  hashTableMemory_.reset();
   result.colNames = colNames;
   return finish(ResultBuilder().value(Value(std::move(result))).build());
 }
 
-DataSet InnerJoinExecutor::probe(
-    const std::vector<Expression*>& probeKeys,
-    Iterator* probeIter,
-    const std::unordered_map<List, std::vector<const Row*>>& hashTable) const {
+DataSet InnerJoinExecutor::probe(const std::vector<Expression*>& probeKeys,
+                                 Iterator* probeIter,
+                                 const ListHashTable& hashTable) const {
   DataSet ds;
   QueryExpressionContext ctx(ectx_);
   ds.rows.reserve(probeIter->size());
@@ -94,10 +95,9 @@ DataSet InnerJoinExecutor::probe(
   return ds;
 }
 
-DataSet InnerJoinExecutor::singleKeyProbe(
-    Expression* probeKey,
-    Iterator* probeIter,
-    const std::unordered_map<Value, std::vector<const Row*>>& hashTable) const {
+DataSet InnerJoinExecutor::singleKeyProbe(Expression* probeKey,
+                                          Iterator* probeIter,
+                                          const HashTable& hashTable) const {
   DataSet ds;
   QueryExpressionContext ctx(ectx_);
   for (; probeIter->valid(); probeIter->next()) {
@@ -129,21 +129,21 @@ folly::Future<Status> InnerJoinExecutor::joinMultiJobs(const std::vector<Express
   if (hashKeys.size() == 1 && probeKeys.size() == 1) {
     hashTable_.reserve(bucketSize);
     if (lhsIter_->size() < rhsIter_->size()) {
-      buildSingleKeyHashTable(hashKeys.front(), lhsIter_.get(), hashTable_);
+      NG_RETURN_IF_ERROR(buildSingleKeyHashTable(hashKeys.front(), lhsIter_.get(), hashTable_));
       return singleKeyProbe(probeKeys.front(), rhsIter_.get());
     } else {
       exchange_ = true;
-      buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), hashTable_);
+      NG_RETURN_IF_ERROR(buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), hashTable_));
       return singleKeyProbe(hashKeys.front(), lhsIter_.get());
     }
   } else {
     listHashTable_.reserve(bucketSize);
     if (lhsIter_->size() < rhsIter_->size()) {
-      buildHashTable(hashKeys, lhsIter_.get(), listHashTable_);
+      NG_RETURN_IF_ERROR(buildHashTable(hashKeys, lhsIter_.get(), listHashTable_));
       return probe(probeKeys, rhsIter_.get());
     } else {
       exchange_ = true;
-      buildHashTable(probeKeys, rhsIter_.get(), listHashTable_);
+      NG_RETURN_IF_ERROR(buildHashTable(probeKeys, rhsIter_.get(), listHashTable_));
       return probe(hashKeys, lhsIter_.get());
     }
   }
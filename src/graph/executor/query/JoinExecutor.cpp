@@ -13,6 +13,7 @@ Status JoinExecutor::checkInputDataSets() {
   // Since the executors might reuse in loops, so manually clear the table here.
   hashTable_.clear();
   listHashTable_.clear();
+  hashTableMemory_.reset();
   auto* join = asNode<Join>(node());
   lhsIter_ = ectx_->getVersionedResult(join->leftVar().first, join->leftVar().second).iter();
   DCHECK(!!lhsIter_);
@@ -52,10 +53,11 @@ Status JoinExecutor::checkBiInputDataSets() {
   return Status::OK();
 }
 
-void JoinExecutor::buildHashTable(const std::vector<Expression*>& hashKeys,
-                                  Iterator* iter,
-                                  std::unordered_map<List, std::vector<const Row*>>& hashTable) {
+Status JoinExecutor::buildHashTable(const std::vector<Expression*>& hashKeys,
+                                    Iterator* iter,
+                                    ListHashTable& hashTable) {
   QueryExpressionContext ctx(ectx_);
+  size_t numRows = 0;
   for (; iter->valid(); iter->next()) {
     List list;
     list.values.reserve(hashKeys.size());
@@ -66,20 +68,24 @@ void JoinExecutor::buildHashTable(const std::vector<Expression*>& hashKeys,
 
     auto& vals = hashTable[list];
     vals.emplace_back(iter->row());
+    ++numRows;
   }
+  return trackHashTable(hashTable, numRows);
 }
 
-void JoinExecutor::buildSingleKeyHashTable(
-    Expression* hashKey,
-    Iterator* iter,
-    std::unordered_map<Value, std::vector<const Row*>>& hashTable) {
+Status JoinExecutor::buildSingleKeyHashTable(Expression* hashKey,
+                                             Iterator* iter,
+                                             HashTable& hashTable) {
   QueryExpressionContext ctx(ectx_);
+  size_t numRows = 0;
   for (; iter->valid(); iter->next()) {
     auto& val = hashKey->eval(ctx(iter));
 
     auto& vals = hashTable[val];
     vals.emplace_back(iter->row());
+    ++numRows;
   }
+  return trackHashTable(hashTable, numRows);
 }
 
 Row JoinExecutor::newRow(Row left, Row right) const {
@@ -5,6 +5,7 @@
 #ifndef GRAPH_EXECUTOR_QUERY_JOINEXECUTOR_H_
 #define GRAPH_EXECUTOR_QUERY_JOINEXECUTOR_H_
 
+#include "common/datatypes/KeyHash.h"
 #include "graph/executor/Executor.h"
 
 namespace nebula {
@@ -13,20 +14,29 @@ namespace graph {
 class JoinExecutor : public Executor {
  public:
   JoinExecutor(const std::string& name, const PlanNode* node, QueryContext* qctx)
-      : Executor(name, node, qctx) {}
+      : Executor(name, node, qctx), hashTableMemory_(qctx->memoryTracker()) {}
 
  protected:
+  using HashTable = std::unordered_map<Value, std::vector<const Row*>, ValueKeyHash, ValueKeyEqual>;
+  using ListHashTable =
+      std::unordered_map<List, std::vector<const Row*>, ListKeyHash, ListKeyEqual>;
+
   Status checkInputDataSets();
 
   Status checkBiInputDataSets();
 
-  void buildHashTable(const std::vector<Expression*>& hashKeys,
-                      Iterator* iter,
-                      std::unordered_map<List, std::vector<const Row*>>& hashTable);
+  // Build the hash table, fails if it exceeds the memory quota of query
+  Status buildHashTable(const std::vector<Expression*>& hashKeys,
+                        Iterator* iter,
+                        ListHashTable& hashTable);
+
+  Status buildSingleKeyHashTable(Expression* hashKey,
+                                 Iterator* iter,
+                                 HashTable& hashTable);
 
-  void buildSingleKeyHashTable(Expression* hashKey,
-                               Iterator* iter,
-                               std::unordered_map<Value, std::vector<const Row*>>& hashTable);
+  // Reserve the estimated memory of hash table in the tracker of query
+  template <typename HT>
+  Status trackHashTable(const HT& hashTable, size_t numRows);
 
   // concat rows
   Row newRow(Row left, Row right) const;
@@ -34,9 +44,20 @@ class JoinExecutor : public Executor {
   std::unique_ptr<Iterator> lhsIter_;
   std::unique_ptr<Iterator> rhsIter_;
   size_t colSize_{0};
-  std::unordered_map<Value, std::vector<const Row*>> hashTable_;
-  std::unordered_map<List, std::vector<const Row*>> listHashTable_;
+  HashTable hashTable_;
+  ListHashTable listHashTable_;
+  MemoryReservation hashTableMemory_;
 };
+
+template <typename HT>
+Status JoinExecutor::trackHashTable(const HT& hashTable, size_t numRows) {
+  using K = typename HT::key_type;
+  // Buckets, nodes with the keys and the row pointers, the heap memory of keys is ignored
+  int64_t bytes = hashTable.bucket_count() * sizeof(void*) +
+                  hashTable.size() * (2 * sizeof(void*) + sizeof(K) + sizeof(std::vector<Row*>)) +
+                  numRows * sizeof(Row*);
+  return hashTableMemory_.resize(bytes);
+}
 }  // namespace graph
 }  // namespace nebula
 #endif
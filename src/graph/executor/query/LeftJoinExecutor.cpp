@@ -35,31 +35,32 @@ folly::Future<Status> LeftJoinExecutor::join(const std::vector<Expression*>& has
   DCHECK_EQ(hashKeys.size(), probeKeys.size());
   DataSet result;
   if (hashKeys.size() == 1 && probeKeys.size() == 1) {
-    std::unordered_map<Value, std::vector<const Row*>> hashTable;
+    HashTable hashTable;
     hashTable.reserve(rhsIter_->empty() ? 1 : rhsIter_->size());
     if (!lhsIter_->empty()) {
-      buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), hashTable);
+      NG_RETURN_IF_ERROR(buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), hashTable));
       mv_ = movable(node()->inputVars()[0]);
       result = singleKeyProbe(hashKeys.front(), lhsIter_.get(), hashTable);
     }
   } else {
-    std::unordered_map<List, std::vector<const Row*>> hashTable;
+    ListHashTable hashTable;
     hashTable.reserve(rhsIter_->empty() ? 1 : rhsIter_->size());
     if (!lhsIter_->empty()) {
-      buildHashTable(probeKeys, rhsIter_.get(), hashTable);
+      NG_RETURN_IF_ERROR(buildHashTable(probeKeys, rhsIter_.get(), hashTable));
       mv_ = movable(node()->inputVars()[0]);
       result = probe(hashKeys, lhsIter_.get(), hashTable);
     }
   }
 
+  // The local hash table is destroyed
+  hashTableMemory_.reset();
   result.colNames = colNames;
   return finish(ResultBuilder().value(Value(std::move(result))).build());
 }
 
-DataSet LeftJoinExecutor::probe(
-    const std::vector<Expression*>& probeKeys,
-    Iterator* probeIter,
-    const std::unordered_map<List, std::vector<const Row*>>& hashTable) const {
+DataSet LeftJoinExecutor::probe(const std::vector<Expression*>& probeKeys,
+                                Iterator* probeIter,
+                                const ListHashTable& hashTable) const {
   DataSet ds;
   ds.rows.reserve(probeIter->size());
   QueryExpressionContext ctx(ectx_);
@@ -82,10 +83,9 @@ DataSet LeftJoinExecutor::probe(
   return ds;
 }
 
-DataSet LeftJoinExecutor::singleKeyProbe(
-    Expression* probeKey,
-    Iterator* probeIter,
-    const std::unordered_map<Value, std::vector<const Row*>>& hashTable) const {
+DataSet LeftJoinExecutor::singleKeyProbe(Expression* probeKey,
+                                         Iterator* probeIter,
+                                         const HashTable& hashTable) const {
   DataSet ds;
   ds.rows.reserve(probeIter->size());
   QueryExpressionContext ctx(ectx_);
@@ -110,13 +110,13 @@ folly::Future<Status> LeftJoinExecutor::joinMultiJobs(const std::vector<Expressi
   if (hashKeys.size() == 1 && probeKeys.size() == 1) {
     hashTable_.reserve(rhsIter_->empty() ? 1 : rhsIter_->size());
     if (!lhsIter_->empty()) {
-      buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), hashTable_);
+      NG_RETURN_IF_ERROR(buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), hashTable_));
       return singleKeyProbe(hashKeys.front(), lhsIter_.get());
     }
   } else {
     listHashTable_.reserve(rhsIter_->empty() ? 1 : rhsIter_->size());
     if (!lhsIter_->empty()) {
-      buildHashTable(probeKeys, rhsIter_.get(), listHashTable_);
+      NG_RETURN_IF_ERROR(buildHashTable(probeKeys, rhsIter_.get(), listHashTable_));
       return probe(hashKeys, lhsIter_.get());
     }
   }
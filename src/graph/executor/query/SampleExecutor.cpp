@@ -13,7 +13,7 @@ folly::Future<Status> SampleExecutor::execute() {
   SCOPED_TIMER(&execTime_);
 
   auto* sample = asNode<Sample>(node());
-  Result result = ectx_->getResult(sample->inputVar());
+  Result result = mutableResult(sample->inputVar());
   auto* iter = result.iterRef();
   DCHECK_NE(iter->kind(), Iterator::Kind::kDefault);
   ResultBuilder builder;
@@ -53,17 +53,17 @@ Status SetExecutor::checkInputDataSets() {
 
 std::unique_ptr<Iterator> SetExecutor::getLeftInputDataIter() const {
   auto left = asNode<SetOp>(node())->leftInputVar();
-  return ectx_->getResult(left).iter();
+  return mutableResult(left).iter();
 }
 
 std::unique_ptr<Iterator> SetExecutor::getRightInputDataIter() const {
   auto right = asNode<SetOp>(node())->rightInputVar();
-  return ectx_->getResult(right).iter();
+  return mutableResult(right).iter();
 }
 
 Result SetExecutor::getLeftInputData() const {
   auto left = asNode<SetOp>(node())->leftInputVar();
-  return ectx_->getResult(left);
+  return mutableResult(left);
 }
 
 Result SetExecutor::getRightInputData() const {
@@ -13,7 +13,7 @@ folly::Future<Status> SortExecutor::execute() {
   SCOPED_TIMER(&execTime_);
 
   auto *sort = asNode<Sort>(node());
-  Result result = ectx_->getResult(sort->inputVar());
+  Result result = mutableResult(sort->inputVar());
   auto *iter = result.iterRef();
   if (UNLIKELY(iter == nullptr)) {
     return Status::Error("Internal error: nullptr iterator in sort executor");
@@ -12,7 +12,7 @@ namespace graph {
 folly::Future<Status> TopNExecutor::execute() {
   SCOPED_TIMER(&execTime_);
   auto *topn = asNode<TopN>(node());
-  Result result = ectx_->getResult(topn->inputVar());
+  Result result = mutableResult(topn->inputVar());
   auto *iter = result.iterRef();
   if (UNLIKELY(iter == nullptr)) {
     return Status::Error("Internal error: nullptr iterator in topn executor");
@@ -7,6 +7,7 @@
 
 #include <robin_hood.h>
 
+#include "common/datatypes/KeyHash.h"
 #include "graph/executor/StorageAccessExecutor.h"
 #include "graph/planner/plan/Query.h"
 #include "interface/gen-cpp2/storage_types.h"
@@ -37,8 +38,8 @@ namespace graph {
 using RpcResponse = storage::StorageRpcResponse<storage::cpp2::GetNeighborsResponse>;
 using Dst = Value;
 using Paths = std::vector<Row>;
-using HashSet = robin_hood::unordered_flat_set<Value, std::hash<Value>>;
-using HashMap = robin_hood::unordered_flat_map<Dst, Paths, std::hash<Value>>;
+using HashSet = robin_hood::unordered_flat_set<Value, ValueKeyHash, ValueKeyEqual>;
+using HashMap = robin_hood::unordered_flat_map<Dst, Paths, ValueKeyHash, ValueKeyEqual>;
 
 struct JobResult {
   // Newly traversed paths size
@@ -13,6 +13,9 @@
 #include "graph/executor/query/UnionExecutor.h"
 #include "graph/planner/plan/Logic.h"
 #include "graph/planner/plan/Query.h"
+#include "graph/scheduler/Scheduler.h"
+
+DECLARE_bool(enable_lifetime_optimize);
 
 using folly::stringPrintf;
 
@@ -460,5 +463,58 @@ TEST_F(SetExecutorTest, TestMinus) {
   }
 }
 
+TEST_F(SetExecutorTest, TestSharedLeftInput) {
+  FLAGS_enable_lifetime_optimize = true;
+  auto testShared = [this](BinaryInputNode* setOp, PlanNode* left, const DataSet& expected) {
+    // The left input is also read by the dedup
+    auto* dedup = Dedup::make(qctx_.get(), left);
+    Scheduler::analyzeLifetime(Union::make(qctx_.get(), setOp, dedup));
+    ASSERT_EQ(2, left->outputVarPtr()->userCount.load());
+
+    DataSet lds;
+    lds.colNames = {"col1", "col2"};
+    lds.rows = {
+        Row({Value(1), Value("row1")}),
+        Row({Value(2), Value("row2")}),
+    };
+    DataSet rds;
+    rds.colNames = {"col1", "col2"};
+    rds.rows = {
+        Row({Value(1), Value("row1")}),
+    };
+    qctx_->ectx()->setResult(
+        left->outputVar(),
+        ResultBuilder().value(Value(lds)).iter(Iterator::Kind::kSequential).build());
+    qctx_->ectx()->setResult(
+        setOp->right()->outputVar(),
+        ResultBuilder().value(Value(rds)).iter(Iterator::Kind::kSequential).build());
+
+    auto executor = Executor::create(setOp, qctx_.get());
+    auto status = executor->execute().get();
+    ASSERT_TRUE(status.ok()) << status;
+    EXPECT_TRUE(diffDataSet(qctx_->ectx()->getResult(setOp->outputVar()).value().getDataSet(),
+                            expected));
+    // The input of dedup is kept as is
+    EXPECT_EQ(1, left->outputVarPtr()->userCount.load());
+    EXPECT_EQ(Value(lds), qctx_->ectx()->getValue(left->outputVar()));
+  };
+
+  DataSet expected;
+  expected.colNames = {"col1", "col2"};
+  {
+    auto left = StartNode::make(qctx_.get());
+    auto right = StartNode::make(qctx_.get());
+    expected.rows = {Row({Value(1), Value("row1")})};
+    testShared(Intersect::make(qctx_.get(), left, right), left, expected);
+  }
+  {
+    auto left = StartNode::make(qctx_.get());
+    auto right = StartNode::make(qctx_.get());
+    expected.rows = {Row({Value(2), Value("row2")})};
+    testShared(Minus::make(qctx_.get(), left, right), left, expected);
+  }
+  FLAGS_enable_lifetime_optimize = false;
+}
+
 }  // namespace graph
 }  // namespace nebula
@@ -28,6 +28,7 @@ TEST_F(ShowQueriesTest, TestAddQueryAndTopN) {
     desc.start_time_ref() = 123;
     desc.status_ref() = meta::cpp2::QueryStatus::RUNNING;
     desc.duration_ref() = 100;
+    desc.peak_memory_bytes_ref() = 1024;
     desc.query_ref() = "";
     desc.graph_addr_ref() = HostAddr("127.0.0.1", 9669);
 
@@ -51,7 +52,8 @@ TEST_F(ShowQueriesTest, TestAddQueryAndTopN) {
                    "StartTime",
                    "DurationInUSec",
                    "Status",
-                   "Query"});
+                   "Query",
+                   "PeakMemoryInBytes"});
   DataSet expected = dataSet;
   {
     Row row;
@@ -65,6 +67,7 @@ TEST_F(ShowQueriesTest, TestAddQueryAndTopN) {
     row.emplace_back(100);
     row.emplace_back("RUNNING");
     row.emplace_back("");
+    row.emplace_back(1024);
     expected.rows.emplace_back(std::move(row));
   }
   {
@@ -79,6 +82,7 @@ TEST_F(ShowQueriesTest, TestAddQueryAndTopN) {
     row.emplace_back(200);
     row.emplace_back("RUNNING");
     row.emplace_back("");
+    row.emplace_back(0);
     expected.rows.emplace_back(std::move(row));
   }
 
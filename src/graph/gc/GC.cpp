@@ -4,31 +4,80 @@
 
 #include "graph/gc/GC.h"
 
+#include "common/datatypes/MemoryEstimator.h"
+#include "common/time/Duration.h"
 #include "graph/service/GraphFlags.h"
+#include "graph/stats/GraphStats.h"
 
 namespace nebula {
 namespace graph {
+namespace {
+
+// The interval of the cleaning task of each worker
+constexpr int64_t kGCIntervalMs = 50;
+
+int64_t pendingLimit() {
+  return FLAGS_gc_pending_memory_limit_mb * 1024 * 1024;
+}
+
+}  // namespace
+
 GC& GC::instance() {
-  static GC gc;
+  static GC gc(FLAGS_gc_worker_size == 0 ? std::thread::hardware_concurrency()
+                                          : FLAGS_gc_worker_size);
   return gc;
 }
 
-GC::GC() {
-  if (FLAGS_gc_worker_size == 0) {
-    workers_.start(std::thread::hardware_concurrency(), "GC");
-  } else {
-    workers_.start(FLAGS_gc_worker_size, "GC");
+GC::GC(size_t numWorkers) {
+  if (numWorkers == 0) {
+    return;
   }
-  workers_.addRepeatTaskForAll(50, &GC::periodicTask, this);
+  workers_.start(numWorkers, "GC");
+  workers_.addRepeatTaskForAll(kGCIntervalMs, &GC::periodicTask, this);
 }
 
 void GC::clear(std::vector<Result>&& garbage) {
-  queue_.enqueue(std::move(garbage));
+  Garbage g;
+  g.results = std::move(garbage);
+  auto limit = pendingLimit();
+  if (limit > 0) {
+    // Sampled estimation, the values shared with others are counted too
+    for (auto& result : g.results) {
+      g.bytes += MemoryEstimator::estimate(result.value());
+    }
+  }
+  if (limit > 0 && pendingBytes_.load(std::memory_order_relaxed) + g.bytes > limit) {
+    // Back pressure, the workers can't keep up with the garbage
+    stats::StatsManager::addValue(kNumGCInlineReleases);
+    g.results.clear();
+    return;
+  }
+  pendingBytes_.fetch_add(g.bytes, std::memory_order_relaxed);
+  stats::StatsManager::addValue(kNumGCPendingResults);
+  stats::StatsManager::addValue(kGCPendingBytes, g.bytes);
+  queue_.enqueue(std::move(g));
+}
+
+void GC::release(Garbage& garbage) {
+  garbage.results.clear();
+  pendingBytes_.fetch_sub(garbage.bytes, std::memory_order_relaxed);
+  stats::StatsManager::decValue(kNumGCPendingResults);
+  stats::StatsManager::decValue(kGCPendingBytes, garbage.bytes);
 }
 
 void GC::periodicTask() {
-  // TODO: maybe could release by batch
-  queue_.try_dequeue();
+  // Drain the queue in a batch of gc_batch_duration_ms at most, keep draining regardless of the
+  // time if the backlog is large, so the batch adapts to the rate of garbage.
+  time::Duration duration;
+  auto limit = pendingLimit();
+  Garbage garbage;
+  while (queue_.try_dequeue(garbage)) {
+    release(garbage);
+    if (duration.elapsedInMSec() >= FLAGS_gc_batch_duration_ms &&
+        (limit <= 0 || pendingBytes_.load(std::memory_order_relaxed) <= limit / 2)) {
+      break;
+    }
+  }
 }
 }  // namespace graph
 }  // namespace nebula
@@ -5,6 +5,8 @@
 #ifndef GRAPH_GC_H_
 #define GRAPH_GC_H_
 
+#include <gtest/gtest_prod.h>
+
 #include "common/base/Base.h"
 #include "common/thread/GenericThreadPool.h"
 #include "graph/context/Result.h"
@@ -23,12 +25,33 @@ class GC {
     workers_.stop();
   }
 
+  // Release the garbage in background. It's released in current thread when the memory pending
+  // release exceeds gc_pending_memory_limit_mb, which slows down the producers of garbage.
   void clear(std::vector<Result>&& garbage);
 
+  // The estimated memory of garbage waiting in the queue
+  int64_t pendingBytes() const {
+    return pendingBytes_.load(std::memory_order_relaxed);
+  }
+
  private:
-  GC();
+  struct Garbage {
+    std::vector<Result> results;
+    int64_t bytes{0};
+  };
+
+  FRIEND_TEST(GCTest, InlineRelease);
+  FRIEND_TEST(GCTest, BatchDuration);
+  FRIEND_TEST(GCTest, BatchBacklog);
+
+  // numWorkers: The background workers releasing the garbage every round, none for test
+  explicit GC(size_t numWorkers);
+  // Release the garbage in a round of the worker
   void periodicTask();
-  folly::UMPMCQueue<std::vector<Result>, false> queue_;
+  void release(Garbage& garbage);
+
+  folly::UMPMCQueue<Garbage, false> queue_;
+  std::atomic<int64_t> pendingBytes_{0};
   thread::GenericThreadPool workers_;
 };
 }  // namespace graph
@@ -0,0 +1,122 @@
+// Copyright (c) 2022 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <gtest/gtest.h>
+
+#include "common/base/Base.h"
+#include "graph/gc/GC.h"
+#include "graph/service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+constexpr int64_t kMB = 1024 * 1024;
+
+// The garbage of a string value in about the bytes, the value is watched by weak
+std::vector<Result> makeGarbage(int64_t bytes, std::weak_ptr<Value>* weak) {
+  auto value = std::make_shared<Value>(std::string(bytes, 'a'));
+  *weak = value;
+  std::vector<Result> garbage;
+  garbage.emplace_back(ResultBuilder().value(std::move(value)).build());
+  return garbage;
+}
+
+class GCTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    limitMb_ = FLAGS_gc_pending_memory_limit_mb;
+    batchMs_ = FLAGS_gc_batch_duration_ms;
+  }
+
+  void TearDown() override {
+    FLAGS_gc_pending_memory_limit_mb = limitMb_;
+    FLAGS_gc_batch_duration_ms = batchMs_;
+  }
+
+  int64_t limitMb_;
+  uint32_t batchMs_;
+};
+
+TEST_F(GCTest, InlineRelease) {
+  FLAGS_gc_pending_memory_limit_mb = 1;
+  GC gc(0);
+  std::weak_ptr<Value> small, large;
+  gc.clear(makeGarbage(kMB / 4, &small));
+  EXPECT_FALSE(small.expired());
+  auto pending = gc.pendingBytes();
+  EXPECT_GE(pending, kMB / 4);
+  EXPECT_LT(pending, kMB / 2);
+
+  // Released by the producer since the pending memory would exceed the limit
+  gc.clear(makeGarbage(kMB, &large));
+  EXPECT_TRUE(large.expired());
+  EXPECT_EQ(pending, gc.pendingBytes());
+
+  gc.periodicTask();
+  EXPECT_TRUE(small.expired());
+  EXPECT_EQ(0, gc.pendingBytes());
+
+  // Nothing is estimated nor released inline without limit
+  FLAGS_gc_pending_memory_limit_mb = 0;
+  gc.clear(makeGarbage(2 * kMB, &large));
+  EXPECT_FALSE(large.expired());
+  EXPECT_EQ(0, gc.pendingBytes());
+  gc.periodicTask();
+  EXPECT_TRUE(large.expired());
+}
+
+TEST_F(GCTest, BatchDuration) {
+  FLAGS_gc_pending_memory_limit_mb = 0;
+  // The budget of round is exhausted by the first garbage
+  FLAGS_gc_batch_duration_ms = 0;
+  GC gc(0);
+  std::vector<std::weak_ptr<Value>> weaks(3);
+  for (auto& weak : weaks) {
+    gc.clear(makeGarbage(1024, &weak));
+  }
+  for (size_t i = 0; i < weaks.size(); ++i) {
+    gc.periodicTask();
+    for (size_t j = 0; j < weaks.size(); ++j) {
+      EXPECT_EQ(j <= i, weaks[j].expired()) << "round " << i << ", garbage " << j;
+    }
+  }
+
+  // All is drained in a round of enough budget
+  FLAGS_gc_batch_duration_ms = 60 * 1000;
+  for (auto& weak : weaks) {
+    gc.clear(makeGarbage(1024, &weak));
+  }
+  gc.periodicTask();
+  for (auto& weak : weaks) {
+    EXPECT_TRUE(weak.expired());
+  }
+}
+
+TEST_F(GCTest, BatchBacklog) {
+  FLAGS_gc_pending_memory_limit_mb = 1;
+  FLAGS_gc_batch_duration_ms = 0;
+  GC gc(0);
+  // 0.9 MB pending, over half of the limit
+  std::vector<std::weak_ptr<Value>> weaks(3);
+  for (auto& weak : weaks) {
+    gc.clear(makeGarbage(kMB * 3 / 10, &weak));
+  }
+  for (auto& weak : weaks) {
+    EXPECT_FALSE(weak.expired());
+  }
+
+  // Keep draining beyond the budget until the backlog is no more than half of the limit
+  gc.periodicTask();
+  EXPECT_TRUE(weaks[0].expired());
+  EXPECT_TRUE(weaks[1].expired());
+  EXPECT_FALSE(weaks[2].expired());
+  EXPECT_LE(gc.pendingBytes(), kMB / 2);
+
+  gc.periodicTask();
+  EXPECT_TRUE(weaks[2].expired());
+  EXPECT_EQ(0, gc.pendingBytes());
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -8,6 +8,7 @@
 #include "common/base/Status.h"
 #include "common/datatypes/Value.h"
 #include "graph/planner/plan/Query.h"
+#include "graph/util/CostModel.h"
 
 using nebula::meta::cpp2::ColumnDef;
 using nebula::meta::cpp2::IndexItem;
@@ -299,6 +300,36 @@ StatusOr<IndexResult> selectLogicalExprIndex(const LogicalExpression* expr,
   return result;
 }
 
+// Move the index result which scans the fewest keys to the back if all of them have statistics,
+// the one with larger score is preferred when they have the same estimation
+void pickCheapestIndex(std::vector<IndexResult>& results, const CostModel& costModel) {
+  std::optional<size_t> cheapest;
+  double cheapestRows = 0;
+  for (size_t i = results.size(); i-- > 0;) {
+    std::vector<IndexColumnHint> hints;
+    for (auto& hint : results[i].hints) {
+      if (hint.score == IndexScore::kNotEqual) {
+        break;
+      }
+      hints.emplace_back(hint.hint);
+    }
+    if (hints.empty()) {
+      continue;
+    }
+    auto rows = costModel.indexScanRows(results[i].index->get_index_id(), hints);
+    if (!rows.has_value()) {
+      return;
+    }
+    if (!cheapest.has_value() || *rows < cheapestRows) {
+      cheapest = i;
+      cheapestRows = *rows;
+    }
+  }
+  if (cheapest.has_value()) {
+    std::swap(results[*cheapest], results.back());
+  }
+}
+
 StatusOr<IndexResult> selectIndex(const Expression* expr, const IndexItem& index) {
   if (expr->isRelExpr()) {
     return selectRelExprIndex(static_cast<const RelationalExpression*>(expr), index);
@@ -331,7 +362,8 @@ void OptimizerUtils::eraseInvalidIndexItems(
 bool OptimizerUtils::findOptimalIndex(const Expression* condition,
                                       const std::vector<std::shared_ptr<IndexItem>>& indexItems,
                                       bool* isPrefixScan,
-                                      IndexQueryContext* ictx) {
+                                      IndexQueryContext* ictx,
+                                      const CostModel* costModel) {
   // Return directly if there is no valid index to use.
   if (indexItems.empty()) {
     return false;
@@ -350,6 +382,9 @@ bool OptimizerUtils::findOptimalIndex(const Expression* condition,
   }
 
   std::sort(results.begin(), results.end());
+  if (costModel != nullptr && costModel->hasStats()) {
+    pickCheapestIndex(results, *costModel);
+  }
 
   auto& index = results.back();
   if (index.hints.empty()) {
@@ -26,6 +26,7 @@ class IndexQueryContext;
 
 namespace graph {
 
+class CostModel;
 class IndexScan;
 
 class OptimizerUtils {
@@ -53,7 +54,8 @@ class OptimizerUtils {
   //     * process collected column hints, for example, merge the begin and end values of
   //       range scan
   //   3. sort all index results generated by each index
-  //   4. select the largest score index result
+  //   4. select the largest score index result, or the one scanning the fewest keys estimated by
+  //      costModel if all indexes have statistics
   //   5. process the selected index result:
   //     * find the first not prefix column hint and ignore all followed hints except first
   //       range hint
@@ -67,7 +69,8 @@ class OptimizerUtils {
       const Expression* condition,
       const std::vector<std::shared_ptr<nebula::meta::cpp2::IndexItem>>& indexItems,
       bool* isPrefixScan,
-      nebula::storage::cpp2::IndexQueryContext* ictx);
+      nebula::storage::cpp2::IndexQueryContext* ictx,
+      const CostModel* costModel = nullptr);
 
   static bool relExprHasIndex(
       const Expression* expr,
@@ -11,6 +11,7 @@
 #include "graph/optimizer/OptimizerUtils.h"
 #include "graph/planner/plan/PlanNode.h"
 #include "graph/planner/plan/Scan.h"
+#include "graph/util/CostModel.h"
 #include "graph/util/ExpressionUtils.h"
 
 using nebula::Expression;
@@ -129,7 +130,9 @@ StatusOr<TransformResult> OptimizeEdgeIndexScanByFilterRule::transform(
 
   IndexQueryContext ictx;
   bool isPrefixScan = false;
-  if (!OptimizerUtils::findOptimalIndex(transformedExpr, indexItems, &isPrefixScan, &ictx)) {
+  CostModel costModel(ctx->qctx(), scan->space());
+  if (!OptimizerUtils::findOptimalIndex(
+          transformedExpr, indexItems, &isPrefixScan, &ictx, &costModel)) {
     return TransformResult::noTransform();
   }
 
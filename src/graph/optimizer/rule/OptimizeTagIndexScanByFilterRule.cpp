@@ -12,6 +12,7 @@
 #include "graph/optimizer/rule/IndexScanRule.h"
 #include "graph/planner/plan/PlanNode.h"
 #include "graph/planner/plan/Scan.h"
+#include "graph/util/CostModel.h"
 #include "graph/util/ExpressionUtils.h"
 
 using nebula::graph::Filter;
@@ -149,7 +150,9 @@ StatusOr<TransformResult> OptimizeTagIndexScanByFilterRule::transform(
 
   IndexQueryContext ictx;
   bool isPrefixScan = false;
-  if (!OptimizerUtils::findOptimalIndex(transformedExpr, indexItems, &isPrefixScan, &ictx)) {
+  CostModel costModel(ctx->qctx(), scan->space());
+  if (!OptimizerUtils::findOptimalIndex(
+          transformedExpr, indexItems, &isPrefixScan, &ictx, &costModel)) {
     return TransformResult::noTransform();
   }
 
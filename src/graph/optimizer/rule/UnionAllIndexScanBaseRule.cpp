@@ -12,6 +12,7 @@
 #include "graph/planner/plan/PlanNode.h"
 #include "graph/planner/plan/Query.h"
 #include "graph/planner/plan/Scan.h"
+#include "graph/util/CostModel.h"
 #include "graph/util/ExpressionUtils.h"
 
 using nebula::graph::Filter;
@@ -166,11 +167,13 @@ StatusOr<TransformResult> UnionAllIndexScanBaseRule::transform(OptContext* ctx,
 
   DCHECK(transformedExpr->kind() == ExprKind::kLogicalOr);
   std::vector<IndexQueryContext> idxCtxs;
+  CostModel costModel(qctx, scan->space());
   auto logicalExpr = static_cast<const LogicalExpression*>(transformedExpr);
   for (auto operand : logicalExpr->operands()) {
     IndexQueryContext ictx;
     bool isPrefixScan = false;
-    if (!OptimizerUtils::findOptimalIndex(operand, indexItems, &isPrefixScan, &ictx)) {
+    if (!OptimizerUtils::findOptimalIndex(
+            operand, indexItems, &isPrefixScan, &ictx, &costModel)) {
       return TransformResult::noTransform();
     }
     idxCtxs.emplace_back(std::move(ictx));
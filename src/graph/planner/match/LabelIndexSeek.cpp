@@ -7,6 +7,7 @@
 
 #include "graph/planner/match/MatchSolver.h"
 #include "graph/planner/plan/Query.h"
+#include "graph/util/CostModel.h"
 #include "graph/util/ExpressionUtils.h"
 
 namespace nebula {
@@ -195,6 +196,20 @@ StatusOr<SubPlan> LabelIndexSeek::transformEdge(EdgeContext* edgeCtx) {
   return plan;
 }
 
+std::optional<double> LabelIndexSeek::estimateNode(NodeContext* nodeCtx) {
+  return CostModel(nodeCtx->qctx, nodeCtx->spaceId).tagRows(nodeCtx->scanInfo.schemaNames.back());
+}
+
+std::optional<double> LabelIndexSeek::estimateEdge(EdgeContext* edgeCtx) {
+  auto rows =
+      CostModel(edgeCtx->qctx, edgeCtx->spaceId).edgeRows(edgeCtx->scanInfo.schemaNames.back());
+  if (rows.has_value() && edgeCtx->scanInfo.direction == MatchEdge::Direction::BOTH) {
+    // Both the src and dst are start vids
+    *rows *= 2;
+  }
+  return rows;
+}
+
 /*static*/ StatusOr<std::vector<IndexID>> LabelIndexSeek::pickTagIndex(const NodeContext* nodeCtx) {
   std::vector<IndexID> indexIds;
   const auto* qctx = nodeCtx->qctx;
@@ -29,6 +29,10 @@ class LabelIndexSeek final : public StartVidFinder {
 
   StatusOr<SubPlan> transformEdge(EdgeContext* edgeCtx) override;
 
+  std::optional<double> estimateNode(NodeContext* nodeCtx) override;
+
+  std::optional<double> estimateEdge(EdgeContext* edgeCtx) override;
+
   static StatusOr<std::vector<IndexID>> pickTagIndex(const NodeContext* nodeCtx);
 
   static StatusOr<std::vector<IndexID>> pickEdgeIndex(const EdgeContext* edgeCtx);
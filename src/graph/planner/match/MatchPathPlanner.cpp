@@ -125,45 +125,66 @@ Status MatchPathPlanner::findStarts(
 
   // Find the start plan node
   for (auto& finder : startVidFinders) {
-    for (size_t i = 0; i < nodeInfos.size() && !foundStart; ++i) {
-      auto nodeCtx = NodeContext(qctx, bindWhereClause, spaceId, &nodeInfos[i]);
-      nodeCtx.nodeAliasesAvailable = &allNodeAliasesAvailable;
+    // All node and edge patterns matched by the finder, in the order of pattern
+    struct Candidate {
+      std::unique_ptr<PatternContext> ctx;
+      std::unique_ptr<StartVidFinder> finder;
+      size_t index;
+      std::optional<double> rows;
+    };
+    std::vector<Candidate> candidates;
+    for (size_t i = 0; i < nodeInfos.size(); ++i) {
+      auto nodeCtx = std::make_unique<NodeContext>(qctx, bindWhereClause, spaceId, &nodeInfos[i]);
+      nodeCtx->nodeAliasesAvailable = &allNodeAliasesAvailable;
       auto nodeFinder = finder();
-      if (nodeFinder->match(&nodeCtx)) {
-        auto plan = nodeFinder->transform(&nodeCtx);
-        if (!plan.ok()) {
-          return plan.status();
-        }
-        matchClausePlan = std::move(plan).value();
-        startIndex = i;
-        foundStart = true;
-        initialExpr_ = nodeCtx.initialExpr->clone();
-        VLOG(1) << "Find starts: " << startIndex << ", Pattern has " << edgeInfos.size()
-                << " edges, root: " << matchClausePlan.root->outputVar()
-                << ", colNames: " << folly::join(",", matchClausePlan.root->colNames());
-        break;
+      if (nodeFinder->match(nodeCtx.get())) {
+        auto rows = nodeFinder->estimate(nodeCtx.get());
+        candidates.emplace_back(Candidate{std::move(nodeCtx), std::move(nodeFinder), i, rows});
       }
 
       if (i != nodeInfos.size() - 1) {
-        auto edgeCtx = EdgeContext(qctx, bindWhereClause, spaceId, &edgeInfos[i]);
+        auto edgeCtx = std::make_unique<EdgeContext>(qctx, bindWhereClause, spaceId, &edgeInfos[i]);
         auto edgeFinder = finder();
-        if (edgeFinder->match(&edgeCtx)) {
-          auto plan = edgeFinder->transform(&edgeCtx);
-          if (!plan.ok()) {
-            return plan.status();
-          }
-          matchClausePlan = std::move(plan).value();
-          startFromEdge = true;
-          startIndex = i;
-          foundStart = true;
-          initialExpr_ = edgeCtx.initialExpr->clone();
-          break;
+        if (edgeFinder->match(edgeCtx.get())) {
+          auto rows = edgeFinder->estimate(edgeCtx.get());
+          candidates.emplace_back(Candidate{std::move(edgeCtx), std::move(edgeFinder), i, rows});
+        }
+      }
+    }
+    if (candidates.empty()) {
+      continue;
+    }
+
+    // Start from the pattern with the fewest rows if all of them are estimated, otherwise from the
+    // first one
+    auto* chosen = &candidates.front();
+    bool allEstimated = std::all_of(
+        candidates.begin(), candidates.end(), [](auto& c) { return c.rows.has_value(); });
+    if (allEstimated) {
+      for (auto& candidate : candidates) {
+        if (*candidate.rows < *chosen->rows) {
+          chosen = &candidate;
         }
       }
     }
-    if (foundStart) {
-      break;
+
+    auto plan = chosen->finder->transform(chosen->ctx.get());
+    if (!plan.ok()) {
+      return plan.status();
+    }
+    matchClausePlan = std::move(plan).value();
+    startIndex = chosen->index;
+    foundStart = true;
+    if (chosen->ctx->kind == PatternKind::kNode) {
+      initialExpr_ = static_cast<NodeContext*>(chosen->ctx.get())->initialExpr->clone();
+    } else {
+      startFromEdge = true;
+      initialExpr_ = static_cast<EdgeContext*>(chosen->ctx.get())->initialExpr->clone();
     }
+    VLOG(1) << "Find starts: " << startIndex << ", from edge: " << startFromEdge << ", Pattern has "
+            << edgeInfos.size() << " edges, root: " << matchClausePlan.root->outputVar()
+            << ", colNames: " << folly::join(",", matchClausePlan.root->colNames());
+    break;
   }
   if (!foundStart) {
     return Status::SemanticError("Can't solve the start vids from the sentence.");
@@ -7,6 +7,7 @@
 
 #include "graph/planner/match/MatchSolver.h"
 #include "graph/planner/plan/Query.h"
+#include "graph/util/CostModel.h"
 #include "graph/util/ExpressionUtils.h"
 
 namespace nebula {
@@ -176,5 +177,40 @@ StatusOr<SubPlan> PropIndexSeek::transformNode(NodeContext* nodeCtx) {
   return plan;
 }
 
+std::optional<double> PropIndexSeek::estimateNode(NodeContext* nodeCtx) {
+  CostModel costModel(nodeCtx->qctx, nodeCtx->spaceId);
+  auto rows = costModel.tagRows(nodeCtx->scanInfo.schemaNames.back());
+  auto indexes = nodeCtx->qctx->indexMng()->getTagIndexes(nodeCtx->spaceId);
+  if (!rows.has_value() || !indexes.ok()) {
+    return std::nullopt;
+  }
+  auto tagId = nodeCtx->scanInfo.schemaIds.back();
+  std::vector<std::shared_ptr<meta::cpp2::IndexItem>> tagIndexes;
+  for (auto& index : indexes.value()) {
+    if (index->get_schema_id().get_tag_id() == tagId) {
+      tagIndexes.emplace_back(index);
+    }
+  }
+  return costModel.filterRows(nodeCtx->scanInfo.filter, tagIndexes, *rows);
+}
+
+std::optional<double> PropIndexSeek::estimateEdge(EdgeContext* edgeCtx) {
+  CostModel costModel(edgeCtx->qctx, edgeCtx->spaceId);
+  auto rows = costModel.edgeRows(edgeCtx->scanInfo.schemaNames.back());
+  auto indexes = edgeCtx->qctx->indexMng()->getEdgeIndexes(edgeCtx->spaceId);
+  if (!rows.has_value() || !indexes.ok()) {
+    return std::nullopt;
+  }
+  auto edgeType = edgeCtx->scanInfo.schemaIds.back();
+  std::vector<std::shared_ptr<meta::cpp2::IndexItem>> edgeIndexes;
+  for (auto& index : indexes.value()) {
+    if (index->get_schema_id().get_edge_type() == edgeType) {
+      edgeIndexes.emplace_back(index);
+    }
+  }
+  auto filtered = costModel.filterRows(edgeCtx->scanInfo.filter, edgeIndexes, *rows);
+  return edgeCtx->scanInfo.direction == MatchEdge::Direction::BOTH ? filtered * 2 : filtered;
+}
+
 }  // namespace graph
 }  // namespace nebula
@@ -26,6 +26,10 @@ class PropIndexSeek final : public StartVidFinder {
 
   StatusOr<SubPlan> transformEdge(EdgeContext* edgeCtx) override;
 
+  std::optional<double> estimateNode(NodeContext* nodeCtx) override;
+
+  std::optional<double> estimateEdge(EdgeContext* edgeCtx) override;
+
  private:
   PropIndexSeek() = default;
 };
@@ -35,5 +35,17 @@ StatusOr<SubPlan> StartVidFinder::transform(PatternContext* patternCtx) {
   return Status::Error("Unknown pattern kind.");
 }
 
+std::optional<double> StartVidFinder::estimate(PatternContext* patternCtx) {
+  if (patternCtx->kind == PatternKind::kNode) {
+    return estimateNode(static_cast<NodeContext*>(patternCtx));
+  }
+
+  if (patternCtx->kind == PatternKind::kEdge) {
+    return estimateEdge(static_cast<EdgeContext*>(patternCtx));
+  }
+
+  return std::nullopt;
+}
+
 }  // namespace graph
 }  // namespace nebula
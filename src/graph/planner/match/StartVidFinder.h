@@ -6,6 +6,8 @@
 #ifndef GRAPH_PLANNER_MATCH_STARTVIDFINDER_H_
 #define GRAPH_PLANNER_MATCH_STARTVIDFINDER_H_
 
+#include <optional>
+
 #include "graph/context/ast/CypherAstContext.h"
 #include "graph/planner/Planner.h"
 
@@ -36,6 +38,9 @@ using StartVidFinderInstantiateFunc = std::function<std::unique_ptr<StartVidFind
 // MATCH(s)-[:edge]->(e) RETURN e
 //
 // 5. ScanSeek finds if a plan could traverse from some vids by scanning.
+//
+// The finders are tried in the above order. When several node or edge patterns are matched by the
+// same finder, the one with the fewest start vids estimated by statistics is picked.
 class StartVidFinder {
  public:
   virtual ~StartVidFinder() = default;
@@ -57,6 +62,18 @@ class StartVidFinder {
 
   StatusOr<SubPlan> transform(PatternContext* patternCtx);
 
+  // Estimate the number of start vids of a pattern matched by the finder, return none if there
+  // are no statistics.
+  std::optional<double> estimate(PatternContext* patternCtx);
+
+  virtual std::optional<double> estimateNode(NodeContext*) {
+    return std::nullopt;
+  }
+
+  virtual std::optional<double> estimateEdge(EdgeContext*) {
+    return std::nullopt;
+  }
+
   virtual StatusOr<SubPlan> transformNode(NodeContext* nodeCtx) = 0;
 
   virtual StatusOr<SubPlan> transformEdge(EdgeContext* edgeCtx) = 0;
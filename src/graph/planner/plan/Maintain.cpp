@@ -51,6 +51,9 @@ std::unique_ptr<PlanNodeDescription> CreateIndexNode::explain() const {
     fields.emplace_back(field.get_name());
   }
   addDescription("fields", folly::toJson(util::toJson(fields)), desc.get());
+  if (!includeFields_.empty()) {
+    addDescription("includeFields", folly::toJson(util::toJson(includeFields_)), desc.get());
+  }
   addDescription("ifNotExists", folly::to<std::string>(ifNotExists_), desc.get());
   if (indexParams_) {
     addDescription("indexParams", folly::toJson(util::toJson(*indexParams_)), desc.get());
@@ -333,14 +333,16 @@ class CreateIndexNode : public SingleDependencyNode {
                   std::vector<meta::cpp2::IndexFieldDef> fields,
                   bool ifNotExists,
                   std::unique_ptr<meta::cpp2::IndexParams> indexParams,
-                  const std::string* comment)
+                  const std::string* comment,
+                  std::vector<std::string> includeFields)
       : SingleDependencyNode(qctx, kind, input),
         schemaName_(std::move(schemaName)),
         indexName_(std::move(indexName)),
         fields_(std::move(fields)),
         ifNotExists_(ifNotExists),
         indexParams_(std::move(indexParams)),
-        comment_(comment) {}
+        comment_(comment),
+        includeFields_(std::move(includeFields)) {}
 
  public:
   const std::string& getSchemaName() const {
@@ -367,6 +369,10 @@ class CreateIndexNode : public SingleDependencyNode {
     return comment_;
   }
 
+  const std::vector<std::string>& getIncludeFields() const {
+    return includeFields_;
+  }
+
   std::unique_ptr<PlanNodeDescription> explain() const override;
 
  protected:
@@ -376,6 +382,7 @@ class CreateIndexNode : public SingleDependencyNode {
   bool ifNotExists_;
   std::unique_ptr<meta::cpp2::IndexParams> indexParams_;
   const std::string* comment_;
+  std::vector<std::string> includeFields_;
 };
 
 class CreateTagIndex final : public CreateIndexNode {
@@ -387,7 +394,8 @@ class CreateTagIndex final : public CreateIndexNode {
                               std::vector<meta::cpp2::IndexFieldDef> fields,
                               bool ifNotExists,
                               std::unique_ptr<meta::cpp2::IndexParams> indexParams,
-                              const std::string* comment) {
+                              const std::string* comment,
+                              std::vector<std::string> includeFields = {}) {
     return qctx->objPool()->makeAndAdd<CreateTagIndex>(qctx,
                                                        input,
                                                        std::move(tagName),
@@ -395,7 +403,8 @@ class CreateTagIndex final : public CreateIndexNode {
                                                        std::move(fields),
                                                        ifNotExists,
                                                        std::move(indexParams),
-                                                       comment);
+                                                       comment,
+                                                       std::move(includeFields));
   }
 
  private:
@@ -407,7 +416,8 @@ class CreateTagIndex final : public CreateIndexNode {
                  std::vector<meta::cpp2::IndexFieldDef> fields,
                  bool ifNotExists,
                  std::unique_ptr<meta::cpp2::IndexParams> indexParams,
-                 const std::string* comment)
+                 const std::string* comment,
+                 std::vector<std::string> includeFields)
       : CreateIndexNode(qctx,
                         input,
                         Kind::kCreateTagIndex,
@@ -416,7 +426,8 @@ class CreateTagIndex final : public CreateIndexNode {
                         std::move(fields),
                         ifNotExists,
                         std::move(indexParams),
-                        comment) {}
+                        comment,
+                        std::move(includeFields)) {}
 };
 
 class CreateEdgeIndex final : public CreateIndexNode {
@@ -428,7 +439,8 @@ class CreateEdgeIndex final : public CreateIndexNode {
                                std::vector<meta::cpp2::IndexFieldDef> fields,
                                bool ifNotExists,
                                std::unique_ptr<meta::cpp2::IndexParams> indexParams,
-                               const std::string* comment) {
+                               const std::string* comment,
+                               std::vector<std::string> includeFields = {}) {
     return qctx->objPool()->makeAndAdd<CreateEdgeIndex>(qctx,
                                                         input,
                                                         std::move(edgeName),
@@ -436,7 +448,8 @@ class CreateEdgeIndex final : public CreateIndexNode {
                                                         std::move(fields),
                                                         ifNotExists,
                                                         std::move(indexParams),
-                                                        comment);
+                                                        comment,
+                                                        std::move(includeFields));
   }
 
  private:
@@ -448,7 +461,8 @@ class CreateEdgeIndex final : public CreateIndexNode {
                   std::vector<meta::cpp2::IndexFieldDef> fields,
                   bool ifNotExists,
                   std::unique_ptr<meta::cpp2::IndexParams> indexParams,
-                  const std::string* comment)
+                  const std::string* comment,
+                  std::vector<std::string> includeFields)
       : CreateIndexNode(qctx,
                         input,
                         Kind::kCreateEdgeIndex,
@@ -457,7 +471,8 @@ class CreateEdgeIndex final : public CreateIndexNode {
                         std::move(fields),
                         ifNotExists,
                         std::move(indexParams),
-                        comment) {}
+                        comment,
+                        std::move(includeFields)) {}
 };
 
 class DescIndexNode : public SingleDependencyNode {
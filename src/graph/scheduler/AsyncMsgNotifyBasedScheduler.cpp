@@ -6,6 +6,7 @@
 #include "graph/scheduler/AsyncMsgNotifyBasedScheduler.h"
 
 DECLARE_bool(enable_lifetime_optimize);
+DECLARE_bool(enable_result_arena);
 
 namespace nebula {
 namespace graph {
@@ -185,6 +186,9 @@ folly::Future<Status> AsyncMsgNotifyBasedScheduler::runLoop(
         if (!val.getBool()) {
           return Status::OK();
         }
+        // The results of each iteration are allocated from a new arena, so the arena of the
+        // iterations before is released once their results are dropped
+        qctx_->renewArena();
         std::vector<folly::Future<Status>> fs;
         fs.emplace_back(doSchedule(loop->loopBody()));
         return runLoop(std::move(fs), loop, runner);
@@ -214,6 +218,8 @@ void AsyncMsgNotifyBasedScheduler::notifyError(std::vector<folly::Promise<Status
 }
 
 folly::Future<Status> AsyncMsgNotifyBasedScheduler::execute(Executor* executor) const {
+  // Only covers the results built synchronously, the callbacks of futures run out of the guard
+  ResultArenaGuard guard(FLAGS_enable_result_arena ? qctx_->arena() : nullptr);
   auto status = executor->open();
   if (!status.ok()) {
     return executor->error(std::move(status));
@@ -74,6 +74,16 @@ DEFINE_bool(enable_toss, false, "Whether to enable toss feature");
 DEFINE_bool(enable_data_balance, true, "Whether to enable data balance feature");
 
 DEFINE_int32(num_rows_to_check_memory, 1024, "number rows to check memory");
+DEFINE_int64(query_memory_quota_mb,
+             0,
+             "Max memory of the results and hash tables of a query in MB, 0 means unlimited");
+DEFINE_int64(session_memory_quota_mb,
+             0,
+             "Max memory of all running queries of a session in MB, 0 means unlimited");
+DEFINE_bool(kill_heaviest_query_on_memory_watermark,
+            true,
+            "Whether to kill the query using the most memory when the system memory hits the high "
+            "watermark, instead of failing the queries which check the watermark");
 DEFINE_int32(max_sessions_per_ip_per_user,
              300,
              "Maximum number of sessions that can be created per IP and per user");
@@ -101,9 +111,36 @@ DEFINE_int32(min_batch_size,
 DEFINE_int32(max_job_size, 1, "The max job size in multi job mode.");
 
 DEFINE_bool(enable_async_gc, false, "If enable async gc.");
+DEFINE_bool(enable_result_arena,
+            true,
+            "Whether to allocate the intermediate results of a query from its arenas, which are "
+            "released once the results are dropped");
 DEFINE_uint32(
     gc_worker_size,
     0,
     "Background garbage clean workers, default number is 0 which means using hardware core size.");
+DEFINE_int64(gc_pending_memory_limit_mb,
+             1024,
+             "Max estimated memory in MB of the garbage waiting for the background workers, the "
+             "garbage beyond it is released by the query itself, 0 means unlimited");
+DEFINE_uint32(gc_batch_duration_ms,
+              10,
+              "Time in ms a gc worker spends in releasing garbage each round, unless the pending "
+              "memory exceeds half of gc_pending_memory_limit_mb");
+
+DEFINE_int32(default_stream_batch_rows,
+             1024,
+             "Rows of a batch of executeStream if the client doesn't specify the batch size");
+DEFINE_uint32(max_streams_per_session,
+              16,
+              "Max result streams of a session not drained or closed by the client");
+
+DEFINE_uint32(max_prepared_statements_per_session,
+              256,
+              "Max prepared statements of a session not closed by the client");
+DEFINE_uint32(prepared_statement_max_reuses,
+              10000,
+              "Executions of a compiled prepared statement before it's compiled again, which "
+              "bounds the expressions cloned into its objects by the executors");
 
 DEFINE_bool(graph_use_vertex_key, false, "whether allow insert or query the vertex key");
@@ -61,12 +61,24 @@ DECLARE_bool(enable_client_white_list);
 DECLARE_string(client_white_list);
 
 DECLARE_int32(num_rows_to_check_memory);
+DECLARE_int64(query_memory_quota_mb);
+DECLARE_int64(session_memory_quota_mb);
+DECLARE_bool(kill_heaviest_query_on_memory_watermark);
 
 DECLARE_int32(min_batch_size);
 DECLARE_int32(max_job_size);
 
 DECLARE_bool(enable_async_gc);
+DECLARE_bool(enable_result_arena);
 DECLARE_uint32(gc_worker_size);
+DECLARE_int64(gc_pending_memory_limit_mb);
+DECLARE_uint32(gc_batch_duration_ms);
+
+DECLARE_int32(default_stream_batch_rows);
+DECLARE_uint32(max_streams_per_session);
+
+DECLARE_uint32(max_prepared_statements_per_session);
+DECLARE_uint32(prepared_statement_max_reuses);
 
 DECLARE_bool(graph_use_vertex_key);
 
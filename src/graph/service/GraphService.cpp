@@ -19,6 +19,7 @@
 #include "graph/service/PasswordAuthenticator.h"
 #include "graph/service/RequestContext.h"
 #include "graph/stats/GraphStats.h"
+#include "graph/util/IdGenerator.h"
 #include "version/Version.h"
 
 namespace nebula {
@@ -66,7 +67,7 @@ Status GraphService::init(std::shared_ptr<folly::IOThreadPoolExecutor> ioExecuto
   }
 
   queryEngine_ = std::make_unique<QueryEngine>();
-  return queryEngine_->init(std::move(ioExecutor), metaClient_.get());
+  return queryEngine_->init(std::move(ioExecutor), metaClient_.get(), sessionManager_.get());
 }
 
 folly::Future<AuthResponse> GraphService::future_authenticate(const std::string& username,
@@ -139,10 +140,19 @@ folly::Future<ExecutionResponse> GraphService::future_executeWithParameter(
     int64_t sessionId,
     const std::string& query,
     const std::unordered_map<std::string, Value>& parameterMap) {
+  return executeQuery(sessionId, query, parameterMap, QueryOptions());
+}
+
+folly::Future<ExecutionResponse> GraphService::executeQuery(
+    int64_t sessionId,
+    const std::string& query,
+    const std::unordered_map<std::string, Value>& parameterMap,
+    QueryOptions options) {
   auto ctx = std::make_unique<RequestContext<ExecutionResponse>>();
   ctx->setQuery(query);
   ctx->setRunner(getThreadManager());
   ctx->setSessionMgr(sessionManager_.get());
+  ctx->setStream(std::move(options.stream));
   auto future = ctx->future();
   // When the sessionId is 0, it means the clients to ping the connection is ok
   if (sessionId == 0) {
@@ -151,8 +161,11 @@ folly::Future<ExecutionResponse> GraphService::future_executeWithParameter(
     ctx->finish();
     return future;
   }
-  auto cb = [this, sessionId, ctx = std::move(ctx), parameterMap = std::move(parameterMap)](
-                StatusOr<std::shared_ptr<ClientSession>> ret) mutable {
+  auto cb = [this,
+             sessionId,
+             ctx = std::move(ctx),
+             parameterMap = std::move(parameterMap),
+             options = std::move(options)](StatusOr<std::shared_ptr<ClientSession>> ret) mutable {
     if (!ret.ok()) {
       LOG(ERROR) << "Get session for sessionId: " << sessionId << " failed: " << ret.status();
       ctx->resp().errorCode = ErrorCode::E_SESSION_INVALID;
@@ -168,6 +181,33 @@ folly::Future<ExecutionResponse> GraphService::future_executeWithParameter(
           new std::string(folly::stringPrintf("SessionId[%ld] does not exist", sessionId)));
       return ctx->finish();
     }
+    if (ctx->stream() != nullptr && sessionPtr->numStreams() >= FLAGS_max_streams_per_session) {
+      ctx->resp().errorCode = ErrorCode::E_EXECUTION_ERROR;
+      ctx->resp().errorMsg.reset(new std::string(
+          folly::stringPrintf("Too many streams of sessionId[%ld], fetch or close them first",
+                              sessionId)));
+      return ctx->finish();
+    }
+    if (options.preparedId >= 0) {
+      auto prepared = sessionPtr->findPrepared(options.preparedId);
+      if (prepared == nullptr) {
+        ctx->resp().errorCode = ErrorCode::E_EXECUTION_ERROR;
+        ctx->resp().errorMsg.reset(new std::string(folly::stringPrintf(
+            "Prepared statement[%ld] does not exist", options.preparedId)));
+        return ctx->finish();
+      }
+      ctx->setQuery(prepared->query());
+      ctx->setPrepared(std::move(prepared), false);
+    } else if (options.prepare != nullptr) {
+      // Reserve the slot before compiling, it's released if the statement fails to compile
+      if (!sessionPtr->addPrepared(options.prepare)) {
+        ctx->resp().errorCode = ErrorCode::E_EXECUTION_ERROR;
+        ctx->resp().errorMsg.reset(new std::string(folly::stringPrintf(
+            "Too many prepared statements of sessionId[%ld], close them first", sessionId)));
+        return ctx->finish();
+      }
+      ctx->setPrepared(std::move(options.prepare), true);
+    }
     stats::StatsManager::addValue(kNumQueries);
     stats::StatsManager::addValue(kNumActiveQueries);
     if (FLAGS_enable_space_level_metrics && sessionPtr->space().name != "") {
@@ -210,6 +250,125 @@ folly::Future<std::string> GraphService::future_executeJsonWithParameter(
   });
 }
 
+folly::Future<cpp2::ExecutionStreamResp> GraphService::future_executeStream(
+    int64_t sessionId,
+    const std::string& query,
+    const std::unordered_map<std::string, Value>& parameterMap,
+    int32_t batchSize) {
+  auto stream = std::make_shared<ResultStream>(
+      batchSize > 0 ? batchSize : std::max(FLAGS_default_stream_batch_rows, 1));
+  QueryOptions options;
+  options.stream = stream;
+  return executeQuery(sessionId, query, parameterMap, std::move(options))
+      .thenValue([stream](ExecutionResponse&& resp) {
+        cpp2::ExecutionStreamResp streamResp;
+        streamResp.error_code_ref() = static_cast<nebula::cpp2::ErrorCode>(resp.errorCode);
+        if (resp.errorMsg != nullptr) {
+          streamResp.error_msg_ref() = std::move(*resp.errorMsg);
+        }
+        if (resp.data != nullptr) {
+          streamResp.stream_id_ref() = stream->id();
+          streamResp.data_ref() = std::move(*resp.data);
+          streamResp.has_more_ref() = stream->hasMore();
+        }
+        streamResp.latency_in_us_ref() = resp.latencyInUs;
+        if (resp.spaceName != nullptr) {
+          streamResp.space_name_ref() = std::move(*resp.spaceName);
+        }
+        return streamResp;
+      });
+}
+
+folly::Future<cpp2::ExecutionStreamResp> GraphService::future_fetchStream(int64_t sessionId,
+                                                                          int64_t streamId) {
+  time::Duration duration;
+  auto cb = [sessionId, streamId, duration](StatusOr<std::shared_ptr<ClientSession>> ret) {
+    cpp2::ExecutionStreamResp resp;
+    resp.error_code_ref() = nebula::cpp2::ErrorCode::SUCCEEDED;
+    if (!ret.ok() || ret.value() == nullptr) {
+      resp.error_code_ref() = nebula::cpp2::ErrorCode::E_SESSION_INVALID;
+      resp.error_msg_ref() = folly::stringPrintf("SessionId[%ld] does not exist", sessionId);
+      return resp;
+    }
+    auto session = std::move(ret).value();
+    // Keep the session active
+    session->charge();
+    resp.stream_id_ref() = streamId;
+    auto stream = session->findStream(streamId);
+    if (stream == nullptr) {
+      resp.error_code_ref() = nebula::cpp2::ErrorCode::E_EXECUTION_ERROR;
+      resp.error_msg_ref() = folly::stringPrintf("Stream[%ld] does not exist", streamId);
+      return resp;
+    }
+    if (stream->isKilled()) {
+      session->deleteStream(streamId);
+      resp.error_code_ref() = nebula::cpp2::ErrorCode::E_EXECUTION_ERROR;
+      resp.error_msg_ref() = "Execution had been killed";
+      return resp;
+    }
+    resp.data_ref() = stream->next();
+    auto hasMore = stream->hasMore();
+    if (!hasMore) {
+      session->deleteStream(streamId);
+    }
+    resp.has_more_ref() = hasMore;
+    resp.latency_in_us_ref() = duration.elapsedInUSec();
+    resp.space_name_ref() = session->space().name;
+    return resp;
+  };
+  return sessionManager_->findSession(sessionId, getThreadManager()).thenValue(std::move(cb));
+}
+
+void GraphService::closeStream(int64_t sessionId, int64_t streamId) {
+  VLOG(2) << "Close stream " << streamId << " of session " << sessionId;
+  sessionManager_->findSession(sessionId, getThreadManager())
+      .thenValue([streamId](StatusOr<std::shared_ptr<ClientSession>> ret) {
+        if (ret.ok() && ret.value() != nullptr) {
+          ret.value()->deleteStream(streamId);
+        }
+      });
+}
+
+folly::Future<cpp2::PrepareResp> GraphService::future_prepare(
+    int64_t sessionId,
+    const std::string& query,
+    const std::unordered_map<std::string, Value>& parameterMap) {
+  QueryOptions options;
+  options.prepare = std::make_shared<PreparedStatement>(EPIdGenerator::instance().id(), query);
+  auto id = options.prepare->id();
+  return executeQuery(sessionId, query, parameterMap, std::move(options))
+      .thenValue([id](ExecutionResponse&& resp) {
+        cpp2::PrepareResp prepareResp;
+        prepareResp.error_code_ref() = static_cast<nebula::cpp2::ErrorCode>(resp.errorCode);
+        if (resp.errorMsg != nullptr) {
+          prepareResp.error_msg_ref() = std::move(*resp.errorMsg);
+        }
+        if (resp.errorCode == ErrorCode::SUCCEEDED) {
+          prepareResp.statement_id_ref() = id;
+        }
+        return prepareResp;
+      });
+}
+
+folly::Future<ExecutionResponse> GraphService::future_executePrepared(
+    int64_t sessionId,
+    int64_t statementId,
+    const std::unordered_map<std::string, Value>& parameterMap) {
+  QueryOptions options;
+  options.preparedId = statementId;
+  return executeQuery(sessionId, "", parameterMap, std::move(options));
+}
+
+void GraphService::closePrepared(int64_t sessionId, int64_t statementId) {
+  VLOG(2) << "Close prepared statement " << statementId << " of session " << sessionId;
+  sessionManager_->findSession(sessionId, getThreadManager())
+      .thenValue([statementId](StatusOr<std::shared_ptr<ClientSession>> ret) {
+        if (ret.ok() && ret.value() != nullptr) {
+          ret.value()->deletePrepared(statementId);
+        }
+      });
+}
+
 Status GraphService::auth(const std::string& username, const std::string& password) {
   auto metaClient = queryEngine_->metaClient();
 
@@ -7,7 +7,9 @@
 #define GRAPH_SERVICE_GRAPHSERVICE_H_
 
 #include "common/base/Base.h"
+#include "graph/context/ResultStream.h"
 #include "graph/service/Authenticator.h"
+#include "graph/service/PreparedStatement.h"
 #include "graph/service/QueryEngine.h"
 #include "graph/session/GraphSessionManager.h"
 #include "interface/gen-cpp2/GraphService.h"
@@ -51,11 +53,50 @@ class GraphService final : public cpp2::GraphServiceSvIf {
   folly::Future<cpp2::VerifyClientVersionResp> future_verifyClientVersion(
       const cpp2::VerifyClientVersionReq& req) override;
 
+  folly::Future<cpp2::ExecutionStreamResp> future_executeStream(
+      int64_t sessionId,
+      const std::string& stmt,
+      const std::unordered_map<std::string, Value>& parameterMap,
+      int32_t batchSize) override;
+
+  folly::Future<cpp2::ExecutionStreamResp> future_fetchStream(int64_t sessionId,
+                                                              int64_t streamId) override;
+
+  void closeStream(int64_t sessionId, int64_t streamId) override;
+
+  folly::Future<cpp2::PrepareResp> future_prepare(
+      int64_t sessionId,
+      const std::string& stmt,
+      const std::unordered_map<std::string, Value>& parameterMap) override;
+
+  folly::Future<ExecutionResponse> future_executePrepared(
+      int64_t sessionId,
+      int64_t statementId,
+      const std::unordered_map<std::string, Value>& parameterMap) override;
+
+  void closePrepared(int64_t sessionId, int64_t statementId) override;
+
   std::unique_ptr<meta::MetaClient> metaClient_;
 
  private:
   Status auth(const std::string& username, const std::string& password);
 
+  // How the query is executed besides executeWithParameter()
+  struct QueryOptions {
+    // The result is moved into the stream
+    std::shared_ptr<ResultStream> stream;
+    // The query is compiled and kept by the statement rather than executed
+    std::shared_ptr<PreparedStatement> prepare;
+    // The prepared statement of the session to execute instead of the query
+    int64_t preparedId{-1};
+  };
+
+  folly::Future<ExecutionResponse> executeQuery(
+      int64_t sessionId,
+      const std::string& stmt,
+      const std::unordered_map<std::string, Value>& parameterMap,
+      QueryOptions options);
+
   std::unique_ptr<GraphSessionManager> sessionManager_;
   std::unique_ptr<QueryEngine> queryEngine_;
 };
@@ -0,0 +1,63 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "graph/service/PreparedStatement.h"
+
+#include "graph/service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+std::unique_ptr<PreparedStatement::Compiled> PreparedStatement::acquire(
+    GraphSpaceID space,
+    int64_t metaVersion,
+    const std::unordered_map<std::string, Value>& parameterMap) {
+  std::unique_ptr<Compiled> compiled;
+  {
+    std::lock_guard<std::mutex> g(lock_);
+    compiled = std::move(compiled_);
+  }
+  if (compiled == nullptr) {
+    return nullptr;
+  }
+  // The invalid one is dropped, and the new one compiled by this execution takes its place
+  if (compiled->space != space || compiled->metaVersion != metaVersion ||
+      compiled->numExecutions >= FLAGS_prepared_statement_max_reuses ||
+      !match(*compiled, parameterMap)) {
+    VLOG(1) << "Compile the prepared statement " << id_ << " again: " << query_;
+    return nullptr;
+  }
+  ++compiled->numExecutions;
+  return compiled;
+}
+
+void PreparedStatement::release(std::unique_ptr<Compiled> compiled) {
+  std::lock_guard<std::mutex> g(lock_);
+  // Keep the latest one if compiled by concurrent executions
+  compiled_.swap(compiled);
+}
+
+// static
+bool PreparedStatement::match(const Compiled& compiled,
+                              const std::unordered_map<std::string, Value>& parameterMap) {
+  if (compiled.parameterTypes.size() != parameterMap.size()) {
+    return false;
+  }
+  for (const auto& param : parameterMap) {
+    auto type = compiled.parameterTypes.find(param.first);
+    if (type == compiled.parameterTypes.end() || type->second != param.second.type()) {
+      return false;
+    }
+  }
+  for (const auto& folded : compiled.foldedParameters) {
+    if (parameterMap.at(folded.first) != folded.second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,81 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef GRAPH_SERVICE_PREPAREDSTATEMENT_H_
+#define GRAPH_SERVICE_PREPAREDSTATEMENT_H_
+
+#include <boost/core/noncopyable.hpp>
+#include <mutex>
+
+#include "common/cpp/helpers.h"
+#include "graph/context/QueryContext.h"
+#include "parser/Sentence.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * @brief A statement prepared by the client, see GraphService::future_prepare. It's parsed,
+ * validated and optimized once, and the compiled query is executed again with the parameters
+ * bound by each execution as long as it's still valid, i.e. on the same space and metadata, with
+ * the same names and types of parameters, and the same values of the parameters folded into the
+ * plan while compiling. Otherwise the statement is compiled again from its text, so the result is
+ * always the same as executeWithParameter().
+ *
+ * The compiled query is used by one execution at a time, the concurrent executions of the same
+ * statement compile their own.
+ */
+class PreparedStatement final : public boost::noncopyable, public cpp::NonMovable {
+ public:
+  struct Compiled {
+    std::unique_ptr<Sentence> sentence;
+    std::unique_ptr<QueryContext> qctx;
+    GraphSpaceID space{-1};
+    // The last update time of metadata when compiled
+    int64_t metaVersion{-1};
+    std::unordered_map<std::string, Value::Type> parameterTypes;
+    // The parameters whose values were read while compiling, e.g. folded into the plan, so the
+    // plan only suits these values
+    std::unordered_map<std::string, Value> foldedParameters;
+    size_t numExecutions{0};
+  };
+
+  PreparedStatement(int64_t id, std::string query) : id_(id), query_(std::move(query)) {}
+
+  int64_t id() const {
+    return id_;
+  }
+
+  const std::string& query() const {
+    return query_;
+  }
+
+  /**
+   * @brief Takes the compiled query for an execution, nullptr if it should be compiled again, or
+   * it's being used by another execution.
+   */
+  std::unique_ptr<Compiled> acquire(GraphSpaceID space,
+                                    int64_t metaVersion,
+                                    const std::unordered_map<std::string, Value>& parameterMap);
+
+  // Keeps the compiled query for the next execution
+  void release(std::unique_ptr<Compiled> compiled);
+
+  // Whether the compiled query suits the parameters
+  static bool match(const Compiled& compiled,
+                    const std::unordered_map<std::string, Value>& parameterMap);
+
+ private:
+  const int64_t id_;
+  const std::string query_;
+
+  std::mutex lock_;
+  std::unique_ptr<Compiled> compiled_;
+};
+
+}  // namespace graph
+}  // namespace nebula
+
+#endif  // GRAPH_SERVICE_PREPAREDSTATEMENT_H_
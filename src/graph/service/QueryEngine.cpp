@@ -14,6 +14,7 @@
 #include "graph/planner/PlannersRegister.h"
 #include "graph/service/GraphFlags.h"
 #include "graph/service/QueryInstance.h"
+#include "graph/session/GraphSessionManager.h"
 #include "version/Version.h"
 
 DECLARE_bool(local_config);
@@ -25,8 +26,10 @@ namespace nebula {
 namespace graph {
 
 Status QueryEngine::init(std::shared_ptr<folly::IOThreadPoolExecutor> ioExecutor,
-                         meta::MetaClient* metaClient) {
+                         meta::MetaClient* metaClient,
+                         GraphSessionManager* sessionManager) {
   metaClient_ = metaClient;
+  sessionManager_ = sessionManager;
   schemaManager_ = meta::ServerBasedSchemaManager::create(metaClient_);
   indexManager_ = meta::ServerBasedIndexManager::create(metaClient_);
   storage_ = std::make_unique<storage::StorageClient>(ioExecutor, metaClient_);
@@ -46,6 +49,18 @@ Status QueryEngine::init(std::shared_ptr<folly::IOThreadPoolExecutor> ioExecutor
 
 // Create query context and query instance and execute it
 void QueryEngine::execute(RequestContextPtr rctx) {
+  auto prepared = rctx->prepared();
+  if (prepared != nullptr && !rctx->prepareOnly()) {
+    auto compiled = prepared->acquire(rctx->session()->space().id,
+                                      metaClient_->localDataLastUpdateTime(),
+                                      rctx->parameterMap());
+    if (compiled != nullptr) {
+      compiled->qctx->reuse(std::move(rctx));
+      auto* instance = new QueryInstance(std::move(compiled), optimizer_.get());
+      instance->execute();
+      return;
+    }
+  }
   auto qctx = std::make_unique<QueryContext>(std::move(rctx),
                                              schemaManager_.get(),
                                              indexManager_.get(),
@@ -62,10 +77,17 @@ Status QueryEngine::setupMemoryMonitorThread() {
     return Status::Error("Fail to start query engine background thread.");
   }
 
-  auto updateMemoryWatermark = []() -> Status {
+  auto updateMemoryWatermark = [this]() -> Status {
     auto status = MemoryUtils::hitsHighWatermark();
     NG_RETURN_IF_ERROR(status);
-    MemoryUtils::kHitMemoryHighWatermark.store(std::move(status).value());
+    auto hit = std::move(status).value();
+    // Only the query using the most memory fails, the watermark is checked again in next round.
+    // Fall back to fail any query checking the watermark if no query could be killed.
+    if (hit && FLAGS_kill_heaviest_query_on_memory_watermark && sessionManager_ != nullptr &&
+        sessionManager_->killHeaviestQuery()) {
+      hit = false;
+    }
+    MemoryUtils::kHitMemoryHighWatermark.store(hit);
     return Status::OK();
   };
 
@@ -24,6 +24,8 @@
 namespace nebula {
 namespace graph {
 
+class GraphSessionManager;
+
 /**
  * QueryEngine is responsible to create and manage ExecutionPlan.
  * For the time being, we don't have the execution plan cache support,
@@ -34,8 +36,10 @@ class QueryEngine final : public boost::noncopyable, public cpp::NonMovable {
   QueryEngine() = default;
   ~QueryEngine() = default;
 
+  // sessionManager: The sessions whose queries are killed when the memory hits the watermark.
   Status init(std::shared_ptr<folly::IOThreadPoolExecutor> ioExecutor,
-              meta::MetaClient* metaClient);
+              meta::MetaClient* metaClient,
+              GraphSessionManager* sessionManager);
 
   using RequestContextPtr = std::unique_ptr<RequestContext<ExecutionResponse>>;
   void execute(RequestContextPtr rctx);
@@ -53,6 +57,7 @@ class QueryEngine final : public boost::noncopyable, public cpp::NonMovable {
   std::unique_ptr<opt::Optimizer> optimizer_;
   std::unique_ptr<thread::GenericWorker> memoryMonitorThread_;
   meta::MetaClient* metaClient_{nullptr};
+  GraphSessionManager* sessionManager_{nullptr};
   CharsetInfo* charsetInfo_{nullptr};
 };
 
@@ -36,15 +36,29 @@ QueryInstance::QueryInstance(std::unique_ptr<QueryContext> qctx, Optimizer *opti
   qctx_->rctx()->session()->addQuery(qctx_.get());
 }
 
+QueryInstance::QueryInstance(std::unique_ptr<PreparedStatement::Compiled> compiled,
+                             Optimizer *optimizer)
+    : QueryInstance(std::move(compiled->qctx), optimizer) {
+  sentence_ = std::move(compiled->sentence);
+  compiled_ = std::move(compiled);
+}
+
 void QueryInstance::execute() {
-  Status status = validateAndOptimize();
-  if (!status.ok()) {
-    onError(std::move(status));
-    return;
-  }
+  // The compiled prepared statement is executed directly
+  if (compiled_ == nullptr) {
+    Status status = validateAndOptimize();
+    if (!status.ok()) {
+      onError(std::move(status));
+      return;
+    }
 
-  // Sentence is explain query, finish
-  if (!explainOrContinue()) {
+    // Sentence is explain query, finish
+    if (!explainOrContinue()) {
+      onFinish();
+      return;
+    }
+  }
+  if (qctx_->rctx()->prepareOnly()) {
     onFinish();
     return;
   }
@@ -68,6 +82,12 @@ void QueryInstance::execute() {
 Status QueryInstance::validateAndOptimize() {
   auto *rctx = qctx()->rctx();
   auto &spaceName = rctx->session()->space().name;
+  // The compiled prepared statement is valid for the space and metadata before compiling
+  auto space = rctx->session()->space().id;
+  auto metaVersion = qctx_->getMetaClient()->localDataLastUpdateTime();
+  if (rctx->prepared() != nullptr) {
+    qctx_->ectx()->trackReads(true);
+  }
   VLOG(1) << "Parsing query: " << rctx->query();
   // Result of parsing, get the parsing tree
   auto result = GQLParser(qctx()).parse(rctx->query());
@@ -98,6 +118,31 @@ Status QueryInstance::validateAndOptimize() {
         stats::StatsManager::histoWithLabels(kOptimizerLatencyUs, {{"space", spaceName}}));
   }
 
+  if (rctx->prepared() != nullptr) {
+    NG_RETURN_IF_ERROR(keepCompiled(space, metaVersion));
+  }
+  return Status::OK();
+}
+
+Status QueryInstance::keepCompiled(GraphSpaceID space, int64_t metaVersion) {
+  if (sentence_->kind() == Sentence::Kind::kExplain) {
+    return Status::SemanticError("EXPLAIN or PROFILE can't be prepared");
+  }
+  auto *rctx = qctx_->rctx();
+  auto *ectx = qctx_->ectx();
+  compiled_ = std::make_unique<PreparedStatement::Compiled>();
+  compiled_->space = space;
+  compiled_->metaVersion = metaVersion;
+  for (const auto &param : rctx->parameterMap()) {
+    compiled_->parameterTypes.emplace(param.first, param.second.type());
+    // Only the parameters read while compiling tie the plan to their values, e.g. the ones
+    // rewritten to constants for the index scan or evaluated as the skip/limit of MATCH
+    if (ectx->reads().count(param.first) != 0) {
+      compiled_->foldedParameters.emplace(param.first, param.second);
+    }
+  }
+  ectx->trackReads(false);
+  qctx_->keepCompiled();
   return Status::OK();
 }
 
@@ -117,14 +162,34 @@ void QueryInstance::onFinish() {
   auto &spaceName = rctx->session()->space().name;
   rctx->resp().spaceName = std::make_unique<std::string>(spaceName);
 
-  fillRespData(&rctx->resp());
+  auto &stream = rctx->stream();
+  if (stream != nullptr) {
+    fillRespStream(&rctx->resp(), stream.get());
+  } else {
+    fillRespData(&rctx->resp());
+  }
 
   auto latency = rctx->duration().elapsedInUSec();
   rctx->resp().latencyInUs = latency;
   addSlowQueryStats(latency, spaceName);
-  rctx->finish();
 
   rctx->session()->deleteQuery(qctx_.get());
+  if (stream != nullptr && stream->hasMore()) {
+    // Registered before the response, which tells the client to fetch the rest
+    rctx->session()->addStream(stream);
+  }
+  if (compiled_ != nullptr) {
+    auto prepared = rctx->prepared();
+    // Hand the compiled query back to the statement before the response, so the next execution
+    // reuses it
+    auto request = qctx_->releaseExecution();
+    compiled_->sentence = std::move(sentence_);
+    compiled_->qctx = std::move(qctx_);
+    prepared->release(std::move(compiled_));
+    request->finish();
+  } else {
+    rctx->finish();
+  }
   // The `QueryInstance' is the root node holding all resources during the
   // execution. When the whole query process is done, it's safe to release this
   // object, as long as no other contexts have chances to access these resources
@@ -192,6 +257,10 @@ void QueryInstance::onError(Status status) {
   }
   addSlowQueryStats(latency, spaceName);
   rctx->session()->deleteQuery(qctx_.get());
+  if (rctx->prepareOnly()) {
+    // Release the slot reserved for the statement failing to compile
+    rctx->session()->deletePrepared(rctx->prepared()->id());
+  }
   rctx->finish();
   delete this;
 }
@@ -236,6 +305,27 @@ void QueryInstance::fillRespData(ExecutionResponse *resp) {
   }
 }
 
+// Move the result into the stream and fill the response with its first batch. The whole result
+// is built before, the stream only bounds the rows serialized in each response.
+void QueryInstance::fillRespStream(ExecutionResponse *resp, ResultStream *stream) {
+  fillRespData(resp);
+  if (resp->errorCode != ErrorCode::SUCCEEDED || resp->data == nullptr) {
+    return;
+  }
+  auto *rctx = qctx_->rctx();
+  auto status = stream->reset(qctx_->plan()->id(),
+                              rctx->query(),
+                              std::move(*resp->data),
+                              rctx->session()->memoryTracker());
+  if (!status.ok()) {
+    resp->data.reset();
+    resp->errorCode = ErrorCode::E_EXECUTION_ERROR;
+    resp->errorMsg = std::make_unique<std::string>(status.toString());
+    return;
+  }
+  *resp->data = stream->next();
+}
+
 // The entry point of the optimizer
 Status QueryInstance::findBestPlan() {
   auto plan = qctx_->plan();
@@ -13,6 +13,7 @@
 #include "graph/context/QueryContext.h"
 #include "graph/optimizer/Optimizer.h"
 #include "graph/scheduler/Scheduler.h"
+#include "graph/service/PreparedStatement.h"
 #include "parser/GQLParser.h"
 
 /**
@@ -27,6 +28,8 @@ namespace graph {
 class QueryInstance final : public boost::noncopyable, public cpp::NonMovable {
  public:
   QueryInstance(std::unique_ptr<QueryContext> qctx, opt::Optimizer* optimizer);
+  // Executes the compiled prepared statement without compiling it again
+  QueryInstance(std::unique_ptr<PreparedStatement::Compiled> compiled, opt::Optimizer* optimizer);
   ~QueryInstance() = default;
 
   // Entrance of the Validate, Optimize, Schedule, Execute process
@@ -52,16 +55,22 @@ class QueryInstance final : public boost::noncopyable, public cpp::NonMovable {
   void onError(Status);
 
   Status validateAndOptimize();
+  // Keeps the compiled query for the executions of the prepared statement
+  Status keepCompiled(GraphSpaceID space, int64_t metaVersion);
   // Return true if continue to execute
   bool explainOrContinue();
   void addSlowQueryStats(uint64_t latency, const std::string& spaceName) const;
   void fillRespData(ExecutionResponse* resp);
+  void fillRespStream(ExecutionResponse* resp, ResultStream* stream);
   Status findBestPlan();
 
   std::unique_ptr<Sentence> sentence_;
   std::unique_ptr<QueryContext> qctx_;
   std::unique_ptr<Scheduler> scheduler_;
   opt::Optimizer* optimizer_{nullptr};
+  // The compiled prepared statement, whose sentence and query context are owned by the instance
+  // during the execution
+  std::unique_ptr<PreparedStatement::Compiled> compiled_;
 };
 
 }  // namespace graph
@@ -10,6 +10,7 @@
 #include "common/base/Base.h"
 #include "common/cpp/helpers.h"
 #include "common/time/Duration.h"
+#include "graph/context/ResultStream.h"
 #include "graph/session/ClientSession.h"
 #include "graph/session/GraphSessionManager.h"
 #include "interface/gen-cpp2/GraphService.h"
@@ -27,6 +28,8 @@
 namespace nebula {
 namespace graph {
 
+class PreparedStatement;
+
 template <typename Response>
 class RequestContext final : public boost::noncopyable, public cpp::NonMovable {
  public:
@@ -98,6 +101,29 @@ class RequestContext final : public boost::noncopyable, public cpp::NonMovable {
     return parameterMap_;
   }
 
+  // The result is returned by the stream in batches rather than in the response
+  void setStream(std::shared_ptr<ResultStream> stream) {
+    stream_ = std::move(stream);
+  }
+
+  const std::shared_ptr<ResultStream>& stream() const {
+    return stream_;
+  }
+
+  // Executes the prepared statement, or only compiles it if prepareOnly
+  void setPrepared(std::shared_ptr<PreparedStatement> prepared, bool prepareOnly) {
+    prepared_ = std::move(prepared);
+    prepareOnly_ = prepareOnly;
+  }
+
+  const std::shared_ptr<PreparedStatement>& prepared() const {
+    return prepared_;
+  }
+
+  bool prepareOnly() const {
+    return prepareOnly_;
+  }
+
  private:
   time::Duration duration_;
   std::string query_;
@@ -107,6 +133,9 @@ class RequestContext final : public boost::noncopyable, public cpp::NonMovable {
   folly::Executor* runner_{nullptr};
   GraphSessionManager* sessionMgr_{nullptr};
   std::unordered_map<std::string, Value> parameterMap_;
+  std::shared_ptr<ResultStream> stream_;
+  std::shared_ptr<PreparedStatement> prepared_;
+  bool prepareOnly_{false};
 };
 
 }  // namespace graph
@@ -0,0 +1,220 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/base/Base.h"
+#include "graph/planner/plan/Logic.h"
+#include "graph/scheduler/Scheduler.h"
+#include "graph/service/GraphFlags.h"
+#include "graph/service/PreparedStatement.h"
+#include "graph/validator/test/ValidatorTestBase.h"
+
+namespace nebula {
+namespace graph {
+
+class PreparedStatementTest : public ValidatorTestBase {
+ protected:
+  // A compiled query on space 1 of metadata version 10, with the folded parameters
+  static std::unique_ptr<PreparedStatement::Compiled> makeCompiled(
+      const std::unordered_map<std::string, Value>& parameterMap,
+      const std::unordered_set<std::string>& folded = {}) {
+    auto compiled = std::make_unique<PreparedStatement::Compiled>();
+    compiled->space = 1;
+    compiled->metaVersion = 10;
+    for (const auto& param : parameterMap) {
+      compiled->parameterTypes.emplace(param.first, param.second.type());
+      if (folded.count(param.first) != 0) {
+        compiled->foldedParameters.emplace(param);
+      }
+    }
+    return compiled;
+  }
+
+  // Validates the query with the parameters set in the context
+  Status compile(QueryContext* qctx, const std::string& query) {
+    auto result = GQLParser(qctx).parse(query);
+    if (!result.ok()) {
+      return std::move(result).status();
+    }
+    sentences_.emplace_back(std::move(result).value());
+    return Validator::validate(sentences_.back().get(), qctx);
+  }
+};
+
+TEST_F(PreparedStatementTest, Match) {
+  auto compiled = makeCompiled({{"a", 1}, {"b", "x"}}, {"a"});
+  EXPECT_TRUE(PreparedStatement::match(*compiled, {{"a", 1}, {"b", "x"}}));
+  // The parameter not folded into the plan could be bound to any value of its type
+  EXPECT_TRUE(PreparedStatement::match(*compiled, {{"a", 1}, {"b", "y"}}));
+  EXPECT_FALSE(PreparedStatement::match(*compiled, {{"a", 2}, {"b", "x"}}));
+  EXPECT_FALSE(PreparedStatement::match(*compiled, {{"a", 1}, {"b", 2}}));
+  EXPECT_FALSE(PreparedStatement::match(*compiled, {{"a", 1}}));
+  EXPECT_FALSE(PreparedStatement::match(*compiled, {{"a", 1}, {"c", "x"}}));
+  EXPECT_FALSE(PreparedStatement::match(*compiled, {{"a", 1}, {"b", "x"}, {"c", "x"}}));
+
+  // Any value of the same types without folded parameter
+  compiled = makeCompiled({{"a", 1}});
+  EXPECT_TRUE(PreparedStatement::match(*compiled, {{"a", 2}}));
+  EXPECT_FALSE(PreparedStatement::match(*compiled, {{"a", 2.0}}));
+}
+
+TEST_F(PreparedStatementTest, Acquire) {
+  std::unordered_map<std::string, Value> params = {{"a", 1}};
+  PreparedStatement prepared(1, "YIELD $a");
+  EXPECT_EQ(nullptr, prepared.acquire(1, 10, params));
+
+  prepared.release(makeCompiled(params));
+  auto compiled = prepared.acquire(1, 10, params);
+  ASSERT_NE(nullptr, compiled);
+  EXPECT_EQ(1, compiled->numExecutions);
+  // Used by one execution at a time
+  EXPECT_EQ(nullptr, prepared.acquire(1, 10, params));
+  prepared.release(std::move(compiled));
+
+  compiled = prepared.acquire(1, 10, {{"a", 2}});
+  ASSERT_NE(nullptr, compiled);
+  EXPECT_EQ(2, compiled->numExecutions);
+  prepared.release(std::move(compiled));
+
+  // Compiled again for the parameters of other types, which drops the kept one
+  EXPECT_EQ(nullptr, prepared.acquire(1, 10, {{"a", "x"}}));
+  EXPECT_EQ(nullptr, prepared.acquire(1, 10, params));
+
+  // Compiled again after the max reuses
+  auto maxReuses = FLAGS_prepared_statement_max_reuses;
+  FLAGS_prepared_statement_max_reuses = 1;
+  prepared.release(makeCompiled(params));
+  compiled = prepared.acquire(1, 10, params);
+  ASSERT_NE(nullptr, compiled);
+  prepared.release(std::move(compiled));
+  EXPECT_EQ(nullptr, prepared.acquire(1, 10, params));
+  FLAGS_prepared_statement_max_reuses = maxReuses;
+}
+
+TEST_F(PreparedStatementTest, Invalidate) {
+  std::unordered_map<std::string, Value> params = {{"a", 1}};
+  PreparedStatement prepared(1, "YIELD $a");
+  // The schema changed since compiled
+  prepared.release(makeCompiled(params));
+  EXPECT_EQ(nullptr, prepared.acquire(1, 11, params));
+  EXPECT_EQ(nullptr, prepared.acquire(1, 10, params));
+
+  // The session switched to another space
+  prepared.release(makeCompiled(params));
+  EXPECT_EQ(nullptr, prepared.acquire(2, 10, params));
+  EXPECT_EQ(nullptr, prepared.acquire(1, 10, params));
+
+  // The one compiled for the new schema takes the place
+  auto compiled = makeCompiled(params);
+  compiled->metaVersion = 11;
+  prepared.release(std::move(compiled));
+  EXPECT_NE(nullptr, prepared.acquire(1, 11, params));
+}
+
+TEST_F(PreparedStatementTest, FoldedParameters) {
+  auto* qctx = buildContext();
+  auto* ectx = qctx->ectx();
+  ectx->setValue("skip", 1);
+  ectx->setValue("limit", 2);
+  ectx->setValue("age", 3);
+  ectx->trackReads(true);
+  auto status =
+      compile(qctx, "MATCH (v:person) WHERE v.person.age > $age RETURN v SKIP $skip LIMIT $limit");
+  ASSERT_TRUE(status.ok()) << status;
+  // The skip and limit of MATCH are folded into the plan, while the filter is left to the
+  // execution
+  EXPECT_EQ(1, ectx->reads().count("skip"));
+  EXPECT_EQ(1, ectx->reads().count("limit"));
+  EXPECT_EQ(0, ectx->reads().count("age"));
+  ectx->trackReads(false);
+}
+
+TEST_F(PreparedStatementTest, Reuse) {
+  auto* qctx = buildContext();
+  qctx->ectx()->setValue("limit", 1);
+  auto status = compile(qctx, "MATCH (v:person) RETURN v LIMIT $limit");
+  ASSERT_TRUE(status.ok()) << status;
+  auto* plan = qctx->plan();
+  auto* root = plan->root();
+  // A variable initialized while compiling
+  qctx->ectx()->setValue("__compiled", 10);
+  auto* compiledPool = qctx->objPool();
+  qctx->keepCompiled();
+  EXPECT_NE(compiledPool, qctx->objPool());
+  auto first = qctx->releaseExecution();
+  EXPECT_NE(nullptr, first);
+  EXPECT_EQ(nullptr, qctx->arena());
+
+  auto rctx = std::make_unique<RequestContext<ExecutionResponse>>();
+  rctx->setSession(session_);
+  rctx->setParameterMap({{"limit", 2}});
+  qctx->reuse(std::move(rctx));
+  // The plan is kept, with the variables of compiling and the parameters of this execution
+  EXPECT_EQ(plan, qctx->plan());
+  EXPECT_EQ(root, qctx->plan()->root());
+  EXPECT_EQ(Value(2), qctx->ectx()->getValue("limit"));
+  EXPECT_EQ(Value(10), qctx->ectx()->getValue("__compiled"));
+  EXPECT_NE(nullptr, qctx->arena());
+
+  // The values of an execution are not seen by the next one
+  qctx->ectx()->setValue("__executed", 20);
+  EXPECT_NE(nullptr, qctx->releaseExecution());
+  rctx = std::make_unique<RequestContext<ExecutionResponse>>();
+  rctx->setSession(session_);
+  rctx->setParameterMap({{"limit", 3}});
+  qctx->reuse(std::move(rctx));
+  EXPECT_EQ(Value(3), qctx->ectx()->getValue("limit"));
+  EXPECT_FALSE(qctx->ectx()->exist("__executed"));
+}
+
+TEST_F(PreparedStatementTest, ReuseLifetime) {
+  auto* qctx = buildContext();
+  auto status = compile(qctx, "GO 2 STEPS FROM \"1\" OVER like YIELD $^ as src");
+  ASSERT_TRUE(status.ok()) << status;
+  // The variables read by the plan, including the ones in the body of loop
+  std::vector<const Variable*> vars;
+  std::function<void(const PlanNode*)> collect = [&](const PlanNode* node) {
+    for (const auto* var : node->inputVars()) {
+      if (var != nullptr) {
+        vars.emplace_back(var);
+      }
+    }
+    if (node->kind() == PlanNode::Kind::kLoop) {
+      collect(static_cast<const Loop*>(node)->body());
+    }
+    for (const auto* dep : node->dependencies()) {
+      collect(dep);
+    }
+  };
+  collect(qctx->plan()->root());
+  ASSERT_FALSE(vars.empty());
+
+  // The first execution is killed, which leaves the counts of variables
+  Scheduler::analyzeLifetime(qctx->plan()->root());
+  std::vector<uint64_t> counts;
+  for (const auto* var : vars) {
+    counts.emplace_back(var->userCount.load());
+  }
+  qctx->keepCompiled();
+
+  for (int i = 0; i < 2; ++i) {
+    qctx->releaseExecution();
+    auto rctx = std::make_unique<RequestContext<ExecutionResponse>>();
+    rctx->setSession(session_);
+    qctx->reuse(std::move(rctx));
+    for (const auto* var : vars) {
+      EXPECT_EQ(0, var->userCount.load()) << var->name;
+    }
+    // Counted as the first execution
+    Scheduler::analyzeLifetime(qctx->plan()->root());
+    for (size_t j = 0; j < vars.size(); ++j) {
+      EXPECT_EQ(counts[j], vars[j]->userCount.load()) << vars[j]->name;
+    }
+  }
+}
+
+}  // namespace graph
+}  // namespace nebula
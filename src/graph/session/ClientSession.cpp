@@ -7,6 +7,8 @@
 #include "common/stats/StatsManager.h"
 #include "common/time/WallClock.h"
 #include "graph/context/QueryContext.h"
+#include "graph/service/PreparedStatement.h"
+#include "graph/service/GraphFlags.h"
 #include "graph/stats/GraphStats.h"
 
 namespace nebula {
@@ -15,6 +17,9 @@ namespace graph {
 ClientSession::ClientSession(meta::cpp2::Session&& session, meta::MetaClient* metaClient) {
   session_ = std::move(session);
   metaClient_ = metaClient;
+  memTracker_ = std::make_shared<MemoryTracker>(
+      folly::sformat("session {}", session_.get_session_id()),
+      FLAGS_session_memory_quota_mb * 1024 * 1024);
 }
 
 std::shared_ptr<ClientSession> ClientSession::create(meta::cpp2::Session&& session,
@@ -28,6 +33,18 @@ void ClientSession::charge() {
   session_.update_time_ref() = time::WallClock::fastNowInMicroSec();
 }
 
+meta::cpp2::Session ClientSession::getSession() const {
+  folly::RWSpinLock::ReadHolder rHolder(rwSpinLock_);
+  auto session = session_;
+  for (auto& query : *session.queries_ref()) {
+    auto context = contexts_.find(query.first);
+    if (context != contexts_.end()) {
+      query.second.peak_memory_bytes_ref() = context->second->memoryTracker()->peak();
+    }
+  }
+  return session;
+}
+
 uint64_t ClientSession::idleSeconds() {
   folly::RWSpinLock::ReadHolder rHolder(rwSpinLock_);
   return idleDuration_.elapsedInSec();
@@ -72,10 +89,15 @@ bool ClientSession::findQuery(nebula::ExecutionPlanID epId) const {
 void ClientSession::markQueryKilled(nebula::ExecutionPlanID epId) {
   folly::RWSpinLock::WriteHolder wHolder(rwSpinLock_);
   auto context = contexts_.find(epId);
-  if (context == contexts_.end()) {
-    return;
+  if (context != contexts_.end()) {
+    context->second->markKilled();
+  } else {
+    auto stream = streams_.find(epId);
+    if (stream == streams_.end()) {
+      return;
+    }
+    stream->second->markKilled();
   }
-  context->second->markKilled();
   stats::StatsManager::addValue(kNumKilledQueries);
   if (FLAGS_enable_space_level_metrics && space_.name != "") {
     stats::StatsManager::addValue(
@@ -97,12 +119,116 @@ void ClientSession::markAllQueryKilled() {
     context.second->markKilled();
     session_.queries_ref()->clear();
   }
-  stats::StatsManager::addValue(kNumKilledQueries, contexts_.size());
+  for (auto& stream : streams_) {
+    stream.second->markKilled();
+    session_.queries_ref()->erase(stream.first);
+  }
+  auto numKilled = contexts_.size() + streams_.size();
+  streams_.clear();
+  stats::StatsManager::addValue(kNumKilledQueries, numKilled);
   if (FLAGS_enable_space_level_metrics && space_.name != "") {
     stats::StatsManager::addValue(
         stats::StatsManager::counterWithLabels(kNumKilledQueries, {{"space", space_.name}}),
-        contexts_.size());
+        numKilled);
+  }
+}
+
+int64_t ClientSession::findHeaviestQuery(nebula::ExecutionPlanID* epId) const {
+  folly::RWSpinLock::ReadHolder rHolder(rwSpinLock_);
+  int64_t heaviest = 0;
+  for (auto& context : contexts_) {
+    auto used = context.second->memoryTracker()->used();
+    if (!context.second->isKilled() && used > heaviest) {
+      heaviest = used;
+      *epId = context.first;
+    }
+  }
+  return heaviest;
+}
+
+bool ClientSession::markQueryMemoryKilled(nebula::ExecutionPlanID epId) {
+  folly::RWSpinLock::WriteHolder wHolder(rwSpinLock_);
+  auto context = contexts_.find(epId);
+  if (context == contexts_.end()) {
+    return false;
+  }
+  auto* qctx = context->second;
+  LOG(WARNING) << "Kill the query using the most memory(" << qctx->memoryTracker()->used()
+               << " bytes): " << (qctx->rctx() ? qctx->rctx()->query() : "");
+  qctx->markMemoryKilled();
+  stats::StatsManager::addValue(kNumKilledQueries);
+  auto query = session_.queries_ref()->find(epId);
+  if (query != session_.queries_ref()->end()) {
+    query->second.status_ref() = meta::cpp2::QueryStatus::KILLING;
+  }
+  return true;
+}
+
+void ClientSession::addStream(std::shared_ptr<ResultStream> stream) {
+  auto epId = stream->id();
+  meta::cpp2::QueryDesc queryDesc;
+  queryDesc.start_time_ref() = time::WallClock::fastNowInMicroSec();
+  queryDesc.status_ref() = meta::cpp2::QueryStatus::RUNNING;
+  queryDesc.query_ref() = stream->query();
+  queryDesc.graph_addr_ref() = session_.get_graph_addr();
+  VLOG(1) << "Add stream: " << stream->query() << ", epId: " << epId;
+
+  folly::RWSpinLock::WriteHolder wHolder(rwSpinLock_);
+  streams_.emplace(epId, std::move(stream));
+  session_.queries_ref()->emplace(epId, std::move(queryDesc));
+}
+
+void ClientSession::deleteStream(nebula::ExecutionPlanID epId) {
+  VLOG(1) << "Delete stream, epId: " << epId;
+  std::shared_ptr<ResultStream> stream;
+  {
+    folly::RWSpinLock::WriteHolder wHolder(rwSpinLock_);
+    auto iter = streams_.find(epId);
+    if (iter == streams_.end()) {
+      return;
+    }
+    stream = std::move(iter->second);
+    streams_.erase(iter);
+    session_.queries_ref()->erase(epId);
+  }
+  // The rest rows are released out of the lock
+}
+
+bool ClientSession::addPrepared(std::shared_ptr<PreparedStatement> prepared) {
+  auto id = prepared->id();
+  folly::RWSpinLock::WriteHolder wHolder(rwSpinLock_);
+  if (prepared_.size() >= FLAGS_max_prepared_statements_per_session) {
+    return false;
+  }
+  prepared_.emplace(id, std::move(prepared));
+  return true;
+}
+
+void ClientSession::deletePrepared(int64_t id) {
+  VLOG(1) << "Delete prepared statement: " << id;
+  std::shared_ptr<PreparedStatement> prepared;
+  {
+    folly::RWSpinLock::WriteHolder wHolder(rwSpinLock_);
+    auto iter = prepared_.find(id);
+    if (iter == prepared_.end()) {
+      return;
+    }
+    prepared = std::move(iter->second);
+    prepared_.erase(iter);
   }
+  // The compiled query is released out of the lock
+}
+
+std::shared_ptr<PreparedStatement> ClientSession::findPrepared(int64_t id) const {
+  folly::RWSpinLock::ReadHolder rHolder(rwSpinLock_);
+  auto prepared = prepared_.find(id);
+  return prepared == prepared_.end() ? nullptr : prepared->second;
+}
+
+std::shared_ptr<ResultStream> ClientSession::findStream(nebula::ExecutionPlanID epId) const {
+  folly::RWSpinLock::ReadHolder rHolder(rwSpinLock_);
+  auto stream = streams_.find(epId);
+  return stream == streams_.end() ? nullptr : stream->second;
 }
 }  // namespace graph
 }  // namespace nebula
@@ -6,13 +6,16 @@
 #define GRAPH_SESSION_CLIENTSESSION_H_
 
 #include "clients/meta/MetaClient.h"
+#include "common/memory/MemoryTracker.h"
 #include "common/time/Duration.h"
+#include "graph/context/ResultStream.h"
 #include "interface/gen-cpp2/meta_types.h"
 
 namespace nebula {
 namespace graph {
 
 class QueryContext;
+class PreparedStatement;
 
 constexpr int64_t kInvalidSpaceID = -1;
 constexpr int64_t kInvalidSessionID = 0;
@@ -131,9 +134,12 @@ class ClientSession final {
     }
   }
 
-  meta::cpp2::Session getSession() const {
-    folly::RWSpinLock::ReadHolder rHolder(rwSpinLock_);
-    return session_;
+  // The session with the peak memory of its queries
+  meta::cpp2::Session getSession() const;
+
+  // Tracks the memory of all queries of the session
+  const std::shared_ptr<MemoryTracker>& memoryTracker() const {
+    return memTracker_;
   }
 
   void updateSpaceName(const std::string& spaceName) {
@@ -160,6 +166,46 @@ class ClientSession final {
   // Marks all queries as killed.
   void markAllQueryKilled();
 
+  // Finds the running query using the most memory, which is not killed yet.
+  // epId: represents the query found.
+  // return: The memory used by the query, 0 if not found.
+  int64_t findHeaviestQuery(nebula::ExecutionPlanID* epId) const;
+
+  // Marks a query as killed since it uses the most memory.
+  // epId: represents a query.
+  // return: Whether the query is still running.
+  bool markQueryMemoryKilled(nebula::ExecutionPlanID epId);
+
+  // Binds the result stream of a finished query to the session until it's drained or closed.
+  // The stream is listed and killed as a query.
+  void addStream(std::shared_ptr<ResultStream> stream);
+
+  // Deletes a stream from the session, its rest rows are released.
+  void deleteStream(nebula::ExecutionPlanID epId);
+
+  // Finds a stream within the session, nullptr if not found.
+  std::shared_ptr<ResultStream> findStream(nebula::ExecutionPlanID epId) const;
+
+  size_t numStreams() const {
+    folly::RWSpinLock::ReadHolder rHolder(rwSpinLock_);
+    return streams_.size();
+  }
+
+  // Binds a prepared statement to the session until it's closed, which reserves its slot before
+  // it's compiled. Returns false if the session has max_prepared_statements_per_session already.
+  bool addPrepared(std::shared_ptr<PreparedStatement> prepared);
+
+  // Deletes a prepared statement from the session.
+  void deletePrepared(int64_t id);
+
+  // Finds a prepared statement within the session, nullptr if not found.
+  std::shared_ptr<PreparedStatement> findPrepared(int64_t id) const;
+
+  size_t numPrepared() const {
+    folly::RWSpinLock::ReadHolder rHolder(rwSpinLock_);
+    return prepared_.size();
+  }
+
  private:
   ClientSession() = default;
 
@@ -181,6 +227,11 @@ class ClientSession final {
   // An ExecutionPlanID represents a query.
   // A QueryContext also represents a query.
   std::unordered_map<ExecutionPlanID, QueryContext*> contexts_;
+  // The results of finished queries fetched in batches
+  std::unordered_map<ExecutionPlanID, std::shared_ptr<ResultStream>> streams_;
+  // The statements prepared by the client
+  std::unordered_map<int64_t, std::shared_ptr<PreparedStatement>> prepared_;
+  std::shared_ptr<MemoryTracker> memTracker_;
 };
 
 }  // namespace graph
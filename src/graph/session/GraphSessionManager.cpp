@@ -111,6 +111,23 @@ std::vector<meta::cpp2::Session> GraphSessionManager::getSessionFromLocalCache()
   return sessions;
 }
 
+bool GraphSessionManager::killHeaviestQuery() {
+  std::shared_ptr<ClientSession> heaviestSession;
+  ExecutionPlanID heaviestQuery = 0;
+  int64_t heaviest = 0;
+  for (auto& it : activeSessions_) {
+    ExecutionPlanID epId = 0;
+    auto used = it.second->findHeaviestQuery(&epId);
+    if (used > heaviest) {
+      heaviest = used;
+      heaviestSession = it.second;
+      heaviestQuery = epId;
+    }
+  }
+  // The query may have finished since found
+  return heaviestSession != nullptr && heaviestSession->markQueryMemoryKilled(heaviestQuery);
+}
+
 folly::Future<StatusOr<std::shared_ptr<ClientSession>>> GraphSessionManager::createSession(
     const std::string userName, const std::string clientIp, folly::Executor* runner) {
   // check the number of sessions per user per ip
@@ -79,6 +79,10 @@ class GraphSessionManager final : public SessionManager<ClientSession> {
   // return: All sessions of the local cache.
   std::vector<meta::cpp2::Session> getSessionFromLocalCache() const;
 
+  // Kills the running query using the most memory among all local sessions.
+  // return: Whether any query is killed.
+  bool killHeaviestQuery();
+
  private:
   // Finds an existing session only from the meta server.
   // id: The id of the session which will be found.
@@ -34,6 +34,10 @@ stats::CounterId kNumAggregateExecutors;
 stats::CounterId kNumSortExecutors;
 stats::CounterId kNumIndexScanExecutors;
 
+stats::CounterId kNumGCPendingResults;
+stats::CounterId kGCPendingBytes;
+stats::CounterId kNumGCInlineReleases;
+
 stats::CounterId kNumOpenedSessions;
 stats::CounterId kNumAuthFailedSessions;
 stats::CounterId kNumAuthFailedSessionsBadUserNamePassword;
@@ -66,6 +70,10 @@ void initGraphStats() {
   kNumIndexScanExecutors =
       stats::StatsManager::registerStats("num_indexscan_executors", "rate, sum");
 
+  kNumGCPendingResults = stats::StatsManager::registerStats("num_gc_pending_results", "sum");
+  kGCPendingBytes = stats::StatsManager::registerStats("gc_pending_bytes", "sum");
+  kNumGCInlineReleases = stats::StatsManager::registerStats("num_gc_inline_releases", "rate, sum");
+
   kNumOpenedSessions = stats::StatsManager::registerStats("num_opened_sessions", "rate, sum");
   kNumAuthFailedSessions =
       stats::StatsManager::registerStats("num_auth_failed_sessions", "rate, sum");
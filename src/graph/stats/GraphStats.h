@@ -39,6 +39,11 @@ extern stats::CounterId kNumIndexScanExecutors;
 // extern stats::CounterId kReceivedBytes;
 // extern stats::CounterId kSentBytes;
 
+// GC
+extern stats::CounterId kNumGCPendingResults;
+extern stats::CounterId kGCPendingBytes;
+extern stats::CounterId kNumGCInlineReleases;
+
 // Session
 extern stats::CounterId kNumOpenedSessions;
 extern stats::CounterId kNumAuthFailedSessions;
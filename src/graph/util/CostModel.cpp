@@ -0,0 +1,222 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "graph/util/CostModel.h"
+
+#include "clients/meta/MetaClient.h"
+#include "common/algorithm/HyperLogLog.h"
+#include "common/expression/ConstantExpression.h"
+#include "common/expression/LogicalExpression.h"
+#include "common/expression/PropertyExpression.h"
+#include "common/expression/RelationalExpression.h"
+#include "graph/context/QueryContext.h"
+#include "graph/util/IndexUtil.h"
+
+using nebula::meta::cpp2::HistogramBucket;
+using nebula::meta::cpp2::IndexStats;
+using nebula::storage::cpp2::IndexColumnHint;
+using nebula::storage::cpp2::ScanType;
+
+namespace nebula {
+namespace graph {
+namespace {
+
+double toDouble(const Value& v) {
+  return v.isInt() ? static_cast<double>(v.getInt()) : v.getFloat();
+}
+
+// The fraction of bucket (lower, upper] in [begin, end] when they are partially overlapped, the
+// values are assumed to be uniformly distributed in a numeric bucket
+double bucketOverlap(const Value& lower, const Value& upper, const Value& begin, const Value& end) {
+  if (!lower.isNumeric() || !upper.isNumeric() || (!begin.empty() && !begin.isNumeric()) ||
+      (!end.empty() && !end.isNumeric())) {
+    return 0.5;
+  }
+  auto l = toDouble(lower), u = toDouble(upper);
+  if (u <= l) {
+    return 1.0;
+  }
+  auto b = begin.empty() ? l : std::max(l, toDouble(begin));
+  auto e = end.empty() ? u : std::min(u, toDouble(end));
+  return std::clamp((e - b) / (u - l), 0.0, 1.0);
+}
+
+// The fraction of values in [begin, end] by histogram, an empty bound means unbounded
+double rangeFraction(const std::vector<HistogramBucket>& histogram,
+                     const Value& begin,
+                     const Value& end) {
+  int64_t total = 0;
+  double selected = 0;
+  for (size_t i = 0; i < histogram.size(); i++) {
+    const auto& upper = histogram[i].get_upper();
+    const auto& lower = i == 0 ? upper : histogram[i - 1].get_upper();
+    auto count = histogram[i].get_count();
+    total += count;
+    if ((!end.empty() && end < lower) || (!begin.empty() && upper < begin)) {
+      continue;
+    }
+    if ((begin.empty() || !(lower < begin)) && (end.empty() || !(end < upper))) {
+      selected += count;
+      continue;
+    }
+    selected += count * bucketOverlap(lower, upper, begin, end);
+  }
+  return total == 0 ? 0 : selected / total;
+}
+
+// The number of keys whose first column satisfies hint
+double columnRows(const IndexStats& stats, const IndexColumnHint& hint) {
+  double notNull = stats.get_num_keys() - stats.get_num_nulls();
+  if (notNull <= 0) {
+    return 0;
+  }
+  if (hint.get_scan_type() == ScanType::PREFIX) {
+    auto ndv = algorithm::HyperLogLog::deserialize(stats.get_ndv_sketch()).estimate();
+    return notNull / std::max(1.0, ndv);
+  }
+  if (stats.get_histogram().empty()) {
+    return notNull * CostModel::kDefaultRangeSelectivity;
+  }
+  auto begin = hint.begin_value_ref().is_set() ? hint.get_begin_value() : Value();
+  auto end = hint.end_value_ref().is_set() ? hint.get_end_value() : Value();
+  return notNull * rangeFraction(stats.get_histogram(), begin, end);
+}
+
+// Convert the comparison of a property and a constant to the column hint on the property
+std::optional<IndexColumnHint> toColumnHint(const Expression* expr) {
+  if (!expr->isRelExpr()) {
+    return std::nullopt;
+  }
+  auto* rel = static_cast<const RelationalExpression*>(expr);
+  auto kind = rel->kind();
+  const Expression* prop = rel->left();
+  const Expression* constant = rel->right();
+  if (prop->kind() == Expression::Kind::kConstant) {
+    std::swap(prop, constant);
+    kind = IndexUtil::reverseRelationalExprKind(kind);
+  }
+  if ((prop->kind() != Expression::Kind::kTagProperty &&
+       prop->kind() != Expression::Kind::kEdgeProperty) ||
+      constant->kind() != Expression::Kind::kConstant) {
+    return std::nullopt;
+  }
+  IndexColumnHint hint;
+  hint.column_name_ref() = static_cast<const PropertyExpression*>(prop)->prop();
+  const auto& value = static_cast<const ConstantExpression*>(constant)->value();
+  switch (kind) {
+    case Expression::Kind::kRelEQ:
+      hint.scan_type_ref() = ScanType::PREFIX;
+      hint.begin_value_ref() = value;
+      break;
+    case Expression::Kind::kRelGT:
+    case Expression::Kind::kRelGE:
+      hint.scan_type_ref() = ScanType::RANGE;
+      hint.begin_value_ref() = value;
+      break;
+    case Expression::Kind::kRelLT:
+    case Expression::Kind::kRelLE:
+      hint.scan_type_ref() = ScanType::RANGE;
+      hint.end_value_ref() = value;
+      break;
+    default:
+      return std::nullopt;
+  }
+  return hint;
+}
+
+}  // namespace
+
+CostModel::CostModel(QueryContext* qctx, GraphSpaceID spaceId) {
+  auto* metaClient = qctx->getMetaClient();
+  if (metaClient != nullptr) {
+    stats_ = metaClient->getStatsFromCache(spaceId);
+  }
+}
+
+std::optional<double> CostModel::tagRows(const std::string& tagName) const {
+  if (stats_ == nullptr) {
+    return std::nullopt;
+  }
+  auto iter = stats_->get_tag_vertices().find(tagName);
+  if (iter == stats_->get_tag_vertices().end()) {
+    return std::nullopt;
+  }
+  return iter->second;
+}
+
+std::optional<double> CostModel::edgeRows(const std::string& edgeName) const {
+  if (stats_ == nullptr) {
+    return std::nullopt;
+  }
+  auto iter = stats_->get_edges().find(edgeName);
+  if (iter == stats_->get_edges().end()) {
+    return std::nullopt;
+  }
+  return iter->second;
+}
+
+std::optional<double> CostModel::indexScanRows(
+    IndexID indexId, const std::vector<storage::cpp2::IndexColumnHint>& hints) const {
+  auto* stats = indexStats(indexId);
+  if (stats == nullptr) {
+    return std::nullopt;
+  }
+  if (hints.empty()) {
+    return stats->get_num_keys();
+  }
+  auto rows = columnRows(*stats, hints.front());
+  for (size_t i = 1; i < hints.size(); i++) {
+    rows *= hints[i].get_scan_type() == ScanType::PREFIX ? kDefaultEqualSelectivity
+                                                         : kDefaultRangeSelectivity;
+  }
+  return rows;
+}
+
+double CostModel::filterRows(const Expression* filter,
+                             const std::vector<std::shared_ptr<meta::cpp2::IndexItem>>& indexes,
+                             double rows) const {
+  std::vector<const Expression*> operands;
+  if (filter->kind() == Expression::Kind::kLogicalAnd) {
+    for (auto* operand : static_cast<const LogicalExpression*>(filter)->operands()) {
+      operands.emplace_back(operand);
+    }
+  } else {
+    operands.emplace_back(filter);
+  }
+
+  double selectivity = 1.0;
+  for (auto* operand : operands) {
+    auto hint = toColumnHint(operand);
+    if (!hint.has_value()) {
+      continue;
+    }
+    auto sel = hint->get_scan_type() == ScanType::PREFIX ? kDefaultEqualSelectivity
+                                                         : kDefaultRangeSelectivity;
+    for (auto& index : indexes) {
+      const auto& fields = index->get_fields();
+      if (fields.empty() || fields[0].get_name() != hint->get_column_name()) {
+        continue;
+      }
+      auto* stats = indexStats(index->get_index_id());
+      if (stats != nullptr && stats->get_num_keys() > 0) {
+        sel = columnRows(*stats, *hint) / stats->get_num_keys();
+        break;
+      }
+    }
+    selectivity = std::min(selectivity, sel);
+  }
+  return rows * selectivity;
+}
+
+const meta::cpp2::IndexStats* CostModel::indexStats(IndexID indexId) const {
+  if (stats_ == nullptr || !stats_->index_stats_ref().has_value()) {
+    return nullptr;
+  }
+  auto iter = stats_->index_stats_ref()->find(indexId);
+  return iter == stats_->index_stats_ref()->end() ? nullptr : &iter->second;
+}
+
+}  // namespace graph
+}  // namespace nebula
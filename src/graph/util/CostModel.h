@@ -0,0 +1,84 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef GRAPH_UTIL_COSTMODEL_H_
+#define GRAPH_UTIL_COSTMODEL_H_
+
+#include <optional>
+
+#include "common/base/Base.h"
+#include "interface/gen-cpp2/meta_types.h"
+#include "interface/gen-cpp2/storage_types.h"
+
+namespace nebula {
+
+class Expression;
+
+namespace graph {
+
+class QueryContext;
+
+/**
+ * @brief Estimate the number of rows of scans by the statistics collected by the stats job of
+ * space. The estimations are none when there are no statistics, then the callers fall back to
+ * their heuristic rules.
+ */
+class CostModel final {
+ public:
+  // The selectivity of a condition on an index column without statistics
+  static constexpr double kDefaultEqualSelectivity = 0.1;
+  static constexpr double kDefaultRangeSelectivity = 1.0 / 3;
+
+  CostModel(QueryContext* qctx, GraphSpaceID spaceId);
+
+  explicit CostModel(std::shared_ptr<const meta::cpp2::StatsItem> stats)
+      : stats_(std::move(stats)) {}
+
+  bool hasStats() const {
+    return stats_ != nullptr;
+  }
+
+  /**
+   * @brief The number of vertices of tag
+   */
+  std::optional<double> tagRows(const std::string& tagName) const;
+
+  /**
+   * @brief The number of edges of edge type
+   */
+  std::optional<double> edgeRows(const std::string& edgeName) const;
+
+  /**
+   * @brief The number of keys read by an index scan with column hints. The statistics only cover
+   * the first column of index, the default selectivity is used for the hints of other columns.
+   *
+   * @param indexId
+   * @param hints Column hints in the order of index fields
+   * @return std::optional<double> None if there are no statistics of index
+   */
+  std::optional<double> indexScanRows(
+      IndexID indexId, const std::vector<storage::cpp2::IndexColumnHint>& hints) const;
+
+  /**
+   * @brief The number of rows of schema which satisfy the filter, the most selective condition
+   * with index statistics is used.
+   *
+   * @param filter Relational expressions of properties and constants, or the AND of them
+   * @param indexes Indexes of the schema
+   * @param rows The number of rows of schema
+   */
+  double filterRows(const Expression* filter,
+                    const std::vector<std::shared_ptr<meta::cpp2::IndexItem>>& indexes,
+                    double rows) const;
+
+ private:
+  const meta::cpp2::IndexStats* indexStats(IndexID indexId) const;
+
+  std::shared_ptr<const meta::cpp2::StatsItem> stats_;
+};
+
+}  // namespace graph
+}  // namespace nebula
+#endif  // GRAPH_UTIL_COSTMODEL_H_
@@ -74,6 +74,16 @@ StatusOr<DataSet> IndexUtil::toShowCreateIndex(bool isTagIndex,
   }
   createStr += ")";
 
+  if (indexItem.include_fields_ref().has_value() && !indexItem.include_fields_ref()->empty()) {
+    std::vector<std::string> includeFields;
+    for (auto &col : *indexItem.include_fields_ref()) {
+      includeFields.emplace_back("`" + col.get_name() + "`");
+    }
+    createStr += " INCLUDE (";
+    createStr += folly::join(", ", includeFields);
+    createStr += ")";
+  }
+
   const auto *indexParams = indexItem.get_index_params();
   std::vector<std::string> params;
   if (indexParams) {
@@ -0,0 +1,137 @@
+// Copyright (c) 2022 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <gtest/gtest.h>
+
+#include "common/algorithm/HyperLogLog.h"
+#include "common/base/ObjectPool.h"
+#include "common/expression/ConstantExpression.h"
+#include "common/expression/LogicalExpression.h"
+#include "common/expression/PropertyExpression.h"
+#include "common/expression/RelationalExpression.h"
+#include "graph/util/CostModel.h"
+
+namespace nebula {
+namespace graph {
+
+class CostModelTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Index 1 on player(age) with 1000 keys, 10 nulls, ages in [0, 99] uniformly
+    meta::cpp2::IndexStats stats;
+    stats.num_keys_ref() = 1000;
+    stats.num_nulls_ref() = 10;
+    algorithm::HyperLogLog hll;
+    for (int64_t i = 0; i < 100; i++) {
+      hll.add(std::hash<int64_t>()(i));
+    }
+    stats.ndv_sketch_ref() = hll.serialize();
+    std::vector<meta::cpp2::HistogramBucket> histogram;
+    for (int64_t upper = 9; upper < 100; upper += 10) {
+      meta::cpp2::HistogramBucket bucket;
+      bucket.upper_ref() = Value(upper);
+      bucket.count_ref() = 99;
+      histogram.emplace_back(std::move(bucket));
+    }
+    stats.histogram_ref() = std::move(histogram);
+
+    auto item = std::make_shared<meta::cpp2::StatsItem>();
+    item->tag_vertices_ref() = {{"player", 1000}};
+    item->edges_ref() = {{"like", 5000}};
+    item->index_stats_ref() = {{1, std::move(stats)}};
+    costModel_ = std::make_unique<CostModel>(std::move(item));
+
+    auto index = std::make_shared<meta::cpp2::IndexItem>();
+    index->index_id_ref() = 1;
+    meta::cpp2::ColumnDef col;
+    col.name_ref() = "age";
+    index->fields_ref() = {col};
+    indexes_.emplace_back(std::move(index));
+  }
+
+  storage::cpp2::IndexColumnHint hint(storage::cpp2::ScanType type, Value begin, Value end) {
+    storage::cpp2::IndexColumnHint h;
+    h.column_name_ref() = "age";
+    h.scan_type_ref() = type;
+    if (!begin.empty()) {
+      h.begin_value_ref() = std::move(begin);
+    }
+    if (!end.empty()) {
+      h.end_value_ref() = std::move(end);
+    }
+    return h;
+  }
+
+  Expression* ageCmp(Expression::Kind kind, int64_t v) {
+    auto* prop = TagPropertyExpression::make(&pool_, "player", "age");
+    auto* constant = ConstantExpression::make(&pool_, v);
+    return RelationalExpression::makeKind(&pool_, kind, prop, constant);
+  }
+
+  ObjectPool pool_;
+  std::unique_ptr<CostModel> costModel_;
+  std::vector<std::shared_ptr<meta::cpp2::IndexItem>> indexes_;
+};
+
+TEST_F(CostModelTest, SchemaRows) {
+  EXPECT_TRUE(costModel_->hasStats());
+  EXPECT_EQ(1000, costModel_->tagRows("player").value());
+  EXPECT_EQ(5000, costModel_->edgeRows("like").value());
+  EXPECT_FALSE(costModel_->tagRows("team").has_value());
+  EXPECT_FALSE(costModel_->edgeRows("serve").has_value());
+
+  CostModel empty(nullptr);
+  EXPECT_FALSE(empty.hasStats());
+  EXPECT_FALSE(empty.tagRows("player").has_value());
+}
+
+TEST_F(CostModelTest, IndexScanRows) {
+  using storage::cpp2::ScanType;
+  EXPECT_FALSE(costModel_->indexScanRows(2, {}).has_value());
+  EXPECT_EQ(1000, costModel_->indexScanRows(1, {}).value());
+
+  // 990 non-null keys with about 100 distinct values
+  auto eq = costModel_->indexScanRows(1, {hint(ScanType::PREFIX, 10, Value())}).value();
+  EXPECT_NEAR(9.9, eq, 1.0);
+
+  // The whole histogram
+  auto all = costModel_->indexScanRows(1, {hint(ScanType::RANGE, Value(), Value())}).value();
+  EXPECT_NEAR(990, all, 1e-6);
+
+  // Half of the histogram
+  auto half = costModel_->indexScanRows(1, {hint(ScanType::RANGE, 49, Value())}).value();
+  EXPECT_NEAR(495, half, 50);
+
+  // Out of the histogram
+  auto none = costModel_->indexScanRows(1, {hint(ScanType::RANGE, 200, Value())}).value();
+  EXPECT_EQ(0, none);
+
+  // The default selectivity of the second column
+  auto second = costModel_->indexScanRows(
+      1, {hint(ScanType::PREFIX, 10, Value()), hint(ScanType::PREFIX, 1, Value())});
+  EXPECT_NEAR(eq * CostModel::kDefaultEqualSelectivity, second.value(), 1e-6);
+}
+
+TEST_F(CostModelTest, FilterRows) {
+  // The statistics of index are used
+  auto* eq = ageCmp(Expression::Kind::kRelEQ, 10);
+  EXPECT_NEAR(99, costModel_->filterRows(eq, indexes_, 10000), 10);
+
+  // Constant on the left side
+  auto* age = TagPropertyExpression::make(&pool_, "player", "age");
+  auto* reversed = RelationalExpression::makeLT(&pool_, ConstantExpression::make(&pool_, 200), age);
+  EXPECT_EQ(0, costModel_->filterRows(reversed, indexes_, 10000));
+
+  // The most selective condition is used
+  auto* range = ageCmp(Expression::Kind::kRelGE, 0);
+  auto* both = LogicalExpression::makeAnd(&pool_, range, eq);
+  EXPECT_NEAR(99, costModel_->filterRows(both, indexes_, 10000), 10);
+
+  // The default selectivity without index
+  EXPECT_NEAR(
+      1000 * CostModel::kDefaultEqualSelectivity, costModel_->filterRows(eq, {}, 1000), 1e-6);
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -625,6 +625,7 @@ Status ShowQueriesValidator::validateImpl() {
   outputs_.emplace_back("DurationInUSec", Value::Type::INT);
   outputs_.emplace_back("Status", Value::Type::STRING);
   outputs_.emplace_back("Query", Value::Type::STRING);
+  outputs_.emplace_back("PeakMemoryInBytes", Value::Type::INT);
   return Status::OK();
 }
 
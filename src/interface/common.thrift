@@ -476,6 +476,7 @@ enum ErrorCode {
 
     E_CLIENT_SERVER_INCOMPATIBLE      = -3061,  // Client and server versions are not compatible
     E_ID_FAILED                       = -3062,  // Failed to get ID serial number
+    E_MEMORY_QUOTA_EXCEEDED           = -3063,  // The request used more memory than its quota
 
     // 35xx for storaged raft
     E_RAFT_UNKNOWN_PART               = -3500,  // Unknown partition
@@ -109,6 +109,29 @@ struct VerifyClientVersionReq {
 }
 
 
+// A batch of the result of executeStream(), the following batches are pulled by fetchStream().
+// The whole result is still built by the graph, the batches bound the size of each response.
+struct ExecutionStreamResp {
+    1: required common.ErrorCode        error_code;
+    2: optional binary                  error_msg;
+    // The plan id of the query, which is listed by SHOW QUERIES and killed by KILL QUERY
+    3: optional i64                     stream_id;
+    4: optional common.DataSet          data;
+    // Whether there are more batches to fetch
+    5: bool                             has_more = false;
+    6: optional i64                     latency_in_us;
+    7: optional binary                  space_name;
+}
+
+
+struct PrepareResp {
+    1: required common.ErrorCode error_code;
+    2: optional binary           error_msg;
+    // The handle of the statement in the session
+    3: optional i64              statement_id;
+}
+
+
 service GraphService {
     AuthResponse authenticate(1: binary username, 2: binary password)
 
@@ -121,4 +144,19 @@ service GraphService {
     binary executeJsonWithParameter(1: i64 sessionId, 2: binary stmt, 3: map<binary, common.Value>(cpp.template = "std::unordered_map") parameterMap)
     
     VerifyClientVersionResp verifyClientVersion(1: VerifyClientVersionReq req)
+
+    // Same as executeWithParameter(), but the result is returned in batches of at most batchSize
+    // rows, the first batch with the response and the rest pulled by fetchStream() one by one
+    ExecutionStreamResp executeStream(1: i64 sessionId, 2: binary stmt, 3: map<binary, common.Value>(cpp.template = "std::unordered_map") parameterMap, 4: i32 batchSize)
+    ExecutionStreamResp fetchStream(1: i64 sessionId, 2: i64 streamId)
+    // Release the stream before all batches are fetched
+    oneway void closeStream(1: i64 sessionId, 2: i64 streamId)
+
+    // Parse, validate and optimize the statement once, and return the handle executed by
+    // executePrepared() with the parameters of each execution. The parameterMap binds the
+    // parameters for validation, and the executions are expected to bind the same names and types.
+    // The handle lives until it's closed or the session is released.
+    PrepareResp prepare(1: i64 sessionId, 2: binary stmt, 3: map<binary, common.Value>(cpp.template = "std::unordered_map") parameterMap)
+    ExecutionResponse executePrepared(1: i64 sessionId, 2: i64 statementId, 3: map<binary, common.Value>(cpp.template = "std::unordered_map") parameterMap)
+    oneway void closePrepared(1: i64 sessionId, 2: i64 statementId)
 }
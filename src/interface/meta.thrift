@@ -154,6 +154,9 @@ struct IndexItem {
     5: list<ColumnDef>      fields,
     6: optional binary      comment,
     7: optional IndexParams index_params,
+    // The columns stored in index value besides the indexed ones, which are returned without
+    // reading the vertex or edge
+    8: optional list<ColumnDef> include_fields,
 }
 
 enum HostStatus {
@@ -308,6 +311,33 @@ struct Correlativity {
     2: double             proportion,
 }
 
+// A bucket of an equi-depth histogram
+struct HistogramBucket {
+    // The largest value in the bucket
+    1: common.Value upper,
+    2: i64          count,
+}
+
+// Statistics of the first column of an index, used by the cost model of graphd
+struct IndexStats {
+    // The number of index keys
+    1: i64                      num_keys,
+    // The number of keys whose first column is null
+    2: i64                      num_nulls,
+    // HyperLogLog sketch of the not null values, to estimate the number of distinct values
+    3: binary                   ndv_sketch,
+    // Equi-depth histogram of the not null values, sorted by the upper bounds
+    4: list<HistogramBucket>    histogram,
+}
+
+// Out degree distribution of an edge type
+struct DegreeStats {
+    // The number of vertices which have out edges of the edge type
+    1: i64 num_sources,
+    // The largest out degree of a vertex
+    2: i64 max_degree,
+}
+
 struct StatsItem {
     // The number of vertices of tagName
     1: map<binary, i64>
@@ -328,6 +358,11 @@ struct StatsItem {
     6: map<common.PartitionID, list<Correlativity>>
         (cpp.template = "std::unordered_map") negative_part_correlativity,
     7: JobStatus                              status,
+    8: optional map<common.IndexID, IndexStats>
+        (cpp.template = "std::unordered_map") index_stats,
+    // The out degree distribution of edgeName
+    9: optional map<binary, DegreeStats>
+        (cpp.template = "std::unordered_map") edge_degrees,
 }
 
 // Graph space related operations.
@@ -544,6 +579,9 @@ struct HBResp {
     3: ClusterID        cluster_id,
     4: i64              last_update_time_in_ms,
     5: i32              meta_version,
+    // Last update time of each space, the spaces never changed after upgrading are absent
+    6: optional map<common.GraphSpaceID, i64>
+        (cpp.template = "std::unordered_map") space_update_time_in_ms,
 }
 
 enum HostRole {
@@ -615,6 +653,7 @@ struct CreateTagIndexReq {
     5: bool                 if_not_exists,
     6: optional binary      comment,
     7: optional IndexParams index_params,
+    8: optional list<binary> include_fields,
 }
 
 struct DropTagIndexReq {
@@ -652,6 +691,7 @@ struct CreateEdgeIndexReq {
     5: bool                	if_not_exists,
     6: optional binary      comment,
     7: optional IndexParams index_params,
+    8: optional list<binary> include_fields,
 }
 
 struct DropEdgeIndexReq {
@@ -1077,6 +1117,8 @@ struct QueryDesc {
     // The session might transfer between query engines, but the query do not, we must
     // record which query engine the query belongs to
     5: common.HostAddr graph_addr,
+    // The peak memory of the results and hash tables of the query
+    6: i64 peak_memory_bytes = 0,
 }
 
 struct Session {
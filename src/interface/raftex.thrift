@@ -137,10 +137,24 @@ struct GetStateResponse {
     9: list<binary>     peers;
 }
 
+struct GetReadIndexRequest {
+    1: GraphSpaceID space;              // Graphspace ID
+    2: PartitionID  part;               // Partition ID
+}
+
+struct GetReadIndexResponse {
+    1: common.ErrorCode error_code;
+    2: TermID           term;
+    // Leader's committed log id when it holds a valid lease, a follower could serve linearizable
+    // reads once it has applied up to this log
+    3: LogID            read_index;
+}
+
 service RaftexService {
     AskForVoteResponse askForVote(1: AskForVoteRequest req);
     AppendLogResponse appendLog(1: AppendLogRequest req);
     SendSnapshotResponse sendSnapshot(1: SendSnapshotRequest req);
     HeartbeatResponse heartbeat(1: HeartbeatRequest req) (thread = 'eb');
     GetStateResponse getState(1: GetStateRequest req);
+    GetReadIndexResponse getReadIndex(1: GetReadIndexRequest req);
 }
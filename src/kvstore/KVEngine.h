@@ -243,6 +243,31 @@ class KVEngine {
    */
   virtual void removePart(PartitionID partId) = 0;
 
+  /**
+   * @brief Remove all data of a partition at once, only supported by engines which isolate the data
+   * of each partition, e.g. a column family per partition in rocksdb
+   *
+   * @param partId Partition id whose data to remove
+   * @return nebula::cpp2::ErrorCode E_UNSUPPORTED if the engine does not isolate partitions
+   */
+  virtual nebula::cpp2::ErrorCode dropPartData(PartitionID partId) {
+    UNUSED(partId);
+    return nebula::cpp2::ErrorCode::E_UNSUPPORTED;
+  }
+
+  /**
+   * @brief Return the last committed log id of a partition which is durable in the engine, the
+   * wal after it is still needed to recover the partition when restarted. Engines which persist
+   * each write return the max log id.
+   *
+   * @param partId Partition id
+   * @return LogID
+   */
+  virtual LogID persistedCommitLogId(PartitionID partId) {
+    UNUSED(partId);
+    return std::numeric_limits<LogID>::max();
+  }
+
   /**
    * @brief Return all parts current engine holds.
    *
@@ -98,6 +98,23 @@ class KVStore {
     return nullptr;
   }
 
+  /**
+   * @brief Wait until the follower has applied up to the read index of leader, then the reads of
+   * the partition on this host are linearizable with canReadFromFollower set. It is called once per
+   * read request of each partition, nothing is blocked while waiting.
+   *
+   * @param spaceId
+   * @param partId
+   * @return folly::Future<nebula::cpp2::ErrorCode> SUCCEEDED if the follower could serve the
+   * reads, E_UNSUPPORTED if follower read is disabled or this host is the leader
+   */
+  virtual folly::Future<nebula::cpp2::ErrorCode> syncReadIndex(GraphSpaceID spaceId,
+                                                               PartitionID partId) {
+    UNUSED(spaceId);
+    UNUSED(partId);
+    return folly::makeFuture(nebula::cpp2::ErrorCode::E_UNSUPPORTED);
+  }
+
   /**
    * @brief Get the Snapshot object
    *
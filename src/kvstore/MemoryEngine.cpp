@@ -0,0 +1,801 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "kvstore/MemoryEngine.h"
+
+#include <folly/synchronization/Rcu.h>
+#include <rocksdb/sst_file_reader.h>
+#include <rocksdb/sst_file_writer.h>
+
+#include "common/fs/FileUtils.h"
+#include "common/utils/NebulaKeyUtils.h"
+
+DEFINE_int32(memory_engine_purge_interval_ms,
+             1000,
+             "Interval to purge the stale versions in memory engine, 0 means disable");
+DEFINE_int32(memory_engine_flush_interval_secs,
+             600,
+             "Interval to dump the data of memory engine into data path, 0 means dump only "
+             "before the wal is cleaned");
+
+namespace nebula {
+namespace kvstore {
+
+using fs::FileType;
+using fs::FileUtils;
+
+namespace {
+
+constexpr int kSkipListHeight = 16;
+constexpr size_t kIngestBatchSize = 1024;
+constexpr folly::StringPiece kDumpFileName = "memory.sst";
+
+// The commit log id in the value of the system commit key
+LogID commitLogIdOf(folly::StringPiece val) {
+  if (val.size() < sizeof(LogID)) {
+    return 0;
+  }
+  LogID logId;
+  memcpy(reinterpret_cast<void*>(&logId), val.data(), sizeof(LogID));
+  return logId;
+}
+
+// The smallest key greater than all keys with the prefix, empty if there is no such key
+std::string prefixEnd(std::string prefix) {
+  while (!prefix.empty()) {
+    auto& last = reinterpret_cast<uint8_t&>(prefix.back());
+    if (last != 0xFF) {
+      last++;
+      return prefix;
+    }
+    prefix.pop_back();
+  }
+  return prefix;
+}
+
+}  // namespace
+
+MemSnapshot::~MemSnapshot() {
+  engine_->releaseSnapshot(seq_);
+}
+
+/***************************************
+ *
+ * Implementation of MemIter
+ *
+ **************************************/
+MemIter::MemIter(std::shared_ptr<MemTable> table,
+                 std::shared_ptr<const MemSnapshot> snapshot,
+                 std::string start,
+                 std::string end,
+                 std::string prefix)
+    : accessor_(std::move(table)),
+      snapshot_(std::move(snapshot)),
+      start_(std::move(start)),
+      end_(std::move(end)),
+      prefix_(std::move(prefix)) {
+  seekToStart();
+}
+
+bool MemIter::valid() const {
+  return iter_ != accessor_.end();
+}
+
+void MemIter::next() {
+  // The node will not be released as long as the accessor is alive
+  const auto& current = iter_->key;
+  ++iter_;
+  while (iter_ != accessor_.end() && iter_->key == current) {
+    ++iter_;
+  }
+  skipToVisible();
+}
+
+void MemIter::prev() {
+  auto current = iter_->key;
+  auto last = accessor_.end();
+  seekToStart();
+  while (valid() && iter_->key < current) {
+    last = iter_;
+    next();
+  }
+  iter_ = last;
+}
+
+void MemIter::seekToStart() {
+  if (start_.empty()) {
+    iter_ = accessor_.begin();
+  } else {
+    iter_ = accessor_.lower_bound(
+        MemEntry{start_, std::numeric_limits<uint64_t>::max(), "", false});
+  }
+  skipToVisible();
+}
+
+void MemIter::skipToVisible() {
+  while (iter_ != accessor_.end()) {
+    folly::StringPiece key(iter_->key);
+    if ((!prefix_.empty() && !key.startsWith(prefix_)) || (!end_.empty() && key >= end_)) {
+      iter_ = accessor_.end();
+      return;
+    }
+    if (iter_->seq > snapshot_->seq()) {
+      // written after the snapshot
+      ++iter_;
+      continue;
+    }
+    if (!iter_->deleted) {
+      return;
+    }
+    // the key has been removed in the snapshot, skip its older versions
+    const auto& current = iter_->key;
+    ++iter_;
+    while (iter_ != accessor_.end() && iter_->key == current) {
+      ++iter_;
+    }
+  }
+}
+
+/***************************************
+ *
+ * Implementation of MemoryEngine
+ *
+ **************************************/
+MemoryEngine::MemoryEngine(GraphSpaceID spaceId,
+                           const std::string& dataPath,
+                           const std::string& walPath)
+    : KVEngine(spaceId),
+      dataPath_(folly::stringPrintf("%s/nebula/%d", dataPath.c_str(), spaceId)),
+      table_(MemTable::createInstance(kSkipListHeight)) {
+  // set wal path as dataPath by default
+  if (walPath.empty()) {
+    walPath_ = folly::stringPrintf("%s/nebula/%d", dataPath.c_str(), spaceId);
+  } else {
+    walPath_ = folly::stringPrintf("%s/nebula/%d", walPath.c_str(), spaceId);
+  }
+  auto path = folly::stringPrintf("%s/data", dataPath_.c_str());
+  if (FileUtils::fileType(path.c_str()) == FileType::NOTEXIST) {
+    if (!FileUtils::makeDir(path)) {
+      LOG(FATAL) << "makeDir " << path << " failed";
+    }
+  }
+  if (FileUtils::fileType(path.c_str()) != FileType::DIRECTORY) {
+    LOG(FATAL) << path << " is not directory";
+  }
+
+  auto file = dumpFile();
+  if (FileUtils::exist(file)) {
+    auto code = loadFromFile(file, true);
+    CHECK(code == nebula::cpp2::ErrorCode::SUCCEEDED) << "Load " << file << " failed";
+    // All loaded data is in the dump file
+    std::unique_ptr<KVIterator> iter;
+    if (prefix(NebulaKeyUtils::systemPrefix(), &iter) == nebula::cpp2::ErrorCode::SUCCEEDED) {
+      for (; iter->valid(); iter->next()) {
+        if (NebulaKeyUtils::isSystemCommit(iter->key())) {
+          persistedCommitLogIds_[NebulaKeyUtils::getPart(iter->key())] =
+              commitLogIdOf(iter->val());
+        }
+      }
+    }
+  }
+  if (spaceId_ != kDefaultSpaceId /* only for storage*/) {
+    std::string dataVersionValue;
+    if (get(NebulaKeyUtils::dataVersionKey(), &dataVersionValue) ==
+        nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+      put(NebulaKeyUtils::dataVersionKey(), NebulaKeyUtils::dataVersionValue());
+    }
+  }
+  partsNum_ = allParts().size();
+  LOG(INFO) << "open memory engine on " << path << ", " << table_->size() << " entries loaded";
+
+  if (FLAGS_memory_engine_purge_interval_ms > 0 || FLAGS_memory_engine_flush_interval_secs > 0) {
+    bgWorker_ = std::make_unique<thread::GenericWorker>();
+    CHECK(bgWorker_->start("mem-engine-bg"));
+    if (FLAGS_memory_engine_purge_interval_ms > 0) {
+      bgWorker_->addRepeatTask(FLAGS_memory_engine_purge_interval_ms, &MemoryEngine::purge, this);
+    }
+    if (FLAGS_memory_engine_flush_interval_secs > 0) {
+      bgWorker_->addRepeatTask(
+          FLAGS_memory_engine_flush_interval_secs * 1000, &MemoryEngine::flush, this);
+    }
+  }
+}
+
+MemoryEngine::~MemoryEngine() {
+  if (bgWorker_) {
+    bgWorker_->stop();
+    bgWorker_->wait();
+  }
+}
+
+void MemoryEngine::stop() {
+  if (bgWorker_) {
+    bgWorker_->stop();
+    bgWorker_->wait();
+    bgWorker_.reset();
+  }
+  flush();
+}
+
+std::string MemoryEngine::dumpFile() const {
+  return folly::stringPrintf("%s/data/%s", dataPath_.c_str(), kDumpFileName.data());
+}
+
+std::shared_ptr<const MemSnapshot> MemoryEngine::acquireSnapshot() {
+  // Register under the lock, so purge won't compute a cutoff newer than the sequence
+  std::lock_guard<std::mutex> lg(readSeqsLock_);
+  auto seq = visibleSeq_.load(std::memory_order_acquire);
+  readSeqs_.emplace(seq);
+  return std::make_shared<const MemSnapshot>(this, seq);
+}
+
+void MemoryEngine::releaseSnapshot(uint64_t seq) {
+  std::lock_guard<std::mutex> lg(readSeqsLock_);
+  auto iter = readSeqs_.find(seq);
+  CHECK(iter != readSeqs_.end());
+  readSeqs_.erase(iter);
+}
+
+uint64_t MemoryEngine::oldestReadSeq() {
+  std::lock_guard<std::mutex> lg(readSeqsLock_);
+  auto seq = visibleSeq_.load(std::memory_order_acquire);
+  if (!readSeqs_.empty()) {
+    seq = std::min(seq, *readSeqs_.begin());
+  }
+  return seq;
+}
+
+const void* MemoryEngine::GetSnapshot() {
+  return new std::shared_ptr<const MemSnapshot>(acquireSnapshot());
+}
+
+void MemoryEngine::ReleaseSnapshot(const void* snapshot) {
+  delete reinterpret_cast<const std::shared_ptr<const MemSnapshot>*>(snapshot);
+}
+
+std::unique_ptr<WriteBatch> MemoryEngine::startBatchWrite() {
+  return std::make_unique<MemWriteBatch>();
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::commitBatchWrite(std::unique_ptr<WriteBatch> batch,
+                                                       bool disableWAL,
+                                                       bool sync,
+                                                       bool wait) {
+  // There is no wal in memory engine, data not dumped yet is recovered by raft
+  UNUSED(disableWAL);
+  UNUSED(sync);
+  UNUSED(wait);
+  auto* b = static_cast<MemWriteBatch*>(batch.get());
+  applyOps(b->ops());
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+void MemoryEngine::applyOps(std::vector<MemWriteBatch::Op>& ops) {
+  std::lock_guard<std::mutex> lg(writeLock_);
+  MemTable::Accessor accessor(table_);
+  for (auto& op : ops) {
+    switch (op.type) {
+      case MemWriteBatch::OpType::kPut: {
+        accessor.insert(MemEntry{std::move(op.key), ++lastSeq_, std::move(op.value), false});
+        break;
+      }
+      case MemWriteBatch::OpType::kRemove: {
+        accessor.insert(MemEntry{std::move(op.key), ++lastSeq_, "", true});
+        break;
+      }
+      case MemWriteBatch::OpType::kRemoveRange: {
+        // Write a tombstone for each live key in the range, operations before in the same batch
+        // are visible here since we are the only writer
+        std::vector<std::string> keys;
+        auto iter = accessor.lower_bound(
+            MemEntry{op.key, std::numeric_limits<uint64_t>::max(), "", false});
+        while (iter != accessor.end() && (op.value.empty() || iter->key < op.value)) {
+          const auto& current = iter->key;
+          if (!iter->deleted) {
+            keys.emplace_back(current);
+          }
+          while (iter != accessor.end() && iter->key == current) {
+            ++iter;
+          }
+        }
+        for (auto& key : keys) {
+          accessor.insert(MemEntry{std::move(key), ++lastSeq_, "", true});
+        }
+        break;
+      }
+    }
+  }
+  // Publish the whole batch at once
+  visibleSeq_.store(lastSeq_, std::memory_order_release);
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::getInternal(MemTable::Accessor& accessor,
+                                                  const std::string& key,
+                                                  uint64_t seq,
+                                                  std::string* value) {
+  auto iter = accessor.lower_bound(MemEntry{key, seq, "", false});
+  if (iter == accessor.end() || iter->key != key || iter->deleted) {
+    return nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND;
+  }
+  *value = iter->value;
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::get(const std::string& key,
+                                          std::string* value,
+                                          const void* snapshot) {
+  MemTable::Accessor accessor(table_);
+  if (snapshot != nullptr) {
+    const auto& snap = *reinterpret_cast<const std::shared_ptr<const MemSnapshot>*>(snapshot);
+    return getInternal(accessor, key, snap->seq(), value);
+  }
+  // A point read is not registered, purge waits for the readers in flight by rcu instead
+  folly::rcu_reader guard;
+  return getInternal(accessor, key, visibleSeq_.load(std::memory_order_acquire), value);
+}
+
+std::vector<Status> MemoryEngine::multiGet(const std::vector<std::string>& keys,
+                                           std::vector<std::string>* values) {
+  std::vector<Status> ret(keys.size());
+  values->resize(keys.size());
+  MemTable::Accessor accessor(table_);
+  folly::rcu_reader guard;
+  auto seq = visibleSeq_.load(std::memory_order_acquire);
+  for (size_t i = 0; i < keys.size(); i++) {
+    auto code = getInternal(accessor, keys[i], seq, &(*values)[i]);
+    if (code == nebula::cpp2::ErrorCode::SUCCEEDED) {
+      ret[i] = Status::OK();
+    } else {
+      ret[i] = Status::KeyNotFound();
+    }
+  }
+  return ret;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::range(const std::string& start,
+                                            const std::string& end,
+                                            std::unique_ptr<KVIterator>* storageIter) {
+  storageIter->reset(new MemIter(table_, acquireSnapshot(), start, end, ""));
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::prefix(const std::string& prefix,
+                                             std::unique_ptr<KVIterator>* storageIter,
+                                             const void* snapshot) {
+  std::shared_ptr<const MemSnapshot> snap;
+  if (snapshot != nullptr) {
+    snap = *reinterpret_cast<const std::shared_ptr<const MemSnapshot>*>(snapshot);
+  } else {
+    snap = acquireSnapshot();
+  }
+  storageIter->reset(new MemIter(table_, std::move(snap), prefix, "", prefix));
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::rangeWithPrefix(const std::string& start,
+                                                      const std::string& prefix,
+                                                      std::unique_ptr<KVIterator>* storageIter) {
+  storageIter->reset(new MemIter(table_, acquireSnapshot(), start, "", prefix));
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::scan(std::unique_ptr<KVIterator>* storageIter) {
+  storageIter->reset(new MemIter(table_, acquireSnapshot(), "", "", ""));
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::put(std::string key, std::string value) {
+  std::vector<MemWriteBatch::Op> ops;
+  ops.emplace_back(
+      MemWriteBatch::Op{MemWriteBatch::OpType::kPut, std::move(key), std::move(value)});
+  applyOps(ops);
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::multiPut(std::vector<KV> keyValues) {
+  std::vector<MemWriteBatch::Op> ops;
+  ops.reserve(keyValues.size());
+  for (auto& kv : keyValues) {
+    ops.emplace_back(
+        MemWriteBatch::Op{MemWriteBatch::OpType::kPut, std::move(kv.first), std::move(kv.second)});
+  }
+  applyOps(ops);
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::remove(const std::string& key) {
+  std::vector<MemWriteBatch::Op> ops;
+  ops.emplace_back(MemWriteBatch::Op{MemWriteBatch::OpType::kRemove, key, ""});
+  applyOps(ops);
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::multiRemove(std::vector<std::string> keys) {
+  std::vector<MemWriteBatch::Op> ops;
+  ops.reserve(keys.size());
+  for (auto& key : keys) {
+    ops.emplace_back(MemWriteBatch::Op{MemWriteBatch::OpType::kRemove, std::move(key), ""});
+  }
+  applyOps(ops);
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::removeRange(const std::string& start,
+                                                  const std::string& end) {
+  std::vector<MemWriteBatch::Op> ops;
+  ops.emplace_back(MemWriteBatch::Op{MemWriteBatch::OpType::kRemoveRange, start, end});
+  applyOps(ops);
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+std::string MemoryEngine::partKey(PartitionID partId) {
+  return NebulaKeyUtils::systemPartKey(partId);
+}
+
+std::string MemoryEngine::balanceKey(PartitionID partId) {
+  return NebulaKeyUtils::systemBalanceKey(partId);
+}
+
+void MemoryEngine::addPart(PartitionID partId, const Peers& raftPeers) {
+  auto ret = put(partKey(partId), "");
+  if (ret == nebula::cpp2::ErrorCode::SUCCEEDED) {
+    partsNum_++;
+    CHECK_GE(partsNum_, 0);
+  }
+
+  if (!raftPeers.allNormalPeers()) {
+    put(balanceKey(partId), raftPeers.toString());
+  }
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::updatePart(PartitionID partId, const Peer& raftPeer) {
+  std::string val;
+  auto ret = get(balanceKey(partId), &val);
+
+  Peers peers;
+  if (ret == nebula::cpp2::ErrorCode::SUCCEEDED) {
+    peers = Peers::fromString(val);
+  } else if (ret != nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+    LOG(INFO) << "Update part failed when get, partId=" << partId;
+    return ret;
+  }
+
+  peers.addOrUpdate(raftPeer);
+  if (peers.allNormalPeers()) {
+    return remove(balanceKey(partId));
+  }
+  return put(balanceKey(partId), peers.toString());
+}
+
+void MemoryEngine::removePart(PartitionID partId) {
+  std::vector<std::string> sysKeysToDelete;
+  sysKeysToDelete.emplace_back(partKey(partId));
+  sysKeysToDelete.emplace_back(balanceKey(partId));
+  sysKeysToDelete.emplace_back(NebulaKeyUtils::systemCommitKey(partId));
+  auto code = multiRemove(sysKeysToDelete);
+  if (code == nebula::cpp2::ErrorCode::SUCCEEDED) {
+    partsNum_--;
+    CHECK_GE(partsNum_, 0);
+  }
+  dropPartData(partId);
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::dropPartData(PartitionID partId) {
+  // All data keys of a part start with the 4 bytes of (partId << 8 | type), the system keys are
+  // removed in removePart
+  std::vector<MemWriteBatch::Op> ops;
+  for (auto type : {NebulaKeyType::kTag_,
+                    NebulaKeyType::kEdge,
+                    NebulaKeyType::kIndex,
+                    NebulaKeyType::kOperation,
+                    NebulaKeyType::kKeyValue,
+                    NebulaKeyType::kVertex,
+                    NebulaKeyType::kPrime,
+                    NebulaKeyType::kDoublePrime}) {
+    uint32_t item =
+        (static_cast<uint32_t>(partId) << kPartitionOffset) | static_cast<uint32_t>(type);
+    std::string start(reinterpret_cast<const char*>(&item), sizeof(item));
+    auto end = prefixEnd(start);
+    ops.emplace_back(MemWriteBatch::Op{
+        MemWriteBatch::OpType::kRemoveRange, std::move(start), std::move(end)});
+  }
+  applyOps(ops);
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+std::vector<PartitionID> MemoryEngine::allParts() {
+  std::unique_ptr<KVIterator> iter;
+  std::vector<PartitionID> parts;
+  static const std::string prefixStr = NebulaKeyUtils::systemPrefix();
+  auto retCode = this->prefix(prefixStr, &iter);
+  if (nebula::cpp2::ErrorCode::SUCCEEDED != retCode) {
+    return parts;
+  }
+
+  while (iter->valid()) {
+    auto key = iter->key();
+    if (!NebulaKeyUtils::isSystemPart(key)) {
+      iter->next();
+      continue;
+    }
+
+    PartitionID partId = *reinterpret_cast<const PartitionID*>(key.data());
+    partId = partId >> 8;
+    parts.emplace_back(partId);
+    iter->next();
+  }
+  return parts;
+}
+
+std::map<PartitionID, Peers> MemoryEngine::balancePartPeers() {
+  std::unique_ptr<KVIterator> iter;
+  std::map<PartitionID, Peers> partRaftPeers;
+  static const std::string prefixStr = NebulaKeyUtils::systemPrefix();
+  auto retCode = this->prefix(prefixStr, &iter);
+  if (nebula::cpp2::ErrorCode::SUCCEEDED != retCode) {
+    return partRaftPeers;
+  }
+
+  while (iter->valid()) {
+    auto key = iter->key();
+    if (!NebulaKeyUtils::isSystemBalance(key)) {
+      iter->next();
+      continue;
+    }
+
+    PartitionID partId = *reinterpret_cast<const PartitionID*>(key.data());
+    auto raftPeers = Peers::fromString(iter->val().toString());
+    partId = partId >> 8;
+    partRaftPeers.emplace(partId, raftPeers);
+    iter->next();
+  }
+  return partRaftPeers;
+}
+
+int32_t MemoryEngine::totalPartsNum() {
+  return partsNum_;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::ingest(const std::vector<std::string>& files,
+                                             bool verifyFileChecksum) {
+  for (const auto& file : files) {
+    auto code = loadFromFile(file, verifyFileChecksum);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return code;
+    }
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::loadFromFile(const std::string& file,
+                                                   bool verifyFileChecksum) {
+  rocksdb::Options options;
+  rocksdb::SstFileReader reader(options);
+  auto status = reader.Open(file);
+  if (status.ok() && verifyFileChecksum) {
+    status = reader.VerifyChecksum();
+  }
+  if (!status.ok()) {
+    LOG(WARNING) << "Load " << file << " failed: " << status.ToString();
+    return nebula::cpp2::ErrorCode::E_UNKNOWN;
+  }
+  std::unique_ptr<rocksdb::Iterator> iter(reader.NewIterator(rocksdb::ReadOptions()));
+  std::vector<MemWriteBatch::Op> ops;
+  for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+    ops.emplace_back(MemWriteBatch::Op{
+        MemWriteBatch::OpType::kPut, iter->key().ToString(), iter->value().ToString()});
+    if (ops.size() >= kIngestBatchSize) {
+      applyOps(ops);
+      ops.clear();
+    }
+  }
+  if (!iter->status().ok()) {
+    LOG(WARNING) << "Load " << file << " failed: " << iter->status().ToString();
+    return nebula::cpp2::ErrorCode::E_UNKNOWN;
+  }
+  applyOps(ops);
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::setOption(const std::string& configKey,
+                                                const std::string& configValue) {
+  LOG(WARNING) << "SetOption is not supported by memory engine: " << configKey << ":"
+               << configValue;
+  return nebula::cpp2::ErrorCode::E_UNSUPPORTED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::setDBOption(const std::string& configKey,
+                                                  const std::string& configValue) {
+  LOG(WARNING) << "SetDBOption is not supported by memory engine: " << configKey << ":"
+               << configValue;
+  return nebula::cpp2::ErrorCode::E_UNSUPPORTED;
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, std::string> MemoryEngine::getProperty(
+    const std::string& property) {
+  LOG(WARNING) << "GetProperty is not supported by memory engine: " << property;
+  return nebula::cpp2::ErrorCode::E_INVALID_PARM;
+}
+
+void MemoryEngine::purge() {
+  auto cutoff = oldestReadSeq();
+  // Wait for the point reads which may be reading an older sequence than the cutoff
+  folly::synchronize_rcu();
+
+  MemTable::Accessor accessor(table_);
+  std::vector<MemEntry> stale;
+  auto iter = accessor.begin();
+  while (iter != accessor.end()) {
+    const auto& current = iter->key;
+    // skip the versions newer than cutoff
+    while (iter != accessor.end() && iter->key == current && iter->seq > cutoff) {
+      ++iter;
+    }
+    if (iter == accessor.end() || iter->key != current) {
+      continue;
+    }
+    // The version visible to cutoff is kept unless it is a tombstone, all the older ones are
+    // invisible to everyone
+    auto tombstone = iter->deleted;
+    auto seq = iter->seq;
+    ++iter;
+    while (iter != accessor.end() && iter->key == current) {
+      stale.emplace_back(MemEntry{iter->key, iter->seq, "", iter->deleted});
+      ++iter;
+    }
+    // The tombstone is erased after the older versions, otherwise the readers at cutoff would
+    // see the deleted value in between
+    if (tombstone) {
+      stale.emplace_back(MemEntry{current, seq, "", true});
+    }
+  }
+  for (const auto& entry : stale) {
+    accessor.erase(entry);
+  }
+  VLOG(2) << "Purged " << stale.size() << " stale versions of space " << spaceId_;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::compact() {
+  purge();
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::flush() {
+  std::lock_guard<std::mutex> lg(dumpLock_);
+  auto file = dumpFile();
+  auto tmpFile = file + ".tmp";
+  std::unordered_map<PartitionID, LogID> commitLogIds;
+  auto code = dumpToFile(tmpFile, "", nullptr, &commitLogIds);
+  if (code == nebula::cpp2::ErrorCode::E_BACKUP_EMPTY_TABLE) {
+    // nothing to dump
+    if (FileUtils::exist(file) && !FileUtils::remove(file.c_str())) {
+      return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+    }
+  } else if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    // The wal is kept since the last successful dump
+    return code;
+  } else if (::rename(tmpFile.c_str(), file.c_str()) != 0) {
+    LOG(WARNING) << "Rename " << tmpFile << " to " << file << " failed, errno " << errno;
+    return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+  }
+  std::lock_guard<std::mutex> pg(persistedLock_);
+  persistedCommitLogIds_ = std::move(commitLogIds);
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+LogID MemoryEngine::persistedCommitLogId(PartitionID partId) {
+  std::lock_guard<std::mutex> lg(persistedLock_);
+  auto iter = persistedCommitLogIds_.find(partId);
+  return iter == persistedCommitLogIds_.end() ? 0 : iter->second;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::dumpToFile(
+    const std::string& file,
+    const std::string& tablePrefix,
+    std::function<bool(const folly::StringPiece& key)> filter,
+    std::unordered_map<PartitionID, LogID>* commitLogIds) {
+  std::unique_ptr<KVIterator> iter;
+  auto ret = prefix(tablePrefix, &iter);
+  if (ret != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return ret;
+  }
+  if (!iter->valid()) {
+    return nebula::cpp2::ErrorCode::E_BACKUP_EMPTY_TABLE;
+  }
+
+  rocksdb::Options options;
+  options.file_checksum_gen_factory = rocksdb::GetFileChecksumGenCrc32cFactory();
+  rocksdb::SstFileWriter sstFileWriter(rocksdb::EnvOptions(), options);
+  auto s = sstFileWriter.Open(file);
+  if (!s.ok()) {
+    LOG(WARNING) << "Open " << file << " failed: " << s.ToString();
+    return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+  }
+
+  size_t count = 0;
+  for (; iter->valid(); iter->next()) {
+    if (filter && filter(iter->key())) {
+      continue;
+    }
+    s = sstFileWriter.Put(rocksdb::Slice(iter->key().data(), iter->key().size()),
+                          rocksdb::Slice(iter->val().data(), iter->val().size()));
+    if (!s.ok()) {
+      LOG(WARNING) << "Write " << file << " failed: " << s.ToString();
+      sstFileWriter.Finish();
+      return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+    }
+    if (commitLogIds != nullptr && NebulaKeyUtils::isSystemCommit(iter->key())) {
+      (*commitLogIds)[NebulaKeyUtils::getPart(iter->key())] = commitLogIdOf(iter->val());
+    }
+    count++;
+  }
+  if (count == 0) {
+    return nebula::cpp2::ErrorCode::E_BACKUP_EMPTY_TABLE;
+  }
+
+  s = sstFileWriter.Finish();
+  if (!s.ok()) {
+    LOG(WARNING) << "Finish " << file << " failed: " << s.ToString();
+    return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode MemoryEngine::createCheckpoint(const std::string& checkpointPath) {
+  LOG(INFO) << "Target checkpoint data path : " << checkpointPath;
+  if (fs::FileUtils::exist(checkpointPath) && !fs::FileUtils::remove(checkpointPath.data(), true)) {
+    LOG(WARNING) << "Remove exist checkpoint data dir failed: " << checkpointPath;
+    return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+  }
+  if (!FileUtils::makeDir(checkpointPath)) {
+    LOG(WARNING) << "Make checkpoint dir failed: " << checkpointPath;
+    return nebula::cpp2::ErrorCode::E_FAILED_TO_CHECKPOINT;
+  }
+  // Same layout as the data path, so the checkpoint could be loaded as data directly
+  auto file = folly::stringPrintf("%s/%s", checkpointPath.c_str(), kDumpFileName.data());
+  auto code = dumpToFile(file, "", nullptr);
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED &&
+      code != nebula::cpp2::ErrorCode::E_BACKUP_EMPTY_TABLE) {
+    return nebula::cpp2::ErrorCode::E_FAILED_TO_CHECKPOINT;
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, std::string> MemoryEngine::backupTable(
+    const std::string& name,
+    const std::string& tablePrefix,
+    std::function<bool(const folly::StringPiece& key)> filter) {
+  auto backupPath = folly::stringPrintf(
+      "%s/checkpoints/%s/%s.sst", dataPath_.c_str(), name.c_str(), tablePrefix.c_str());
+  VLOG(3) << "Start writing the sst file with table (" << tablePrefix
+          << ") to file: " << backupPath;
+
+  auto parent = backupPath.substr(0, backupPath.rfind('/'));
+  if (!FileUtils::exist(parent)) {
+    if (!FileUtils::makeDir(parent)) {
+      LOG(WARNING) << "Make dir " << parent << " failed";
+      return nebula::cpp2::ErrorCode::E_BACKUP_FAILED;
+    }
+  }
+
+  auto code = dumpToFile(backupPath, tablePrefix, std::move(filter));
+  if (code == nebula::cpp2::ErrorCode::E_BACKUP_EMPTY_TABLE) {
+    return code;
+  } else if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return nebula::cpp2::ErrorCode::E_BACKUP_TABLE_FAILED;
+  }
+
+  if (backupPath[0] == '/') {
+    return backupPath;
+  }
+  auto result = FileUtils::realPath(backupPath.c_str());
+  if (!result.ok()) {
+    return nebula::cpp2::ErrorCode::E_BACKUP_TABLE_FAILED;
+  }
+  return result.value();
+}
+
+}  // namespace kvstore
+}  // namespace nebula
@@ -0,0 +1,350 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef KVSTORE_MEMORYENGINE_H_
+#define KVSTORE_MEMORYENGINE_H_
+
+#include <folly/ConcurrentSkipList.h>
+#include <gtest/gtest_prod.h>
+
+#include "common/base/Base.h"
+#include "common/thread/GenericWorker.h"
+#include "kvstore/KVEngine.h"
+#include "kvstore/KVIterator.h"
+
+DECLARE_int32(memory_engine_purge_interval_ms);
+DECLARE_int32(memory_engine_flush_interval_secs);
+
+namespace nebula {
+namespace kvstore {
+
+/**
+ * @brief One version of a key in memory engine. All versions of the same key are ordered from the
+ * newest to the oldest, a reader with sequence S sees the first version whose seq <= S.
+ */
+struct MemEntry {
+  std::string key;
+  uint64_t seq{0};
+  std::string value;
+  bool deleted{false};
+};
+
+struct MemEntryLess {
+  bool operator()(const MemEntry& lhs, const MemEntry& rhs) const {
+    auto cmp = lhs.key.compare(rhs.key);
+    return cmp < 0 || (cmp == 0 && lhs.seq > rhs.seq);
+  }
+};
+
+using MemTable = folly::ConcurrentSkipList<MemEntry, MemEntryLess>;
+
+class MemoryEngine;
+
+/**
+ * @brief A registered read sequence. Versions visible to a registered sequence won't be purged
+ * until it is released.
+ */
+class MemSnapshot final {
+ public:
+  MemSnapshot(MemoryEngine* engine, uint64_t seq) : engine_(engine), seq_(seq) {}
+
+  ~MemSnapshot();
+
+  uint64_t seq() const {
+    return seq_;
+  }
+
+ private:
+  MemoryEngine* engine_;
+  uint64_t seq_;
+};
+
+/**
+ * @brief Iterate the versions visible to a snapshot, in the range [start, end) or with a prefix
+ */
+class MemIter : public KVIterator {
+ public:
+  MemIter(std::shared_ptr<MemTable> table,
+          std::shared_ptr<const MemSnapshot> snapshot,
+          std::string start,
+          std::string end,
+          std::string prefix);
+
+  ~MemIter() = default;
+
+  bool valid() const override;
+
+  void next() override;
+
+  /**
+   * @brief Skip list is forward only, so prev will seek from the start again, which is O(n)
+   */
+  void prev() override;
+
+  folly::StringPiece key() const override {
+    return folly::StringPiece(iter_->key);
+  }
+
+  folly::StringPiece val() const override {
+    return folly::StringPiece(iter_->value);
+  }
+
+ private:
+  void seekToStart();
+
+  // Move to the version visible to the snapshot of the current or the following keys
+  void skipToVisible();
+
+ private:
+  MemTable::Accessor accessor_;
+  std::shared_ptr<const MemSnapshot> snapshot_;
+  std::string start_;
+  // empty end means no upper bound
+  std::string end_;
+  std::string prefix_;
+  MemTable::iterator iter_;
+};
+
+/**
+ * @brief Write batch of memory engine, the operations are applied in order when committed
+ */
+class MemWriteBatch : public WriteBatch {
+ public:
+  enum class OpType : uint8_t {
+    kPut,
+    kRemove,
+    kRemoveRange,
+  };
+
+  struct Op {
+    OpType type;
+    std::string key;
+    // the value for put, or the end key for removeRange
+    std::string value;
+  };
+
+  nebula::cpp2::ErrorCode put(folly::StringPiece key, folly::StringPiece value) override {
+    ops_.emplace_back(Op{OpType::kPut, key.str(), value.str()});
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+
+  nebula::cpp2::ErrorCode remove(folly::StringPiece key) override {
+    ops_.emplace_back(Op{OpType::kRemove, key.str(), ""});
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+
+  // Remove all keys in the range [start, end)
+  nebula::cpp2::ErrorCode removeRange(folly::StringPiece start, folly::StringPiece end) override {
+    ops_.emplace_back(Op{OpType::kRemoveRange, start.str(), end.str()});
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+
+  std::vector<Op>& ops() {
+    return ops_;
+  }
+
+ private:
+  std::vector<Op> ops_;
+};
+
+/**
+ * @brief KVEngine which keeps all data in a concurrent skip list. Each write creates a new version
+ * of the key with an increasing sequence, so readers and snapshots see a consistent view without
+ * locks. Old versions are purged in background once no reader could see them.
+ *
+ * The data is dumped into a sst file when flushed or checkpointed, and loaded when the engine is
+ * opened. Data written after the last dump is recovered by raft, so the wal of a part is only
+ * cleaned up to the commit log id in the last dump, see persistedCommitLogId.
+ */
+class MemoryEngine : public KVEngine {
+  FRIEND_TEST(MemoryEngineTest, PurgeTest);
+  friend class MemSnapshot;
+
+ public:
+  MemoryEngine(GraphSpaceID spaceId, const std::string& dataPath, const std::string& walPath = "");
+
+  ~MemoryEngine();
+
+  void stop() override;
+
+  const char* getDataRoot() const override {
+    return dataPath_.c_str();
+  }
+
+  const char* getWalRoot() const override {
+    return walPath_.c_str();
+  }
+
+  const void* GetSnapshot() override;
+
+  void ReleaseSnapshot(const void* snapshot) override;
+
+  std::unique_ptr<WriteBatch> startBatchWrite() override;
+
+  nebula::cpp2::ErrorCode commitBatchWrite(std::unique_ptr<WriteBatch> batch,
+                                           bool disableWAL,
+                                           bool sync,
+                                           bool wait) override;
+
+  nebula::cpp2::ErrorCode get(const std::string& key,
+                              std::string* value,
+                              const void* snapshot = nullptr) override;
+
+  std::vector<Status> multiGet(const std::vector<std::string>& keys,
+                               std::vector<std::string>* values) override;
+
+  nebula::cpp2::ErrorCode range(const std::string& start,
+                                const std::string& end,
+                                std::unique_ptr<KVIterator>* iter) override;
+
+  nebula::cpp2::ErrorCode prefix(const std::string& prefix,
+                                 std::unique_ptr<KVIterator>* iter,
+                                 const void* snapshot = nullptr) override;
+
+  nebula::cpp2::ErrorCode rangeWithPrefix(const std::string& start,
+                                          const std::string& prefix,
+                                          std::unique_ptr<KVIterator>* iter) override;
+
+  nebula::cpp2::ErrorCode scan(std::unique_ptr<KVIterator>* iter) override;
+
+  nebula::cpp2::ErrorCode put(std::string key, std::string value) override;
+
+  nebula::cpp2::ErrorCode multiPut(std::vector<KV> keyValues) override;
+
+  nebula::cpp2::ErrorCode remove(const std::string& key) override;
+
+  nebula::cpp2::ErrorCode multiRemove(std::vector<std::string> keys) override;
+
+  nebula::cpp2::ErrorCode removeRange(const std::string& start, const std::string& end) override;
+
+  void addPart(PartitionID partId, const Peers& raftPeers = {}) override;
+
+  nebula::cpp2::ErrorCode updatePart(PartitionID partId, const Peer& raftPeer) override;
+
+  void removePart(PartitionID partId) override;
+
+  nebula::cpp2::ErrorCode dropPartData(PartitionID partId) override;
+
+  /**
+   * @brief Return the commit log id of the part in the last dump file, 0 if nothing dumped
+   */
+  LogID persistedCommitLogId(PartitionID partId) override;
+
+  std::vector<PartitionID> allParts() override;
+
+  std::map<PartitionID, Peers> balancePartPeers() override;
+
+  int32_t totalPartsNum() override;
+
+  nebula::cpp2::ErrorCode ingest(const std::vector<std::string>& files,
+                                 bool verifyFileChecksum = false) override;
+
+  nebula::cpp2::ErrorCode setOption(const std::string& configKey,
+                                    const std::string& configValue) override;
+
+  nebula::cpp2::ErrorCode setDBOption(const std::string& configKey,
+                                      const std::string& configValue) override;
+
+  ErrorOr<nebula::cpp2::ErrorCode, std::string> getProperty(const std::string& property) override;
+
+  /**
+   * @brief Purge the versions which are invisible to all readers
+   */
+  nebula::cpp2::ErrorCode compact() override;
+
+  /**
+   * @brief Dump all data into the sst file in data path
+   */
+  nebula::cpp2::ErrorCode flush() override;
+
+  nebula::cpp2::ErrorCode createCheckpoint(const std::string& checkpointPath) override;
+
+  ErrorOr<nebula::cpp2::ErrorCode, std::string> backupTable(
+      const std::string& path,
+      const std::string& tablePrefix,
+      std::function<bool(const folly::StringPiece& key)> filter) override;
+
+  /**
+   * @brief Nothing to backup besides the dumped sst file
+   */
+  nebula::cpp2::ErrorCode backup() override {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+
+ private:
+  /**
+   * @brief Register the latest visible sequence
+   */
+  std::shared_ptr<const MemSnapshot> acquireSnapshot();
+
+  void releaseSnapshot(uint64_t seq);
+
+  /**
+   * @brief Return the oldest sequence which may be read by someone
+   */
+  uint64_t oldestReadSeq();
+
+  /**
+   * @brief Find the visible version of key to the sequence
+   */
+  nebula::cpp2::ErrorCode getInternal(MemTable::Accessor& accessor,
+                                      const std::string& key,
+                                      uint64_t seq,
+                                      std::string* value);
+
+  /**
+   * @brief Apply the operations with write lock held, they are visible to readers all at once
+   */
+  void applyOps(std::vector<MemWriteBatch::Op>& ops);
+
+  void purge();
+
+  /**
+   * @brief Write all data visible to current sequence into a sst file, the commit log id of each
+   * part dumped is collected into commitLogIds if not null
+   */
+  nebula::cpp2::ErrorCode dumpToFile(
+      const std::string& file,
+      const std::string& prefix,
+      std::function<bool(const folly::StringPiece& key)> filter,
+      std::unordered_map<PartitionID, LogID>* commitLogIds = nullptr);
+
+  nebula::cpp2::ErrorCode loadFromFile(const std::string& file, bool verifyFileChecksum);
+
+  std::string dumpFile() const;
+
+  std::string partKey(PartitionID partId);
+
+  std::string balanceKey(PartitionID partId);
+
+ private:
+  std::string dataPath_;
+  std::string walPath_;
+
+  std::shared_ptr<MemTable> table_;
+  // The sequence of the last applied operation, guarded by writeLock_
+  uint64_t lastSeq_{0};
+  // All operations with seq <= visibleSeq_ are visible to new readers
+  std::atomic<uint64_t> visibleSeq_{0};
+  std::mutex writeLock_;
+
+  // sequences of live snapshots and iterators
+  std::multiset<uint64_t> readSeqs_;
+  std::mutex readSeqsLock_;
+
+  std::atomic<int32_t> partsNum_{0};
+  // only one dump of the data file at a time
+  std::mutex dumpLock_;
+  // The commit log id of each part in the dump file
+  std::unordered_map<PartitionID, LogID> persistedCommitLogIds_;
+  std::mutex persistedLock_;
+
+  std::unique_ptr<thread::GenericWorker> bgWorker_;
+};
+
+}  // namespace kvstore
+}  // namespace nebula
+
+#endif  // KVSTORE_MEMORYENGINE_H_
@@ -15,6 +15,7 @@
 #include "common/network/NetworkUtils.h"
 #include "common/time/WallClock.h"
 #include "common/utils/NebulaKeyUtils.h"
+#include "kvstore/MemoryEngine.h"
 #include "kvstore/NebulaSnapshotManager.h"
 #include "kvstore/RocksEngine.h"
 
@@ -25,6 +26,10 @@ DEFINE_int32(custom_filter_interval_secs,
              "default minor compaction");
 DEFINE_int32(num_workers, 4, "Number of worker threads");
 DEFINE_int32(clean_wal_interval_secs, 600, "interval to trigger clean expired wal");
+DEFINE_bool(enable_follower_read,
+            false,
+            "Whether followers serve linearizable reads after applying up to the leader's read "
+            "index");
 DEFINE_bool(auto_remove_invalid_space, true, "whether remove data of invalid space when restart");
 
 DECLARE_bool(rocksdb_disable_wal);
@@ -340,6 +345,8 @@ std::unique_ptr<KVEngine> NebulaStore::newEngine(GraphSpaceID spaceId,
     auto vIdLen = getSpaceVidLen(spaceId);
     return std::make_unique<RocksEngine>(
         spaceId, vIdLen, dataPath, walPath, options_.mergeOp_, cfFactory);
+  } else if (FLAGS_engine_type == "memory") {
+    return std::make_unique<MemoryEngine>(spaceId, dataPath, walPath);
   } else {
     LOG(FATAL) << "Unknown engine type " << FLAGS_engine_type;
     return nullptr;
@@ -1265,13 +1272,34 @@ bool NebulaStore::checkLeader(std::shared_ptr<Part> part, bool canReadFromFollow
   return canReadFromFollower || (part->isLeader() && part->leaseValid());
 }
 
+folly::Future<nebula::cpp2::ErrorCode> NebulaStore::syncReadIndex(GraphSpaceID spaceId,
+                                                                   PartitionID partId) {
+  if (!FLAGS_enable_follower_read) {
+    return folly::makeFuture(nebula::cpp2::ErrorCode::E_UNSUPPORTED);
+  }
+  auto ret = part(spaceId, partId);
+  if (!ok(ret)) {
+    return folly::makeFuture(error(ret));
+  }
+  auto part = nebula::value(ret);
+  if (part->isLeader()) {
+    // The reads on leader are checked by its lease
+    return folly::makeFuture(nebula::cpp2::ErrorCode::E_UNSUPPORTED);
+  }
+  return part->syncReadIndex();
+}
+
 void NebulaStore::cleanWAL() {
   folly::RWSpinLock::ReadHolder rh(&lock_);
   SCOPE_EXIT {
     storeWorker_->addDelayTask(FLAGS_clean_wal_interval_secs * 1000, &NebulaStore::cleanWAL, this);
   };
+  // The memory engine without periodic dumps is dumped before the wal is cleaned
+  bool flushEngine =
+      FLAGS_rocksdb_disable_wal ||
+      (FLAGS_engine_type == "memory" && FLAGS_memory_engine_flush_interval_secs <= 0);
   for (const auto& spaceEntry : spaces_) {
-    if (FLAGS_rocksdb_disable_wal) {
+    if (flushEngine) {
       for (const auto& engine : spaceEntry.second->engines_) {
         engine->flush();
       }
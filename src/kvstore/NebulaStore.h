@@ -162,6 +162,18 @@ class NebulaStore : public KVStore, public Handler {
   ErrorOr<nebula::cpp2::ErrorCode, HostAddr> partLeader(GraphSpaceID spaceId,
                                                         PartitionID partId) override;
 
+  /**
+   * @brief Wait until the follower has applied up to the read index of leader, when
+   * enable_follower_read is on
+   *
+   * @param spaceId
+   * @param partId
+   * @return folly::Future<nebula::cpp2::ErrorCode> SUCCEEDED if the follower could serve the
+   * reads with canReadFromFollower set
+   */
+  folly::Future<nebula::cpp2::ErrorCode> syncReadIndex(GraphSpaceID spaceId,
+                                                       PartitionID partId) override;
+
   /**
    * @brief Return pointer of part manager
    *
@@ -15,10 +15,22 @@
 #include "kvstore/stats/KVStats.h"
 
 DEFINE_int32(cluster_id, 0, "A unique id for each cluster");
+DEFINE_bool(raft_async_apply,
+            false,
+            "Whether followers apply the committed logs asynchronously out of the raft lock");
+DEFINE_int32(raft_apply_batch_logs,
+             1024,
+             "Max number of logs coalesced into one write batch when applied asynchronously");
+DEFINE_int32(follower_read_timeout_ms,
+             1000,
+             "Max time a follower waits to apply up to the read index before serving a read");
 
 namespace nebula {
 namespace kvstore {
 
+static constexpr size_t kApplyRetryIntervalMs = 100;
+static constexpr int64_t kMaxPendingApplyBatches = 16;
+
 Part::Part(GraphSpaceID spaceId,
            PartitionID partId,
            HostAddr localAddr,
@@ -62,9 +74,101 @@ std::pair<LogID, TermID> Part::lastCommittedLogId() {
   TermID termId;
   memcpy(reinterpret_cast<void*>(&termId), val.data() + sizeof(LogID), sizeof(TermID));
 
+  // It is read when raft starts, all logs before have been applied
+  appliedLogId_ = lastId;
   return std::make_pair(lastId, termId);
 }
 
+void Part::stop() {
+  RaftPart::stop();
+  applyStopped_ = true;
+  // Wait for the logs being applied, the rest are applied again from wal when restarted
+  std::lock_guard<std::mutex> g(applyLock_);
+  std::vector<std::pair<LogID, uint64_t>> waiters;
+  {
+    std::lock_guard<std::mutex> wg(readWaitersLock_);
+    for (const auto& waiter : readWaiters_) {
+      waiters.emplace_back(waiter.first);
+    }
+  }
+  for (const auto& waiter : waiters) {
+    expireReadWaiter(waiter.first, waiter.second, nebula::cpp2::ErrorCode::E_RAFT_STOPPED);
+  }
+}
+
+void Part::cleanWal() {
+  std::lock_guard<std::mutex> g(raftLock_);
+  // The logs not applied yet, or not persisted by the engine, are still needed when restarted
+  wal()->cleanWAL(std::min(
+      {committedLogId_, appliedLogId_.load(), engine_->persistedCommitLogId(partId_)}));
+}
+
+folly::Future<nebula::cpp2::ErrorCode> Part::syncReadIndex() {
+  return readIndex().thenValue(
+      [self = std::dynamic_pointer_cast<Part>(shared_from_this())](
+          ErrorOr<nebula::cpp2::ErrorCode, LogID>&& ret) {
+        if (!ok(ret)) {
+          return folly::makeFuture(error(ret));
+        }
+        return self->waitApplied(value(ret));
+      });
+}
+
+folly::Future<nebula::cpp2::ErrorCode> Part::waitApplied(LogID logId) {
+  if (appliedLogId_ >= logId) {
+    return folly::makeFuture(nebula::cpp2::ErrorCode::SUCCEEDED);
+  }
+  folly::Promise<nebula::cpp2::ErrorCode> promise;
+  auto future = promise.getSemiFuture();
+  uint64_t id = 0;
+  {
+    std::lock_guard<std::mutex> g(readWaitersLock_);
+    // Check again, the applier moves appliedLogId_ forward before notifying the waiters
+    if (appliedLogId_ >= logId) {
+      return folly::makeFuture(nebula::cpp2::ErrorCode::SUCCEEDED);
+    }
+    id = nextReadWaiterId_++;
+    readWaiters_.emplace(std::make_pair(logId, id), std::move(promise));
+  }
+  bgWorkers_->addDelayTask(FLAGS_follower_read_timeout_ms,
+                           [self = std::dynamic_pointer_cast<Part>(shared_from_this()), logId, id] {
+                             self->expireReadWaiter(
+                                 logId, id, nebula::cpp2::ErrorCode::E_LEADER_CHANGED);
+                           });
+  return std::move(future).via(ioThreadPool_.get());
+}
+
+void Part::notifyReadWaiters() {
+  std::vector<folly::Promise<nebula::cpp2::ErrorCode>> ready;
+  {
+    std::lock_guard<std::mutex> g(readWaitersLock_);
+    auto end = readWaiters_.upper_bound(
+        std::make_pair(appliedLogId_.load(), std::numeric_limits<uint64_t>::max()));
+    for (auto iter = readWaiters_.begin(); iter != end;) {
+      ready.emplace_back(std::move(iter->second));
+      iter = readWaiters_.erase(iter);
+    }
+  }
+  for (auto& promise : ready) {
+    promise.setValue(nebula::cpp2::ErrorCode::SUCCEEDED);
+  }
+}
+
+void Part::expireReadWaiter(LogID logId, uint64_t id, nebula::cpp2::ErrorCode code) {
+  folly::Promise<nebula::cpp2::ErrorCode> promise;
+  {
+    std::lock_guard<std::mutex> g(readWaitersLock_);
+    auto iter = readWaiters_.find(std::make_pair(logId, id));
+    if (iter == readWaiters_.end()) {
+      return;
+    }
+    promise = std::move(iter->second);
+    readWaiters_.erase(iter);
+  }
+  VLOG(3) << idStr_ << "Applied log " << appliedLogId_ << " falls behind read index " << logId;
+  promise.setValue(code);
+}
+
 void Part::asyncPut(folly::StringPiece key, folly::StringPiece value, KVCallback cb) {
   std::string log = encodeMultiValues(OP_PUT, key, value);
 
@@ -213,14 +317,170 @@ void Part::onDiscoverNewLeader(HostAddr nLeader) {
 
 std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> Part::commitLogs(
     std::unique_ptr<LogIterator> iter, bool wait, bool needLock) {
-  // We should apply any membership change which happens before start time. Because when we start
-  // up, the peers comes from meta, has already contains all previous changes.
+  if (FLAGS_raft_async_apply && !wait) {
+    return asyncCommitLogs(std::move(iter), needLock);
+  }
+  return syncCommitLogs(std::move(iter), wait, needLock);
+}
+
+std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> Part::syncCommitLogs(
+    std::unique_ptr<LogIterator> iter, bool wait, bool needLock) {
+  MembershipChanges changes;
+  std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> ret;
+  {
+    std::lock_guard<std::mutex> g(applyLock_);
+    std::vector<std::unique_ptr<LogIterator>> iters;
+    if (iter->valid()) {
+      // The logs committed asynchronously before must be applied at first, they are coalesced
+      // into the same batch
+      auto pendingTo = std::min(applyTarget_.load(), iter->logId() - 1);
+      if (appliedLogId_ < pendingTo) {
+        iters.emplace_back(wal()->iterator(appliedLogId_ + 1, pendingTo));
+      }
+    }
+    iters.emplace_back(std::move(iter));
+    ret = applyLogs(std::move(iters), wait, &changes);
+  }
+  // The leader acquires raftLock_ for membership changes, which is never acquired with
+  // applyLock_ held. The failed logs are committed again later, so are the changes.
+  if (std::get<0>(ret) == nebula::cpp2::ErrorCode::SUCCEEDED) {
+    applyMembershipChanges(changes, needLock);
+  }
+  return ret;
+}
+
+void Part::applyMembershipChanges(const MembershipChanges& changes, bool needLock) {
+  for (const auto& change : changes) {
+    if (change.first == OP_TRANS_LEADER) {
+      commitTransLeader(change.second, needLock);
+    } else if (change.first == OP_REMOVE_PEER) {
+      commitRemovePeer(change.second, needLock);
+    }
+  }
+}
+
+std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> Part::asyncCommitLogs(
+    std::unique_ptr<LogIterator> iter, bool needLock) {
+  if (applyTarget_ - appliedLogId_ > kMaxPendingApplyBatches * FLAGS_raft_apply_batch_logs) {
+    // The applier falls behind too much, delay the commit like a write stall
+    scheduleApply(0);
+    return {nebula::cpp2::ErrorCode::E_WRITE_STALLED, kNoCommitLogId, kNoCommitLogTerm};
+  }
+  // Only peek the logs here, they are decoded when applied
+  LogID firstId = kNoCommitLogId;
+  LogID lastId = kNoCommitLogId;
+  TermID lastTerm = kNoCommitLogTerm;
+  bool membershipChange = false;
+  while (iter->valid()) {
+    if (firstId == kNoCommitLogId) {
+      firstId = iter->logId();
+    }
+    lastId = iter->logId();
+    lastTerm = iter->logTerm();
+    auto log = iter->logMsg();
+    if (log.size() > sizeof(int64_t) &&
+        (log[sizeof(int64_t)] == OP_TRANS_LEADER || log[sizeof(int64_t)] == OP_REMOVE_PEER)) {
+      membershipChange = true;
+    }
+    ++(*iter);
+  }
+  if (lastId == kNoCommitLogId) {
+    return {nebula::cpp2::ErrorCode::SUCCEEDED, lastId, lastTerm};
+  }
+  if (membershipChange) {
+    // Membership changes must take effect in order with raftLock_ held, apply them synchronously
+    return syncCommitLogs(wal()->iterator(firstId, lastId), false, needLock);
+  }
+  applyTarget_ = lastId;
+  scheduleApply(0);
+  return {nebula::cpp2::ErrorCode::SUCCEEDED, lastId, lastTerm};
+}
+
+void Part::scheduleApply(size_t delayMs) {
+  if (applyScheduled_.exchange(true)) {
+    return;
+  }
+  auto task = [self = std::dynamic_pointer_cast<Part>(shared_from_this())] {
+    self->applyCommittedLogs();
+  };
+  if (delayMs == 0) {
+    bgWorkers_->addTask(std::move(task));
+  } else {
+    bgWorkers_->addDelayTask(delayMs, std::move(task));
+  }
+}
+
+void Part::applyCommittedLogs() {
+  std::lock_guard<std::mutex> g(applyLock_);
+  // Clear the flag before reading the target, a target raised later will schedule another round
+  applyScheduled_ = false;
+  while (!applyStopped_ && appliedLogId_ < applyTarget_) {
+    auto from = appliedLogId_ + 1;
+    auto to = std::min(applyTarget_.load(), from + FLAGS_raft_apply_batch_logs - 1);
+    std::vector<std::unique_ptr<LogIterator>> iters;
+    iters.emplace_back(wal()->iterator(from, to));
+    // There is no membership change in logs committed asynchronously
+    MembershipChanges changes;
+    auto [code, lastId, lastTerm] = applyLogs(std::move(iters), false, &changes);
+    UNUSED(lastTerm);
+    DCHECK(changes.empty());
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED || lastId != to) {
+      VLOG(3) << idStr_ << "Failed to apply logs " << from << " to " << to << ", error "
+              << apache::thrift::util::enumNameSafe(code) << ", retry later";
+      scheduleApply(kApplyRetryIntervalMs);
+      return;
+    }
+    stats::StatsManager::addValue(kNumAsyncApplyBatch);
+  }
+}
+
+std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> Part::applyLogs(
+    std::vector<std::unique_ptr<LogIterator>> iters, bool wait, MembershipChanges* changes) {
   SCOPED_TIMER([](uint64_t elapsedTime) {
     stats::StatsManager::addValue(kCommitLogLatencyUs, elapsedTime);
   });
   auto batch = engine_->startBatchWrite();
   LogID lastId = kNoCommitLogId;
   TermID lastTerm = kNoCommitLogTerm;
+  for (auto& iter : iters) {
+    auto [code, logId, logTerm] = decodeLogs(iter.get(), batch.get(), changes);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return {code, kNoCommitLogId, kNoCommitLogTerm};
+    }
+    if (logId != kNoCommitLogId) {
+      lastId = logId;
+      lastTerm = logTerm;
+    }
+  }
+
+  if (lastId >= 0) {
+    auto code = putCommitMsg(batch.get(), lastId, lastTerm);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      VLOG(3) << idStr_ << "Put commit id into batch failed";
+      return {code, kNoCommitLogId, kNoCommitLogTerm};
+    }
+  }
+
+  auto code = engine_->commitBatchWrite(
+      std::move(batch), FLAGS_rocksdb_disable_wal, FLAGS_rocksdb_wal_sync, wait);
+  if (code == nebula::cpp2::ErrorCode::SUCCEEDED) {
+    if (lastId >= 0) {
+      appliedLogId_ = lastId;
+      notifyReadWaiters();
+    }
+    return {code, lastId, lastTerm};
+  } else {
+    return {code, kNoCommitLogId, kNoCommitLogTerm};
+  }
+}
+
+std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> Part::decodeLogs(LogIterator* iter,
+                                                                    WriteBatch* batch,
+                                                                    MembershipChanges* changes) {
+  // We should apply any membership change which happens before start time. Because when we start
+  // up, the peers comes from meta, has already contains all previous changes.
+  LogID lastId = kNoCommitLogId;
+  TermID lastTerm = kNoCommitLogTerm;
   while (iter->valid()) {
     lastId = iter->logId();
     lastTerm = iter->logTerm();
@@ -316,7 +576,7 @@ std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> Part::commitLogs(
         auto newLeader = decodeHost(OP_TRANS_LEADER, log);
         auto ts = getTimestamp(log);
         if (ts > startTimeMs_) {
-          commitTransLeader(newLeader, needLock);
+          changes->emplace_back(OP_TRANS_LEADER, newLeader);
         } else {
           VLOG(2) << idStr_ << "Skip commit stale transfer leader " << newLeader
                   << ", the part is opened at " << startTimeMs_ << ", but the log timestamp is "
@@ -328,7 +588,7 @@ std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> Part::commitLogs(
         auto peer = decodeHost(OP_REMOVE_PEER, log);
         auto ts = getTimestamp(log);
         if (ts > startTimeMs_) {
-          commitRemovePeer(peer, needLock);
+          changes->emplace_back(OP_REMOVE_PEER, peer);
         } else {
           VLOG(2) << idStr_ << "Skip commit stale remove peer " << peer
                   << ", the part is opened at " << startTimeMs_ << ", but the log timestamp is "
@@ -344,22 +604,7 @@ std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> Part::commitLogs(
 
     ++(*iter);
   }
-
-  if (lastId >= 0) {
-    auto code = putCommitMsg(batch.get(), lastId, lastTerm);
-    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
-      VLOG(3) << idStr_ << "Put commit id into batch failed";
-      return {code, kNoCommitLogId, kNoCommitLogTerm};
-    }
-  }
-
-  auto code = engine_->commitBatchWrite(
-      std::move(batch), FLAGS_rocksdb_disable_wal, FLAGS_rocksdb_wal_sync, wait);
-  if (code == nebula::cpp2::ErrorCode::SUCCEEDED) {
-    return {code, lastId, lastTerm};
-  } else {
-    return {code, kNoCommitLogId, kNoCommitLogTerm};
-  }
+  return {nebula::cpp2::ErrorCode::SUCCEEDED, lastId, lastTerm};
 }
 
 std::tuple<nebula::cpp2::ErrorCode, int64_t, int64_t> Part::commitSnapshot(
@@ -396,6 +641,12 @@ std::tuple<nebula::cpp2::ErrorCode, int64_t, int64_t> Part::commitSnapshot(
   if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
     return {code, kNoSnapshotCount, kNoSnapshotSize};
   }
+  if (finished) {
+    std::lock_guard<std::mutex> g(applyLock_);
+    appliedLogId_ = committedLogId;
+    applyTarget_ = committedLogId;
+    notifyReadWaiters();
+  }
   return {code, count, size};
 }
 
@@ -488,6 +739,22 @@ bool Part::preProcessLog(LogID logId, TermID termId, ClusterID clusterId, const
 
 nebula::cpp2::ErrorCode Part::cleanup() {
   LOG(INFO) << idStr_ << "Clean rocksdb part data";
+  {
+    // Wait for the logs being applied, and drop the ones waiting since the wal has been reset
+    std::lock_guard<std::mutex> g(applyLock_);
+    appliedLogId_ = 0;
+    applyTarget_ = 0;
+  }
+  // Drop all data at once if the engine stores each part separately
+  auto code = engine_->dropPartData(partId_);
+  if (code == nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return engine_->remove(NebulaKeyUtils::systemCommitKey(partId_));
+  } else if (code != nebula::cpp2::ErrorCode::E_UNSUPPORTED) {
+    VLOG(3) << idStr_ << "Failed to drop part data, error "
+            << apache::thrift::util::enumNameSafe(code);
+    return code;
+  }
+
   auto batch = engine_->startBatchWrite();
   // Remove the vertex, edge, index, systemCommitKey, operation data under the part
 
@@ -10,10 +10,14 @@
 #include "common/utils/NebulaKeyUtils.h"
 #include "kvstore/Common.h"
 #include "kvstore/KVEngine.h"
+#include "kvstore/LogEncoder.h"
 #include "kvstore/raftex/SnapshotManager.h"
 #include "kvstore/wal/FileBasedWal.h"
 #include "raftex/RaftPart.h"
 
+DECLARE_bool(raft_async_apply);
+DECLARE_int32(follower_read_timeout_ms);
+
 namespace nebula {
 namespace kvstore {
 
@@ -66,6 +70,34 @@ class Part : public raftex::RaftPart {
     return engine_;
   }
 
+  /**
+   * @brief Stop the raft part and wait for the logs being applied
+   */
+  void stop() override;
+
+  /**
+   * @brief Clean wal before the last log applied into engine
+   */
+  void cleanWal() override;
+
+  /**
+   * @brief Return the last log applied into engine, it may fall behind the committed log id when
+   * raft_async_apply is on
+   */
+  LogID appliedLogId() const {
+    return appliedLogId_.load();
+  }
+
+  /**
+   * @brief Fetch the read index from leader, the future is fulfilled once the logs up to it have
+   * been applied, after which reads on this replica are linearizable. No thread is blocked while
+   * waiting, it is called once per read request of each part, see BaseProcessor::syncReadIndex
+   *
+   * @return folly::Future<nebula::cpp2::ErrorCode> SUCCEEDED if caught up within
+   * follower_read_timeout_ms, otherwise the replica could not serve the read
+   */
+  folly::Future<nebula::cpp2::ErrorCode> syncReadIndex();
+
   /**
    * @brief Write single key/values to kvstore asynchronously
    *
@@ -207,6 +239,9 @@ class Part : public raftex::RaftPart {
   }
 
  private:
+  // The transfer leader and remove peer operations decoded from logs, with the target host
+  using MembershipChanges = std::vector<std::pair<LogType, HostAddr>>;
+
   /**
    * Methods inherited from RaftPart
    */
@@ -262,6 +297,72 @@ class Part : public raftex::RaftPart {
                                                                 bool wait,
                                                                 bool needLock) override;
 
+  /**
+   * @brief Apply the logs synchronously, the logs committed asynchronously before will be applied
+   * in the same write batch at first
+   */
+  std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> syncCommitLogs(
+      std::unique_ptr<LogIterator> iter, bool wait, bool needLock);
+
+  /**
+   * @brief Hand the committed logs to the background applier and return immediately, used by
+   * follower when raft_async_apply is on
+   */
+  std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> asyncCommitLogs(
+      std::unique_ptr<LogIterator> iter, bool needLock);
+
+  /**
+   * @brief Decode the logs and apply them into one write batch, then commit the batch to engine
+   *
+   * @return std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> The last log id and term applied
+   */
+  std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> applyLogs(
+      std::vector<std::unique_ptr<LogIterator>> iters, bool wait, MembershipChanges* changes);
+
+  /**
+   * @brief Decode the logs in iterator into write batch, the membership changes are collected
+   * into changes, which are applied after applyLock_ is released
+   *
+   * @return std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> The last log id and term decoded
+   */
+  std::tuple<nebula::cpp2::ErrorCode, LogID, TermID> decodeLogs(LogIterator* iter,
+                                                                WriteBatch* batch,
+                                                                MembershipChanges* changes);
+
+  /**
+   * @brief Apply the membership changes decoded from logs, which may acquire raftLock_, so they
+   * must never be applied with applyLock_ held
+   */
+  void applyMembershipChanges(const MembershipChanges& changes, bool needLock);
+
+  /**
+   * @brief Return a future fulfilled once the log has been applied, or failed after
+   * follower_read_timeout_ms
+   */
+  folly::Future<nebula::cpp2::ErrorCode> waitApplied(LogID logId);
+
+  /**
+   * @brief Fulfill the waiters whose log has been applied, the continuations of waiters run on
+   * the io threads rather than inline
+   */
+  void notifyReadWaiters();
+
+  /**
+   * @brief Fail the waiter if it is still waiting
+   */
+  void expireReadWaiter(LogID logId, uint64_t id, nebula::cpp2::ErrorCode code);
+
+  /**
+   * @brief Schedule a round of background apply if there is none
+   */
+  void scheduleApply(size_t delayMs);
+
+  /**
+   * @brief Apply the logs committed asynchronously, many raft batches are coalesced into one
+   * write batch
+   */
+  void applyCommittedLogs();
+
   /**
    * @brief Some special log need to be pre-processed when appending to wal
    *
@@ -343,6 +444,21 @@ class Part : public raftex::RaftPart {
  private:
   KVEngine* engine_ = nullptr;
   int32_t vIdLen_;
+
+  // Guard the apply of logs into engine. When both are needed, raftLock_ is acquired before it,
+  // never acquire raftLock_ when holding it
+  std::mutex applyLock_;
+  // The last log applied into engine
+  std::atomic<LogID> appliedLogId_{0};
+  // The reads waiting for the log to be applied, keyed by the log id and the id of waiter
+  std::map<std::pair<LogID, uint64_t>, folly::Promise<nebula::cpp2::ErrorCode>> readWaiters_;
+  uint64_t nextReadWaiterId_{0};
+  std::mutex readWaitersLock_;
+  // The last log committed asynchronously, logs in (appliedLogId_, applyTarget_] are waiting to be
+  // applied
+  std::atomic<LogID> applyTarget_{0};
+  std::atomic<bool> applyScheduled_{false};
+  std::atomic<bool> applyStopped_{false};
 };
 
 }  // namespace kvstore
@@ -7,6 +7,7 @@
 
 #include <folly/String.h>
 #include <rocksdb/convenience.h>
+#include <rocksdb/sst_file_reader.h>
 
 #include "common/base/Base.h"
 #include "common/fs/FileUtils.h"
@@ -25,6 +26,38 @@ namespace kvstore {
 using fs::FileType;
 using fs::FileUtils;
 
+namespace {
+
+constexpr folly::StringPiece kPartCfPrefix = "part_";
+constexpr size_t kIngestBatchSize = 1024;
+
+std::string partCfName(PartitionID partId) {
+  return folly::stringPrintf("%s%d", kPartCfPrefix.data(), partId);
+}
+
+// Return 0 if the column family does not belong to any part
+PartitionID partOfCfName(folly::StringPiece name) {
+  if (!name.startsWith(kPartCfPrefix)) {
+    return 0;
+  }
+  return folly::tryTo<PartitionID>(name.subpiece(kPartCfPrefix.size())).value_or(0);
+}
+
+// The handle is destroyed when no one holds it, so a dropped column family is still readable by
+// the readers which got the handle before
+std::shared_ptr<rocksdb::ColumnFamilyHandle> wrapHandle(rocksdb::DB* db,
+                                                        rocksdb::ColumnFamilyHandle* handle) {
+  return std::shared_ptr<rocksdb::ColumnFamilyHandle>(
+      handle, [db](rocksdb::ColumnFamilyHandle* h) { db->DestroyColumnFamilyHandle(h); });
+}
+
+rocksdb::ColumnFamilyHandle* rawHandle(rocksdb::DB* db,
+                                       const std::shared_ptr<rocksdb::ColumnFamilyHandle>& cf) {
+  return cf ? cf.get() : db->DefaultColumnFamily();
+}
+
+}  // namespace
+
 /***************************************
  *
  * Implementation of RocksEngine
@@ -73,13 +106,43 @@ RocksEngine::RocksEngine(GraphSpaceID spaceId,
   if (cfFactory != nullptr) {
     options.compaction_filter_factory = cfFactory;
   }
+  cfOptions_ = rocksdb::ColumnFamilyOptions(options);
 
+  // All existing column families must be opened, parts may have their own ones
+  std::vector<std::string> cfNames;
+  bool newDb = !rocksdb::DB::ListColumnFamilies(options, path, &cfNames).ok();
+  if (newDb) {
+    cfNames = {rocksdb::kDefaultColumnFamilyName};
+  }
+  std::vector<rocksdb::ColumnFamilyDescriptor> cfDescs;
+  for (const auto& name : cfNames) {
+    cfDescs.emplace_back(name, cfOptions_);
+  }
+  std::vector<rocksdb::ColumnFamilyHandle*> cfHandles;
   if (readonly) {
-    status = rocksdb::DB::OpenForReadOnly(options, path, &db);
+    status = rocksdb::DB::OpenForReadOnly(options, path, cfDescs, &cfHandles, &db);
   } else {
-    status = rocksdb::DB::Open(options, path, &db);
+    status = rocksdb::DB::Open(options, path, cfDescs, &cfHandles, &db);
   }
   CHECK(status.ok()) << status.ToString();
+  for (size_t i = 0; i < cfNames.size(); i++) {
+    auto partId = partOfCfName(cfNames[i]);
+    if (partId == 0) {
+      // we always access the default column family by DefaultColumnFamily()
+      db->DestroyColumnFamilyHandle(cfHandles[i]);
+      continue;
+    }
+    partCfs_.emplace(partId, wrapHandle(db, cfHandles[i]));
+  }
+  // The layout is decided when the data path is created: a data path with part column families
+  // keeps using them, while an existing data path without them is never converted
+  partColumnFamily_ = spaceId_ != kDefaultSpaceId &&
+                      (!partCfs_.empty() || (newDb && FLAGS_rocksdb_part_column_family));
+  if (FLAGS_rocksdb_part_column_family && !partColumnFamily_ && spaceId_ != kDefaultSpaceId) {
+    LOG(INFO) << "Data path " << path << " is not created with column family per part, "
+              << "keep storing all parts in the default column family";
+  }
+
   if (!readonly && spaceId_ != kDefaultSpaceId /* only for storage*/) {
     rocksdb::ReadOptions readOptions;
     std::string dataVersionValue = "";
@@ -108,6 +171,10 @@ void RocksEngine::stop() {
 }
 
 std::unique_ptr<WriteBatch> RocksEngine::startBatchWrite() {
+  if (partColumnFamily_) {
+    return std::make_unique<RocksWriteBatch>(
+        [this](folly::StringPiece key) { return writeColumnFamily(key); });
+  }
   return std::make_unique<RocksWriteBatch>();
 }
 
@@ -137,7 +204,8 @@ nebula::cpp2::ErrorCode RocksEngine::get(const std::string& key,
   if (UNLIKELY(snapshot != nullptr)) {
     options.snapshot = reinterpret_cast<const rocksdb::Snapshot*>(snapshot);
   }
-  rocksdb::Status status = db_->Get(options, rocksdb::Slice(key), value);
+  auto cf = columnFamily(key);
+  rocksdb::Status status = db_->Get(options, rawHandle(db_.get(), cf), rocksdb::Slice(key), value);
   if (status.ok()) {
     return nebula::cpp2::ErrorCode::SUCCEEDED;
   } else if (status.IsNotFound()) {
@@ -153,11 +221,15 @@ std::vector<Status> RocksEngine::multiGet(const std::vector<std::string>& keys,
                                           std::vector<std::string>* values) {
   rocksdb::ReadOptions options;
   std::vector<rocksdb::Slice> slices;
+  std::vector<std::shared_ptr<rocksdb::ColumnFamilyHandle>> cfs;
+  std::vector<rocksdb::ColumnFamilyHandle*> handles;
   for (size_t index = 0; index < keys.size(); index++) {
     slices.emplace_back(keys[index]);
+    cfs.emplace_back(columnFamily(keys[index]));
+    handles.emplace_back(rawHandle(db_.get(), cfs.back()));
   }
 
-  auto status = db_->MultiGet(options, slices, values);
+  auto status = db_->MultiGet(options, handles, slices, values);
   std::vector<Status> ret;
   std::transform(status.begin(), status.end(), std::back_inserter(ret), [](const auto& s) {
     if (s.ok()) {
@@ -176,11 +248,14 @@ nebula::cpp2::ErrorCode RocksEngine::range(const std::string& start,
                                            std::unique_ptr<KVIterator>* storageIter) {
   rocksdb::ReadOptions options;
   options.total_order_seek = FLAGS_enable_rocksdb_prefix_filtering;
-  rocksdb::Iterator* iter = db_->NewIterator(options);
+  auto upperBound = std::make_unique<rocksdb::Slice>(end);
+  options.iterate_upper_bound = upperBound.get();
+  auto cf = columnFamily(start);
+  rocksdb::Iterator* iter = db_->NewIterator(options, rawHandle(db_.get(), cf));
   if (iter) {
     iter->Seek(rocksdb::Slice(start));
   }
-  storageIter->reset(new RocksRangeIter(iter, start, end));
+  storageIter->reset(new RocksRangeIter(iter, start, std::move(upperBound)));
   return nebula::cpp2::ErrorCode::SUCCEEDED;
 }
 
@@ -204,7 +279,8 @@ nebula::cpp2::ErrorCode RocksEngine::prefixWithExtractor(const std::string& pref
     options.snapshot = reinterpret_cast<const rocksdb::Snapshot*>(snapshot);
   }
   options.prefix_same_as_start = true;
-  rocksdb::Iterator* iter = db_->NewIterator(options);
+  auto cf = columnFamily(prefix);
+  rocksdb::Iterator* iter = db_->NewIterator(options, rawHandle(db_.get(), cf));
   if (iter) {
     iter->Seek(rocksdb::Slice(prefix));
   }
@@ -220,7 +296,8 @@ nebula::cpp2::ErrorCode RocksEngine::prefixWithoutExtractor(
   }
   // prefix_same_as_start is false by default
   options.total_order_seek = FLAGS_enable_rocksdb_prefix_filtering;
-  rocksdb::Iterator* iter = db_->NewIterator(options);
+  auto cf = columnFamily(prefix);
+  rocksdb::Iterator* iter = db_->NewIterator(options, rawHandle(db_.get(), cf));
   if (iter) {
     iter->Seek(rocksdb::Slice(prefix));
   }
@@ -234,7 +311,8 @@ nebula::cpp2::ErrorCode RocksEngine::rangeWithPrefix(const std::string& start,
   rocksdb::ReadOptions options;
   // prefix_same_as_start is false by default
   options.total_order_seek = FLAGS_enable_rocksdb_prefix_filtering;
-  rocksdb::Iterator* iter = db_->NewIterator(options);
+  auto cf = columnFamily(prefix);
+  rocksdb::Iterator* iter = db_->NewIterator(options, rawHandle(db_.get(), cf));
   if (iter) {
     iter->Seek(rocksdb::Slice(start));
   }
@@ -245,6 +323,25 @@ nebula::cpp2::ErrorCode RocksEngine::rangeWithPrefix(const std::string& start,
 nebula::cpp2::ErrorCode RocksEngine::scan(std::unique_ptr<KVIterator>* storageIter) {
   rocksdb::ReadOptions options;
   options.total_order_seek = true;
+  if (partColumnFamily_) {
+    auto cfs = partColumnFamilies();
+    std::vector<rocksdb::ColumnFamilyHandle*> handles{db_->DefaultColumnFamily()};
+    for (const auto& cf : cfs) {
+      handles.emplace_back(cf.get());
+    }
+    std::vector<rocksdb::Iterator*> rawIters;
+    auto status = db_->NewIterators(options, handles, &rawIters);
+    if (!status.ok()) {
+      VLOG(4) << "Scan Failed: " << status.ToString();
+      return nebula::cpp2::ErrorCode::E_UNKNOWN;
+    }
+    std::vector<std::unique_ptr<rocksdb::Iterator>> iters;
+    for (auto* iter : rawIters) {
+      iters.emplace_back(iter);
+    }
+    storageIter->reset(new RocksChainIter(std::move(iters)));
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
   rocksdb::Iterator* iter = db_->NewIterator(options);
   iter->SeekToFirst();
   storageIter->reset(new RocksCommonIter(iter));
@@ -254,7 +351,12 @@ nebula::cpp2::ErrorCode RocksEngine::scan(std::unique_ptr<KVIterator>* storageIt
 nebula::cpp2::ErrorCode RocksEngine::put(std::string key, std::string value) {
   rocksdb::WriteOptions options;
   options.disableWAL = FLAGS_rocksdb_disable_wal;
-  rocksdb::Status status = db_->Put(options, key, value);
+  auto ret = writeColumnFamily(key);
+  if (!ok(ret)) {
+    return error(ret);
+  }
+  auto cf = nebula::value(ret);
+  rocksdb::Status status = db_->Put(options, rawHandle(db_.get(), cf), key, value);
   if (status.ok()) {
     return nebula::cpp2::ErrorCode::SUCCEEDED;
   } else {
@@ -266,7 +368,12 @@ nebula::cpp2::ErrorCode RocksEngine::put(std::string key, std::string value) {
 nebula::cpp2::ErrorCode RocksEngine::multiPut(std::vector<KV> keyValues) {
   rocksdb::WriteBatch updates(FLAGS_rocksdb_batch_size);
   for (size_t i = 0; i < keyValues.size(); i++) {
-    updates.Put(keyValues[i].first, keyValues[i].second);
+    auto ret = writeColumnFamily(keyValues[i].first);
+    if (!ok(ret)) {
+      return error(ret);
+    }
+    auto cf = value(ret);
+    updates.Put(rawHandle(db_.get(), cf), keyValues[i].first, keyValues[i].second);
   }
   rocksdb::WriteOptions options;
   options.disableWAL = FLAGS_rocksdb_disable_wal;
@@ -282,7 +389,8 @@ nebula::cpp2::ErrorCode RocksEngine::multiPut(std::vector<KV> keyValues) {
 nebula::cpp2::ErrorCode RocksEngine::remove(const std::string& key) {
   rocksdb::WriteOptions options;
   options.disableWAL = FLAGS_rocksdb_disable_wal;
-  auto status = db_->Delete(options, key);
+  auto cf = columnFamily(key);
+  auto status = db_->Delete(options, rawHandle(db_.get(), cf), key);
   if (status.ok()) {
     return nebula::cpp2::ErrorCode::SUCCEEDED;
   } else {
@@ -294,7 +402,8 @@ nebula::cpp2::ErrorCode RocksEngine::remove(const std::string& key) {
 nebula::cpp2::ErrorCode RocksEngine::multiRemove(std::vector<std::string> keys) {
   rocksdb::WriteBatch deletes(FLAGS_rocksdb_batch_size);
   for (size_t i = 0; i < keys.size(); i++) {
-    deletes.Delete(keys[i]);
+    auto cf = columnFamily(keys[i]);
+    deletes.Delete(rawHandle(db_.get(), cf), keys[i]);
   }
   rocksdb::WriteOptions options;
   options.disableWAL = FLAGS_rocksdb_disable_wal;
@@ -310,7 +419,8 @@ nebula::cpp2::ErrorCode RocksEngine::multiRemove(std::vector<std::string> keys)
 nebula::cpp2::ErrorCode RocksEngine::removeRange(const std::string& start, const std::string& end) {
   rocksdb::WriteOptions options;
   options.disableWAL = FLAGS_rocksdb_disable_wal;
-  auto status = db_->DeleteRange(options, db_->DefaultColumnFamily(), start, end);
+  auto cf = columnFamily(start);
+  auto status = db_->DeleteRange(options, rawHandle(db_.get(), cf), start, end);
   if (status.ok()) {
     return nebula::cpp2::ErrorCode::SUCCEEDED;
   } else {
@@ -381,6 +491,104 @@ void RocksEngine::removePart(PartitionID partId) {
     partsNum_--;
     CHECK_GE(partsNum_, 0);
   }
+  if (partColumnFamily_) {
+    dropPartData(partId);
+  }
+}
+
+nebula::cpp2::ErrorCode RocksEngine::dropPartData(PartitionID partId) {
+  if (!partColumnFamily_) {
+    return nebula::cpp2::ErrorCode::E_UNSUPPORTED;
+  }
+  // Hold the lock until dropped, otherwise a concurrent write may create the column family with
+  // the same name before it is dropped
+  folly::SharedMutex::WriteHolder wh(cfLock_);
+  auto iter = partCfs_.find(partId);
+  if (iter == partCfs_.end()) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  auto status = db_->DropColumnFamily(iter->second.get());
+  if (!status.ok()) {
+    LOG(WARNING) << "Drop column family of part " << partId << " failed: " << status.ToString();
+    return nebula::cpp2::ErrorCode::E_UNKNOWN;
+  }
+  partCfs_.erase(iter);
+  LOG(INFO) << "Column family of space " << spaceId_ << " part " << partId << " has been dropped";
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+PartitionID RocksEngine::cfPartOfKey(folly::StringPiece key) const {
+  if (!partColumnFamily_ || key.size() < sizeof(PartitionID)) {
+    return 0;
+  }
+  auto type = static_cast<NebulaKeyType>(readInt<uint32_t>(key.data(), sizeof(PartitionID)) &
+                                         kTypeMask);
+  switch (type) {
+    case NebulaKeyType::kTag_:
+    case NebulaKeyType::kEdge:
+    case NebulaKeyType::kIndex:
+    case NebulaKeyType::kOperation:
+    case NebulaKeyType::kKeyValue:
+    case NebulaKeyType::kVertex:
+    case NebulaKeyType::kPrime:
+    case NebulaKeyType::kDoublePrime:
+      return NebulaKeyUtils::getPart(key);
+    default:
+      // system keys and data version key are kept in default column family
+      return 0;
+  }
+}
+
+std::shared_ptr<rocksdb::ColumnFamilyHandle> RocksEngine::columnFamily(folly::StringPiece key) {
+  auto partId = cfPartOfKey(key);
+  if (partId == 0) {
+    return nullptr;
+  }
+  folly::SharedMutex::ReadHolder rh(cfLock_);
+  auto iter = partCfs_.find(partId);
+  if (iter != partCfs_.end()) {
+    return iter->second;
+  }
+  // Nothing of the part in the default column family, the read would find nothing
+  return nullptr;
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, std::shared_ptr<rocksdb::ColumnFamilyHandle>>
+RocksEngine::writeColumnFamily(folly::StringPiece key) {
+  auto partId = cfPartOfKey(key);
+  if (partId == 0) {
+    return std::shared_ptr<rocksdb::ColumnFamilyHandle>();
+  }
+  auto existing = columnFamily(key);
+  if (existing != nullptr) {
+    return existing;
+  }
+  folly::SharedMutex::WriteHolder wh(cfLock_);
+  auto iter = partCfs_.find(partId);
+  if (iter != partCfs_.end()) {
+    return iter->second;
+  }
+  rocksdb::ColumnFamilyHandle* handle = nullptr;
+  auto status = db_->CreateColumnFamily(cfOptions_, partCfName(partId), &handle);
+  if (!status.ok()) {
+    LOG(ERROR) << "Create column family of space " << spaceId_ << " part " << partId
+               << " failed, " << status.ToString();
+    return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+  }
+  LOG(INFO) << "Column family of space " << spaceId_ << " part " << partId << " is created";
+  auto cf = wrapHandle(db_.get(), handle);
+  partCfs_.emplace(partId, cf);
+  return cf;
+}
+
+std::vector<std::shared_ptr<rocksdb::ColumnFamilyHandle>> RocksEngine::partColumnFamilies() {
+  std::vector<std::shared_ptr<rocksdb::ColumnFamilyHandle>> cfs;
+  folly::SharedMutex::ReadHolder rh(cfLock_);
+  cfs.reserve(partCfs_.size());
+  for (const auto& entry : partCfs_) {
+    cfs.emplace_back(entry.second);
+  }
+  return cfs;
 }
 
 std::vector<PartitionID> RocksEngine::allParts() {
@@ -438,6 +646,9 @@ int32_t RocksEngine::totalPartsNum() {
 
 nebula::cpp2::ErrorCode RocksEngine::ingest(const std::vector<std::string>& files,
                                             bool verifyFileChecksum) {
+  if (partColumnFamily_) {
+    return ingestIntoPartCfs(files, verifyFileChecksum);
+  }
   rocksdb::IngestExternalFileOptions options;
   options.move_files = FLAGS_move_files;
   options.verify_file_checksum = verifyFileChecksum;
@@ -450,11 +661,59 @@ nebula::cpp2::ErrorCode RocksEngine::ingest(const std::vector<std::string>& file
   }
 }
 
+nebula::cpp2::ErrorCode RocksEngine::ingestIntoPartCfs(const std::vector<std::string>& files,
+                                                       bool verifyFileChecksum) {
+  rocksdb::Options options;
+  for (const auto& file : files) {
+    rocksdb::SstFileReader reader(options);
+    auto status = reader.Open(file);
+    if (status.ok() && verifyFileChecksum) {
+      status = reader.VerifyChecksum();
+    }
+    if (!status.ok()) {
+      LOG(WARNING) << "Ingest Failed: " << status.ToString();
+      return nebula::cpp2::ErrorCode::E_UNKNOWN;
+    }
+    std::unique_ptr<rocksdb::Iterator> iter(reader.NewIterator(rocksdb::ReadOptions()));
+    auto batch = startBatchWrite();
+    size_t count = 0;
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+      auto code = batch->put(folly::StringPiece(iter->key().data(), iter->key().size()),
+                             folly::StringPiece(iter->value().data(), iter->value().size()));
+      if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+        return code;
+      }
+      if (++count % kIngestBatchSize == 0) {
+        code = commitBatchWrite(std::move(batch), FLAGS_rocksdb_disable_wal, false, true);
+        if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+          return code;
+        }
+        batch = startBatchWrite();
+      }
+    }
+    if (!iter->status().ok()) {
+      LOG(WARNING) << "Ingest Failed: " << iter->status().ToString();
+      return nebula::cpp2::ErrorCode::E_UNKNOWN;
+    }
+    auto code = commitBatchWrite(std::move(batch), FLAGS_rocksdb_disable_wal, false, true);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return code;
+    }
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
 nebula::cpp2::ErrorCode RocksEngine::setOption(const std::string& configKey,
                                                const std::string& configValue) {
   std::unordered_map<std::string, std::string> configOptions = {{configKey, configValue}};
 
   rocksdb::Status status = db_->SetOptions(configOptions);
+  for (const auto& cf : partColumnFamilies()) {
+    if (!status.ok()) {
+      break;
+    }
+    status = db_->SetOptions(cf.get(), configOptions);
+  }
   if (status.ok()) {
     LOG(INFO) << "SetOption Succeeded: " << configKey << ":" << configValue;
     return nebula::cpp2::ErrorCode::SUCCEEDED;
@@ -483,9 +742,22 @@ ErrorOr<nebula::cpp2::ErrorCode, std::string> RocksEngine::getProperty(
   std::string value;
   if (!db_->GetProperty(property, &value)) {
     return nebula::cpp2::ErrorCode::E_INVALID_PARM;
-  } else {
-    return value;
   }
+  if (partColumnFamily_) {
+    // Sum up the integer property of all column families
+    uint64_t total = 0;
+    if (!db_->GetIntProperty(property, &total)) {
+      return value;
+    }
+    for (const auto& cf : partColumnFamilies()) {
+      uint64_t num = 0;
+      if (db_->GetIntProperty(cf.get(), property, &num)) {
+        total += num;
+      }
+    }
+    return folly::to<std::string>(total);
+  }
+  return value;
 }
 
 nebula::cpp2::ErrorCode RocksEngine::compact() {
@@ -493,6 +765,13 @@ nebula::cpp2::ErrorCode RocksEngine::compact() {
   options.change_level = FLAGS_rocksdb_compact_change_level;
   options.target_level = FLAGS_rocksdb_compact_target_level;
   rocksdb::Status status = db_->CompactRange(options, nullptr, nullptr);
+  // Each part is compacted separately, so hot parts won't compact the cold ones
+  for (const auto& cf : partColumnFamilies()) {
+    if (!status.ok()) {
+      break;
+    }
+    status = db_->CompactRange(options, cf.get(), nullptr, nullptr);
+  }
   if (status.ok()) {
     return nebula::cpp2::ErrorCode::SUCCEEDED;
   } else {
@@ -503,7 +782,12 @@ nebula::cpp2::ErrorCode RocksEngine::compact() {
 
 nebula::cpp2::ErrorCode RocksEngine::flush() {
   rocksdb::FlushOptions options;
-  rocksdb::Status status = db_->Flush(options);
+  auto cfs = partColumnFamilies();
+  std::vector<rocksdb::ColumnFamilyHandle*> handles{db_->DefaultColumnFamily()};
+  for (const auto& cf : cfs) {
+    handles.emplace_back(cf.get());
+  }
+  rocksdb::Status status = db_->Flush(options, handles);
   if (status.ok()) {
     return nebula::cpp2::ErrorCode::SUCCEEDED;
   } else {
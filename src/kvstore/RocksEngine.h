@@ -6,6 +6,7 @@
 #ifndef KVSTORE_ROCKSENGINE_H_
 #define KVSTORE_ROCKSENGINE_H_
 
+#include <folly/SharedMutex.h>
 #include <gtest/gtest_prod.h>
 #include <rocksdb/db.h>
 #include <rocksdb/utilities/backup_engine.h>
@@ -27,6 +28,15 @@ class RocksRangeIter : public KVIterator {
   RocksRangeIter(rocksdb::Iterator* iter, rocksdb::Slice start, rocksdb::Slice end)
       : iter_(iter), start_(start), end_(end) {}
 
+  /**
+   * @brief The iterator is created with `upperBound` as its iterate_upper_bound, so rocksdb stops
+   * at the end of range instead of reading the keys and tombstones after it
+   */
+  RocksRangeIter(rocksdb::Iterator* iter,
+                 rocksdb::Slice start,
+                 std::unique_ptr<rocksdb::Slice> upperBound)
+      : upperBound_(std::move(upperBound)), iter_(iter), start_(start), end_(*upperBound_) {}
+
   ~RocksRangeIter() = default;
 
   bool valid() const override {
@@ -50,6 +60,8 @@ class RocksRangeIter : public KVIterator {
   }
 
  private:
+  // Must outlive iter_ which refers to it
+  std::unique_ptr<rocksdb::Slice> upperBound_;
   std::unique_ptr<rocksdb::Iterator> iter_;
   rocksdb::Slice start_;
   rocksdb::Slice end_;
@@ -127,17 +139,90 @@ class RocksCommonIter : public KVIterator {
  * Implementation of WriteBatch
  *
  **************************************/
+/**
+ * @brief Iterate the iterators of several column families one after another, keys are only sorted
+ * inside each column family
+ */
+class RocksChainIter : public KVIterator {
+ public:
+  explicit RocksChainIter(std::vector<std::unique_ptr<rocksdb::Iterator>> iters)
+      : iters_(std::move(iters)) {
+    for (auto& iter : iters_) {
+      iter->SeekToFirst();
+    }
+    skipInvalid();
+  }
+
+  ~RocksChainIter() = default;
+
+  bool valid() const override {
+    return curr_ < iters_.size() && iters_[curr_]->Valid();
+  }
+
+  void next() override {
+    iters_[curr_]->Next();
+    skipInvalid();
+  }
+
+  void prev() override {
+    iters_[curr_]->Prev();
+    while (!iters_[curr_]->Valid() && curr_ > 0) {
+      --curr_;
+      iters_[curr_]->SeekToLast();
+    }
+  }
+
+  folly::StringPiece key() const override {
+    return folly::StringPiece(iters_[curr_]->key().data(), iters_[curr_]->key().size());
+  }
+
+  folly::StringPiece val() const override {
+    return folly::StringPiece(iters_[curr_]->value().data(), iters_[curr_]->value().size());
+  }
+
+ private:
+  void skipInvalid() {
+    while (curr_ < iters_.size() && !iters_[curr_]->Valid()) {
+      ++curr_;
+    }
+  }
+
+ private:
+  std::vector<std::unique_ptr<rocksdb::Iterator>> iters_;
+  size_t curr_{0};
+};
+
+/**
+ * @brief Return the column family handle which holds the key, nullptr means the default one, or
+ * the error code if the column family could not be created
+ */
+using ColumnFamilyResolver = std::function<
+    ErrorOr<nebula::cpp2::ErrorCode, std::shared_ptr<rocksdb::ColumnFamilyHandle>>(
+        folly::StringPiece key)>;
+
 class RocksWriteBatch : public WriteBatch {
  private:
   rocksdb::WriteBatch batch_;
+  ColumnFamilyResolver resolver_;
 
  public:
   RocksWriteBatch() : batch_(FLAGS_rocksdb_batch_size) {}
 
+  explicit RocksWriteBatch(ColumnFamilyResolver resolver)
+      : batch_(FLAGS_rocksdb_batch_size), resolver_(std::move(resolver)) {}
+
   virtual ~RocksWriteBatch() = default;
 
   nebula::cpp2::ErrorCode put(folly::StringPiece key, folly::StringPiece value) override {
-    if (batch_.Put(toSlice(key), toSlice(value)).ok()) {
+    auto ret = resolve(key);
+    if (!ok(ret)) {
+      return error(ret);
+    }
+    // The parameter value hides nebula::value
+    auto cf = nebula::value(ret);
+    auto status = cf ? batch_.Put(cf.get(), toSlice(key), toSlice(value))
+                     : batch_.Put(toSlice(key), toSlice(value));
+    if (status.ok()) {
       return nebula::cpp2::ErrorCode::SUCCEEDED;
     } else {
       return nebula::cpp2::ErrorCode::E_UNKNOWN;
@@ -145,7 +230,13 @@ class RocksWriteBatch : public WriteBatch {
   }
 
   nebula::cpp2::ErrorCode remove(folly::StringPiece key) override {
-    if (batch_.Delete(toSlice(key)).ok()) {
+    auto ret = resolve(key);
+    if (!ok(ret)) {
+      return error(ret);
+    }
+    auto cf = value(ret);
+    auto status = cf ? batch_.Delete(cf.get(), toSlice(key)) : batch_.Delete(toSlice(key));
+    if (status.ok()) {
       return nebula::cpp2::ErrorCode::SUCCEEDED;
     } else {
       return nebula::cpp2::ErrorCode::E_UNKNOWN;
@@ -154,7 +245,15 @@ class RocksWriteBatch : public WriteBatch {
 
   // Remove all keys in the range [start, end)
   nebula::cpp2::ErrorCode removeRange(folly::StringPiece start, folly::StringPiece end) override {
-    if (batch_.DeleteRange(toSlice(start), toSlice(end)).ok()) {
+    // A range never crosses parts, so it belongs to the column family of the start key
+    auto ret = resolve(start);
+    if (!ok(ret)) {
+      return error(ret);
+    }
+    auto cf = value(ret);
+    auto status = cf ? batch_.DeleteRange(cf.get(), toSlice(start), toSlice(end))
+                     : batch_.DeleteRange(toSlice(start), toSlice(end));
+    if (status.ok()) {
       return nebula::cpp2::ErrorCode::SUCCEEDED;
     } else {
       return nebula::cpp2::ErrorCode::E_UNKNOWN;
@@ -164,6 +263,15 @@ class RocksWriteBatch : public WriteBatch {
   rocksdb::WriteBatch* data() {
     return &batch_;
   }
+
+ private:
+  ErrorOr<nebula::cpp2::ErrorCode, std::shared_ptr<rocksdb::ColumnFamilyHandle>> resolve(
+      folly::StringPiece key) {
+    if (!resolver_) {
+      return std::shared_ptr<rocksdb::ColumnFamilyHandle>();
+    }
+    return resolver_(key);
+  }
 };
 /**
  * @brief An implementation of KVEngine based on Rocksdb
@@ -193,6 +301,11 @@ class RocksEngine : public KVEngine {
               bool readonly = false);
 
   ~RocksEngine() {
+    {
+      // column family handles must be released before closing the db
+      folly::SharedMutex::WriteHolder wh(cfLock_);
+      partCfs_.clear();
+    }
     LOG(INFO) << "Release rocksdb on " << dataPath_;
   }
 
@@ -416,6 +529,8 @@ class RocksEngine : public KVEngine {
    */
   void removePart(PartitionID partId) override;
 
+  nebula::cpp2::ErrorCode dropPartData(PartitionID partId) override;
+
   /**
    * @brief Return all partitions in rocksdb instance by scanning system part key.
    *
@@ -543,6 +658,45 @@ class RocksEngine : public KVEngine {
    */
   void openBackupEngine(GraphSpaceID spaceId);
 
+  /**
+   * @brief Return the part id of which column family holds the key, 0 if the key is stored in the
+   * default column family, e.g. system keys
+   */
+  PartitionID cfPartOfKey(folly::StringPiece key) const;
+
+  /**
+   * @brief Return the column family handle of the key to read when each part has its own column
+   * family
+   *
+   * @param key Key to be read
+   * @return std::shared_ptr<rocksdb::ColumnFamilyHandle> nullptr means the default column family,
+   * or the column family of the part doesn't exist
+   */
+  std::shared_ptr<rocksdb::ColumnFamilyHandle> columnFamily(folly::StringPiece key);
+
+  /**
+   * @brief Return the column family handle of the key to write, the column family of the part is
+   * created if not exists
+   *
+   * @param key Key to be written
+   * @return ErrorOr<nebula::cpp2::ErrorCode, std::shared_ptr<rocksdb::ColumnFamilyHandle>> nullptr
+   * means the default column family, E_STORE_FAILURE if failed to create the column family
+   */
+  ErrorOr<nebula::cpp2::ErrorCode, std::shared_ptr<rocksdb::ColumnFamilyHandle>>
+  writeColumnFamily(folly::StringPiece key);
+
+  /**
+   * @brief Return the column family handles of all parts, the default one is not included
+   */
+  std::vector<std::shared_ptr<rocksdb::ColumnFamilyHandle>> partColumnFamilies();
+
+  /**
+   * @brief Ingest sst files by writing each key into the column family of its part, because a sst
+   * file could only be ingested into one column family as a whole
+   */
+  nebula::cpp2::ErrorCode ingestIntoPartCfs(const std::vector<std::string>& files,
+                                            bool verifyFileChecksum);
+
  private:
   GraphSpaceID spaceId_;
   std::string dataPath_;
@@ -552,6 +706,13 @@ class RocksEngine : public KVEngine {
   std::unique_ptr<rocksdb::BackupEngine> backupDb_{nullptr};
   int32_t partsNum_ = -1;
   size_t extractorLen_;
+
+  // Whether the data of each part is stored in its own column family
+  bool partColumnFamily_{false};
+  rocksdb::ColumnFamilyOptions cfOptions_;
+  // partId -> column family handle of the part
+  std::unordered_map<PartitionID, std::shared_ptr<rocksdb::ColumnFamilyHandle>> partCfs_;
+  folly::SharedMutex cfLock_;
 };
 
 }  // namespace kvstore
@@ -122,6 +122,11 @@ DEFINE_int32(rocksdb_backup_interval_secs,
              300,
              "Rocksdb backup directory, only used in PlainTable format");
 
+DEFINE_bool(rocksdb_part_column_family,
+            false,
+            "Whether to store the data of each part in its own column family, only takes effect "
+            "on newly created data path of storage");
+
 DEFINE_bool(rocksdb_enable_kv_separation,
             false,
             "Whether or not to enable BlobDB (RocksDB key-value separation support)");
@@ -67,6 +67,9 @@ DECLARE_int32(rocksdb_backup_interval_secs);
 DECLARE_bool(rocksdb_enable_kv_separation);
 DECLARE_uint64(rocksdb_kv_separation_threshold);
 
+// rocksdb column family per part
+DECLARE_bool(rocksdb_part_column_family);
+
 namespace nebula {
 namespace kvstore {
 
@@ -21,6 +21,16 @@ DEFINE_uint32(max_appendlog_batch_size,
               "The max number of logs in each appendLog request batch");
 DEFINE_uint32(max_outstanding_requests, 1024, "The max number of outstanding appendLog requests");
 DEFINE_int32(raft_rpc_timeout_ms, 1000, "rpc timeout for raft client");
+DEFINE_int64(raft_catch_up_log_lag,
+             10000,
+             "Enter catch-up mode when a peer lags behind more than this number of logs, "
+             "0 means disable the catch-up mode");
+DEFINE_uint32(max_concurrent_catch_up_hosts,
+              4,
+              "The max number of peers in catch-up mode at the same time in one process");
+DEFINE_uint64(raft_catch_up_batch_bytes,
+              4 * 1024 * 1024,
+              "The max bytes of logs in each appendLog request batch in catch-up mode");
 
 DECLARE_bool(trace_raft);
 DECLARE_uint32(raft_heartbeat_interval_secs);
@@ -30,6 +40,9 @@ namespace raftex {
 
 using nebula::network::NetworkUtils;
 
+// The number of hosts in catch-up mode of all parts
+static std::atomic<uint32_t> gCatchUpHosts{0};
+
 Host::Host(const HostAddr& addr, std::shared_ptr<RaftPart> part, bool isLearner)
     : part_(std::move(part)),
       addr_(addr),
@@ -151,6 +164,9 @@ folly::Future<cpp2::AppendLogResponse> Host::appendLogs(folly::EventBase* eb,
 
 void Host::setResponse(const cpp2::AppendLogResponse& r) {
   CHECK(!lock_.try_lock());
+  // Only called on errors, leave the catch-up mode so a dead peer won't hold the slot, the next
+  // request takes the slot again if the peer still lags far behind
+  stopCatchUp();
   promise_.setValue(r);
   cachingPromise_.setValue(r);
   cachingPromise_ = folly::SharedPromise<cpp2::AppendLogResponse>();
@@ -207,7 +223,10 @@ void Host::appendLogsInternal(folly::EventBase* eb, std::shared_ptr<cpp2::Append
                 }
               } else {
                 // resp.get_last_matched_log_id() >= self->logIdToSend_
-                // All logs up to logIdToSend_ has been sent, fulfill the promise
+                // All logs up to logIdToSend_ has been sent, the peer has caught up. Release the
+                // catch-up slot, the heartbeats of an idle peer won't check the state again
+                self->stopCatchUp();
+                // Fulfill the promise
                 self->promise_.setValue(resp);
                 // Check if there are any pending request:
                 // Eithor send pending requst if any, or set Host to vacant
@@ -306,15 +325,29 @@ Host::prepareAppendLogRequest() {
     return nebula::cpp2::ErrorCode::E_RAFT_NO_WAL_FOUND;
   }
 
+  size_t maxLogs = FLAGS_max_appendlog_batch_size;
+  size_t maxBytes = std::numeric_limits<size_t>::max();
+  if (updateCatchUpState()) {
+    // Send the rest of the sealed wal file which contains the next log in one batch
+    auto lastIdInFile = part_->wal()->sealedFileLastLogId(lastLogIdSent_ + 1);
+    if (lastIdInFile > lastLogIdSent_) {
+      maxLogs = std::max(maxLogs, static_cast<size_t>(lastIdInFile - lastLogIdSent_));
+      maxBytes = FLAGS_raft_catch_up_batch_bytes;
+      stats::StatsManager::addValue(kNumCatchUpBatch);
+    }
+  }
+
   auto it = part_->wal()->iterator(lastLogIdSent_ + 1, logIdToSend_);
   if (it->valid()) {
     auto req = makeReq();
     std::vector<cpp2::RaftLogEntry> logs;
-    for (size_t cnt = 0; it->valid() && cnt < FLAGS_max_appendlog_batch_size; ++(*it), ++cnt) {
+    size_t bytes = 0;
+    for (size_t cnt = 0; it->valid() && cnt < maxLogs && bytes < maxBytes; ++(*it), ++cnt) {
       cpp2::RaftLogEntry entry;
       entry.cluster_ref() = it->logSource();
       entry.log_str_ref() = it->logMsg().toString();
       entry.log_term_ref() = it->logTerm();
+      bytes += entry.get_log_str().size();
       logs.emplace_back(std::move(entry));
     }
     // the last log entry's id is (lastLogIdSent_ + cnt), when iterator is invalid and last log
@@ -364,6 +397,40 @@ nebula::cpp2::ErrorCode Host::startSendSnapshot() {
   return nebula::cpp2::ErrorCode::E_RAFT_WAITING_SNAPSHOT;
 }
 
+bool Host::updateCatchUpState() {
+  CHECK(!lock_.try_lock());
+  bool lagging = FLAGS_raft_catch_up_log_lag > 0 &&
+                 logIdToSend_ - lastLogIdSent_ > FLAGS_raft_catch_up_log_lag;
+  if (!lagging) {
+    stopCatchUp();
+    return false;
+  }
+  if (!catchingUp_) {
+    if (gCatchUpHosts.fetch_add(1) >= FLAGS_max_concurrent_catch_up_hosts) {
+      // Too many peers are catching up, fall back to normal batches
+      gCatchUpHosts.fetch_sub(1);
+      return false;
+    }
+    catchingUp_ = true;
+    VLOG(1) << idStr_ << "Enter catch-up mode, lastLogIdSent = " << lastLogIdSent_
+            << ", logIdToSend = " << logIdToSend_;
+  }
+  return true;
+}
+
+uint32_t Host::numCatchUpHosts() {
+  return gCatchUpHosts.load();
+}
+
+void Host::stopCatchUp() {
+  if (catchingUp_) {
+    catchingUp_ = false;
+    gCatchUpHosts.fetch_sub(1);
+    VLOG(1) << idStr_ << "Leave catch-up mode, lastLogIdSent = " << lastLogIdSent_
+            << ", logIdToSend = " << logIdToSend_;
+  }
+}
+
 folly::Future<cpp2::AppendLogResponse> Host::sendAppendLogRequest(
     folly::EventBase* eb, std::shared_ptr<cpp2::AppendLogRequest> req) {
   VLOG(4) << idStr_ << "Entering Host::sendAppendLogRequest()";
@@ -45,6 +45,7 @@ class Host final : public std::enable_shared_from_this<Host> {
    * @brief Destroy the Host
    */
   ~Host() {
+    stopCatchUp();
     VLOG(1) << idStr_ << " The host has been destroyed!";
   }
 
@@ -61,6 +62,7 @@ class Host final : public std::enable_shared_from_this<Host> {
   void pause() {
     std::lock_guard<std::mutex> g(lock_);
     paused_ = true;
+    stopCatchUp();
   }
 
   /**
@@ -77,6 +79,7 @@ class Host final : public std::enable_shared_from_this<Host> {
   void stop() {
     std::lock_guard<std::mutex> g(lock_);
     stopped_ = true;
+    stopCatchUp();
   }
 
   /**
@@ -92,6 +95,7 @@ class Host final : public std::enable_shared_from_this<Host> {
     committedLogId_ = 0;
     sendingSnapshot_ = false;
     followerCommittedLogId_ = 0;
+    stopCatchUp();
   }
 
   /**
@@ -113,6 +117,11 @@ class Host final : public std::enable_shared_from_this<Host> {
     isLearner_ = isLearner;
   }
 
+  /**
+   * @brief The number of hosts in catch-up mode of all parts in this process
+   */
+  static uint32_t numCatchUpHosts();
+
   /**
    * @brief Send the leader election rpc to the peer
    *
@@ -204,6 +213,20 @@ class Host final : public std::enable_shared_from_this<Host> {
    */
   nebula::cpp2::ErrorCode startSendSnapshot();
 
+  /**
+   * @brief Check whether the peer lags far behind, and enter or leave the catch-up mode. In
+   * catch-up mode, the rest of a sealed wal file is sent in one batch. The number of hosts in
+   * catch-up mode is bounded by FLAGS_max_concurrent_catch_up_hosts
+   *
+   * @return Whether the host is in catch-up mode
+   */
+  bool updateCatchUpState();
+
+  /**
+   * @brief Leave the catch-up mode and release the slot if any
+   */
+  void stopCatchUp();
+
   /**
    * @brief Return true if there isn't a request in flight
    */
@@ -251,6 +274,8 @@ class Host final : public std::enable_shared_from_this<Host> {
   bool requestOnGoing_{false};
   // whether there is a snapshot for target host in on going
   bool sendingSnapshot_{false};
+  // whether the target host lags far behind and logs are sent in sealed wal file granularity
+  bool catchingUp_{false};
 
   std::condition_variable noMoreRequestCV_;
   folly::SharedPromise<cpp2::AppendLogResponse> promise_;
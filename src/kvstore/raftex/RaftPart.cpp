@@ -35,6 +35,7 @@ DEFINE_uint32(max_batch_size, 256, "The max number of logs in a batch");
 
 DEFINE_bool(trace_raft, false, "Enable trace one raft request");
 
+DECLARE_int32(raft_rpc_timeout_ms);
 DECLARE_int32(wal_ttl);
 DECLARE_int64(wal_file_size);
 DECLARE_int32(wal_buffer_size);
@@ -1212,6 +1213,72 @@ void RaftPart::getState(cpp2::GetStateResponse& resp) {
   resp.peers_ref() = peers;
 }
 
+void RaftPart::processGetReadIndexRequest(const cpp2::GetReadIndexRequest& req,
+                                          cpp2::GetReadIndexResponse& resp) {
+  std::lock_guard<std::mutex> g(raftLock_);
+  resp.term_ref() = term_;
+  if (role_ != Role::LEADER) {
+    VLOG(3) << idStr_ << "Not leader, reject read index request of space " << req.get_space()
+            << ", part " << req.get_part();
+    resp.error_code_ref() = nebula::cpp2::ErrorCode::E_LEADER_CHANGED;
+    return;
+  }
+  // Within the lease no other leader could have committed any log, so our committed log id covers
+  // all writes acknowledged to clients
+  if (!leaseValidInLock()) {
+    resp.error_code_ref() = nebula::cpp2::ErrorCode::E_LEADER_LEASE_FAILED;
+    return;
+  }
+  resp.read_index_ref() = committedLogId_;
+  resp.error_code_ref() = nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+folly::Future<ErrorOr<nebula::cpp2::ErrorCode, LogID>> RaftPart::readIndex() {
+  using Result = ErrorOr<nebula::cpp2::ErrorCode, LogID>;
+  HostAddr leader;
+  {
+    std::lock_guard<std::mutex> g(raftLock_);
+    if (status_ != Status::RUNNING) {
+      return folly::makeFuture<Result>(nebula::cpp2::ErrorCode::E_RAFT_STOPPED);
+    }
+    if (role_ == Role::LEADER) {
+      if (!leaseValidInLock()) {
+        return folly::makeFuture<Result>(nebula::cpp2::ErrorCode::E_LEADER_LEASE_FAILED);
+      }
+      return folly::makeFuture<Result>(committedLogId_);
+    }
+    if (leader_ == HostAddr("", 0)) {
+      return folly::makeFuture<Result>(nebula::cpp2::ErrorCode::E_LEADER_CHANGED);
+    }
+    leader = leader_;
+  }
+
+  cpp2::GetReadIndexRequest req;
+  req.space_ref() = spaceId_;
+  req.part_ref() = partId_;
+  auto* eb = ioThreadPool_->getEventBase();
+  return folly::via(
+             eb,
+             [self = shared_from_this(), eb, leader, req = std::move(req)] {
+               auto client =
+                   self->clientMan_->client(leader, eb, false, FLAGS_raft_rpc_timeout_ms);
+               return client->future_getReadIndex(req);
+             })
+      .thenTry([self = shared_from_this(), leader](
+                   folly::Try<cpp2::GetReadIndexResponse>&& t) -> Result {
+        if (t.hasException()) {
+          VLOG(3) << self->idStr_ << "Get read index from " << leader
+                  << " failed: " << t.exception().what();
+          return nebula::cpp2::ErrorCode::E_RAFT_RPC_EXCEPTION;
+        }
+        auto& resp = t.value();
+        if (resp.get_error_code() != nebula::cpp2::ErrorCode::SUCCEEDED) {
+          return resp.get_error_code();
+        }
+        return resp.get_read_index();
+      });
+}
+
 bool RaftPart::processElectionResponses(const RaftPart::ElectionResponses& results,
                                         std::vector<std::shared_ptr<Host>> hosts,
                                         TermID proposedTerm,
@@ -2250,6 +2317,10 @@ void RaftPart::checkRemoteListeners(const std::set<HostAddr>& expected) {
 
 bool RaftPart::leaseValid() {
   std::lock_guard<std::mutex> g(raftLock_);
+  return leaseValidInLock();
+}
+
+bool RaftPart::leaseValidInLock() {
   if (hosts_.empty()) {
     return true;
   }
@@ -360,11 +360,29 @@ class RaftPart : public std::enable_shared_from_this<RaftPart> {
    */
   void processHeartbeatRequest(const cpp2::HeartbeatRequest& req, cpp2::HeartbeatResponse& resp);
 
+  /**
+   * @brief Process get read index request, only a leader with valid lease returns its committed log
+   * id as read index
+   *
+   * @param req
+   * @param resp
+   */
+  void processGetReadIndexRequest(const cpp2::GetReadIndexRequest& req,
+                                  cpp2::GetReadIndexResponse& resp);
+
   /**
    * @brief Return whether leader lease is still valid
    */
   bool leaseValid();
 
+  /**
+   * @brief Get the read index of current leader. The leader returns its own committed log id, a
+   * follower asks the leader by rpc
+   *
+   * @return folly::Future<ErrorOr<nebula::cpp2::ErrorCode, LogID>> The read index or error code
+   */
+  folly::Future<ErrorOr<nebula::cpp2::ErrorCode, LogID>> readIndex();
+
   /**
    * @brief Return whether we need to clean expired wal
    */
@@ -620,6 +638,11 @@ class RaftPart : public std::enable_shared_from_this<RaftPart> {
    */
   void statusPolling(int64_t startTime);
 
+  /**
+   * @brief Return whether leader lease is still valid, the caller must hold raftLock_
+   */
+  bool leaseValidInLock();
+
   /**
    * @brief Return whether need to send heartbeat
    */
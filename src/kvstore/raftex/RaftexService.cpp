@@ -159,6 +159,18 @@ void RaftexService::sendSnapshot(cpp2::SendSnapshotResponse& resp,
   part->processSendSnapshotRequest(req, resp);
 }
 
+void RaftexService::getReadIndex(cpp2::GetReadIndexResponse& resp,
+                                 const cpp2::GetReadIndexRequest& req) {
+  auto part = findPart(req.get_space(), req.get_part());
+  if (!part) {
+    // Not found
+    resp.error_code_ref() = nebula::cpp2::ErrorCode::E_RAFT_UNKNOWN_PART;
+    return;
+  }
+
+  part->processGetReadIndexRequest(req, resp);
+}
+
 void RaftexService::async_eb_heartbeat(
     std::unique_ptr<apache::thrift::HandlerCallback<cpp2::HeartbeatResponse>> callback,
     const cpp2::HeartbeatRequest& req) {
@@ -84,6 +84,15 @@ class RaftexService : public cpp2::RaftexServiceSvIf {
    */
   void getState(cpp2::GetStateResponse& resp, const cpp2::GetStateRequest& req) override;
 
+  /**
+   * @brief Get the read index from leader, used by linearizable reads on followers
+   *
+   * @param resp
+   * @param req
+   */
+  void getReadIndex(cpp2::GetReadIndexResponse& resp,
+                    const cpp2::GetReadIndexRequest& req) override;
+
   /**
    * @brief Handle append log request in worker thread
    *
@@ -11,11 +11,15 @@
 #include "common/fs/TempDir.h"
 #include "common/network/NetworkUtils.h"
 #include "common/thread/GenericThreadPool.h"
+#include "common/time/WallClock.h"
+#include "kvstore/raftex/Host.h"
 #include "kvstore/raftex/RaftexService.h"
 #include "kvstore/raftex/test/RaftexTestBase.h"
 #include "kvstore/raftex/test/TestShard.h"
 
 DECLARE_uint32(raft_heartbeat_interval_secs);
+DECLARE_int64(raft_catch_up_log_lag);
+DECLARE_uint32(max_appendlog_batch_size);
 
 namespace nebula {
 namespace raftex {
@@ -131,6 +135,53 @@ TEST(LearnerTest, CatchUpDataTest) {
   finishRaft(services, copies, workers, leader);
 }
 
+TEST(LearnerTest, CatchUpSlotTest) {
+  // The learner catches up in small batches, the last one is still sent in catch-up mode
+  auto oldLag = FLAGS_raft_catch_up_log_lag;
+  auto oldBatchSize = FLAGS_max_appendlog_batch_size;
+  FLAGS_raft_catch_up_log_lag = 1;
+  FLAGS_max_appendlog_batch_size = 2;
+
+  fs::TempDir walRoot("/tmp/catch_up_slot.XXXXXX");
+  std::shared_ptr<thread::GenericThreadPool> workers;
+  std::vector<std::string> wals;
+  std::vector<HostAddr> allHosts;
+  std::vector<std::shared_ptr<RaftexService>> services;
+  std::vector<std::shared_ptr<test::TestShard>> copies;
+
+  std::shared_ptr<test::TestShard> leader;
+  std::vector<bool> isLearner = {false, false, false, true};
+  setupRaft(4, walRoot, workers, wals, allHosts, services, copies, leader, isLearner);
+
+  checkLeadership(copies, leader);
+
+  std::vector<std::string> msgs;
+  appendLogs(0, 99, leader, msgs);
+  sleep(FLAGS_raft_heartbeat_interval_secs);
+  EXPECT_EQ(0, Host::numCatchUpHosts());
+
+  LOG(INFO) << "Add learner, it takes a catch-up slot until it catches up";
+  auto& learner = copies[3];
+  auto f = leader->sendCommandAsync(test::encodeLearner(allHosts[3]));
+  uint32_t maxCatchUpHosts = 0;
+  auto deadline = time::WallClock::fastNowInSec() + FLAGS_raft_heartbeat_interval_secs;
+  while (learner->getNumLogs() < 100 && time::WallClock::fastNowInSec() <= deadline) {
+    maxCatchUpHosts = std::max(maxCatchUpHosts, Host::numCatchUpHosts());
+    std::this_thread::yield();
+  }
+  f.wait();
+  EXPECT_LE(1, maxCatchUpHosts);
+
+  sleep(FLAGS_raft_heartbeat_interval_secs);
+  ASSERT_EQ(100, learner->getNumLogs());
+  // Released once the learner has caught up, though only heartbeats are sent to it since then
+  EXPECT_EQ(0, Host::numCatchUpHosts());
+
+  finishRaft(services, copies, workers, leader);
+  FLAGS_raft_catch_up_log_lag = oldLag;
+  FLAGS_max_appendlog_batch_size = oldBatchSize;
+}
+
 }  // namespace raftex
 }  // namespace nebula
 
@@ -19,6 +19,8 @@ stats::CounterId kTransferLeaderLatencyUs;
 stats::CounterId kNumStartElect;
 stats::CounterId kNumGrantVotes;
 stats::CounterId kNumSendSnapshot;
+stats::CounterId kNumCatchUpBatch;
+stats::CounterId kNumAsyncApplyBatch;
 
 void initKVStats() {
   kCommitLogLatencyUs = stats::StatsManager::registerHisto(
@@ -36,6 +38,8 @@ void initKVStats() {
   kNumStartElect = stats::StatsManager::registerStats("num_start_elect", "rate, sum");
   kNumGrantVotes = stats::StatsManager::registerStats("num_grant_votes", "rate, sum");
   kNumSendSnapshot = stats::StatsManager::registerStats("num_send_snapshot", "rate, sum");
+  kNumCatchUpBatch = stats::StatsManager::registerStats("num_catch_up_batch", "rate, sum");
+  kNumAsyncApplyBatch = stats::StatsManager::registerStats("num_async_apply_batch", "rate, sum");
 }
 
 }  // namespace nebula
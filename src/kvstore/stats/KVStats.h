@@ -21,6 +21,8 @@ extern stats::CounterId kTransferLeaderLatencyUs;
 extern stats::CounterId kNumStartElect;
 extern stats::CounterId kNumGrantVotes;
 extern stats::CounterId kNumSendSnapshot;
+extern stats::CounterId kNumCatchUpBatch;
+extern stats::CounterId kNumAsyncApplyBatch;
 
 void initKVStats();
 
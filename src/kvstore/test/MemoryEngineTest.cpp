@@ -0,0 +1,286 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/base/Base.h"
+#include "common/fs/TempDir.h"
+#include "common/utils/NebulaKeyUtils.h"
+#include "kvstore/MemoryEngine.h"
+
+namespace nebula {
+namespace kvstore {
+
+TEST(MemoryEngineTest, SimpleTest) {
+  fs::TempDir rootPath("/tmp/memory_engine_SimpleTest.XXXXXX");
+  auto engine = std::make_unique<MemoryEngine>(0, rootPath.path());
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->put("key", "val"));
+  std::string val;
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->get("key", &val));
+  EXPECT_EQ("val", val);
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->put("key", "newVal"));
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->get("key", &val));
+  EXPECT_EQ("newVal", val);
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->remove("key"));
+  EXPECT_EQ(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND, engine->get("key", &val));
+
+  std::vector<std::string> values;
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->put("key1", "val1"));
+  auto status = engine->multiGet({"key", "key1"}, &values);
+  ASSERT_EQ(2, status.size());
+  EXPECT_TRUE(status[0].isKeyNotFound());
+  EXPECT_TRUE(status[1].ok());
+  EXPECT_EQ("val1", values[1]);
+}
+
+TEST(MemoryEngineTest, RangeTest) {
+  fs::TempDir rootPath("/tmp/memory_engine_RangeTest.XXXXXX");
+  auto engine = std::make_unique<MemoryEngine>(0, rootPath.path());
+  std::vector<KV> data;
+  for (int32_t i = 10; i < 20; i++) {
+    data.emplace_back(std::string(reinterpret_cast<const char*>(&i), sizeof(int32_t)),
+                      folly::stringPrintf("val_%d", i));
+  }
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->multiPut(std::move(data)));
+
+  auto checkRange = [&](int32_t start, int32_t end, int32_t expectedFrom, int32_t expectedTotal) {
+    std::string s(reinterpret_cast<const char*>(&start), sizeof(int32_t));
+    std::string e(reinterpret_cast<const char*>(&end), sizeof(int32_t));
+    std::unique_ptr<KVIterator> iter;
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->range(s, e, &iter));
+    int num = 0;
+    while (iter->valid()) {
+      num++;
+      auto key = *reinterpret_cast<const int32_t*>(iter->key().data());
+      EXPECT_EQ(expectedFrom, key);
+      EXPECT_EQ(folly::stringPrintf("val_%d", expectedFrom), iter->val());
+      expectedFrom++;
+      iter->next();
+    }
+    EXPECT_EQ(expectedTotal, num);
+  };
+
+  checkRange(10, 20, 10, 10);
+  checkRange(1, 50, 10, 10);
+  checkRange(15, 18, 15, 3);
+  checkRange(15, 23, 15, 5);
+  checkRange(1, 15, 10, 5);
+}
+
+TEST(MemoryEngineTest, PrefixTest) {
+  fs::TempDir rootPath("/tmp/memory_engine_PrefixTest.XXXXXX");
+  auto engine = std::make_unique<MemoryEngine>(0, rootPath.path());
+  std::vector<KV> data;
+  for (int32_t i = 0; i < 10; i++) {
+    data.emplace_back(folly::stringPrintf("a_%d", i), folly::stringPrintf("val_%d", i));
+    data.emplace_back(folly::stringPrintf("b_%d", i), folly::stringPrintf("val_%d", i));
+    data.emplace_back(folly::stringPrintf("c_%d", i), folly::stringPrintf("val_%d", i));
+  }
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->multiPut(std::move(data)));
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->remove("b_5"));
+
+  auto checkPrefix = [&](const std::string& prefix, const std::string& start, int32_t expected) {
+    std::unique_ptr<KVIterator> iter;
+    if (start.empty()) {
+      EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->prefix(prefix, &iter));
+    } else {
+      EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->rangeWithPrefix(start, prefix, &iter));
+    }
+    int num = 0;
+    while (iter->valid()) {
+      EXPECT_TRUE(iter->key().startsWith(prefix));
+      EXPECT_NE("b_5", iter->key());
+      num++;
+      iter->next();
+    }
+    EXPECT_EQ(expected, num);
+  };
+  checkPrefix("a_", "", 10);
+  checkPrefix("b_", "", 9);
+  checkPrefix("c_", "c_3", 7);
+  checkPrefix("d_", "", 0);
+}
+
+TEST(MemoryEngineTest, RemoveRangeTest) {
+  fs::TempDir rootPath("/tmp/memory_engine_RemoveRangeTest.XXXXXX");
+  auto engine = std::make_unique<MemoryEngine>(0, rootPath.path());
+  for (int32_t i = 0; i < 100; i++) {
+    std::string key(reinterpret_cast<const char*>(&i), sizeof(int32_t));
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+              engine->put(key, folly::stringPrintf("%d_val", i)));
+  }
+  // the removeRange in a batch sees the puts before it
+  auto batch = engine->startBatchWrite();
+  int32_t s = 0, e = 50, extra = 20;
+  batch->put(std::string(reinterpret_cast<const char*>(&extra), sizeof(int32_t)), "extra");
+  batch->removeRange(std::string(reinterpret_cast<const char*>(&s), sizeof(int32_t)),
+                     std::string(reinterpret_cast<const char*>(&e), sizeof(int32_t)));
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            engine->commitBatchWrite(std::move(batch), false, false, true));
+
+  std::unique_ptr<KVIterator> iter;
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->scan(&iter));
+  int num = 0;
+  int expectedFrom = 50;
+  while (iter->valid()) {
+    num++;
+    EXPECT_EQ(expectedFrom, *reinterpret_cast<const int32_t*>(iter->key().data()));
+    EXPECT_EQ(folly::stringPrintf("%d_val", expectedFrom), iter->val());
+    expectedFrom++;
+    iter->next();
+  }
+  EXPECT_EQ(50, num);
+}
+
+TEST(MemoryEngineTest, SnapshotTest) {
+  fs::TempDir rootPath("/tmp/memory_engine_SnapshotTest.XXXXXX");
+  auto engine = std::make_unique<MemoryEngine>(0, rootPath.path());
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->put("key1", "val1"));
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->put("key2", "val2"));
+
+  const void* snapshot = engine->GetSnapshot();
+  std::unique_ptr<KVIterator> iter;
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->prefix("key", &iter, snapshot));
+
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->put("key1", "newVal1"));
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->remove("key2"));
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->put("key3", "val3"));
+  engine->compact();
+
+  std::string val;
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->get("key2", &val, snapshot));
+  EXPECT_EQ("val2", val);
+  EXPECT_EQ(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND, engine->get("key2", &val));
+  engine->ReleaseSnapshot(snapshot);
+
+  // the iterator keeps reading the snapshot after it is released
+  std::vector<std::pair<std::string, std::string>> kvs;
+  while (iter->valid()) {
+    kvs.emplace_back(iter->key().str(), iter->val().str());
+    iter->next();
+  }
+  ASSERT_EQ(2, kvs.size());
+  EXPECT_EQ(std::make_pair(std::string("key1"), std::string("val1")), kvs[0]);
+  EXPECT_EQ(std::make_pair(std::string("key2"), std::string("val2")), kvs[1]);
+}
+
+TEST(MemoryEngineTest, PurgeTest) {
+  fs::TempDir rootPath("/tmp/memory_engine_PurgeTest.XXXXXX");
+  auto engine = std::make_unique<MemoryEngine>(0, rootPath.path());
+  for (int32_t i = 0; i < 10; i++) {
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+              engine->put("key", folly::stringPrintf("val_%d", i)));
+  }
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->put("removed", "val"));
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->remove("removed"));
+  EXPECT_EQ(12, engine->table_->size());
+
+  {
+    // the version read by an iterator is kept
+    std::unique_ptr<KVIterator> iter;
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->prefix("key", &iter));
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->put("key", "latest"));
+    engine->purge();
+    EXPECT_EQ(2, engine->table_->size());
+    ASSERT_TRUE(iter->valid());
+    EXPECT_EQ("val_9", iter->val());
+  }
+  engine->purge();
+  EXPECT_EQ(1, engine->table_->size());
+  std::string val;
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->get("key", &val));
+  EXPECT_EQ("latest", val);
+}
+
+TEST(MemoryEngineTest, FlushAndReloadTest) {
+  fs::TempDir rootPath("/tmp/memory_engine_FlushAndReloadTest.XXXXXX");
+  GraphSpaceID spaceId = 1;
+  {
+    auto engine = std::make_unique<MemoryEngine>(spaceId, rootPath.path());
+    engine->addPart(1);
+    engine->addPart(2);
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->put("key1", "val1"));
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->put("key2", "val2"));
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->remove("key2"));
+    engine->stop();
+  }
+  {
+    auto engine = std::make_unique<MemoryEngine>(spaceId, rootPath.path());
+    EXPECT_EQ(2, engine->totalPartsNum());
+    std::string val;
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->get("key1", &val));
+    EXPECT_EQ("val1", val);
+    EXPECT_EQ(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND, engine->get("key2", &val));
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+              engine->get(NebulaKeyUtils::dataVersionKey(), &val));
+  }
+}
+
+TEST(MemoryEngineTest, PersistedCommitLogIdTest) {
+  fs::TempDir rootPath("/tmp/memory_engine_PersistedCommitLogIdTest.XXXXXX");
+  GraphSpaceID spaceId = 1;
+  auto commit = [](LogID logId, TermID termId) {
+    std::string val;
+    val.append(reinterpret_cast<const char*>(&logId), sizeof(LogID))
+        .append(reinterpret_cast<const char*>(&termId), sizeof(TermID));
+    return val;
+  };
+  {
+    auto engine = std::make_unique<MemoryEngine>(spaceId, rootPath.path());
+    engine->addPart(1);
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+              engine->put(NebulaKeyUtils::systemCommitKey(1), commit(10, 1)));
+    // nothing dumped yet, the whole wal is needed
+    EXPECT_EQ(0, engine->persistedCommitLogId(1));
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->flush());
+    EXPECT_EQ(10, engine->persistedCommitLogId(1));
+    EXPECT_EQ(0, engine->persistedCommitLogId(2));
+
+    // the logs after the last dump are only in wal
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+              engine->put(NebulaKeyUtils::systemCommitKey(1), commit(20, 1)));
+    EXPECT_EQ(10, engine->persistedCommitLogId(1));
+  }
+  {
+    // the commit log id loaded from the dump file
+    auto engine = std::make_unique<MemoryEngine>(spaceId, rootPath.path());
+    EXPECT_EQ(10, engine->persistedCommitLogId(1));
+  }
+}
+
+TEST(MemoryEngineTest, DropPartDataTest) {
+  fs::TempDir rootPath("/tmp/memory_engine_DropPartDataTest.XXXXXX");
+  auto engine = std::make_unique<MemoryEngine>(1, rootPath.path());
+  for (PartitionID partId = 1; partId <= 3; partId++) {
+    engine->addPart(partId);
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+              engine->put(NebulaKeyUtils::kvKey(partId, "key"), "val"));
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+              engine->put(NebulaKeyUtils::systemCommitKey(partId), "commit"));
+  }
+  engine->removePart(2);
+  EXPECT_EQ(2, engine->totalPartsNum());
+  std::string val;
+  for (PartitionID partId = 1; partId <= 3; partId++) {
+    auto code = partId == 2 ? nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND
+                            : nebula::cpp2::ErrorCode::SUCCEEDED;
+    EXPECT_EQ(code, engine->get(NebulaKeyUtils::kvKey(partId, "key"), &val));
+    EXPECT_EQ(code, engine->get(NebulaKeyUtils::systemCommitKey(partId), &val));
+  }
+}
+
+}  // namespace kvstore
+}  // namespace nebula
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  folly::init(&argc, &argv, true);
+  google::SetStderrLogging(google::INFO);
+
+  // purge and flush are triggered manually in tests
+  FLAGS_memory_engine_purge_interval_ms = 0;
+  FLAGS_memory_engine_flush_interval_secs = 0;
+  return RUN_ALL_TESTS();
+}
@@ -23,6 +23,7 @@
 
 DECLARE_uint32(raft_heartbeat_interval_secs);
 DECLARE_bool(auto_remove_invalid_space);
+DECLARE_bool(enable_follower_read);
 const int32_t kDefaultVidLen = 8;
 using nebula::meta::PartHosts;
 
@@ -552,6 +553,166 @@ TEST(NebulaStoreTest, ThreeCopiesTest) {
   }
 }
 
+TEST(NebulaStoreTest, AsyncApplyTest) {
+  FLAGS_raft_async_apply = true;
+  fs::TempDir rootPath("/tmp/nebula_store_test.XXXXXX");
+  auto initNebulaStore = [](const std::vector<HostAddr>& peers,
+                            int32_t index,
+                            const std::string& path) -> std::unique_ptr<NebulaStore> {
+    auto sIoThreadPool = std::make_shared<folly::IOThreadPoolExecutor>(4);
+    auto partMan = std::make_unique<MemPartManager>();
+    PartHosts pm;
+    pm.spaceId_ = 0;
+    pm.partId_ = 0;
+    pm.hosts_ = peers;
+    partMan->partsMap_[0][0] = std::move(pm);
+    std::vector<std::string> paths;
+    paths.emplace_back(folly::stringPrintf("%s/disk%d", path.c_str(), index));
+    KVOptions options;
+    options.dataPaths_ = std::move(paths);
+    options.partMan_ = std::move(partMan);
+    return std::make_unique<NebulaStore>(
+        std::move(options), sIoThreadPool, peers[index], getHandlers());
+  };
+  int32_t replicas = 3;
+  std::vector<HostAddr> peers;
+  for (int32_t i = 0; i < replicas; i++) {
+    peers.emplace_back("127.0.0.1", network::NetworkUtils::getAvailablePort());
+  }
+  std::vector<std::unique_ptr<NebulaStore>> stores;
+  for (int i = 0; i < replicas; i++) {
+    stores.emplace_back(initNebulaStore(peers, i, rootPath.path()));
+    stores.back()->init();
+  }
+  int32_t leaderIndex = -1;
+  while (leaderIndex < 0) {
+    usleep(100000);
+    for (int i = 0; i < replicas; i++) {
+      nebula::meta::ActiveHostsMan::AllLeaders leaderIds;
+      if (stores[i]->allLeader(leaderIds) == 1) {
+        leaderIndex = i;
+      }
+    }
+  }
+
+  LOG(INFO) << "Write many batches, followers apply them in background";
+  for (int32_t batch = 0; batch < 10; batch++) {
+    std::vector<KV> data;
+    for (int32_t i = 0; i < 100; i++) {
+      data.emplace_back(folly::stringPrintf("key_%d_%d", batch, i),
+                        folly::stringPrintf("val_%d_%d", batch, i));
+    }
+    folly::Baton<true, std::atomic> baton;
+    stores[leaderIndex]->asyncMultiPut(
+        0, 0, std::move(data), [&baton](nebula::cpp2::ErrorCode code) {
+          EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, code);
+          baton.post();
+        });
+    baton.wait();
+  }
+  sleep(FLAGS_raft_heartbeat_interval_secs);
+
+  auto leaderPart = value(stores[leaderIndex]->part(0, 0));
+  for (int i = 0; i < replicas; i++) {
+    auto part = value(stores[i]->part(0, 0));
+    EXPECT_EQ(leaderPart->appliedLogId(), part->appliedLogId());
+    auto* engine = value(stores[i]->engine(0, 0));
+    std::unique_ptr<KVIterator> iter;
+    ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->prefix("key_", &iter));
+    int32_t num = 0;
+    for (; iter->valid(); iter->next()) {
+      num++;
+    }
+    EXPECT_EQ(1000, num);
+  }
+  FLAGS_raft_async_apply = false;
+}
+
+TEST(NebulaStoreTest, FollowerReadTest) {
+  fs::TempDir rootPath("/tmp/follower_read_test.XXXXXX");
+  auto initNebulaStore = [](const std::vector<HostAddr>& peers,
+                            int32_t index,
+                            const std::string& path) -> std::unique_ptr<NebulaStore> {
+    auto sIoThreadPool = std::make_shared<folly::IOThreadPoolExecutor>(4);
+    auto partMan = std::make_unique<MemPartManager>();
+    PartHosts pm;
+    pm.spaceId_ = 0;
+    pm.partId_ = 0;
+    pm.hosts_ = peers;
+    partMan->partsMap_[0][0] = std::move(pm);
+    std::vector<std::string> paths;
+    paths.emplace_back(folly::stringPrintf("%s/disk%d", path.c_str(), index));
+    KVOptions options;
+    options.dataPaths_ = std::move(paths);
+    options.partMan_ = std::move(partMan);
+    return std::make_unique<NebulaStore>(
+        std::move(options), sIoThreadPool, peers[index], getHandlers());
+  };
+  int32_t replicas = 3;
+  std::vector<HostAddr> peers;
+  for (int32_t i = 0; i < replicas; i++) {
+    peers.emplace_back("127.0.0.1", network::NetworkUtils::getAvailablePort());
+  }
+  std::vector<std::unique_ptr<NebulaStore>> stores;
+  for (int i = 0; i < replicas; i++) {
+    stores.emplace_back(initNebulaStore(peers, i, rootPath.path()));
+    stores.back()->init();
+  }
+  int32_t leaderIndex = -1;
+  while (leaderIndex < 0) {
+    usleep(100000);
+    for (int i = 0; i < replicas; i++) {
+      nebula::meta::ActiveHostsMan::AllLeaders leaderIds;
+      if (stores[i]->allLeader(leaderIds) == 1) {
+        leaderIndex = i;
+      }
+    }
+  }
+  // wait for the leader lease
+  sleep(FLAGS_raft_heartbeat_interval_secs);
+
+  std::vector<KV> data;
+  for (int32_t i = 0; i < 100; i++) {
+    data.emplace_back(folly::stringPrintf("key_%d", i), folly::stringPrintf("val_%d", i));
+  }
+  folly::Baton<true, std::atomic> baton;
+  stores[leaderIndex]->asyncMultiPut(
+      0, 0, std::move(data), [&baton](nebula::cpp2::ErrorCode code) {
+        EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, code);
+        baton.post();
+      });
+  baton.wait();
+
+  auto followerIndex = (leaderIndex + 1) % replicas;
+  {
+    LOG(INFO) << "Follower rejects reads by default";
+    std::string val;
+    EXPECT_EQ(nebula::cpp2::ErrorCode::E_LEADER_CHANGED,
+              stores[followerIndex]->get(0, 0, "key_0", &val));
+  }
+  {
+    LOG(INFO) << "Follower serves reads after catching up with the read index";
+    FLAGS_enable_follower_read = true;
+    // the follower learns the committed log id by next append log or heartbeat
+    FLAGS_follower_read_timeout_ms = FLAGS_raft_heartbeat_interval_secs * 2000;
+    EXPECT_EQ(nebula::cpp2::ErrorCode::E_UNSUPPORTED,
+              stores[leaderIndex]->syncReadIndex(0, 0).get());
+    // The read index is fetched once per request, the reads never block on it
+    std::string val;
+    EXPECT_EQ(nebula::cpp2::ErrorCode::E_LEADER_CHANGED,
+              stores[followerIndex]->get(0, 0, "key_0", &val));
+    ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+              stores[followerIndex]->syncReadIndex(0, 0).get());
+    for (int32_t i = 0; i < 100; i++) {
+      ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+                stores[followerIndex]->get(0, 0, folly::stringPrintf("key_%d", i), &val, true));
+      EXPECT_EQ(folly::stringPrintf("val_%d", i), val);
+    }
+    FLAGS_enable_follower_read = false;
+    FLAGS_follower_read_timeout_ms = 1000;
+  }
+}
+
 TEST(NebulaStoreTest, TransLeaderTest) {
   fs::TempDir rootPath("/tmp/trans_leader_test.XXXXXX");
   auto initNebulaStore = [](const std::vector<HostAddr>& peers,
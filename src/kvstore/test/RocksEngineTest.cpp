@@ -860,6 +860,103 @@ TEST(RebuildPrefixBloomFilter, RebuildPrefixBloomFilter) {
   checkNewData();
 }
 
+TEST(PartColumnFamilyTest, PartColumnFamilyTest) {
+  GraphSpaceID spaceId = 1;
+  FLAGS_rocksdb_part_column_family = true;
+  fs::TempDir dataPath("/tmp/rocksdb_engine_part_column_family.XXXXXX");
+  auto engine = std::make_unique<RocksEngine>(spaceId, kDefaultVIdLen, dataPath.path());
+
+  auto countPrefix = [&](const std::string& prefix) {
+    std::unique_ptr<KVIterator> iter;
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->prefix(prefix, &iter));
+    int32_t num = 0;
+    while (iter->valid()) {
+      num++;
+      iter->next();
+    }
+    return num;
+  };
+
+  for (PartitionID partId = 1; partId <= 3; partId++) {
+    engine->addPart(partId);
+    auto batch = engine->startBatchWrite();
+    for (TagID tagId = 0; tagId < 10; tagId++) {
+      batch->put(NebulaKeyUtils::tagKey(kDefaultVIdLen, partId, "vertex", tagId), "val");
+    }
+    batch->put(NebulaKeyUtils::systemCommitKey(partId), "123");
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+              engine->commitBatchWrite(std::move(batch), false, false, true));
+    EXPECT_EQ(10, countPrefix(NebulaKeyUtils::tagPrefix(partId)));
+  }
+  EXPECT_EQ(3, engine->allParts().size());
+
+  // a whole scan goes through all column families
+  {
+    std::unique_ptr<KVIterator> iter;
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->scan(&iter));
+    int32_t num = 0;
+    while (iter->valid()) {
+      if (NebulaKeyUtils::isTag(kDefaultVIdLen, iter->key())) {
+        num++;
+      }
+      iter->next();
+    }
+    EXPECT_EQ(30, num);
+  }
+
+  // drop the data of part 1 and remove part 2
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->dropPartData(1));
+  engine->removePart(2);
+  EXPECT_EQ(0, countPrefix(NebulaKeyUtils::tagPrefix(1)));
+  EXPECT_EQ(0, countPrefix(NebulaKeyUtils::tagPrefix(2)));
+  EXPECT_EQ(10, countPrefix(NebulaKeyUtils::tagPrefix(3)));
+  EXPECT_EQ(2, engine->allParts().size());
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->compact());
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->flush());
+
+  // the layout is kept after restart, even if the flag is turned off
+  engine.reset();
+  FLAGS_rocksdb_part_column_family = false;
+  engine = std::make_unique<RocksEngine>(spaceId, kDefaultVIdLen, dataPath.path());
+  EXPECT_EQ(0, countPrefix(NebulaKeyUtils::tagPrefix(1)));
+  EXPECT_EQ(10, countPrefix(NebulaKeyUtils::tagPrefix(3)));
+  std::string value;
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            engine->get(NebulaKeyUtils::tagKey(kDefaultVIdLen, 3, "vertex", 0), &value));
+  EXPECT_EQ("val", value);
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            engine->get(NebulaKeyUtils::systemCommitKey(3), &value));
+  EXPECT_EQ("123", value);
+  EXPECT_EQ(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND,
+            engine->get(NebulaKeyUtils::tagKey(kDefaultVIdLen, 1, "vertex", 0), &value));
+
+  // failed to create the column family of a new part, e.g. in a read only instance
+  engine.reset();
+  engine = std::make_unique<RocksEngine>(
+      spaceId, kDefaultVIdLen, dataPath.path(), "", nullptr, nullptr, true);
+  EXPECT_EQ(nebula::cpp2::ErrorCode::E_STORE_FAILURE,
+            engine->put(NebulaKeyUtils::tagKey(kDefaultVIdLen, 5, "vertex", 0), "val"));
+  {
+    auto batch = engine->startBatchWrite();
+    EXPECT_EQ(nebula::cpp2::ErrorCode::E_STORE_FAILURE,
+              batch->put(NebulaKeyUtils::tagKey(kDefaultVIdLen, 5, "vertex", 0), "val"));
+  }
+  EXPECT_EQ(10, countPrefix(NebulaKeyUtils::tagPrefix(3)));
+
+  // an existing data path is never converted
+  fs::TempDir sharedPath("/tmp/rocksdb_engine_shared_column_family.XXXXXX");
+  engine = std::make_unique<RocksEngine>(spaceId, kDefaultVIdLen, sharedPath.path());
+  engine->addPart(1);
+  EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            engine->put(NebulaKeyUtils::tagKey(kDefaultVIdLen, 1, "vertex", 0), "val"));
+  engine.reset();
+  FLAGS_rocksdb_part_column_family = true;
+  engine = std::make_unique<RocksEngine>(spaceId, kDefaultVIdLen, sharedPath.path());
+  EXPECT_EQ(nebula::cpp2::ErrorCode::E_UNSUPPORTED, engine->dropPartData(1));
+  EXPECT_EQ(1, countPrefix(NebulaKeyUtils::tagPrefix(1)));
+  FLAGS_rocksdb_part_column_family = false;
+}
+
 }  // namespace kvstore
 }  // namespace nebula
 
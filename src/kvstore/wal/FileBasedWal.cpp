@@ -718,6 +718,24 @@ size_t FileBasedWal::accessAllWalInfo(std::function<bool(WalFileInfoPtr info)> f
   return count;
 }
 
+LogID FileBasedWal::sealedFileLastLogId(LogID id) const {
+  std::lock_guard<std::mutex> g(walFilesMutex_);
+  if (walFiles_.empty() || id < walFiles_.begin()->first) {
+    return -1;
+  }
+  // Find the first file whose first log id is greater than id, the previous one contains the log
+  auto it = walFiles_.upper_bound(id);
+  if (it == walFiles_.end()) {
+    // The log is in the last file, which is still being appended to
+    return -1;
+  }
+  --it;
+  if (id > it->second->lastId()) {
+    return -1;
+  }
+  return it->second->lastId();
+}
+
 TermID FileBasedWal::getLogTerm(LogID id) {
   TermID term = INVALID_TERM;
   auto iter = iterator(id, id);
@@ -44,6 +44,7 @@ class FileBasedWal final : public Wal, public std::enable_shared_from_this<FileB
   FRIEND_TEST(FileBasedWal, CheckLastWalTest);
   FRIEND_TEST(FileBasedWal, LinkTest);
   FRIEND_TEST(FileBasedWal, CleanWalBeforeIdTest);
+  FRIEND_TEST(FileBasedWal, SealedFileLastLogIdTest);
   FRIEND_TEST(WalFileIter, MultiFilesReadTest);
   friend class FileBasedWalIterator;
   friend class WalFileIterator;
@@ -176,6 +177,16 @@ class FileBasedWal final : public Wal, public std::enable_shared_from_this<FileB
    */
   size_t accessAllWalInfo(std::function<bool(WalFileInfoPtr info)> fn) const;
 
+  /**
+   * @brief Return the last log id of the sealed wal file which contains the given log id. A wal
+   * file is sealed when it is not the file being appended to any more.
+   *
+   * @param id The log id to look up
+   * @return LogID The last log id of the sealed file, -1 if the log is not found or it is in the
+   * file being appended to
+   */
+  LogID sealedFileLastLogId(LogID id) const;
+
   /**
    * @brief Return the log buffer in memory
    */
@@ -602,6 +602,39 @@ TEST(FileBasedWal, getLogTermTest) {
   EXPECT_EQ(10, wal->getLogTerm(10));
 }
 
+TEST(FileBasedWal, SealedFileLastLogIdTest) {
+  TempDir walDir("/tmp/testWal.XXXXXX");
+  FileBasedWalInfo info;
+  FileBasedWalPolicy policy;
+  policy.fileSize = 1024 * 10;
+  auto wal = FileBasedWal::getWal(
+      walDir.path(), info, policy, [](LogID, TermID, ClusterID, const std::string&) {
+        return true;
+      });
+  // Nothing in wal
+  EXPECT_EQ(-1, wal->sealedFileLastLogId(1));
+
+  for (LogID i = 1; i <= 100; i++) {
+    EXPECT_TRUE(wal->appendLog(i, 1, 0, folly::stringPrintf(kLongMsg, i)));
+  }
+  ASSERT_GT(wal->walFiles_.size(), 1UL);
+
+  for (const auto& file : wal->walFiles_) {
+    auto fileInfo = file.second;
+    if (fileInfo == wal->walFiles_.rbegin()->second) {
+      // The last file is not sealed
+      EXPECT_EQ(-1, wal->sealedFileLastLogId(fileInfo->firstId()));
+      EXPECT_EQ(-1, wal->sealedFileLastLogId(wal->lastLogId()));
+    } else {
+      EXPECT_EQ(fileInfo->lastId(), wal->sealedFileLastLogId(fileInfo->firstId()));
+      EXPECT_EQ(fileInfo->lastId(), wal->sealedFileLastLogId(fileInfo->lastId()));
+    }
+  }
+  // Out of range
+  EXPECT_EQ(-1, wal->sealedFileLastLogId(0));
+  EXPECT_EQ(-1, wal->sealedFileLastLogId(101));
+}
+
 }  // namespace wal
 }  // namespace nebula
 
@@ -218,6 +218,22 @@ class LastUpdateTimeMan final {
 
   static void update(kvstore::BatchHolder* batchHolder, const int64_t timeInMilliSec);
 
+  /**
+   * @brief Update the global last update time and the last update time of the space, the client
+   * only reloads the spaces whose last update time changed
+   *
+   * @param data
+   * @param timeInMilliSec
+   * @param spaceId
+   */
+  static void update(std::vector<kvstore::KV>& data,
+                     const int64_t timeInMilliSec,
+                     GraphSpaceID spaceId);
+
+  static void update(kvstore::BatchHolder* batchHolder,
+                     const int64_t timeInMilliSec,
+                     GraphSpaceID spaceId);
+
  protected:
   LastUpdateTimeMan() = default;
 };
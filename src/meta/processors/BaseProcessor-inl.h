@@ -445,7 +445,13 @@ nebula::cpp2::ErrorCode BaseProcessor<RESP>::indexCheck(
       if (*tagItem.op_ref() == nebula::meta::cpp2::AlterSchemaOp::CHANGE ||
           *tagItem.op_ref() == nebula::meta::cpp2::AlterSchemaOp::DROP) {
         const auto& tagCols = tagItem.get_schema().get_columns();
-        const auto& indexCols = index.get_fields();
+        // The columns stored in index value can't be changed either
+        auto indexCols = index.get_fields();
+        if (index.include_fields_ref().has_value()) {
+          indexCols.insert(indexCols.end(),
+                           index.include_fields_ref()->begin(),
+                           index.include_fields_ref()->end());
+        }
         for (const auto& tCol : tagCols) {
           auto it = std::find_if(indexCols.begin(), indexCols.end(), [&](const auto& iCol) {
             return tCol.name == iCol.name;
@@ -484,7 +490,8 @@ nebula::cpp2::ErrorCode BaseProcessor<RESP>::ftIndexCheck(
 
 template <typename RESP>
 bool BaseProcessor<RESP>::checkIndexExist(const std::vector<cpp2::IndexFieldDef>& fields,
-                                          const cpp2::IndexItem& item) {
+                                          const cpp2::IndexItem& item,
+                                          const std::vector<std::string>& includeFields) {
   const auto& itemFields = item.get_fields();
   if (fields.size() != itemFields.size()) {
     return false;
@@ -494,10 +501,51 @@ bool BaseProcessor<RESP>::checkIndexExist(const std::vector<cpp2::IndexFieldDef>
       return false;
     }
   }
+  if (!includeFields.empty()) {
+    if (!item.include_fields_ref().has_value()) {
+      return false;
+    }
+    const auto& itemIncludes = *item.include_fields_ref();
+    for (const auto& field : includeFields) {
+      auto iter = std::find_if(itemIncludes.begin(), itemIncludes.end(), [&](const auto& col) {
+        return col.get_name() == field;
+      });
+      if (iter == itemIncludes.end()) {
+        return false;
+      }
+    }
+  }
   LOG(INFO) << "Index " << item.get_index_name() << " has existed";
   return true;
 }
 
+template <typename RESP>
+ErrorOr<nebula::cpp2::ErrorCode, std::vector<cpp2::ColumnDef>> BaseProcessor<RESP>::includeColumns(
+    const std::vector<std::string>& includeFields,
+    const std::vector<cpp2::IndexFieldDef>& fields,
+    const std::vector<cpp2::ColumnDef>& schemaCols) {
+  std::set<std::string> names;
+  for (const auto& field : fields) {
+    names.emplace(field.get_name());
+  }
+  std::vector<cpp2::ColumnDef> columns;
+  for (const auto& field : includeFields) {
+    if (!names.emplace(field).second) {
+      LOG(INFO) << "Include field " << field << " is duplicated or indexed";
+      return nebula::cpp2::ErrorCode::E_CONFLICT;
+    }
+    auto iter = std::find_if(schemaCols.begin(), schemaCols.end(), [&](const auto& col) {
+      return col.get_name() == field;
+    });
+    if (iter == schemaCols.end()) {
+      LOG(INFO) << "Include field " << field << " not found";
+      return nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND;
+    }
+    columns.emplace_back(*iter);
+  }
+  return columns;
+}
+
 template <typename RESP>
 nebula::cpp2::ErrorCode BaseProcessor<RESP>::zoneExist(const std::string& zoneName) {
   auto zoneKey = MetaKeyUtils::zoneKey(zoneName);
@@ -383,10 +383,27 @@ class BaseProcessor {
    * @tparam RESP
    * @param fields
    * @param item
+   * @param includeFields The index must store all these columns too
    * @return true
    * @return false
    */
-  bool checkIndexExist(const std::vector<cpp2::IndexFieldDef>& fields, const cpp2::IndexItem& item);
+  bool checkIndexExist(const std::vector<cpp2::IndexFieldDef>& fields,
+                       const cpp2::IndexItem& item,
+                       const std::vector<std::string>& includeFields = {});
+
+  /**
+   * @brief Get the definitions of columns stored in index value from schema, they should not be
+   * duplicated or indexed.
+   *
+   * @param includeFields
+   * @param fields Indexed fields
+   * @param schemaCols Columns of latest schema
+   * @return ErrorOr<nebula::cpp2::ErrorCode, std::vector<cpp2::ColumnDef>>
+   */
+  ErrorOr<nebula::cpp2::ErrorCode, std::vector<cpp2::ColumnDef>> includeColumns(
+      const std::vector<std::string>& includeFields,
+      const std::vector<cpp2::IndexFieldDef>& fields,
+      const std::vector<cpp2::ColumnDef>& schemaCols);
 
   /**
    * @brief Check if given zone exist.
@@ -104,6 +104,19 @@ void HBProcessor::process(const cpp2::HBReq& req) {
     resp_.last_update_time_in_ms_ref() = 0;
   }
 
+  // set update time of each space, so client could only reload the changed spaces
+  auto spaceTimeRet = doPrefix(MetaKeyUtils::spaceLastUpdateTimePrefix());
+  if (nebula::ok(spaceTimeRet)) {
+    std::unordered_map<GraphSpaceID, int64_t> spaceUpdateTime;
+    auto iter = nebula::value(spaceTimeRet).get();
+    while (iter->valid()) {
+      auto spaceId = MetaKeyUtils::parseSpaceLastUpdateTimeKeySpaceId(iter->key());
+      spaceUpdateTime[spaceId] = *reinterpret_cast<const int64_t*>(iter->val().data());
+      iter->next();
+    }
+    resp_.space_update_time_in_ms_ref() = std::move(spaceUpdateTime);
+  }
+
   auto version = metaVersion_.load();
   if (version == -1) {
     metaVersion_.store(static_cast<int64_t>(MetaVersionMan::getMetaVersionFromKV(kvstore_)));
@@ -17,6 +17,10 @@ void CreateEdgeIndexProcessor::process(const cpp2::CreateEdgeIndexReq& req) {
   auto& edgeName = req.get_edge_name();
   const auto& fields = req.get_fields();
   auto ifNotExists = req.get_if_not_exists();
+  std::vector<std::string> includeFields;
+  if (req.include_fields_ref().has_value()) {
+    includeFields = *req.include_fields_ref();
+  }
 
   std::set<std::string> columnSet;
   for (const auto& field : fields) {
@@ -96,7 +100,7 @@ void CreateEdgeIndexProcessor::process(const cpp2::CreateEdgeIndexReq& req) {
       continue;
     }
 
-    if (checkIndexExist(fields, item)) {
+    if (checkIndexExist(fields, item, includeFields)) {
       if (ifNotExists) {
         resp_.code_ref() = nebula::cpp2::ErrorCode::SUCCEEDED;
         cpp2::ID thriftID;
@@ -183,6 +187,12 @@ void CreateEdgeIndexProcessor::process(const cpp2::CreateEdgeIndexReq& req) {
     }
     columns.emplace_back(col);
   }
+  auto includeRet = includeColumns(includeFields, fields, schemaCols);
+  if (!nebula::ok(includeRet)) {
+    handleErrorCode(nebula::error(includeRet));
+    onFinished();
+    return;
+  }
 
   // add index item
   std::vector<kvstore::KV> data;
@@ -203,6 +213,9 @@ void CreateEdgeIndexProcessor::process(const cpp2::CreateEdgeIndexReq& req) {
   item.schema_id_ref() = schemaID;
   item.schema_name_ref() = edgeName;
   item.fields_ref() = std::move(columns);
+  if (!includeFields.empty()) {
+    item.include_fields_ref() = std::move(nebula::value(includeRet));
+  }
   if (req.index_params_ref().has_value()) {
     item.index_params_ref() = *req.index_params_ref();
   }
@@ -215,7 +228,7 @@ void CreateEdgeIndexProcessor::process(const cpp2::CreateEdgeIndexReq& req) {
   LOG(INFO) << "Create Edge Index " << indexName << ", edgeIndex " << edgeIndex;
   resp_.id_ref() = to(edgeIndex, EntryType::INDEX);
   auto timeInMilliSec = time::WallClock::fastNowInMilliSec();
-  LastUpdateTimeMan::update(data, timeInMilliSec);
+  LastUpdateTimeMan::update(data, timeInMilliSec, space);
   auto result = doSyncPut(std::move(data));
   handleErrorCode(result);
   onFinished();
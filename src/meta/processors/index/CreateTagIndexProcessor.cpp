@@ -17,6 +17,10 @@ void CreateTagIndexProcessor::process(const cpp2::CreateTagIndexReq& req) {
   auto& tagName = req.get_tag_name();
   const auto& fields = req.get_fields();
   auto ifNotExists = req.get_if_not_exists();
+  std::vector<std::string> includeFields;
+  if (req.include_fields_ref().has_value()) {
+    includeFields = *req.include_fields_ref();
+  }
 
   std::set<std::string> columnSet;
   for (const auto& field : fields) {
@@ -96,7 +100,7 @@ void CreateTagIndexProcessor::process(const cpp2::CreateTagIndexReq& req) {
       continue;
     }
 
-    if (checkIndexExist(fields, item)) {
+    if (checkIndexExist(fields, item, includeFields)) {
       if (ifNotExists) {
         resp_.code_ref() = nebula::cpp2::ErrorCode::SUCCEEDED;
         cpp2::ID thriftID;
@@ -182,6 +186,12 @@ void CreateTagIndexProcessor::process(const cpp2::CreateTagIndexReq& req) {
     }
     columns.emplace_back(col);
   }
+  auto includeRet = includeColumns(includeFields, fields, schemaCols);
+  if (!nebula::ok(includeRet)) {
+    handleErrorCode(nebula::error(includeRet));
+    onFinished();
+    return;
+  }
 
   std::vector<kvstore::KV> data;
   auto tagIndexRet = autoIncrementIdInSpace(space);
@@ -201,6 +211,9 @@ void CreateTagIndexProcessor::process(const cpp2::CreateTagIndexReq& req) {
   item.schema_id_ref() = schemaID;
   item.schema_name_ref() = tagName;
   item.fields_ref() = std::move(columns);
+  if (!includeFields.empty()) {
+    item.include_fields_ref() = std::move(nebula::value(includeRet));
+  }
   if (req.index_params_ref().has_value()) {
     item.index_params_ref() = *req.index_params_ref();
   }
@@ -214,7 +227,7 @@ void CreateTagIndexProcessor::process(const cpp2::CreateTagIndexReq& req) {
   LOG(INFO) << "Create Tag Index " << indexName << ", tagIndex " << tagIndex;
   resp_.id_ref() = to(tagIndex, EntryType::INDEX);
   auto timeInMilliSec = time::WallClock::fastNowInMilliSec();
-  LastUpdateTimeMan::update(data, timeInMilliSec);
+  LastUpdateTimeMan::update(data, timeInMilliSec, space);
   auto result = doSyncPut(std::move(data));
   handleErrorCode(result);
   onFinished();
@@ -5,6 +5,7 @@
 
 #include "meta/processors/job/StatsJobExecutor.h"
 
+#include "common/utils/IndexStatsUtils.h"
 #include "common/utils/MetaKeyUtils.h"
 #include "common/utils/Utils.h"
 #include "meta/processors/Common.h"
@@ -109,6 +110,7 @@ void StatsJobExecutor::addStats(cpp2::StatsItem& lhs, const cpp2::StatsItem& rhs
   (*lhs.negative_part_correlativity_ref())
       .insert((*rhs.negative_part_correlativity_ref()).begin(),  // NOLINT
               (*rhs.negative_part_correlativity_ref()).end());
+  IndexStatsUtils::mergeStatsItem(lhs, rhs);
 }
 
 /**
@@ -89,7 +89,7 @@ nebula::cpp2::ErrorCode ZoneBalanceJobExecutor::updateMeta() {
   properties.zone_names_ref() = std::move(zones);
   std::vector<kvstore::KV> data;
   auto timeInMilliSec = time::WallClock::fastNowInMilliSec();
-  LastUpdateTimeMan::update(data, timeInMilliSec);
+  LastUpdateTimeMan::update(data, timeInMilliSec, spaceInfo_.spaceId_);
   data.emplace_back(MetaKeyUtils::spaceKey(spaceInfo_.spaceId_),
                     MetaKeyUtils::spaceVal(properties));
   folly::Baton<true, std::atomic> baton;
@@ -86,7 +86,7 @@ void CreateSpaceAsProcessor::process(const cpp2::CreateSpaceAsReq &req) {
 
   resp_.id_ref() = to(nebula::value(newSpaceId), EntryType::SPACE);
   auto timeInMilliSec = time::WallClock::fastNowInMilliSec();
-  LastUpdateTimeMan::update(data, timeInMilliSec);
+  LastUpdateTimeMan::update(data, timeInMilliSec, nebula::value(newSpaceId));
   rc_ = doSyncPut(std::move(data));
   if (rc_ != nebula::cpp2::ErrorCode::SUCCEEDED) {
     LOG(INFO) << "Update last update time error, " << apache::thrift::util::enumNameSafe(rc_);
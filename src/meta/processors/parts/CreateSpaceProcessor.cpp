@@ -275,7 +275,7 @@ void CreateSpaceProcessor::process(const cpp2::CreateSpaceReq& req) {
   resp_.id_ref() = to(spaceId, EntryType::SPACE);
   LOG(INFO) << "Create space " << spaceName;
   auto timeInMilliSec = time::WallClock::fastNowInMilliSec();
-  LastUpdateTimeMan::update(data, timeInMilliSec);
+  LastUpdateTimeMan::update(data, timeInMilliSec, spaceId);
   auto result = doSyncPut(std::move(data));
   handleErrorCode(result);
   onFinished();
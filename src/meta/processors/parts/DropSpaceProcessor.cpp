@@ -128,6 +128,7 @@ void DropSpaceProcessor::process(const cpp2::DropSpaceReq& req) {
   // 7. Delete local_id meta data
   auto localIdkey = MetaKeyUtils::localIdKey(spaceId);
   batchHolder->remove(std::move(localIdkey));
+  batchHolder->remove(MetaKeyUtils::spaceLastUpdateTimeKey(spaceId));
 
   auto timeInMilliSec = time::WallClock::fastNowInMilliSec();
   LastUpdateTimeMan::update(batchHolder.get(), timeInMilliSec);
@@ -155,7 +155,7 @@ void AlterEdgeProcessor::process(const cpp2::AlterEdgeReq& req) {
                     MetaKeyUtils::schemaVal(edgeName, schema));
   resp_.id_ref() = to(edgeType, EntryType::EDGE);
   auto timeInMilliSec = time::WallClock::fastNowInMilliSec();
-  LastUpdateTimeMan::update(data, timeInMilliSec);
+  LastUpdateTimeMan::update(data, timeInMilliSec, spaceId);
   auto result = doSyncPut(std::move(data));
   handleErrorCode(result);
   onFinished();
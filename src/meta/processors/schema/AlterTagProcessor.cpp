@@ -149,7 +149,7 @@ void AlterTagProcessor::process(const cpp2::AlterTagReq& req) {
                     MetaKeyUtils::schemaVal(tagName, schema));
   resp_.id_ref() = to(tagId, EntryType::TAG);
   auto timeInMilliSec = time::WallClock::fastNowInMilliSec();
-  LastUpdateTimeMan::update(data, timeInMilliSec);
+  LastUpdateTimeMan::update(data, timeInMilliSec, spaceId);
   auto result = doSyncPut(std::move(data));
   handleErrorCode(result);
   onFinished();
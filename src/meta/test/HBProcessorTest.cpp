@@ -9,6 +9,7 @@
 #include "common/fs/TempDir.h"
 #include "common/utils/MetaKeyUtils.h"
 #include "meta/processors/admin/HBProcessor.h"
+#include "meta/processors/schema/CreateTagProcessor.h"
 #include "meta/test/TestUtils.h"
 
 namespace nebula {
@@ -63,6 +64,53 @@ TEST(HBProcessorTest, HBTest) {
   }
 }
 
+TEST(HBProcessorTest, SpaceUpdateTimeTest) {
+  fs::TempDir rootPath("/tmp/SpaceUpdateTimeTest.XXXXXX");
+  std::unique_ptr<kvstore::KVStore> kv(MockCluster::initMetaKV(rootPath.path()));
+  TestUtils::assembleSpace(kv.get(), 1, 1, 1, 1, true);
+  TestUtils::assembleSpace(kv.get(), 2, 1, 1, 1, true);
+
+  auto heartbeat = [&kv]() {
+    cpp2::HBReq req;
+    req.host_ref() = HostAddr("0", 0);
+    req.role_ref() = cpp2::HostRole::GRAPH;
+    auto* processor = HBProcessor::instance(kv.get(), nullptr);
+    auto f = processor->getFuture();
+    processor->process(req);
+    auto resp = std::move(f).get();
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, resp.get_code());
+    return resp;
+  };
+  {
+    auto resp = heartbeat();
+    ASSERT_TRUE(resp.space_update_time_in_ms_ref().has_value());
+    ASSERT_TRUE(resp.space_update_time_in_ms_ref()->empty());
+  }
+  {
+    cpp2::Schema schema;
+    std::vector<cpp2::ColumnDef> cols;
+    cols.emplace_back(TestUtils::columnDef(0, PropertyType::INT64));
+    schema.columns_ref() = std::move(cols);
+    cpp2::CreateTagReq req;
+    req.space_id_ref() = 1;
+    req.tag_name_ref() = "default_tag";
+    req.schema_ref() = std::move(schema);
+    auto* processor = CreateTagProcessor::instance(kv.get());
+    auto f = processor->getFuture();
+    processor->process(req);
+    auto resp = std::move(f).get();
+    ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, resp.get_code());
+  }
+  {
+    // only the changed space is reported
+    auto resp = heartbeat();
+    const auto& spaceUpdateTime = *resp.space_update_time_in_ms_ref();
+    ASSERT_EQ(1, spaceUpdateTime.size());
+    ASSERT_EQ(1, spaceUpdateTime.count(1));
+    ASSERT_EQ(resp.get_last_update_time_in_ms(), spaceUpdateTime.at(1));
+  }
+}
+
 }  // namespace meta
 }  // namespace nebula
 
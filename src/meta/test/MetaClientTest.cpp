@@ -2795,6 +2795,170 @@ TEST(MetaClientTest, RocksdbOptionsTest) {
   cluster.stop();
 }
 
+TEST(MetaClientTest, SnapshotSharingTest) {
+  FLAGS_heartbeat_interval_secs = 1;
+  fs::TempDir rootPath("/tmp/SnapshotSharingTest.XXXXXX");
+
+  mock::MockCluster cluster;
+  cluster.startMeta(rootPath.path());
+  cluster.initMetaClient();
+  auto* client = cluster.metaClient_.get();
+  {
+    std::vector<HostAddr> hosts = {{"0", 0}, {"1", 1}, {"2", 2}};
+    auto result = client->addHosts(hosts).get();
+    TestUtils::registerHB(cluster.metaKV_.get(), hosts);
+    ASSERT_TRUE(result.ok());
+  }
+  auto createSpace = [client](const std::string& name) {
+    meta::cpp2::SpaceDesc spaceDesc;
+    spaceDesc.space_name_ref() = name;
+    spaceDesc.partition_num_ref() = 3;
+    spaceDesc.replica_factor_ref() = 1;
+    auto ret = client->createSpace(spaceDesc).get();
+    CHECK(ret.ok()) << ret.status();
+    return ret.value();
+  };
+  auto createTag = [client](GraphSpaceID spaceId, const std::string& name) {
+    std::vector<cpp2::ColumnDef> columns;
+    columns.emplace_back();
+    columns.back().name_ref() = "col";
+    columns.back().type.type_ref() = PropertyType::INT64;
+    cpp2::Schema schema;
+    schema.columns_ref() = std::move(columns);
+    auto ret = client->createTagSchema(spaceId, name, std::move(schema)).get();
+    CHECK(ret.ok()) << ret.status();
+    return ret.value();
+  };
+  auto unchangedSpace = createSpace("unchanged_space");
+  auto changedSpace = createSpace("changed_space");
+  auto unchangedTag = createTag(unchangedSpace, "tag");
+  auto changedTag = createTag(changedSpace, "tag");
+  sleep(FLAGS_heartbeat_interval_secs + 1);
+
+  auto unchangedSchema = client->getTagSchemaFromCache(unchangedSpace, unchangedTag);
+  ASSERT_TRUE(unchangedSchema.ok());
+  auto changedSchema = client->getTagSchemaFromCache(changedSpace, changedTag);
+  ASSERT_TRUE(changedSchema.ok());
+
+  // Only changed_space is reloaded, the new snapshot shares the schemas of unchanged_space
+  createTag(changedSpace, "new_tag");
+  sleep(FLAGS_heartbeat_interval_secs + 1);
+  ASSERT_TRUE(client->refreshCache().ok());
+  ASSERT_TRUE(client->getTagIDByNameFromCache(changedSpace, "new_tag").ok());
+  {
+    auto ret = client->getTagSchemaFromCache(unchangedSpace, unchangedTag);
+    ASSERT_TRUE(ret.ok());
+    EXPECT_EQ(unchangedSchema.value().get(), ret.value().get());
+  }
+  {
+    // The schema read from the retired snapshot is still valid
+    auto ret = client->getTagSchemaFromCache(changedSpace, changedTag);
+    ASSERT_TRUE(ret.ok());
+    EXPECT_EQ(1, changedSchema.value()->getNumFields());
+    EXPECT_EQ(ret.value()->getNumFields(), changedSchema.value()->getNumFields());
+  }
+  cluster.stop();
+}
+
+TEST(MetaClientTest, StorageLeaderTest) {
+  FLAGS_heartbeat_interval_secs = 1;
+  fs::TempDir rootPath("/tmp/StorageLeaderTest.XXXXXX");
+
+  mock::MockCluster cluster;
+  cluster.startMeta(rootPath.path());
+  cluster.initMetaClient();
+  auto* client = cluster.metaClient_.get();
+  std::vector<HostAddr> hosts = {{"0", 0}, {"1", 1}, {"2", 2}};
+  {
+    auto result = client->addHosts(hosts).get();
+    TestUtils::registerHB(cluster.metaKV_.get(), hosts);
+    ASSERT_TRUE(result.ok());
+  }
+  meta::cpp2::SpaceDesc spaceDesc;
+  spaceDesc.space_name_ref() = "default_space";
+  spaceDesc.partition_num_ref() = 3;
+  spaceDesc.replica_factor_ref() = 3;
+  auto ret = client->createSpace(spaceDesc).get();
+  ASSERT_TRUE(ret.ok()) << ret.status();
+  GraphSpaceID spaceId = ret.value();
+  sleep(FLAGS_heartbeat_interval_secs + 1);
+  // No storage reported its leaders, the leaders are picked in round-robin
+  ASSERT_TRUE(client->refreshCache().ok());
+
+  PartitionID partId = 1;
+  auto partHosts = client->getPartHostsFromCache(spaceId, partId);
+  ASSERT_TRUE(partHosts.ok());
+  ASSERT_EQ(3, partHosts.value().hosts_.size());
+  {
+    auto first = client->getStorageLeaderFromCache(spaceId, partId);
+    ASSERT_TRUE(first.ok());
+    EXPECT_EQ(partHosts.value().hosts_[1], first.value());
+    // The picked one is cached
+    auto second = client->getStorageLeaderFromCache(spaceId, partId);
+    ASSERT_TRUE(second.ok());
+    EXPECT_EQ(first.value(), second.value());
+  }
+  {
+    // Invalidating the leader picks the next peer
+    client->invalidStorageLeader(spaceId, partId);
+    auto picked = client->getStorageLeaderFromCache(spaceId, partId);
+    ASSERT_TRUE(picked.ok());
+    EXPECT_EQ(partHosts.value().hosts_[2], picked.value());
+    auto leaderInfo = client->getLeaderInfo();
+    ASSERT_TRUE(leaderInfo.ok());
+    EXPECT_EQ(2, leaderInfo.value().pickedIndex_[std::make_pair(spaceId, partId)]);
+  }
+  {
+    HostAddr leader = partHosts.value().hosts_[0];
+    client->updateStorageLeader(spaceId, partId, leader);
+    auto ret2 = client->getStorageLeaderFromCache(spaceId, partId);
+    ASSERT_TRUE(ret2.ok());
+    EXPECT_EQ(leader, ret2.value());
+    auto leaderInfo = client->getLeaderInfo();
+    ASSERT_TRUE(leaderInfo.ok());
+    EXPECT_EQ(leader, leaderInfo.value().leaderMap_[std::make_pair(spaceId, partId)]);
+  }
+  {
+    // Readers always see one of the peers while the leader is updated concurrently
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> invalid{0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+      readers.emplace_back([&] {
+        while (!stop) {
+          auto leader = client->getStorageLeaderFromCache(spaceId, partId);
+          const auto& peers = partHosts.value().hosts_;
+          if (!leader.ok() ||
+              std::find(peers.begin(), peers.end(), leader.value()) == peers.end()) {
+            invalid++;
+          }
+        }
+      });
+    }
+    for (int i = 0; i < 10000; i++) {
+      if (i % 2 == 0) {
+        client->updateStorageLeader(spaceId, partId, partHosts.value().hosts_[i % 3]);
+      } else {
+        client->invalidStorageLeader(spaceId, partId);
+      }
+    }
+    stop = true;
+    for (auto& reader : readers) {
+      reader.join();
+    }
+    EXPECT_EQ(0, invalid);
+  }
+  {
+    // Reloading replaces the leaders with the ones reported by storage, none here
+    client->updateStorageLeader(spaceId, partId, partHosts.value().hosts_[0]);
+    ASSERT_TRUE(client->refreshCache().ok());
+    auto leaderInfo = client->getLeaderInfo();
+    ASSERT_TRUE(leaderInfo.ok());
+    EXPECT_TRUE(leaderInfo.value().leaderMap_.empty());
+  }
+  cluster.stop();
+}
+
 }  // namespace meta
 }  // namespace nebula
 
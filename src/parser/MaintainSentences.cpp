@@ -280,6 +280,11 @@ std::string CreateTagIndexSentence::toString() const {
   folly::join(", ", fieldDefs, fields);
   buf += fields;
   buf += ")";
+  if (includeFields_ != nullptr) {
+    buf += " INCLUDE (";
+    buf += folly::join(", ", includeFields());
+    buf += ")";
+  }
   std::string params;
   if (indexParams_ != nullptr) {
     params = indexParams_->toString();
@@ -319,6 +324,11 @@ std::string CreateEdgeIndexSentence::toString() const {
   folly::join(", ", fieldDefs, fields);
   buf += fields;
   buf += ")";
+  if (includeFields_ != nullptr) {
+    buf += " INCLUDE (";
+    buf += folly::join(", ", includeFields());
+    buf += ")";
+  }
   std::string params;
   if (indexParams_ != nullptr) {
     params = indexParams_->toString();
@@ -633,7 +633,8 @@ class CreateTagIndexSentence final : public CreateSentence {
                          IndexFieldList *fields,
                          bool ifNotExists,
                          IndexParamList *indexParams,
-                         std::string *comment)
+                         std::string *comment,
+                         NameLabelList *includeFields = nullptr)
       : CreateSentence(ifNotExists) {
     indexName_.reset(indexName);
     tagName_.reset(tagName);
@@ -644,6 +645,7 @@ class CreateTagIndexSentence final : public CreateSentence {
     }
     indexParams_.reset(indexParams);
     comment_.reset(comment);
+    includeFields_.reset(includeFields);
     kind_ = Kind::kCreateTagIndex;
   }
 
@@ -674,12 +676,23 @@ class CreateTagIndexSentence final : public CreateSentence {
     return comment_.get();
   }
 
+  std::vector<std::string> includeFields() const {
+    std::vector<std::string> result;
+    if (includeFields_ != nullptr) {
+      for (const auto *label : includeFields_->labels()) {
+        result.emplace_back(*label);
+      }
+    }
+    return result;
+  }
+
  private:
   std::unique_ptr<std::string> indexName_;
   std::unique_ptr<std::string> tagName_;
   std::unique_ptr<IndexFieldList> fields_;
   std::unique_ptr<IndexParamList> indexParams_;
   std::unique_ptr<std::string> comment_;
+  std::unique_ptr<NameLabelList> includeFields_;
 };
 
 class CreateEdgeIndexSentence final : public CreateSentence {
@@ -689,7 +702,8 @@ class CreateEdgeIndexSentence final : public CreateSentence {
                           IndexFieldList *fields,
                           bool ifNotExists,
                           IndexParamList *indexParams,
-                          std::string *comment)
+                          std::string *comment,
+                          NameLabelList *includeFields = nullptr)
       : CreateSentence(ifNotExists) {
     indexName_.reset(indexName);
     edgeName_.reset(edgeName);
@@ -700,6 +714,7 @@ class CreateEdgeIndexSentence final : public CreateSentence {
     }
     indexParams_.reset(indexParams);
     comment_.reset(comment);
+    includeFields_.reset(includeFields);
     kind_ = Kind::kCreateEdgeIndex;
   }
 
@@ -730,12 +745,23 @@ class CreateEdgeIndexSentence final : public CreateSentence {
     return comment_.get();
   }
 
+  std::vector<std::string> includeFields() const {
+    std::vector<std::string> result;
+    if (includeFields_ != nullptr) {
+      for (const auto *label : includeFields_->labels()) {
+        result.emplace_back(*label);
+      }
+    }
+    return result;
+  }
+
  private:
   std::unique_ptr<std::string> indexName_;
   std::unique_ptr<std::string> edgeName_;
   std::unique_ptr<IndexFieldList> fields_;
   std::unique_ptr<IndexParamList> indexParams_;
   std::unique_ptr<std::string> comment_;
+  std::unique_ptr<NameLabelList> includeFields_;
 };
 
 class DescribeTagIndexSentence final : public Sentence {
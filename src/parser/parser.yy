@@ -179,7 +179,7 @@ using namespace nebula;
 %token KW_NO KW_OVERWRITE KW_IN KW_DESCRIBE KW_DESC KW_SHOW KW_HOST KW_HOSTS KW_PART KW_PARTS KW_ADD
 %token KW_PARTITION_NUM KW_REPLICA_FACTOR KW_CHARSET KW_COLLATE KW_COLLATION KW_VID_TYPE
 %token KW_ATOMIC_EDGE
-%token KW_COMMENT KW_S2_MAX_LEVEL KW_S2_MAX_CELLS
+%token KW_COMMENT KW_S2_MAX_LEVEL KW_S2_MAX_CELLS KW_INCLUDE
 %token KW_DROP KW_CLEAR KW_REMOVE KW_SPACES KW_INGEST KW_INDEX KW_INDEXES
 %token KW_IF KW_NOT KW_EXISTS KW_WITH
 %token KW_BY KW_DOWNLOAD KW_HDFS KW_UUID KW_CONFIGS KW_FORCE
@@ -357,7 +357,7 @@ using namespace nebula;
 %type <role_type_clause> role_type_clause
 %type <acl_item_clause> acl_item_clause
 
-%type <name_label_list> name_label_list
+%type <name_label_list> name_label_list opt_index_include_list
 %type <index_field> index_field
 %type <index_field_list> index_field_list opt_index_field_list
 
@@ -562,6 +562,7 @@ unreserved_keyword
     | KW_COMMENT            { $$ = new std::string("comment"); }
     | KW_S2_MAX_LEVEL       { $$ = new std::string("s2_max_level"); }
     | KW_S2_MAX_CELLS       { $$ = new std::string("s2_max_cells"); }
+    | KW_INCLUDE            { $$ = new std::string("include"); }
     | KW_SESSION            { $$ = new std::string("session"); }
     | KW_SESSIONS           { $$ = new std::string("sessions"); }
     | KW_LOCAL              { $$ = new std::string("local"); }
@@ -2681,14 +2682,14 @@ opt_index_field_list
     ;
 
 create_tag_index_sentence
-    : KW_CREATE KW_TAG KW_INDEX opt_if_not_exists name_label KW_ON name_label L_PAREN opt_index_field_list R_PAREN opt_with_index_param_list opt_comment_prop {
-        $$ = new CreateTagIndexSentence($5, $7, $9, $4, $11, $12);
+    : KW_CREATE KW_TAG KW_INDEX opt_if_not_exists name_label KW_ON name_label L_PAREN opt_index_field_list R_PAREN opt_index_include_list opt_with_index_param_list opt_comment_prop {
+        $$ = new CreateTagIndexSentence($5, $7, $9, $4, $12, $13, $11);
     }
     ;
 
 create_edge_index_sentence
-    : KW_CREATE KW_EDGE KW_INDEX opt_if_not_exists name_label KW_ON name_label L_PAREN opt_index_field_list R_PAREN opt_with_index_param_list opt_comment_prop {
-        $$ = new CreateEdgeIndexSentence($5, $7, $9, $4, $11, $12);
+    : KW_CREATE KW_EDGE KW_INDEX opt_if_not_exists name_label KW_ON name_label L_PAREN opt_index_field_list R_PAREN opt_index_include_list opt_with_index_param_list opt_comment_prop {
+        $$ = new CreateEdgeIndexSentence($5, $7, $9, $4, $12, $13, $11);
     }
     ;
 
@@ -2744,6 +2745,15 @@ opt_comment_prop
     }
     ;
 
+opt_index_include_list
+    : %empty {
+        $$ = nullptr;
+    }
+    | KW_INCLUDE L_PAREN name_label_list R_PAREN {
+        $$ = $3;
+    }
+    ;
+
 opt_with_index_param_list
     : %empty {
         $$ = nullptr;
@@ -658,6 +658,25 @@ TEST_F(ParserTest, IndexOperation) {
     auto& sentence = result.value();
     EXPECT_EQ(query, sentence->toString());
   }
+  {
+    std::string query = "CREATE TAG INDEX name_index ON person(name(10)) INCLUDE (age, email)";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+    auto& sentence = result.value();
+    EXPECT_EQ(query, sentence->toString());
+  }
+  {
+    std::string query = "CREATE EDGE INDEX like_index ON like(likeness) INCLUDE (start_time)";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+    auto& sentence = result.value();
+    EXPECT_EQ(query, sentence->toString());
+  }
+  {
+    std::string query = "CREATE TAG INDEX name_index ON person(name(10)) INCLUDE ()";
+    auto result = parse(query);
+    ASSERT_FALSE(result.ok());
+  }
   {
     std::string query = "DROP TAG INDEX name_index";
     auto result = parse(query);
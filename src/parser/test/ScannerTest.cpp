@@ -379,6 +379,9 @@ TEST(Scanner, Basic) {
       CHECK_SEMANTIC_TYPE("PLAN", TokenType::KW_PLAN),
       CHECK_SEMANTIC_TYPE("plan", TokenType::KW_PLAN),
       CHECK_SEMANTIC_TYPE("Plan", TokenType::KW_PLAN),
+      CHECK_SEMANTIC_TYPE("INCLUDE", TokenType::KW_INCLUDE),
+      CHECK_SEMANTIC_TYPE("include", TokenType::KW_INCLUDE),
+      CHECK_SEMANTIC_TYPE("Include", TokenType::KW_INCLUDE),
       CHECK_SEMANTIC_TYPE("FETCH", TokenType::KW_FETCH),
       CHECK_SEMANTIC_TYPE("Fetch", TokenType::KW_FETCH),
       CHECK_SEMANTIC_TYPE("fetch", TokenType::KW_FETCH),
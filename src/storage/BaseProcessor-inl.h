@@ -11,6 +11,37 @@
 namespace nebula {
 namespace storage {
 
+template <typename RESP>
+template <typename REQ, typename RUN>
+void BaseProcessor<RESP>::syncReadIndex(const REQ& req, RUN&& run) {
+  if (!FLAGS_enable_follower_read) {
+    run(req);
+    return;
+  }
+  auto spaceId = req.get_space_id();
+  std::vector<PartitionID> parts;
+  std::vector<folly::Future<nebula::cpp2::ErrorCode>> futures;
+  parts.reserve(req.get_parts().size());
+  futures.reserve(req.get_parts().size());
+  for (const auto& part : req.get_parts()) {
+    parts.emplace_back(part.first);
+    futures.emplace_back(env_->kvstore_->syncReadIndex(spaceId, part.first));
+  }
+  // the read indexes are fulfilled in io threads of kvstore, run() dispatches to executor_ if any
+  folly::collectAll(futures)
+      .via(&folly::InlineExecutor::instance())
+      .thenValue([this, req, parts = std::move(parts), run = std::forward<RUN>(run)](
+                     std::vector<folly::Try<nebula::cpp2::ErrorCode>>&& codes) mutable {
+        for (size_t i = 0; i < codes.size(); i++) {
+          if (codes[i].hasValue() && codes[i].value() == nebula::cpp2::ErrorCode::SUCCEEDED) {
+            followerReadParts_.emplace(parts[i]);
+          }
+        }
+        // the parts not in followerReadParts_ are only read on leader
+        run(req);
+      });
+}
+
 template <typename RESP>
 nebula::cpp2::ErrorCode BaseProcessor<RESP>::writeResultTo(WriteResult code, bool isEdge) {
   switch (code) {
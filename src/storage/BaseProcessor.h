@@ -7,6 +7,7 @@
 #define STORAGE_BASEPROCESSOR_H_
 
 #include <folly/SpinLock.h>
+#include <folly/executors/InlineExecutor.h>
 #include <folly/futures/Future.h>
 #include <folly/futures/Promise.h>
 #include <thrift/lib/cpp/util/EnumUtils.h>
@@ -19,6 +20,8 @@
 #include "common/utils/IndexKeyUtils.h"
 #include "storage/CommonUtils.h"
 
+DECLARE_bool(enable_follower_read);
+
 namespace nebula {
 namespace storage {
 
@@ -74,6 +77,17 @@ class BaseProcessor {
     return nebula::cpp2::ErrorCode::SUCCEEDED;
   }
 
+  /**
+   * @brief Run the read request. When enable_follower_read is on, the read index of each part
+   * is fetched once before running, and the parts whose follower has applied up to it are put
+   * into followerReadParts_, which could be read with canReadFromFollower set.
+   *
+   * @param req Read request with space_id and parts keyed by partition id
+   * @param run Called with the request, in the thread which fulfills the read indexes
+   */
+  template <typename REQ, typename RUN>
+  void syncReadIndex(const REQ& req, RUN&& run);
+
   void doPut(GraphSpaceID spaceId, PartitionID partId, std::vector<kvstore::KV>&& data);
 
   void doRemove(GraphSpaceID spaceId, PartitionID partId, std::vector<std::string>&& keys);
@@ -124,6 +138,7 @@ class BaseProcessor {
   time::Duration duration_;
   std::vector<cpp2::PartitionResult> codes_;
   std::mutex lock_;
+  std::unordered_set<PartitionID> followerReadParts_;
   int32_t callingNum_{0};
   int32_t spaceVidLen_;
   bool isIntId_;
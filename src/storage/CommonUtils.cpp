@@ -5,6 +5,8 @@
 
 #include "storage/CommonUtils.h"
 
+#include "common/utils/IndexKeyUtils.h"
+
 namespace nebula {
 namespace storage {
 
@@ -62,5 +64,22 @@ StatusOr<Value> CommonUtils::ttlValue(const meta::SchemaProviderIf* schema, RowR
   return reader->getValueByName(std::move(ttlProp).second.second);
 }
 
+std::string CommonUtils::indexValue(const meta::SchemaProviderIf* schema,
+                                    RowReader* reader,
+                                    const meta::cpp2::IndexItem* index) {
+  auto ttl = ttlValue(schema, reader);
+  if (index->include_fields_ref().has_value() && !index->include_fields_ref()->empty()) {
+    auto includes = IndexKeyUtils::collectIncludeValues(reader, index, schema);
+    if (includes.ok()) {
+      return IndexKeyUtils::indexVal(ttl.ok() ? std::move(ttl).value() : Value(),
+                                     std::move(includes).value());
+    }
+    // The included columns would be read from data when they are not in index value
+    LOG(WARNING) << "Collect included values of index " << index->get_index_name()
+                 << " failed: " << includes.status();
+  }
+  return ttl.ok() ? IndexKeyUtils::indexVal(std::move(ttl).value()) : "";
+}
+
 }  // namespace storage
 }  // namespace nebula
@@ -12,12 +12,14 @@
 #include "common/base/Base.h"
 #include "common/base/ConcurrentLRUCache.h"
 #include "common/meta/IndexManager.h"
+#include "common/memory/MemoryTracker.h"
 #include "common/meta/SchemaManager.h"
 #include "common/stats/StatsManager.h"
 #include "common/utils/MemoryLockWrapper.h"
 #include "interface/gen-cpp2/storage_types.h"
 #include "kvstore/KVEngine.h"
 #include "kvstore/KVStore.h"
+#include "storage/StorageFlags.h"
 
 namespace nebula {
 namespace storage {
@@ -151,7 +153,8 @@ class PlanContext {
         sessionId_(0),
         planId_(0),
         vIdLen_(vIdLen),
-        isIntId_(isIntId) {}
+        isIntId_(isIntId),
+        memTracker_(newMemoryTracker()) {}
   PlanContext(
       StorageEnv* env, GraphSpaceID spaceId, size_t vIdLen, bool isIntId, ReqCommonRef commonRef)
       : env_(env),
@@ -159,7 +162,8 @@ class PlanContext {
         sessionId_(0),
         planId_(0),
         vIdLen_(vIdLen),
-        isIntId_(isIntId) {
+        isIntId_(isIntId),
+        memTracker_(newMemoryTracker()) {
     if (commonRef.has_value()) {
       auto& common = commonRef.value();
       sessionId_ = common.session_id_ref().value_or(0);
@@ -183,8 +187,20 @@ class PlanContext {
   // will be true if query is killed during execution
   bool isKilled_ = false;
 
+  // parts on follower which have applied up to the read index of leader, could be read locally
+  std::unordered_set<PartitionID> followerReadParts_;
+
   // Manage expressions
   ObjectPool objPool_;
+
+  // Tracks the memory of the result of request
+  std::shared_ptr<MemoryTracker> memTracker_;
+
+ private:
+  static std::shared_ptr<MemoryTracker> newMemoryTracker() {
+    return std::make_shared<MemoryTracker>("storage request",
+                                           FLAGS_storage_request_memory_quota_mb * 1024 * 1024);
+  }
 };
 
 // RunTimeContext stores information **may changed** during the process. Since
@@ -218,6 +234,14 @@ struct RuntimeContext {
     return &planContext_->objPool_;
   }
 
+  MemoryTracker* memoryTracker() const {
+    return planContext_->memTracker_.get();
+  }
+
+  bool canReadFromFollower(PartitionID partId) const {
+    return planContext_->followerReadParts_.count(partId) != 0;
+  }
+
   bool isPlanKilled() {
     if (env() == nullptr) {
       return false;
@@ -265,6 +289,14 @@ class CommonUtils final {
       const meta::SchemaProviderIf* schema);
 
   static StatusOr<Value> ttlValue(const meta::SchemaProviderIf* schema, RowReader* reader);
+
+  /**
+   * @brief Value of the index key of row, which has the ttl value and the values of the included
+   * columns of index. Return empty string if neither of them is needed.
+   */
+  static std::string indexValue(const meta::SchemaProviderIf* schema,
+                                RowReader* reader,
+                                const meta::cpp2::IndexItem* index);
 };
 
 }  // namespace storage
@@ -47,4 +47,19 @@ DEFINE_bool(query_concurrently,
             "whether to run query of each part concurrently, only lookup and "
             "go are supported");
 
+DEFINE_int32(max_index_scan_shards_per_part,
+             4,
+             "max number of threads to scan the key ranges of one part in lookup, only works "
+             "when query_concurrently is true");
+
 DEFINE_bool(use_vertex_key, false, "whether allow insert or query the vertex key");
+
+DEFINE_int32(memory_lock_wait_us,
+             0,
+             "max time in microseconds for updates and toss edge writes to wait for the memory "
+             "locks of hot keys held by others, 0 means failing with conflict at once");
+
+DEFINE_int64(storage_request_memory_quota_mb,
+             0,
+             "max estimated memory in MB of the result built by a read request, e.g. "
+             "GetNeighbors, 0 means unlimited");
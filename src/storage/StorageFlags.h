@@ -34,6 +34,12 @@ DECLARE_int32(max_edge_returned_per_vertex);
 
 DECLARE_bool(query_concurrently);
 
+DECLARE_int32(max_index_scan_shards_per_part);
+
 DECLARE_bool(use_vertex_key);
 
+DECLARE_int32(memory_lock_wait_us);
+
+DECLARE_int64(storage_request_memory_quota_mb);
+
 #endif  // STORAGE_STORAGEFLAGS_H_
@@ -126,14 +126,6 @@ nebula::cpp2::ErrorCode RebuildEdgeIndexTask::buildIndexGlobal(GraphSpaceID spac
       continue;
     }
 
-    std::string indexVal = "";
-    if (ttlProp.first) {
-      auto ttlValRet = CommonUtils::ttlValue(schema, reader.get());
-      if (ttlValRet.ok()) {
-        indexVal = IndexKeyUtils::indexVal(std::move(ttlValRet).value());
-      }
-    }
-
     for (const auto& item : items) {
       if (item->get_schema_id().get_edge_type() == edgeType) {
         auto valuesRet = IndexKeyUtils::collectIndexValues(reader.get(), item.get(), schema);
@@ -148,6 +140,7 @@ nebula::cpp2::ErrorCode RebuildEdgeIndexTask::buildIndexGlobal(GraphSpaceID spac
                                                       ranking,
                                                       destination.toString(),
                                                       std::move(valuesRet).value());
+        auto indexVal = CommonUtils::indexValue(schema, reader.get(), item.get());
         for (auto& indexKey : indexKeys) {
           batchSize += indexKey.size() + indexVal.size();
           data.emplace_back(std::move(indexKey), indexVal);
@@ -8,6 +8,8 @@
 #include <thrift/lib/cpp/util/EnumUtils.h>
 
 #include "common/base/MurmurHash2.h"
+#include "common/utils/IndexKeyUtils.h"
+#include "common/utils/IndexStatsUtils.h"
 #include "common/utils/NebulaKeyUtils.h"
 #include "kvstore/Common.h"
 #include "storage/StorageFlags.h"
@@ -54,6 +56,63 @@ nebula::cpp2::ErrorCode StatsTask::getSchemas(GraphSpaceID spaceId) {
     }
     edges_.emplace(edgeType, std::move(edgeNameRet.value()));
   }
+
+  if (env_->indexMan_ != nullptr) {
+    auto tagIndexes = env_->indexMan_->getTagIndexes(spaceId);
+    auto edgeIndexes = env_->indexMan_->getEdgeIndexes(spaceId);
+    if (!tagIndexes.ok() || !edgeIndexes.ok()) {
+      return nebula::cpp2::ErrorCode::E_SPACE_NOT_FOUND;
+    }
+    for (auto& indexes : {tagIndexes.value(), edgeIndexes.value()}) {
+      for (auto& index : indexes) {
+        // The values of geography index are cell ids, which are useless to estimate selectivity
+        auto& fields = index->get_fields();
+        if (fields.empty() ||
+            fields[0].get_type().get_type() == nebula::cpp2::PropertyType::GEOGRAPHY) {
+          continue;
+        }
+        indexes_.emplace_back(index);
+      }
+    }
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode StatsTask::collectIndexStats(GraphSpaceID spaceId,
+                                                     PartitionID part,
+                                                     size_t vIdLen,
+                                                     size_t& countToSleep,
+                                                     nebula::meta::cpp2::StatsItem& statsItem) {
+  std::unordered_map<IndexID, nebula::meta::cpp2::IndexStats> indexStats;
+  for (const auto& index : indexes_) {
+    auto& fields = index->get_fields();
+    bool isEdgeIndex = index->get_schema_id().edge_type_ref().has_value();
+    bool hasNullableCol = std::any_of(fields.begin(), fields.end(), [](const auto& field) {
+      return field.nullable_ref().value_or(false);
+    });
+    auto prefix = IndexKeyUtils::indexPrefix(part, index->get_index_id());
+    std::unique_ptr<kvstore::KVIterator> iter;
+    auto ret = env_->kvstore_->prefix(spaceId, part, prefix, &iter, true);
+    if (ret != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      LOG(INFO) << "Stats task failed";
+      return ret;
+    }
+
+    // The index keys are sorted by the first column
+    IndexStatsBuilder builder(IndexStatsUtils::kNumBuckets);
+    while (iter && iter->valid()) {
+      if (UNLIKELY(canceled_)) {
+        LOG(INFO) << "Stats task is canceled";
+        return nebula::cpp2::ErrorCode::E_USER_CANCEL;
+      }
+      builder.add(IndexKeyUtils::getValueFromIndexKey(
+          vIdLen, iter->key(), fields[0].get_name(), fields, isEdgeIndex, hasNullableCol));
+      iter->next();
+      sleepIfScannedSomeRecord(++countToSleep);
+    }
+    indexStats.emplace(index->get_index_id(), builder.finish());
+  }
+  statsItem.index_stats_ref() = std::move(indexStats);
   return nebula::cpp2::ErrorCode::SUCCEEDED;
 }
 
@@ -138,6 +197,7 @@ nebula::cpp2::ErrorCode StatsTask::genSubTask(GraphSpaceID spaceId,
   std::unordered_map<EdgeType, int64_t> edgetypeEdges;
   std::unordered_map<PartitionID, int64_t> positiveRelevancy;
   std::unordered_map<PartitionID, int64_t> negativeRelevancy;
+  std::unordered_map<EdgeType, nebula::meta::cpp2::DegreeStats> edgeDegrees;
   int64_t spaceVertices = 0;
   int64_t spaceEdges = 0;
   // Once 1000 records are scanned, check if we need to sleep for a while to prevent high pressure
@@ -197,6 +257,18 @@ nebula::cpp2::ErrorCode StatsTask::genSubTask(GraphSpaceID spaceId,
   // 1    1       1    2
   // 2    2       1    3  (invalid data, for example, edge data without edge
   // schema) 2    3       1    4 2    3       1    5
+  // The out edges of a vertex are adjacent, count the out degrees of each edge type of the last
+  // source vertex, and add them into edgeDegrees when the source changes
+  std::string lastSource;
+  std::unordered_map<EdgeType, int64_t> sourceDegrees;
+  auto flushDegrees = [&edgeDegrees, &sourceDegrees]() {
+    for (auto& degree : sourceDegrees) {
+      auto& stats = edgeDegrees[degree.first];
+      *stats.num_sources_ref() += 1;
+      stats.max_degree_ref() = std::max(stats.get_max_degree(), degree.second);
+    }
+    sourceDegrees.clear();
+  };
   while (edgeIter && edgeIter->valid()) {
     if (UNLIKELY(canceled_)) {
       LOG(INFO) << "Stats task is canceled";
@@ -218,6 +290,11 @@ nebula::cpp2::ErrorCode StatsTask::genSubTask(GraphSpaceID spaceId,
     if (edgeType > 0) {
       spaceEdges++;
       edgetypeEdges[edgeType] += 1;
+      if (source != lastSource) {
+        flushDegrees();
+        lastSource = source;
+      }
+      sourceDegrees[edgeType]++;
 
       uint64_t destinationVid = 0;
       if (isIntId) {
@@ -240,6 +317,7 @@ nebula::cpp2::ErrorCode StatsTask::genSubTask(GraphSpaceID spaceId,
     edgeIter->next();
     sleepIfScannedSomeRecord(++countToSleep);
   }
+  flushDegrees();
   int64_t verticesCountByVertexKey = 0;
   if (FLAGS_use_vertex_key) {
     while (vertexIter && vertexIter->valid()) {
@@ -249,6 +327,10 @@ nebula::cpp2::ErrorCode StatsTask::genSubTask(GraphSpaceID spaceId,
     }
   }
   nebula::meta::cpp2::StatsItem statsItem;
+  ret = collectIndexStats(spaceId, part, vIdLen, countToSleep, statsItem);
+  if (ret != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return ret;
+  }
 
   // convert tagId/edgeType to tagName/edgeName
   for (auto& tagElem : tagsVertices) {
@@ -263,6 +345,14 @@ nebula::cpp2::ErrorCode StatsTask::genSubTask(GraphSpaceID spaceId,
       (*statsItem.edges_ref()).emplace(iter->second, edgeElem.second);
     }
   }
+  std::unordered_map<std::string, nebula::meta::cpp2::DegreeStats> degrees;
+  for (auto& degreeElem : edgeDegrees) {
+    auto iter = edges_.find(degreeElem.first);
+    if (iter != edges_.end()) {
+      degrees.emplace(iter->second, std::move(degreeElem.second));
+    }
+  }
+  statsItem.edge_degrees_ref() = std::move(degrees);
 
   statsItem.space_vertices_ref() = FLAGS_use_vertex_key ? verticesCountByVertexKey : spaceVertices;
   statsItem.space_edges_ref() = spaceEdges;
@@ -350,6 +440,7 @@ void StatsTask::finish(nebula::cpp2::ErrorCode rc) {
       (*result.negative_part_correlativity_ref())
           .insert((*item.negative_part_correlativity_ref()).begin(),
                   (*item.negative_part_correlativity_ref()).end());
+      IndexStatsUtils::mergeStatsItem(result, item);
     }
     result.status_ref() = nebula::meta::cpp2::JobStatus::FINISHED;
     ctx_.onFinish_(rc, result);
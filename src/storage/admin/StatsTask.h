@@ -52,6 +52,15 @@ class StatsTask : public AdminTask {
  private:
   nebula::cpp2::ErrorCode getSchemas(GraphSpaceID spaceId);
 
+  /**
+   * @brief Collect the statistics of the first column of each index in part
+   */
+  nebula::cpp2::ErrorCode collectIndexStats(GraphSpaceID spaceId,
+                                            PartitionID part,
+                                            size_t vIdLen,
+                                            size_t& countToSleep,
+                                            nebula::meta::cpp2::StatsItem& statsItem);
+
   void sleepIfScannedSomeRecord(size_t& countToSleep);
 
  protected:
@@ -63,6 +72,9 @@ class StatsTask : public AdminTask {
   // All edgeTypes and edgeName of the spaceId
   std::unordered_map<EdgeType, std::string> edges_;
 
+  // All indexes of the spaceId whose statistics are collected
+  std::vector<std::shared_ptr<nebula::meta::cpp2::IndexItem>> indexes_;
+
   folly::ConcurrentHashMap<PartitionID, nebula::meta::cpp2::StatsItem> statistics_;
 
   // The number of subtasks equals to the number of parts in request
@@ -127,7 +127,8 @@ class FetchEdgeNode final : public EdgeNode<cpp2::EdgeKey> {
                                    *edgeKey.edge_type_ref(),
                                    *edgeKey.ranking_ref(),
                                    (*edgeKey.dst_ref()).getStr());
-    ret = context_->env()->kvstore_->get(context_->spaceId(), partId, key_, &val_);
+    ret = context_->env()->kvstore_->get(
+        context_->spaceId(), partId, key_, &val_, context_->canReadFromFollower(partId));
     if (ret == nebula::cpp2::ErrorCode::SUCCEEDED) {
       return doExecute(key_, val_);
     } else if (ret == nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
@@ -219,7 +220,8 @@ class SingleEdgeNode final : public EdgeNode<VertexID> {
             << ", prop size " << props_->size();
     std::unique_ptr<kvstore::KVIterator> iter;
     prefix_ = NebulaKeyUtils::edgePrefix(context_->vIdLen(), partId, vId, edgeType_);
-    ret = context_->env()->kvstore_->prefix(context_->spaceId(), partId, prefix_, &iter);
+    ret = context_->env()->kvstore_->prefix(
+        context_->spaceId(), partId, prefix_, &iter, context_->canReadFromFollower(partId));
     if (ret == nebula::cpp2::ErrorCode::SUCCEEDED && iter && iter->valid()) {
       iter_.reset(new SingleEdgeIterator(context_, std::move(iter), edgeType_, schemas_, &ttl_));
     } else {
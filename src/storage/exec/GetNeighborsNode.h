@@ -8,6 +8,7 @@
 
 #include "common/algorithm/ReservoirSampling.h"
 #include "common/base/Base.h"
+#include "common/datatypes/MemoryEstimator.h"
 #include "storage/StorageFlags.h"
 #include "storage/exec/AggregateNode.h"
 #include "storage/exec/HashJoinNode.h"
@@ -93,6 +94,11 @@ class GetNeighborsNode : public QueryNode<VertexID> {
     // only set filterInvalidResultOut = true in TagOnly mode
     // so if it it an edge, this test is always true
     if (!context_->filterInvalidResultOut || context_->resultStat_ == ResultStatus::NORMAL) {
+      auto* tracker = context_->memoryTracker();
+      // Only estimate the memory when there is a quota, it's freed with the request
+      if (tracker->limit() > 0 && !tracker->alloc(MemoryEstimator::estimate(row)).ok()) {
+        return nebula::cpp2::ErrorCode::E_MEMORY_QUOTA_EXCEEDED;
+      }
       resultDataSet_->rows.emplace_back(std::move(row));
     }
 
@@ -65,7 +65,11 @@ class GetTagPropNode : public QueryNode<VertexID> {
         // check if vId has any valid tag by prefix scan
         std::unique_ptr<kvstore::KVIterator> iter;
         auto tagPrefix = NebulaKeyUtils::tagPrefix(context_->vIdLen(), partId, vId);
-        ret = context_->env()->kvstore_->prefix(context_->spaceId(), partId, tagPrefix, &iter);
+        ret = context_->env()->kvstore_->prefix(context_->spaceId(),
+                                                partId,
+                                                tagPrefix,
+                                                &iter,
+                                                context_->canReadFromFollower(partId));
         if (ret != nebula::cpp2::ErrorCode::SUCCEEDED) {
           return ret;
         } else if (!iter->valid()) {
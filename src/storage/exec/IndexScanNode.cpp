@@ -328,6 +328,13 @@ void PrefixPath::resetPart(PartitionID partId) {
   prefix_ = prefix_.replace(0, p.size(), p);
 }
 
+std::pair<std::string, std::string> PrefixPath::keyRange() {
+  // Same as the end of RangePath, append '\xFF' to the prefix until it is longer than any key
+  std::string end = prefix_;
+  end.append(totalKeyLength_ - end.size() + 1, '\xFF');
+  return {prefix_, std::move(end)};
+}
+
 void PrefixPath::buildKey() {
   std::string common;
   common.append(IndexKeyUtils::indexPrefix(0, index_->index_id_ref().value()));
@@ -359,17 +366,22 @@ IndexScanNode::IndexScanNode(const IndexScanNode& node)
       indexId_(node.indexId_),
       index_(node.index_),
       columnHints_(node.columnHints_),
+      shard_(node.shard_),
+      numShards_(node.numShards_),
       kvstore_(node.kvstore_),
       indexNullable_(node.indexNullable_),
       requiredColumns_(node.requiredColumns_),
       requiredAndHintColumns_(node.requiredAndHintColumns_),
       ttlProps_(node.ttlProps_),
       needAccessBase_(node.needAccessBase_),
+      needIncludeValues_(node.needIncludeValues_),
       colPosMap_(node.colPosMap_) {
-  if (node.path_->isRange()) {
-    path_ = std::make_unique<RangePath>(*dynamic_cast<RangePath*>(node.path_.get()));
-  } else {
-    path_ = std::make_unique<PrefixPath>(*dynamic_cast<PrefixPath*>(node.path_.get()));
+  for (auto& path : node.paths_) {
+    if (path->isRange()) {
+      paths_.emplace_back(std::make_unique<RangePath>(*dynamic_cast<RangePath*>(path.get())));
+    } else {
+      paths_.emplace_back(std::make_unique<PrefixPath>(*dynamic_cast<PrefixPath*>(path.get())));
+    }
   }
 }
 
@@ -378,8 +390,10 @@ IndexScanNode::IndexScanNode(const IndexScanNode& node)
   ttlProps_ = CommonUtils::ttlProps(getSchema().back().get());
   requiredAndHintColumns_ = ctx.requiredColumns;
   auto schema = getSchema().back();
-  for (auto& hint : columnHints_) {
-    requiredAndHintColumns_.insert(hint.get_column_name());
+  for (auto* columnHints : columnHints_) {
+    for (auto& hint : *columnHints) {
+      requiredAndHintColumns_.insert(hint.get_column_name());
+    }
   }
   for (auto& col : ctx.requiredColumns) {
     requiredColumns_.push_back(col);
@@ -401,6 +415,12 @@ IndexScanNode::IndexScanNode(const IndexScanNode& node)
     }
     tmp.erase(field.get_name());
   }
+  // The included columns are stored in index value
+  if (index_->include_fields_ref().has_value()) {
+    for (auto& field : *index_->include_fields_ref()) {
+      needIncludeValues_ |= tmp.erase(field.get_name()) > 0;
+    }
+  }
   tmp.erase(kVid);
   tmp.erase(kTag);
   tmp.erase(kRank);
@@ -408,7 +428,10 @@ IndexScanNode::IndexScanNode(const IndexScanNode& node)
   tmp.erase(kDst);
   tmp.erase(kType);
   needAccessBase_ = !tmp.empty();
-  path_ = Path::make(index_.get(), getSchema().back().get(), columnHints_, context_->vIdLen());
+  for (auto* columnHints : columnHints_) {
+    paths_.emplace_back(
+        Path::make(index_.get(), getSchema().back().get(), *columnHints, context_->vIdLen()));
+  }
   return ::nebula::cpp2::ErrorCode::SUCCEEDED;
 }
 
@@ -419,52 +442,103 @@ nebula::cpp2::ErrorCode IndexScanNode::doExecute(PartitionID partId) {
 }
 
 IndexNode::Result IndexScanNode::doNext() {
-  for (; iter_ && iter_->valid(); iter_->next()) {
-    if (!checkTTL()) {
-      continue;
-    }
-    auto q = path_->qualified(iter_->key());
-    if (q == QualifiedStrategy::INCOMPATIBLE) {
-      continue;
-    }
-    bool compatible = q == QualifiedStrategy::COMPATIBLE;
-    if (compatible && !needAccessBase_) {
-      auto key = iter_->key().toString();
-      iter_->next();
-      Row row = decodeFromIndex(key);
-      return Result(std::move(row));
-    }
-    std::pair<std::string, std::string> kv;
-    auto ret = getBaseData(iter_->key(), kv);
-    if (ret == nebula::cpp2::ErrorCode::SUCCEEDED) {  // do nothing
-    } else if (ret == nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
-      if (LIKELY(!fatalOnBaseNotFound_)) {
-        LOG(WARNING) << "base data not found";
-      } else {
-        LOG(FATAL) << "base data not found";
+  while (iter_) {
+    for (; iter_->valid(); iter_->next()) {
+      if (!checkTTL()) {
+        continue;
       }
-      continue;
-    } else {
-      return Result(ret);
-    }
-    Map<std::string, Value> rowData = decodeFromBase(kv.first, kv.second);
-    if (!compatible) {
-      q = path_->qualified(rowData);
-      CHECK(q != QualifiedStrategy::UNCERTAIN);
+      auto q = qualified(iter_->key());
       if (q == QualifiedStrategy::INCOMPATIBLE) {
         continue;
       }
+      bool compatible = q == QualifiedStrategy::COMPATIBLE;
+      if (compatible && !needAccessBase_) {
+        std::optional<std::vector<Value>> includes;
+        if (needIncludeValues_) {
+          includes = IndexKeyUtils::parseIndexIncludes(iter_->val());
+        }
+        // Read base data if the index value was written before it has the included columns
+        if (!needIncludeValues_ ||
+            (includes.has_value() && includes->size() == index_->include_fields_ref()->size())) {
+          auto key = iter_->key().toString();
+          iter_->next();
+          Row row = decodeFromIndex(key);
+          if (needIncludeValues_) {
+            decodeIncludeFromIndex(std::move(includes).value(), row.values);
+          }
+          return Result(std::move(row));
+        }
+      }
+      std::pair<std::string, std::string> kv;
+      auto ret = getBaseData(iter_->key(), kv);
+      if (ret == nebula::cpp2::ErrorCode::SUCCEEDED) {  // do nothing
+      } else if (ret == nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+        if (LIKELY(!fatalOnBaseNotFound_)) {
+          LOG(WARNING) << "base data not found";
+        } else {
+          LOG(FATAL) << "base data not found";
+        }
+        continue;
+      } else {
+        return Result(ret);
+      }
+      Map<std::string, Value> rowData = decodeFromBase(kv.first, kv.second);
+      if (!compatible) {
+        q = qualified(rowData);
+        CHECK(q != QualifiedStrategy::UNCERTAIN);
+        if (q == QualifiedStrategy::INCOMPATIBLE) {
+          continue;
+        }
+      }
+      Row row;
+      for (auto& col : requiredColumns_) {
+        row.emplace_back(std::move(rowData.at(col)));
+      }
+      iter_->next();
+      return Result(std::move(row));
     }
-    Row row;
-    for (auto& col : requiredColumns_) {
-      row.emplace_back(std::move(rowData.at(col)));
+    auto ret = nextRange();
+    if (ret != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return Result(ret);
     }
-    iter_->next();
-    return Result(std::move(row));
   }
   return Result();
 }
 
+QualifiedStrategy::Result IndexScanNode::qualified(const folly::StringPiece& key) {
+  if (paths_.size() == 1) {
+    return paths_.front()->qualified(key);
+  }
+  uncertainPaths_.clear();
+  auto ret = QualifiedStrategy::INCOMPATIBLE;
+  for (auto& pathRange : ranges_[nextRange_ - 1].paths) {
+    if (key < folly::StringPiece(pathRange.start) || key >= folly::StringPiece(pathRange.end)) {
+      continue;
+    }
+    auto q = pathRange.path->qualified(key);
+    if (q == QualifiedStrategy::COMPATIBLE) {
+      return q;
+    }
+    if (q == QualifiedStrategy::UNCERTAIN) {
+      uncertainPaths_.emplace_back(pathRange.path);
+      ret = q;
+    }
+  }
+  return ret;
+}
+
+QualifiedStrategy::Result IndexScanNode::qualified(const Map<std::string, Value>& rowData) {
+  if (paths_.size() == 1) {
+    return paths_.front()->qualified(rowData);
+  }
+  for (auto* path : uncertainPaths_) {
+    if (path->qualified(rowData) == QualifiedStrategy::COMPATIBLE) {
+      return QualifiedStrategy::COMPATIBLE;
+    }
+  }
+  return QualifiedStrategy::INCOMPATIBLE;
+}
+
 bool IndexScanNode::checkTTL() {
   if (iter_->val().empty() || ttlProps_.first == false) {
     return true;
@@ -480,16 +554,69 @@ bool IndexScanNode::checkTTL() {
 }
 
 nebula::cpp2::ErrorCode IndexScanNode::resetIter(PartitionID partId) {
-  path_->resetPart(partId);
-  nebula::cpp2::ErrorCode ret = nebula::cpp2::ErrorCode::SUCCEEDED;
-  if (path_->isRange()) {
-    auto rangePath = dynamic_cast<RangePath*>(path_.get());
-    kvstore_->range(spaceId_, partId, rangePath->getStartKey(), rangePath->getEndKey(), &iter_);
-  } else {
-    auto prefixPath = dynamic_cast<PrefixPath*>(path_.get());
-    ret = kvstore_->prefix(spaceId_, partId, prefixPath->getPrefixKey(), &iter_);
+  iter_.reset();
+  ranges_.clear();
+  nextRange_ = 0;
+  if (paths_.size() == 1) {
+    auto& path = paths_.front();
+    path->resetPart(partId);
+    nebula::cpp2::ErrorCode ret = nebula::cpp2::ErrorCode::SUCCEEDED;
+    if (path->isRange()) {
+      auto rangePath = dynamic_cast<RangePath*>(path.get());
+      kvstore_->range(spaceId_, partId, rangePath->getStartKey(), rangePath->getEndKey(), &iter_);
+    } else {
+      auto prefixPath = dynamic_cast<PrefixPath*>(path.get());
+      ret = kvstore_->prefix(spaceId_, partId, prefixPath->getPrefixKey(), &iter_);
+    }
+    return ret;
+  }
+
+  std::vector<PathRange> pathRanges;
+  pathRanges.reserve(paths_.size());
+  for (auto& path : paths_) {
+    path->resetPart(partId);
+    auto [start, end] = path->keyRange();
+    if (start < end) {
+      pathRanges.emplace_back(PathRange{std::move(start), std::move(end), path.get()});
+    }
+  }
+  std::sort(pathRanges.begin(), pathRanges.end(), [](const auto& a, const auto& b) {
+    return a.start < b.start;
+  });
+  // Merge the overlapped ranges, so each key is read once no matter how many paths contain it
+  std::vector<ScanRange> merged;
+  for (auto& pathRange : pathRanges) {
+    if (merged.empty() || merged.back().end <= pathRange.start) {
+      merged.emplace_back(ScanRange{pathRange.start, pathRange.end, {}});
+    } else if (merged.back().end < pathRange.end) {
+      merged.back().end = pathRange.end;
+    }
+    merged.back().paths.emplace_back(std::move(pathRange));
+  }
+  for (size_t i = shard_; i < merged.size(); i += numShards_) {
+    ranges_.emplace_back(std::move(merged[i]));
+  }
+  return nextRange();
+}
+
+nebula::cpp2::ErrorCode IndexScanNode::nextRange() {
+  iter_.reset();
+  if (nextRange_ >= ranges_.size()) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  auto& range = ranges_[nextRange_++];
+  return kvstore_->range(spaceId_, partId_, range.start, range.end, &iter_);
+}
+
+void IndexScanNode::decodeIncludeFromIndex(std::vector<Value>&& includes,
+                                           std::vector<Value>& values) {
+  auto& fields = *index_->include_fields_ref();
+  for (size_t i = 0; i < fields.size(); i++) {
+    auto iter = colPosMap_.find(fields[i].get_name());
+    if (iter != colPosMap_.end()) {
+      values[iter->second] = std::move(includes[i]);
+    }
   }
-  return ret;
 }
 
 void IndexScanNode::decodePropFromIndex(folly::StringPiece key,
@@ -554,7 +681,11 @@ void IndexScanNode::decodePropFromIndex(folly::StringPiece key,
 }
 
 std::string IndexScanNode::identify() {
-  return fmt::format("{}(IndexID={}, Path=({}))", name_, indexId_, path_->toString());
+  std::vector<std::string> paths;
+  for (auto& path : paths_) {
+    paths.emplace_back(fmt::format("({})", path->toString()));
+  }
+  return fmt::format("{}(IndexID={}, Path={})", name_, indexId_, folly::join(", ", paths));
 }
 
 // End of IndexScan
@@ -22,158 +22,6 @@ namespace storage {
 class Path;
 class QualifiedStrategySet;
 
-/**
- * @brief `IndexScanNode` is the base class of the node which need to access disk. It has two derive
- * class `IndexVertexScanNode` and `IndexEdgeScanNode`.
- *
- * `IndexScanNode` will access index data, and then access base data if necessary.
- *
- * @implements IndexNode
- * @see IndexNode, IndexVertexScanNode, IndexEdgeScanNode
- *
- */
-class IndexScanNode : public IndexNode {
-  FRIEND_TEST(IndexScanTest, Base);
-  FRIEND_TEST(IndexScanTest, Vertex);
-  FRIEND_TEST(IndexScanTest, Edge);
-  // There are too many unittests, so a helper is defined to access private data
-  friend class IndexScanTestHelper;
-
- public:
-  /**
-   * @brief shallow copy.
-   * @attention This constructor will create a new Path
-   * @see IndexNode::IndexNode(const IndexNode& node)
-   */
-  IndexScanNode(const IndexScanNode& node);
-
-  /**
-   * @brief Construct a new Index Scan Node object
-   *
-   * @param context
-   * @param name
-   * @param indexId
-   * @param columnHints
-   * @param kvstore
-   */
-  IndexScanNode(RuntimeContext* context,
-                const std::string& name,
-                IndexID indexId,
-                const std::vector<cpp2::IndexColumnHint>& columnHints,
-                ::nebula::kvstore::KVStore* kvstore,
-                bool hasNullableCol)
-      : IndexNode(context, name),
-        indexId_(indexId),
-        columnHints_(columnHints),
-        kvstore_(kvstore),
-        indexNullable_(hasNullableCol) {}
-  ::nebula::cpp2::ErrorCode init(InitContext& ctx) override;
-  std::string identify() override;
-
- protected:
-  nebula::cpp2::ErrorCode doExecute(PartitionID partId) final;
-  Result doNext() final;
-
-  /**
-   * @brief decode values from index key
-   *
-   * @param key index key
-   * @param colPosMap needed columns and these position(order) in values
-   * @param values result.Its order must meet the requirements of colPosMap.
-   */
-  void decodePropFromIndex(folly::StringPiece key,
-                           const Map<std::string, size_t>& colPosMap,
-                           std::vector<Value>& values);
-  /**
-   * @brief decode all props from index key
-   *
-   * decodePropFromIndex() will decode props who are defined in tag/edge properties.And,
-   * IndexScanNode sometime needs not only those but alse vid,edge_type,tag_id. decodeFromIndex()
-   * should be override by derived class and decode these special prop and then call
-   * decodePropFromIndex() to decode general props.
-   *
-   * @param key index key
-   * @return Row
-   * @see decodePropFromIndex
-   */
-  virtual Row decodeFromIndex(folly::StringPiece key) = 0;
-
-  /**
-   * @brief get the base data key-value according to index key
-   *
-   * @param key index key
-   * @param kv base data key-value
-   * @return nebula::cpp2::ErrorCode
-   */
-  virtual nebula::cpp2::ErrorCode getBaseData(folly::StringPiece key,
-                                              std::pair<std::string, std::string>& kv) = 0;
-
-  /**
-   * @brief decode all props from base data key-value.
-   *
-   * @param key base data key
-   * @param value base data value
-   * @return Map<std::string, Value>
-   */
-  virtual Map<std::string, Value> decodeFromBase(const std::string& key,
-                                                 const std::string& value) = 0;
-  virtual const std::vector<std::shared_ptr<const meta::NebulaSchemaProvider>>& getSchema() = 0;
-
-  /**
-   * @brief Check whether the indexkey has expired
-   *
-   * @return true
-   * @return false
-   */
-  bool checkTTL();
-
-  /**
-   * @brief start query a new part
-   *
-   * @param partId
-   * @return nebula::cpp2::ErrorCode
-   * @see Path
-   */
-  nebula::cpp2::ErrorCode resetIter(PartitionID partId);
-  PartitionID partId_;
-  /**
-   * @brief index_ in this Node to access
-   */
-  const IndexID indexId_;
-  /**
-   * @brief index definition
-   */
-  std::shared_ptr<nebula::meta::cpp2::IndexItem> index_;
-  const std::vector<cpp2::IndexColumnHint>& columnHints_;
-  /**
-   * @see Path
-   */
-  std::unique_ptr<Path> path_;
-  /**
-   * @brief current kvstore iterator.It while be reset `doExecute` and iterated during `doNext`
-   */
-  std::unique_ptr<kvstore::KVIterator> iter_;
-  nebula::kvstore::KVStore* kvstore_;
-  /**
-   * @brief if index contain nullable field or not
-   */
-  bool indexNullable_ = false;
-  /**
-   * @brief row format that `doNext` needs to return
-   */
-  std::vector<std::string> requiredColumns_;
-  /**
-   * @brief columns that `decodeFromBase` needs to decode
-   */
-  Set<std::string> requiredAndHintColumns_;
-  /**
-   * @brief ttl properties `needAccessBase_
-   */
-  std::pair<bool, std::pair<int64_t, std::string>> ttlProps_;
-  bool needAccessBase_{false};
-  bool fatalOnBaseNotFound_{false};
-  Map<std::string, size_t> colPosMap_;
-};
 class QualifiedStrategy {
  public:
   /**
@@ -384,6 +232,13 @@ class Path {
     return false;
   }
 
+  /**
+   * @brief return the key range [start, end) of path in current part
+   *
+   * @return std::pair<std::string, std::string>
+   */
+  virtual std::pair<std::string, std::string> keyRange() = 0;
+
   /**
    * @brief apply all qulified strategy on base data with format map<key,value>.
    *
@@ -498,6 +353,8 @@ class PrefixPath : public Path {
 
   void resetPart(PartitionID partId) override;
 
+  std::pair<std::string, std::string> keyRange() override;
+
   /**
    * @brief get prefix key
    *
@@ -555,6 +412,10 @@ class RangePath : public Path {
     return true;
   }
 
+  std::pair<std::string, std::string> keyRange() override {
+    return {startKey_, endKey_};
+  }
+
  private:
   std::string startKey_, endKey_;
   bool includeStart_ = true;
@@ -594,6 +455,238 @@ class RangePath : public Path {
                              std::string& key,
                              size_t offset);
 };
+/**
+ * @brief `IndexScanNode` is the base class of the node which need to access disk. It has two derive
+ * class `IndexVertexScanNode` and `IndexEdgeScanNode`.
+ *
+ * `IndexScanNode` will access index data, and then access base data if necessary.
+ *
+ * @implements IndexNode
+ * @see IndexNode, IndexVertexScanNode, IndexEdgeScanNode
+ *
+ */
+class IndexScanNode : public IndexNode {
+  FRIEND_TEST(IndexScanTest, Base);
+  FRIEND_TEST(IndexScanTest, Vertex);
+  FRIEND_TEST(IndexScanTest, Edge);
+  // There are too many unittests, so a helper is defined to access private data
+  friend class IndexScanTestHelper;
+
+ public:
+  /**
+   * @brief shallow copy.
+   * @attention This constructor will create a new Path
+   * @see IndexNode::IndexNode(const IndexNode& node)
+   */
+  IndexScanNode(const IndexScanNode& node);
+
+  /**
+   * @brief Construct a new Index Scan Node object
+   *
+   * @param context
+   * @param name
+   * @param indexId
+   * @param columnHints
+   * @param kvstore
+   */
+  IndexScanNode(RuntimeContext* context,
+                const std::string& name,
+                IndexID indexId,
+                const std::vector<cpp2::IndexColumnHint>& columnHints,
+                ::nebula::kvstore::KVStore* kvstore,
+                bool hasNullableCol)
+      : IndexNode(context, name),
+        indexId_(indexId),
+        columnHints_({&columnHints}),
+        kvstore_(kvstore),
+        indexNullable_(hasNullableCol) {}
+  ::nebula::cpp2::ErrorCode init(InitContext& ctx) override;
+  std::string identify() override;
+
+  /**
+   * @brief Scan the keys of another group of column hints on the same index, such as each value
+   * of `a IN [...]`. The key ranges of all groups are sorted and the overlapped ones are merged
+   * during execution, so each key is read only once.
+   *
+   * @attention Must be called before init(). Not supported by the index on geography, whose keys
+   * of different groups may point to the same base data.
+   * @param columnHints
+   */
+  void addColumnHints(const std::vector<cpp2::IndexColumnHint>& columnHints) {
+    columnHints_.emplace_back(&columnHints);
+  }
+
+  size_t numColumnHints() const {
+    return columnHints_.size();
+  }
+
+  /**
+   * @brief Only scan the merged key ranges whose ordinal modulo `numShards` is `shard`, so that
+   * the ranges of one part could be scanned by several copies of the plan in parallel.
+   *
+   * @param shard
+   * @param numShards
+   */
+  void setShard(size_t shard, size_t numShards) {
+    DCHECK_LT(shard, numShards);
+    shard_ = shard;
+    numShards_ = numShards;
+  }
+
+ protected:
+  nebula::cpp2::ErrorCode doExecute(PartitionID partId) final;
+  Result doNext() final;
+
+  /**
+   * @brief decode values from index key
+   *
+   * @param key index key
+   * @param colPosMap needed columns and these position(order) in values
+   * @param values result.Its order must meet the requirements of colPosMap.
+   */
+  void decodePropFromIndex(folly::StringPiece key,
+                           const Map<std::string, size_t>& colPosMap,
+                           std::vector<Value>& values);
+  /**
+   * @brief decode all props from index key
+   *
+   * decodePropFromIndex() will decode props who are defined in tag/edge properties.And,
+   * IndexScanNode sometime needs not only those but alse vid,edge_type,tag_id. decodeFromIndex()
+   * should be override by derived class and decode these special prop and then call
+   * decodePropFromIndex() to decode general props.
+   *
+   * @param key index key
+   * @return Row
+   * @see decodePropFromIndex
+   */
+  virtual Row decodeFromIndex(folly::StringPiece key) = 0;
+
+  /**
+   * @brief fill the included columns of a covering index into row
+   *
+   * @param includes values parsed from index value, in the order of include_fields
+   * @param values row decoded by decodeFromIndex()
+   */
+  void decodeIncludeFromIndex(std::vector<Value>&& includes, std::vector<Value>& values);
+
+  /**
+   * @brief get the base data key-value according to index key
+   *
+   * @param key index key
+   * @param kv base data key-value
+   * @return nebula::cpp2::ErrorCode
+   */
+  virtual nebula::cpp2::ErrorCode getBaseData(folly::StringPiece key,
+                                              std::pair<std::string, std::string>& kv) = 0;
+
+  /**
+   * @brief decode all props from base data key-value.
+   *
+   * @param key base data key
+   * @param value base data value
+   * @return Map<std::string, Value>
+   */
+  virtual Map<std::string, Value> decodeFromBase(const std::string& key,
+                                                 const std::string& value) = 0;
+  virtual const std::vector<std::shared_ptr<const meta::NebulaSchemaProvider>>& getSchema() = 0;
+
+  /**
+   * @brief Check whether the indexkey has expired
+   *
+   * @return true
+   * @return false
+   */
+  bool checkTTL();
+
+  /**
+   * @brief start query a new part
+   *
+   * @param partId
+   * @return nebula::cpp2::ErrorCode
+   * @see Path
+   */
+  nebula::cpp2::ErrorCode resetIter(PartitionID partId);
+
+  /**
+   * @brief open the iterator of next merged key range, iter_ is reset when all ranges are scanned
+   */
+  nebula::cpp2::ErrorCode nextRange();
+
+  /**
+   * @brief apply the paths whose range contains the key. The key is qualified once any of them
+   * accepts it, and the uncertain ones are recorded to be checked again on base data.
+   */
+  QualifiedStrategy::Result qualified(const folly::StringPiece& key);
+  QualifiedStrategy::Result qualified(const Map<std::string, Value>& rowData);
+
+  PartitionID partId_;
+  /**
+   * @brief index_ in this Node to access
+   */
+  const IndexID indexId_;
+  /**
+   * @brief index definition
+   */
+  std::shared_ptr<nebula::meta::cpp2::IndexItem> index_;
+  /**
+   * @brief groups of column hints, each group is scanned by a path
+   */
+  std::vector<const std::vector<cpp2::IndexColumnHint>*> columnHints_;
+  /**
+   * @brief one path for each group of column hints
+   * @see Path
+   */
+  std::vector<std::unique_ptr<Path>> paths_;
+  struct PathRange {
+    std::string start;
+    std::string end;
+    Path* path;
+  };
+  /**
+   * @brief key range [start, end) merged from the overlapped ranges of paths
+   */
+  struct ScanRange {
+    std::string start;
+    std::string end;
+    std::vector<PathRange> paths;
+  };
+  /**
+   * @brief sorted and disjoint ranges to scan in current part when there are several paths
+   */
+  std::vector<ScanRange> ranges_;
+  size_t nextRange_{0};
+  std::vector<Path*> uncertainPaths_;
+  size_t shard_{0};
+  size_t numShards_{1};
+  /**
+   * @brief current kvstore iterator.It while be reset `doExecute` and iterated during `doNext`
+   */
+  std::unique_ptr<kvstore::KVIterator> iter_;
+  nebula::kvstore::KVStore* kvstore_;
+  /**
+   * @brief if index contain nullable field or not
+   */
+  bool indexNullable_ = false;
+  /**
+   * @brief row format that `doNext` needs to return
+   */
+  std::vector<std::string> requiredColumns_;
+  /**
+   * @brief columns that `decodeFromBase` needs to decode
+   */
+  Set<std::string> requiredAndHintColumns_;
+  /**
+   * @brief ttl properties `needAccessBase_
+   */
+  std::pair<bool, std::pair<int64_t, std::string>> ttlProps_;
+  bool needAccessBase_{false};
+  /**
+   * @brief whether some required columns are the included columns stored in index value
+   */
+  bool needIncludeValues_{false};
+  bool fatalOnBaseNotFound_{false};
+  Map<std::string, size_t> colPosMap_;
+};
 /* define inline functions */
 QualifiedStrategy::Result QualifiedStrategySet::operator()(const folly::StringPiece& key) {
   QualifiedStrategy::Result ret = QualifiedStrategy::COMPATIBLE;
@@ -230,7 +230,11 @@ class UpdateTagNode : public UpdateNode<VertexID> {
 
     // Update is read-modify-write, which is an atomic operation.
     std::vector<VMLI> dummyLock = {std::make_tuple(context_->spaceId(), partId, tagId_, vId)};
-    nebula::MemoryLockGuard<VMLI> lg(context_->env()->verticesML_.get(), std::move(dummyLock));
+    nebula::MemoryLockGuard<VMLI> lg(context_->env()->verticesML_.get(),
+                                     std::move(dummyLock),
+                                     false,
+                                     true,
+                                     std::chrono::microseconds(FLAGS_memory_lock_wait_us));
     if (!lg) {
       auto conflict = lg.conflictKey();
       LOG(ERROR) << "vertex conflict " << std::get<0>(conflict) << ":" << std::get<1>(conflict)
@@ -467,8 +471,7 @@ class UpdateTagNode : public UpdateNode<VertexID> {
           }
           auto nis = indexKeys(partId, vId, nReader.get(), index);
           if (!nis.empty()) {
-            auto v = CommonUtils::ttlValue(schema_, nReader.get());
-            auto niv = v.ok() ? IndexKeyUtils::indexVal(std::move(v).value()) : "";
+            auto niv = CommonUtils::indexValue(schema_, nReader.get(), index.get());
             auto indexState = context_->env()->getIndexState(context_->spaceId(), partId);
             if (context_->env()->checkRebuilding(indexState)) {
               for (auto& ni : nis) {
@@ -557,7 +560,11 @@ class UpdateEdgeNode : public UpdateNode<cpp2::EdgeKey> {
                                                    edgeKey.get_edge_type(),
                                                    edgeKey.get_ranking(),
                                                    edgeKey.get_dst().getStr())};
-    nebula::MemoryLockGuard<EMLI> lg(context_->env()->edgesML_.get(), std::move(dummyLock));
+    nebula::MemoryLockGuard<EMLI> lg(context_->env()->edgesML_.get(),
+                                     std::move(dummyLock),
+                                     false,
+                                     true,
+                                     std::chrono::microseconds(FLAGS_memory_lock_wait_us));
     if (!lg) {
       auto conflict = lg.conflictKey();
       LOG(ERROR) << "edge conflict " << std::get<0>(conflict) << ":" << std::get<1>(conflict) << ":"
@@ -819,8 +826,7 @@ class UpdateEdgeNode : public UpdateNode<cpp2::EdgeKey> {
           }
           auto niks = indexKeys(partId, nReader.get(), edgeKey, index);
           if (!niks.empty()) {
-            auto v = CommonUtils::ttlValue(schema_, nReader.get());
-            auto niv = v.ok() ? IndexKeyUtils::indexVal(std::move(v).value()) : "";
+            auto niv = CommonUtils::indexValue(schema_, nReader.get(), index.get());
             auto indexState = context_->env()->getIndexState(context_->spaceId(), partId);
             if (context_->env()->checkRebuilding(indexState)) {
               for (auto& nik : niks) {
@@ -11,6 +11,7 @@
 #include "interface/gen-cpp2/common_types.tcc"
 #include "interface/gen-cpp2/meta_types.tcc"
 #include "interface/gen-cpp2/storage_types.tcc"
+#include "storage/StorageFlags.h"
 #include "storage/exec/IndexAggregateNode.h"
 #include "storage/exec/IndexDedupNode.h"
 #include "storage/exec/IndexEdgeScanNode.h"
@@ -115,11 +116,24 @@ void LookupProcessor::doProcess(const cpp2::LookupIndexRequest& req) {
 ErrorOr<nebula::cpp2::ErrorCode, std::unique_ptr<IndexNode>> LookupProcessor::buildPlan(
     const cpp2::LookupIndexRequest& req) {
   std::vector<std::unique_ptr<IndexNode>> nodes;
+  // The contexts on the same index with the same filter, such as `a IN [...]` which is split into
+  // one context per value, are scanned by one node in the order of keys
+  std::map<std::pair<IndexID, std::string>, IndexScanNode*> scans;
   for (auto& ctx : req.get_indices().get_contexts()) {
-    auto scan = buildOneContext(ctx);
+    auto key = std::make_pair(ctx.get_index_id(), ctx.get_filter());
+    auto found = scans.find(key);
+    if (found != scans.end()) {
+      found->second->addColumnHints(ctx.get_column_hints());
+      continue;
+    }
+    IndexScanNode* scanNode = nullptr;
+    auto scan = buildOneContext(ctx, &scanNode);
     if (!ok(scan)) {
       return error(scan);
     }
+    if (scanNode != nullptr) {
+      scans.emplace(std::move(key), scanNode);
+    }
     nodes.emplace_back(std::move(value(scan)));
   }
   for (size_t i = 0; i < nodes.size(); i++) {
@@ -140,7 +154,7 @@ ErrorOr<nebula::cpp2::ErrorCode, std::unique_ptr<IndexNode>> LookupProcessor::bu
       dedup->addChild(std::move(node));
     }
     nodes.clear();
-    nodes[0] = std::move(dedup);
+    nodes.emplace_back(std::move(dedup));
   }
   if (req.limit_ref().has_value()) {
     auto limit = *req.get_limit();
@@ -168,8 +182,14 @@ ErrorOr<nebula::cpp2::ErrorCode, std::unique_ptr<IndexNode>> LookupProcessor::bu
 }
 
 ErrorOr<nebula::cpp2::ErrorCode, std::unique_ptr<IndexNode>> LookupProcessor::buildOneContext(
-    const cpp2::IndexQueryContext& ctx) {
-  std::unique_ptr<IndexNode> node;
+    const cpp2::IndexQueryContext& ctx, IndexScanNode** scan) {
+  std::unique_ptr<IndexScanNode> node;
+  // The keys of different contexts on geography index may point to the same base data, which are
+  // deduped by IndexDedupNode, so these contexts are not merged
+  auto isGeo = [](const meta::cpp2::ColumnDef& col) {
+    return col.get_type().get_type() == nebula::cpp2::PropertyType::GEOGRAPHY;
+  };
+  bool mergeable = true;
   DLOG(INFO) << ctx.get_column_hints().size();
   DLOG(INFO) << &ctx.get_column_hints();
   DLOG(INFO) << ::apache::thrift::SimpleJSONSerializer::serialize<std::string>(ctx);
@@ -183,6 +203,7 @@ ErrorOr<nebula::cpp2::ErrorCode, std::unique_ptr<IndexNode>> LookupProcessor::bu
         std::any_of(cols.begin(), cols.end(), [](const meta::cpp2::ColumnDef& col) {
           return col.nullable_ref().value_or(false);
         });
+    mergeable = std::none_of(cols.begin(), cols.end(), isGeo);
     node = std::make_unique<IndexEdgeScanNode>(context_.get(),
                                                ctx.get_index_id(),
                                                ctx.get_column_hints(),
@@ -198,19 +219,21 @@ ErrorOr<nebula::cpp2::ErrorCode, std::unique_ptr<IndexNode>> LookupProcessor::bu
         std::any_of(cols.begin(), cols.end(), [](const meta::cpp2::ColumnDef& col) {
           return col.nullable_ref().value_or(false);
         });
+    mergeable = std::none_of(cols.begin(), cols.end(), isGeo);
     node = std::make_unique<IndexVertexScanNode>(context_.get(),
                                                  ctx.get_index_id(),
                                                  ctx.get_column_hints(),
                                                  context_->env()->kvstore_,
                                                  hasNullableCol);
   }
+  *scan = mergeable ? node.get() : nullptr;
   if (ctx.filter_ref().is_set() && !ctx.get_filter().empty()) {
     auto expr = Expression::decode(context_->objPool(), *ctx.filter_ref());
     auto filterNode = std::make_unique<IndexSelectionNode>(context_.get(), expr);
     filterNode->addChild(std::move(node));
-    node = std::move(filterNode);
+    return std::unique_ptr<IndexNode>(std::move(filterNode));
   }
-  return node;
+  return std::unique_ptr<IndexNode>(std::move(node));
 }
 
 void LookupProcessor::runInSingleThread(const std::vector<PartitionID>& parts,
@@ -262,12 +285,25 @@ void LookupProcessor::runInSingleThread(const std::vector<PartitionID>& parts,
 
 void LookupProcessor::runInMultipleThread(const std::vector<PartitionID>& parts,
                                           std::unique_ptr<IndexNode> plan) {
-  std::vector<std::unique_ptr<IndexNode>> planCopy = reproducePlan(plan.get(), parts.size());
+  // The key ranges of a part are scanned by several copies of plan in parallel, when they are all
+  // scanned by the only scan node
+  size_t shards = 1;
+  auto scan = soleScanNode(plan.get());
+  if (scan != nullptr && FLAGS_max_index_scan_shards_per_part > 1) {
+    shards = std::min(scan->numColumnHints(),
+                      static_cast<size_t>(FLAGS_max_index_scan_shards_per_part));
+  }
+  std::vector<std::unique_ptr<IndexNode>> planCopy =
+      reproducePlan(plan.get(), parts.size() * shards);
   using ReturnType = std::tuple<PartitionID, ::nebula::cpp2::ErrorCode, std::deque<Row>, Row>;
   std::vector<folly::Future<ReturnType>> futures;
-  for (size_t i = 0; i < parts.size(); i++) {
+  for (size_t i = 0; i < planCopy.size(); i++) {
+    if (shards > 1) {
+      soleScanNode(planCopy[i].get())->setShard(i % shards, shards);
+    }
     futures.emplace_back(folly::via(
-        executor_, [this, plan = std::move(planCopy[i]), part = parts[i]]() -> ReturnType {
+        executor_,
+        [this, plan = std::move(planCopy[i]), part = parts[i / shards]]() -> ReturnType {
           ::nebula::cpp2::ErrorCode code = ::nebula::cpp2::ErrorCode::SUCCEEDED;
           std::deque<Row> dataset;
           plan->execute(part);
@@ -297,18 +333,27 @@ void LookupProcessor::runInMultipleThread(const std::vector<PartitionID>& parts,
   folly::collectAll(futures).via(executor_).thenTry([this](auto&& t) {
     CHECK(!t.hasException());
     const auto& tries = t.value();
-    std::vector<Row> statResults;
+    // A part fails if any of its shards fails
+    std::unordered_map<PartitionID, ::nebula::cpp2::ErrorCode> failedParts;
     for (size_t j = 0; j < tries.size(); j++) {
       CHECK(!tries[j].hasException());
       auto& [partId, code, dataset, statResult] = tries[j].value();
-      if (code == ::nebula::cpp2::ErrorCode::SUCCEEDED) {
+      if (code != ::nebula::cpp2::ErrorCode::SUCCEEDED) {
+        failedParts.emplace(partId, code);
+      }
+    }
+    std::vector<Row> statResults;
+    for (size_t j = 0; j < tries.size(); j++) {
+      auto& [partId, code, dataset, statResult] = tries[j].value();
+      if (failedParts.count(partId) == 0) {
         for (auto& row : dataset) {
           resultDataSet_.emplace_back(std::move(row));
         }
-      } else {
-        handleErrorCode(code, context_->spaceId(), partId);
+        statResults.emplace_back(std::move(statResult));
       }
-      statResults.emplace_back(std::move(statResult));
+    }
+    for (auto& [partId, code] : failedParts) {
+      handleErrorCode(code, context_->spaceId(), partId);
     }
     DLOG(INFO) << "finish";
     // IndexAggregateNode has been copyed and each part get it's own aggregate info,
@@ -429,6 +474,14 @@ std::vector<std::unique_ptr<IndexNode>> LookupProcessor::reproducePlan(IndexNode
   }
   return ret;
 }
+IndexScanNode* LookupProcessor::soleScanNode(IndexNode* root) {
+  auto node = root;
+  while (node->children().size() == 1) {
+    node = node->children().front().get();
+  }
+  return node->children().empty() ? dynamic_cast<IndexScanNode*>(node) : nullptr;
+}
+
 void LookupProcessor::profilePlan(IndexNode* root) {
   std::unique_lock<std::mutex> lck(BaseProcessor<cpp2::LookupIndexResp>::profileMut_);
   std::queue<IndexNode*> q;
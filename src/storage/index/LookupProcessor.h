@@ -9,6 +9,7 @@
 #include "interface/gen-cpp2/storage_types.h"
 #include "storage/BaseProcessor.h"
 #include "storage/exec/IndexNode.h"
+#include "storage/exec/IndexScanNode.h"
 namespace nebula {
 namespace storage {
 extern ProcessorCounters kLookupCounters;
@@ -40,9 +41,20 @@ class LookupProcessor : public BaseProcessor<cpp2::LookupIndexResp> {
   ::nebula::cpp2::ErrorCode prepare(const cpp2::LookupIndexRequest& req);
   ErrorOr<nebula::cpp2::ErrorCode, std::unique_ptr<IndexNode>> buildPlan(
       const cpp2::LookupIndexRequest& req);
+  /**
+   * @brief build the scan (and filter) of one context
+   *
+   * @param ctx
+   * @param scan The scan node of ctx if the other contexts on the same index could be merged into
+   * it, otherwise nullptr
+   */
   ErrorOr<nebula::cpp2::ErrorCode, std::unique_ptr<IndexNode>> buildOneContext(
-      const cpp2::IndexQueryContext& ctx);
+      const cpp2::IndexQueryContext& ctx, IndexScanNode** scan);
   std::vector<std::unique_ptr<IndexNode>> reproducePlan(IndexNode* root, size_t count);
+  /**
+   * @brief return the scan node if it is the only leaf of plan, otherwise nullptr
+   */
+  static IndexScanNode* soleScanNode(IndexNode* root);
   ErrorOr<nebula::cpp2::ErrorCode, std::vector<std::pair<std::string, cpp2::StatType>>>
   handleStatProps(const std::vector<cpp2::StatProp>& statProps);
   void mergeStatsResult(const std::vector<Row>& statsResult);
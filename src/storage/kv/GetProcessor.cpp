@@ -14,6 +14,10 @@ ProcessorCounters kGetCounters;
 
 void GetProcessor::process(const cpp2::KVGetRequest& req) {
   CHECK_NOTNULL(env_->kvstore_);
+  syncReadIndex(req, [this](const cpp2::KVGetRequest& request) { doProcess(request); });
+}
+
+void GetProcessor::doProcess(const cpp2::KVGetRequest& req) {
   GraphSpaceID spaceId = req.get_space_id();
   bool returnPartly = req.get_return_partly();
 
@@ -33,7 +37,8 @@ void GetProcessor::process(const cpp2::KVGetRequest& req) {
       return NebulaKeyUtils::kvKey(partId, key);
     });
     std::vector<std::string> values;
-    auto ret = env_->kvstore_->multiGet(spaceId, partId, kvKeys, &values);
+    auto ret = env_->kvstore_->multiGet(
+        spaceId, partId, kvKeys, &values, followerReadParts_.count(partId) != 0);
     if ((ret.first == nebula::cpp2::ErrorCode::SUCCEEDED) ||
         (ret.first == nebula::cpp2::ErrorCode::E_PARTIAL_RESULT && returnPartly)) {
       auto& status = ret.second;
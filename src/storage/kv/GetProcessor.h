@@ -27,6 +27,8 @@ class GetProcessor : public BaseProcessor<cpp2::KVGetResponse> {
   void process(const cpp2::KVGetRequest& req);
 
  protected:
+  void doProcess(const cpp2::KVGetRequest& req);
+
   GetProcessor(StorageEnv* env, const ProcessorCounters* counters)
       : BaseProcessor<cpp2::KVGetResponse>(env, counters) {}
 };
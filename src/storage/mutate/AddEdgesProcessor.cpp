@@ -277,9 +277,8 @@ kvstore::MergeableAtomicOpResult AddEdgesProcessor::addEdgesWithIndex(
           if (newReader != nullptr) {
             auto newIndexKeys = indexKeys(partId, newReader.get(), key, index, nullptr);
             if (!newIndexKeys.empty()) {
-              // check if index has ttl field, write it to index value if exists
-              auto field = CommonUtils::ttlValue(schema.get(), newReader.get());
-              auto indexVal = field.ok() ? IndexKeyUtils::indexVal(std::move(field).value()) : "";
+              // write ttl field and included columns to index value if exist
+              auto indexVal = CommonUtils::indexValue(schema.get(), newReader.get(), index.get());
               auto indexState = env_->getIndexState(spaceId_, partId);
               if (env_->checkRebuilding(indexState)) {
                 for (auto& idxKey : newIndexKeys) {
@@ -283,9 +283,8 @@ kvstore::MergeableAtomicOpResult AddVerticesProcessor::addVerticesWithIndex(
         if (newReader != nullptr) {
           auto newIndexKeys = indexKeys(partId, vId.str(), newReader.get(), index, schema.get());
           if (!newIndexKeys.empty()) {
-            // check if index has ttl field, write it to index value if exists
-            auto field = CommonUtils::ttlValue(schema.get(), newReader.get());
-            auto indexVal = field.ok() ? IndexKeyUtils::indexVal(std::move(field).value()) : "";
+            // write ttl field and included columns to index value if exist
+            auto indexVal = CommonUtils::indexValue(schema.get(), newReader.get(), index.get());
             auto indexState = env_->getIndexState(spaceId_, partId);
             if (env_->checkRebuilding(indexState)) {
               for (auto& idxKey : newIndexKeys) {
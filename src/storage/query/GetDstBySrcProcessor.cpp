@@ -20,11 +20,13 @@ namespace storage {
 ProcessorCounters kGetDstBySrcCounters;
 
 void GetDstBySrcProcessor::process(const cpp2::GetDstBySrcRequest& req) {
-  if (executor_ != nullptr) {
-    executor_->add([req, this]() { this->doProcess(req); });
-  } else {
-    doProcess(req);
-  }
+  syncReadIndex(req, [this](const cpp2::GetDstBySrcRequest& request) {
+    if (executor_ != nullptr) {
+      executor_->add([request, this]() { this->doProcess(request); });
+    } else {
+      doProcess(request);
+    }
+  });
 }
 
 void GetDstBySrcProcessor::doProcess(const cpp2::GetDstBySrcRequest& req) {
@@ -39,6 +41,7 @@ void GetDstBySrcProcessor::doProcess(const cpp2::GetDstBySrcRequest& req) {
   }
   this->planContext_ = std::make_unique<PlanContext>(
       this->env_, spaceId_, this->spaceVidLen_, this->isIntId_, req.common_ref());
+  this->planContext_->followerReadParts_ = std::move(this->followerReadParts_);
 
   // check edgetypes exists
   retCode = checkAndBuildContexts(req);
@@ -20,11 +20,13 @@ namespace storage {
 ProcessorCounters kGetNeighborsCounters;
 
 void GetNeighborsProcessor::process(const cpp2::GetNeighborsRequest& req) {
-  if (executor_ != nullptr) {
-    executor_->add([req, this]() { this->doProcess(req); });
-  } else {
-    doProcess(req);
-  }
+  syncReadIndex(req, [this](const cpp2::GetNeighborsRequest& request) {
+    if (executor_ != nullptr) {
+      executor_->add([request, this]() { this->doProcess(request); });
+    } else {
+      doProcess(request);
+    }
+  });
 }
 
 void GetNeighborsProcessor::doProcess(const cpp2::GetNeighborsRequest& req) {
@@ -42,6 +44,7 @@ void GetNeighborsProcessor::doProcess(const cpp2::GetNeighborsRequest& req) {
   }
   this->planContext_ = std::make_unique<PlanContext>(
       this->env_, spaceId_, this->spaceVidLen_, this->isIntId_, req.common_ref());
+  this->planContext_->followerReadParts_ = std::move(this->followerReadParts_);
 
   // build TagContext and EdgeContext
   retCode = checkAndBuildContexts(req);
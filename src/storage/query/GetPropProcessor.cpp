@@ -13,11 +13,13 @@ namespace storage {
 ProcessorCounters kGetPropCounters;
 
 void GetPropProcessor::process(const cpp2::GetPropRequest& req) {
-  if (executor_ != nullptr) {
-    executor_->add([req, this]() { this->doProcess(req); });
-  } else {
-    doProcess(req);
-  }
+  syncReadIndex(req, [this](const cpp2::GetPropRequest& request) {
+    if (executor_ != nullptr) {
+      executor_->add([request, this]() { this->doProcess(request); });
+    } else {
+      doProcess(request);
+    }
+  });
 }
 
 void GetPropProcessor::doProcess(const cpp2::GetPropRequest& req) {
@@ -35,6 +37,7 @@ void GetPropProcessor::doProcess(const cpp2::GetPropRequest& req) {
   }
   this->planContext_ = std::make_unique<PlanContext>(
       this->env_, spaceId_, this->spaceVidLen_, this->isIntId_, req.common_ref());
+  this->planContext_->followerReadParts_ = std::move(this->followerReadParts_);
 
   retCode = checkAndBuildContexts(req);
   if (retCode != nebula::cpp2::ErrorCode::SUCCEEDED) {
@@ -6,11 +6,14 @@
 #include <folly/Format.h>
 #include <folly/String.h>
 #include <folly/container/Enumerate.h>
+#include <folly/executors/IOThreadPoolExecutor.h>
 #include <folly/init/Init.h>
+#include <folly/synchronization/Baton.h>
 #include <gtest/gtest.h>
 #include <thrift/lib/cpp/util/EnumUtils.h>
 
 #include "common/fs/TempDir.h"
+#include "common/utils/NebulaKeyUtils.h"
 #include "mock/MockCluster.h"
 #include "mock/MockData.h"
 #include "storage/CommonUtils.h"
@@ -18,6 +21,7 @@
 #include "storage/test/TestUtils.h"
 #include "storage/transaction/ChainAddEdgesGroupProcessor.h"
 #include "storage/transaction/ChainAddEdgesLocalProcessor.h"
+#include "storage/transaction/ChainGroupExecutor.h"
 #include "storage/transaction/ConsistUtil.h"
 
 namespace nebula {
@@ -176,6 +180,128 @@ TEST(ChainAddEdgesTest, processRemoteUnknownTest) {
   EXPECT_EQ(334, numOfKey(req, util.genDoublePrime, env));
 }
 
+TEST(ChainAddEdgesTest, groupExecutorTest) {
+  auto pool = std::make_shared<folly::IOThreadPoolExecutor>(1);
+  std::mutex lock;
+  std::vector<std::vector<int>> groups;
+  std::deque<folly::Promise<Code>> promises;
+  ChainGroupExecutor<int> groupExecutor(
+      pool.get(),
+      [&](std::vector<int>&& items) {
+        std::lock_guard<std::mutex> guard(lock);
+        groups.emplace_back(std::move(items));
+        promises.emplace_back();
+        return promises.back().getSemiFuture();
+      },
+      [](const int&) { return 1; });
+  auto waitGroups = [&](size_t num) {
+    for (int i = 0; i < 1000; ++i) {
+      {
+        std::lock_guard<std::mutex> guard(lock);
+        if (groups.size() >= num) {
+          return;
+        }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  };
+  auto finishGroup = [&](size_t i, Code code) {
+    std::lock_guard<std::mutex> guard(lock);
+    promises[i].setValue(code);
+  };
+
+  // one group in flight at most, and two items in a group at most
+  auto f1 = groupExecutor.add("k", 1, 1, 2);
+  auto f2 = groupExecutor.add("k", 2, 1, 2);
+  auto f3 = groupExecutor.add("k", 3, 1, 2);
+  auto f4 = groupExecutor.add("k", 4, 1, 2);
+  // other keys are not blocked
+  auto f5 = groupExecutor.add("other", 5, 1, 2);
+  waitGroups(2);
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    ASSERT_EQ(2, groups.size());
+    EXPECT_EQ(std::vector<int>({1}), groups[0]);
+    EXPECT_EQ(std::vector<int>({5}), groups[1]);
+  }
+
+  finishGroup(0, suc);
+  EXPECT_EQ(suc, std::move(f1).get());
+  waitGroups(3);
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    ASSERT_EQ(3, groups.size());
+    EXPECT_EQ(std::vector<int>({2, 3}), groups[2]);
+  }
+
+  // every item of a group gets the result of the group
+  finishGroup(2, Code::E_RPC_FAILURE);
+  EXPECT_EQ(Code::E_RPC_FAILURE, std::move(f2).get());
+  EXPECT_EQ(Code::E_RPC_FAILURE, std::move(f3).get());
+  waitGroups(4);
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    ASSERT_EQ(4, groups.size());
+    EXPECT_EQ(std::vector<int>({4}), groups[3]);
+  }
+
+  finishGroup(3, suc);
+  finishGroup(1, Code::E_LEADER_CHANGED);
+  EXPECT_EQ(suc, std::move(f4).get());
+  EXPECT_EQ(Code::E_LEADER_CHANGED, std::move(f5).get());
+  pool->join();
+}
+
+// A prime left by the previous term is resumed only after the task of previous term released it
+TEST(ChainAddEdgesTest, resumeAfterPreviousTermTest) {
+  fs::TempDir rootPath("/tmp/AddEdgesTest.XXXXXX");
+  mock::MockCluster cluster;
+  cluster.initStorageKV(rootPath.path());
+  auto* env = cluster.storageEnv_.get();
+  auto mClient = MetaClientTestUpdater::makeDefault();
+  env->metaClient_ = mClient.get();
+  PartitionID partId = 1;
+  TermID prevTerm = 1;
+  TermID currTerm = 2;
+
+  // nothing to resume in the previous term
+  env->txnMan_->scanPrimes(mockSpaceId, partId, prevTerm);
+  auto edgeKey = NebulaKeyUtils::edgeKey(32, partId, "src", 101, 0, "dst");
+  auto prevLock = env->txnMan_->getLockCore(mockSpaceId, partId, prevTerm, false);
+  ASSERT_TRUE(prevLock->try_lock(edgeKey));
+
+  auto write = [&](std::function<void(kvstore::KVCallback)> op) {
+    folly::Baton<true, std::atomic> baton;
+    op([&](Code code) {
+      EXPECT_EQ(suc, code);
+      baton.post();
+    });
+    baton.wait();
+  };
+  auto primeKey = ConsistUtil::primeTable(partId) + edgeKey;
+  write([&](kvstore::KVCallback cb) {
+    std::vector<kvstore::KV> data{{primeKey, "prime"}};
+    env->kvstore_->asyncMultiPut(mockSpaceId, partId, std::move(data), std::move(cb));
+  });
+  env->txnMan_->scanPrimes(mockSpaceId, partId, currTerm);
+  // Without the prime, the resume just releases the lock of current term
+  write([&](kvstore::KVCallback cb) {
+    env->kvstore_->asyncRemove(mockSpaceId, partId, primeKey, std::move(cb));
+  });
+
+  auto currLock = env->txnMan_->getLockCore(mockSpaceId, partId, currTerm, false);
+  std::this_thread::sleep_for(std::chrono::seconds(1));
+  EXPECT_TRUE(currLock->contains(edgeKey));
+
+  prevLock->unlock(edgeKey);
+  for (int i = 0; i < 100 && currLock->contains(edgeKey); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  EXPECT_FALSE(currLock->contains(edgeKey));
+  env->txnMan_->stop();
+  env->txnMan_->join();
+}
+
 }  // namespace storage
 }  // namespace nebula
 
@@ -705,6 +705,95 @@ TEST_F(IndexScanTest, Int) {
     check(indices[2], columnHints, expect(1, 0, 2, 3, 5), "case7.6");  //
   }                                                                    // End of Case 7
 }
+TEST_F(IndexScanTest, MultiRange) {
+  auto rows = R"(
+    int | int
+    1   | 1
+    2   | 2
+    3   | <null>
+    4   | 4
+    5   | 5
+    6   | 6
+  )"_row;
+  auto schema = R"(
+    a   | int | | false
+    b   | int | | true
+  )"_schema;
+  auto indices = R"(
+    TAG(t,1)
+    (i1,2):a
+    (i2,3):b
+  )"_index(schema);
+  bool hasNullableCol = schema->hasNullableCol();
+  auto kv = encodeTag(rows, 1, schema, indices);
+  auto kvstore = std::make_unique<MockKVStore>();
+  for (auto& iter : kv) {
+    for (auto& item : iter) {
+      kvstore->put(item.first, item.second);
+    }
+  }
+  auto check = [&](std::shared_ptr<IndexItem> index,
+                   const std::vector<std::vector<ColumnHint>>& columnHints,
+                   size_t shard,
+                   size_t numShards,
+                   const std::vector<Row>& expect,
+                   const std::string& case_) {
+    auto context = makeContext(1, 0);
+    auto scanNode = std::make_unique<IndexVertexScanNode>(
+        context.get(), 0, columnHints[0], kvstore.get(), hasNullableCol);
+    for (size_t i = 1; i < columnHints.size(); i++) {
+      scanNode->addColumnHints(columnHints[i]);
+    }
+    IndexScanTestHelper helper;
+    helper.setIndex(scanNode.get(), index);
+    helper.setTag(scanNode.get(), schema);
+    InitContext initCtx;
+    initCtx.requiredColumns = {kVid};
+    scanNode->init(initCtx);
+    scanNode->setShard(shard, numShards);
+    scanNode->execute(0);
+
+    std::vector<Row> result;
+    while (true) {
+      auto res = scanNode->next();
+      ASSERT(res.success());
+      if (!res.hasData()) {
+        break;
+      }
+      result.emplace_back(std::move(res).row());
+    }
+    EXPECT_EQ(result, expect) << "Fail at case " << case_;
+  };
+  auto expect = [](auto... vidList) {
+    std::vector<Row> ret;
+    std::vector<Value> value;
+    (value.push_back(std::to_string(vidList)), ...);
+    for (auto& v : value) {
+      Row row;
+      row.emplace_back(v);
+      ret.emplace_back(std::move(row));
+    }
+    return ret;
+  };
+  // a IN [5, 1, 1], returned in the order of keys and without duplicates
+  std::vector<std::vector<ColumnHint>> columnHints = {
+      {makeColumnHint("a", 5)}, {makeColumnHint("a", 1)}, {makeColumnHint("a", 1)}};
+  check(indices[0], columnHints, 0, 1, expect(0, 4), "case1");
+  // 2<=a<4 OR 3<=a<5 OR a=6, the overlapped ranges are merged
+  columnHints = {{makeColumnHint<true, false>("a", 2, 4)},
+                 {makeColumnHint<true, false>("a", 3, 5)},
+                 {makeColumnHint("a", 6)}};
+  check(indices[0], columnHints, 0, 1, expect(1, 2, 3, 5), "case2");
+  // Each shard scans a part of the merged ranges [a=1], [2<=a<5], [a=6]
+  columnHints.push_back({makeColumnHint("a", 1)});
+  check(indices[0], columnHints, 0, 2, expect(0, 5), "case3.1");
+  check(indices[0], columnHints, 1, 2, expect(1, 2, 3), "case3.2");
+  // b IN [NULL, 2, 1], the null value is only matched by the hint of null
+  columnHints = {{makeColumnHint("b", Value::kNullValue)},
+                 {makeColumnHint("b", 2)},
+                 {makeColumnHint("b", 1)}};
+  check(indices[1], columnHints, 0, 1, expect(0, 1, 2), "case4");
+}
 TEST_F(IndexScanTest, Float) {
   /**
    * Some special values
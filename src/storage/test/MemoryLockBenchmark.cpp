@@ -4,6 +4,7 @@
  */
 
 #include <folly/Benchmark.h>
+#include <folly/Random.h>
 #include <folly/executors/IOThreadPoolExecutor.h>
 #include <rocksdb/db.h>
 
@@ -14,6 +15,12 @@
 DEFINE_int64(total_spaces, 10000, "total spaces number");
 DEFINE_int64(num_threads, 100, "threads number");
 DEFINE_int32(num_batch, 10000, "batch write number");
+DEFINE_int32(num_hot_keys, 16, "hot keys number of contended scenarios");
+DEFINE_int32(num_hot_batch, 4, "keys number of a batch of contended scenarios");
+DEFINE_int32(num_updates, 1000, "updates number of every thread of contended scenarios");
+DEFINE_int32(hold_us, 20, "time to hold the locks of an update");
+DEFINE_int32(retry_delay_us, 200, "time for client to retry a conflicted update");
+DEFINE_int32(wait_us, 100000, "max time to wait for the locks of an update");
 
 namespace nebula {
 namespace storage {
@@ -41,6 +48,44 @@ void forString(StringLock* lock, int64_t spaceId) noexcept {
   nebula::MemoryLockGuard<std::string> lg(lock, std::move(toLock));
 }
 
+// Every update locks some of a few hot keys and holds them for a while. When failed, the client
+// retries the update after a round trip.
+void hotUpdates(StringLock* lock, std::chrono::microseconds wait, size_t batch) noexcept {
+  for (int32_t i = 0; i < FLAGS_num_updates; i++) {
+    std::vector<std::string> toLock;
+    while (toLock.size() < batch) {
+      auto key = folly::to<std::string>(folly::Random::rand32(FLAGS_num_hot_keys));
+      if (std::find(toLock.begin(), toLock.end(), key) == toLock.end()) {
+        toLock.emplace_back(std::move(key));
+      }
+    }
+    while (true) {
+      nebula::MemoryLockGuard<std::string> lg(lock, toLock, false, true, wait);
+      if (lg) {
+        std::this_thread::sleep_for(std::chrono::microseconds(FLAGS_hold_us));
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::microseconds(FLAGS_retry_delay_us));
+    }
+  }
+}
+
+void runHotUpdates(std::chrono::microseconds wait, size_t batch) {
+  auto lock = std::make_unique<StringLock>();
+  auto pool = std::make_unique<ThreadPool>(FLAGS_num_threads);
+  for (auto i = 0; i < FLAGS_num_threads; ++i) {
+    pool->add(std::bind(hotUpdates, lock.get(), wait, batch));
+  }
+  pool->join();
+  int64_t conflicts = 0, waits = 0, timeouts = 0;
+  for (auto& stats : lock->stats()) {
+    conflicts += stats.conflicts;
+    waits += stats.waits;
+    timeouts += stats.timeouts;
+  }
+  VLOG(1) << "conflicts " << conflicts << ", waits " << waits << ", timeouts " << timeouts;
+}
+
 BENCHMARK(TupleKey) {
   std::unique_ptr<TupleLock> lock = std::make_unique<TupleLock>();
   auto pool = std::make_unique<ThreadPool>(FLAGS_num_threads);
@@ -59,6 +104,24 @@ BENCHMARK_RELATIVE(StringKey) {
   pool->join();
 }
 
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK(HotKeyTryLock) {
+  runHotUpdates(std::chrono::microseconds(0), 1);
+}
+
+BENCHMARK_RELATIVE(HotKeyWaitLock) {
+  runHotUpdates(std::chrono::microseconds(FLAGS_wait_us), 1);
+}
+
+BENCHMARK(HotBatchTryLock) {
+  runHotUpdates(std::chrono::microseconds(0), FLAGS_num_hot_batch);
+}
+
+BENCHMARK_RELATIVE(HotBatchWaitLock) {
+  runHotUpdates(std::chrono::microseconds(FLAGS_wait_us), FLAGS_num_hot_batch);
+}
+
 }  // namespace storage
 }  // namespace nebula
 
@@ -122,6 +122,70 @@ TEST_F(MemoryLockTest, DedupTest) {
   EXPECT_EQ(0, mlock.size());
 }
 
+TEST_F(MemoryLockTest, WaitTest) {
+  MemoryLockCore<std::string> mlock;
+  auto wait = std::chrono::microseconds(std::chrono::seconds(10));
+  {
+    // timed out
+    LockGuard lk1(&mlock, "1");
+    EXPECT_TRUE(lk1);
+    LockGuard lk2(&mlock, "1", std::chrono::microseconds(1000));
+    EXPECT_FALSE(lk2);
+    EXPECT_EQ("1", lk2.conflictKey());
+  }
+  EXPECT_EQ(0, mlock.size());
+  {
+    // duplicated keys conflict with themselves
+    std::vector<std::string> keys{"1", "2", "1"};
+    LockGuard lk(&mlock, keys, false, true, wait);
+    EXPECT_FALSE(lk);
+    EXPECT_EQ("1", lk.conflictKey());
+    EXPECT_EQ(0, mlock.size());
+  }
+  {
+    // the waiters get the lock in FIFO order when it's released
+    MemoryLockCore<std::string> fifoLock;
+    auto* lk = new LockGuard(&fifoLock, "1");
+    std::mutex lock;
+    std::vector<int> order;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 3; ++i) {
+      threads.emplace_back([&, i] {
+        LockGuard waiter(&fifoLock, std::vector<std::string>{"2", "1"}, false, true, wait);
+        EXPECT_TRUE(waiter);
+        std::lock_guard<std::mutex> guard(lock);
+        order.emplace_back(i);
+      });
+      // wait until the thread is queued
+      int64_t waits = 0;
+      while (waits != i + 1) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        waits = 0;
+        for (auto& stats : fifoLock.stats()) {
+          waits += stats.waits;
+        }
+      }
+    }
+    delete lk;
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    EXPECT_EQ(std::vector<int>({0, 1, 2}), order);
+    EXPECT_EQ(0, fifoLock.size());
+  }
+}
+
+TEST_F(MemoryLockTest, ContainsTest) {
+  MemoryLockCore<std::string> mlock;
+  // contains() is true iff the key is held
+  EXPECT_FALSE(mlock.contains("1"));
+  EXPECT_TRUE(mlock.try_lock("1"));
+  EXPECT_TRUE(mlock.contains("1"));
+  EXPECT_FALSE(mlock.contains("2"));
+  mlock.unlock("1");
+  EXPECT_FALSE(mlock.contains("1"));
+}
+
 }  // namespace storage
 }  // namespace nebula
 
@@ -0,0 +1,303 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <folly/io/async/ScopedEventBaseThread.h>
+#include <gtest/gtest.h>
+
+#include "clients/storage/RequestBatcher.h"
+#include "clients/storage/StorageClient.h"
+#include "common/base/Base.h"
+
+DECLARE_int32(storage_client_batch_window_us);
+DECLARE_int32(storage_client_batch_max_requests);
+
+namespace nebula {
+namespace storage {
+
+cpp2::GetPropRequest vertexPropsRequest(SessionID sessionId,
+                                        ExecutionPlanID planId,
+                                        std::unordered_map<PartitionID, std::vector<Row>> parts) {
+  cpp2::GetPropRequest req;
+  req.space_id_ref() = 1;
+  req.parts_ref() = std::move(parts);
+  cpp2::VertexProp vertexProp;
+  vertexProp.tag_ref() = 1;
+  vertexProp.props_ref() = std::vector<std::string>{"name", "age"};
+  req.vertex_props_ref() = std::vector<cpp2::VertexProp>{vertexProp};
+  cpp2::RequestCommon common;
+  common.session_id_ref() = sessionId;
+  common.plan_id_ref() = planId;
+  req.common_ref() = std::move(common);
+  return req;
+}
+
+TEST(StorageClientBatchTest, BatchKeyTest) {
+  auto req = vertexPropsRequest(1, 1, {{1, {Row({"a"})}}});
+  auto key = StorageClient::getPropsBatchKey(req);
+  ASSERT_TRUE(key.has_value());
+  {
+    // The vertices don't matter
+    auto other = vertexPropsRequest(1, 1, {{2, {Row({"b"})}}});
+    EXPECT_EQ(key, StorageClient::getPropsBatchKey(other));
+  }
+  {
+    // Requests of different queries are merged
+    EXPECT_EQ(key, StorageClient::getPropsBatchKey(vertexPropsRequest(2, 1, {})));
+    EXPECT_EQ(key, StorageClient::getPropsBatchKey(vertexPropsRequest(1, 2, {})));
+  }
+  {
+    auto other = req;
+    (*other.vertex_props_ref())[0].props_ref() = std::vector<std::string>{"name"};
+    EXPECT_NE(key, StorageClient::getPropsBatchKey(other));
+  }
+  {
+    // The requests whose rows are not one per vertex are not batchable
+    auto other = req;
+    other.limit_ref() = 10;
+    EXPECT_FALSE(StorageClient::getPropsBatchKey(other).has_value());
+    other = req;
+    other.dedup_ref() = true;
+    EXPECT_FALSE(StorageClient::getPropsBatchKey(other).has_value());
+    other = req;
+    other.filter_ref() = std::string("filter");
+    EXPECT_FALSE(StorageClient::getPropsBatchKey(other).has_value());
+    other = req;
+    other.vertex_props_ref().reset();
+    other.edge_props_ref() = std::vector<cpp2::EdgeProp>();
+    EXPECT_FALSE(StorageClient::getPropsBatchKey(other).has_value());
+    other = req;
+    other.common_ref()->profile_detail_ref() = true;
+    EXPECT_FALSE(StorageClient::getPropsBatchKey(other).has_value());
+  }
+}
+
+TEST(StorageClientBatchTest, MergeTest) {
+  auto req1 = vertexPropsRequest(1, 1, {{1, {Row({"a"}), Row({"b"})}}, {2, {Row({"c"})}}});
+  auto req2 = vertexPropsRequest(2, 1, {{1, {Row({"b"})}}, {3, {Row({"d"})}}});
+  auto merged = StorageClient::mergeGetProps({&req1, &req2});
+  EXPECT_EQ(1, merged.get_space_id());
+  EXPECT_EQ(*req1.vertex_props_ref(), *merged.vertex_props_ref());
+  // The merged request of different queries belongs to none of them
+  EXPECT_FALSE(merged.common_ref().has_value());
+
+  const auto& parts = merged.get_parts();
+  ASSERT_EQ(3, parts.size());
+  // The vertex fetched by both requests is fetched once
+  std::vector<Row> expected = {Row({"a"}), Row({"b"})};
+  EXPECT_EQ(expected, parts.at(1));
+  expected = {Row({"c"})};
+  EXPECT_EQ(expected, parts.at(2));
+  expected = {Row({"d"})};
+  EXPECT_EQ(expected, parts.at(3));
+}
+
+TEST(StorageClientBatchTest, SplitTest) {
+  auto req1 = vertexPropsRequest(1, 1, {{1, {Row({"a"}), Row({"b"})}}});
+  auto req2 = vertexPropsRequest(2, 1, {{1, {Row({"b"})}}, {2, {Row({"c"})}}});
+  // The query of req3 is killed while the batch is in flight
+  auto req3 = vertexPropsRequest(3, 1, {{1, {Row({"a"})}}});
+
+  cpp2::GetPropResponse merged;
+  DataSet props({"_vid", "1.name"});
+  props.rows.emplace_back(Row({"a", "Tim"}));
+  props.rows.emplace_back(Row({"b", "Tony"}));
+  merged.props_ref() = std::move(props);
+  cpp2::ResponseCommon result;
+  result.latency_in_us_ref() = 100;
+  cpp2::PartitionResult failedPart;
+  failedPart.code_ref() = nebula::cpp2::ErrorCode::E_LEADER_CHANGED;
+  failedPart.part_id_ref() = 2;
+  result.failed_parts_ref() = std::vector<cpp2::PartitionResult>{failedPart};
+  merged.result_ref() = std::move(result);
+
+  auto isKilled = [](SessionID session, ExecutionPlanID) { return session == 3; };
+  auto resps = StorageClient::splitGetProps(std::move(merged), {&req1, &req2, &req3}, isKilled);
+  ASSERT_EQ(3, resps.size());
+  {
+    const auto& resp = resps[0];
+    EXPECT_EQ(100, resp.get_result().get_latency_in_us());
+    // The failed part is only reported to the request which has it
+    EXPECT_TRUE(resp.get_result().get_failed_parts().empty());
+    DataSet expected({"_vid", "1.name"});
+    expected.rows.emplace_back(Row({"a", "Tim"}));
+    expected.rows.emplace_back(Row({"b", "Tony"}));
+    EXPECT_EQ(expected, *resp.props_ref());
+  }
+  {
+    const auto& resp = resps[1];
+    ASSERT_EQ(1, resp.get_result().get_failed_parts().size());
+    EXPECT_EQ(2, resp.get_result().get_failed_parts()[0].get_part_id());
+    EXPECT_EQ(nebula::cpp2::ErrorCode::E_LEADER_CHANGED,
+              resp.get_result().get_failed_parts()[0].get_code());
+    // The vertex fetched by both requests is returned to both
+    DataSet expected({"_vid", "1.name"});
+    expected.rows.emplace_back(Row({"b", "Tony"}));
+    EXPECT_EQ(expected, *resp.props_ref());
+  }
+  {
+    // Nothing is returned to the killed query
+    const auto& resp = resps[2];
+    ASSERT_EQ(1, resp.get_result().get_failed_parts().size());
+    EXPECT_EQ(1, resp.get_result().get_failed_parts()[0].get_part_id());
+    EXPECT_EQ(nebula::cpp2::ErrorCode::E_PLAN_IS_KILLED,
+              resp.get_result().get_failed_parts()[0].get_code());
+    EXPECT_FALSE(resp.props_ref().has_value());
+  }
+}
+
+// Each request is a list of ids, and the response doubles each id
+struct FakeClient {};
+using Ids = std::vector<int64_t>;
+using FakeBatcher = RequestBatcher<FakeClient, Ids, Ids>;
+
+FakeBatcher fakeBatcher() {
+  return FakeBatcher(
+      [](const Ids& req) -> std::optional<std::string> {
+        if (req.empty()) {
+          return std::nullopt;
+        }
+        return folly::to<std::string>(req.front() % 2);
+      },
+      [](const std::vector<const Ids*>& reqs) {
+        Ids merged;
+        for (const auto* req : reqs) {
+          merged.insert(merged.end(), req->begin(), req->end());
+        }
+        return merged;
+      },
+      [](Ids&& merged, const std::vector<const Ids*>& reqs) {
+        std::vector<Ids> resps;
+        size_t offset = 0;
+        for (const auto* req : reqs) {
+          resps.emplace_back(merged.begin() + offset, merged.begin() + offset + req->size());
+          offset += req->size();
+        }
+        return resps;
+      });
+}
+
+class RequestBatcherTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    windowUs_ = FLAGS_storage_client_batch_window_us;
+    maxRequests_ = FLAGS_storage_client_batch_max_requests;
+  }
+
+  void TearDown() override {
+    FLAGS_storage_client_batch_window_us = windowUs_;
+    FLAGS_storage_client_batch_max_requests = maxRequests_;
+  }
+
+  // Add the requests in the event base, and return the responses
+  std::vector<folly::Future<Ids>> add(FakeBatcher* batcher,
+                                      const HostAddr& host,
+                                      const std::vector<Ids>& reqs,
+                                      bool fail = false) {
+    std::vector<folly::Future<Ids>> futures;
+    evbThread_.getEventBase()->runInEventBaseThreadAndWait([&] {
+      for (const auto& req : reqs) {
+        auto key = batcher->key(req);
+        CHECK(key.has_value());
+        futures.emplace_back(
+            batcher->add(host, *key, &client_, req, [this, fail](FakeClient*, const Ids& merged) {
+              sent_.emplace_back(merged);
+              if (fail) {
+                return folly::makeFuture<Ids>(std::runtime_error("rpc failure"));
+              }
+              Ids resp;
+              for (auto id : merged) {
+                resp.emplace_back(id * 2);
+              }
+              return folly::makeFuture(std::move(resp));
+            }));
+      }
+    });
+    return futures;
+  }
+
+  folly::ScopedEventBaseThread evbThread_;
+  FakeClient client_;
+  // The merged requests sent, only accessed in evbThread_
+  std::vector<Ids> sent_;
+  int32_t windowUs_;
+  int32_t maxRequests_;
+};
+
+TEST_F(RequestBatcherTest, DisabledTest) {
+  FLAGS_storage_client_batch_window_us = 0;
+  auto batcher = fakeBatcher();
+  EXPECT_FALSE(batcher.key({1}).has_value());
+  FLAGS_storage_client_batch_window_us = 1000;
+  EXPECT_TRUE(batcher.key({1}).has_value());
+  // The request which is not batchable
+  EXPECT_FALSE(batcher.key({}).has_value());
+}
+
+TEST_F(RequestBatcherTest, FlushByWindowTest) {
+  FLAGS_storage_client_batch_window_us = 10 * 1000;
+  FLAGS_storage_client_batch_max_requests = 64;
+  auto batcher = fakeBatcher();
+  HostAddr host("127.0.0.1", 1);
+  auto futures = add(&batcher, host, {{1, 3}, {5}, {2}});
+  auto resps = folly::collectAll(futures).get();
+  ASSERT_EQ(3, resps.size());
+  EXPECT_EQ(Ids({2, 6}), resps[0].value());
+  EXPECT_EQ(Ids({10}), resps[1].value());
+  EXPECT_EQ(Ids({4}), resps[2].value());
+  evbThread_.getEventBase()->runInEventBaseThreadAndWait([&] {
+    // The requests with the same key are sent in one rpc
+    ASSERT_EQ(2, sent_.size());
+    std::sort(sent_.begin(), sent_.end());
+    EXPECT_EQ(Ids({1, 3, 5}), sent_[0]);
+    EXPECT_EQ(Ids({2}), sent_[1]);
+  });
+}
+
+TEST_F(RequestBatcherTest, FlushByMaxRequestsTest) {
+  // The window is never reached
+  FLAGS_storage_client_batch_window_us = 60 * 1000 * 1000;
+  FLAGS_storage_client_batch_max_requests = 2;
+  auto batcher = fakeBatcher();
+  HostAddr host1("127.0.0.1", 1);
+  HostAddr host2("127.0.0.1", 2);
+  auto futures = add(&batcher, host1, {{1}, {3}});
+  auto other = add(&batcher, host2, {{5}, {7}});
+  futures.insert(futures.end(),
+                 std::make_move_iterator(other.begin()),
+                 std::make_move_iterator(other.end()));
+  auto resps = folly::collectAll(futures).get();
+  EXPECT_EQ(Ids({2}), resps[0].value());
+  EXPECT_EQ(Ids({6}), resps[1].value());
+  EXPECT_EQ(Ids({10}), resps[2].value());
+  EXPECT_EQ(Ids({14}), resps[3].value());
+  evbThread_.getEventBase()->runInEventBaseThreadAndWait([&] {
+    // The requests to different hosts are not merged
+    ASSERT_EQ(2, sent_.size());
+    EXPECT_EQ(Ids({1, 3}), sent_[0]);
+    EXPECT_EQ(Ids({5, 7}), sent_[1]);
+  });
+}
+
+TEST_F(RequestBatcherTest, FailureTest) {
+  FLAGS_storage_client_batch_window_us = 10 * 1000;
+  FLAGS_storage_client_batch_max_requests = 64;
+  auto batcher = fakeBatcher();
+  auto futures = add(&batcher, HostAddr("127.0.0.1", 1), {{1}, {3}}, true);
+  auto resps = folly::collectAll(futures).get();
+  // The rpc failure is returned to all requests in the batch
+  for (const auto& resp : resps) {
+    EXPECT_TRUE(resp.hasException());
+  }
+}
+
+}  // namespace storage
+}  // namespace nebula
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  folly::init(&argc, &argv, true);
+  google::SetStderrLogging(google::INFO);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,281 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "clients/storage/StorageClient.h"
+#include "common/base/Base.h"
+#include "common/fs/TempDir.h"
+#include "common/network/NetworkUtils.h"
+#include "meta/test/TestUtils.h"
+#include "mock/MockCluster.h"
+
+DECLARE_int32(heartbeat_interval_secs);
+DECLARE_string(storage_client_read_policy);
+DECLARE_bool(storage_client_hedge_reads);
+DECLARE_int32(storage_client_hedge_min_delay_ms);
+
+namespace nebula {
+namespace storage {
+
+class HedgeStorageClient : public StorageClient {
+ public:
+  HedgeStorageClient(std::shared_ptr<folly::IOThreadPoolExecutor> ioThreadPool,
+                     meta::MetaClient* metaClient)
+      : StorageClient(ioThreadPool, metaClient) {}
+
+  using StorageClient::getHedgedResponse;
+  using StorageClient::getHedgeHost;
+};
+
+// The rpc sent to storage, which is responded by the test
+struct FakeRpc {
+  std::mutex lock;
+  std::vector<folly::Promise<cpp2::GetPropResponse>> promises;
+
+  size_t sent() {
+    std::lock_guard<std::mutex> g(lock);
+    return promises.size();
+  }
+
+  void waitSent(size_t num) {
+    while (sent() < num) {
+      usleep(1000);
+    }
+  }
+
+  void respond(size_t index, cpp2::GetPropResponse resp) {
+    std::lock_guard<std::mutex> g(lock);
+    promises[index].setValue(std::move(resp));
+  }
+
+  void fail(size_t index) {
+    std::lock_guard<std::mutex> g(lock);
+    promises[index].setException(std::runtime_error("fake rpc failure"));
+  }
+};
+
+cpp2::GetPropResponse mockResponse(int64_t id, std::vector<PartitionID> failedParts = {}) {
+  cpp2::ResponseCommon result;
+  std::vector<cpp2::PartitionResult> codes;
+  for (auto partId : failedParts) {
+    cpp2::PartitionResult code;
+    code.code_ref() = nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND;
+    code.part_id_ref() = partId;
+    codes.emplace_back(std::move(code));
+  }
+  result.failed_parts_ref() = std::move(codes);
+  // use the latency to tell which attempt the response comes from
+  result.latency_in_us_ref() = id;
+  cpp2::GetPropResponse resp;
+  resp.result_ref() = std::move(result);
+  return resp;
+}
+
+class StorageClientHedgeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    FLAGS_heartbeat_interval_secs = 1;
+    rootPath_ = std::make_unique<fs::TempDir>("/tmp/StorageClientHedgeTest.XXXXXX");
+    cluster_.startMeta(rootPath_->path());
+    cluster_.initMetaClient();
+    auto* metaClient = cluster_.metaClient_.get();
+    for (int i = 0; i < 3; i++) {
+      hosts_.emplace_back("127.0.0.1", network::NetworkUtils::getAvailablePort());
+    }
+    auto result = metaClient->addHosts(hosts_).get();
+    ASSERT_TRUE(result.ok());
+    meta::TestUtils::registerHB(cluster_.metaKV_.get(), hosts_);
+
+    // each part of replicated_space is on all hosts, each part of single_space on one host
+    meta::cpp2::SpaceDesc spaceDesc;
+    spaceDesc.space_name_ref() = "replicated_space";
+    spaceDesc.partition_num_ref() = 3;
+    spaceDesc.replica_factor_ref() = 3;
+    auto ret = metaClient->createSpace(spaceDesc).get();
+    ASSERT_TRUE(ret.ok()) << ret.status();
+    replicatedSpace_ = ret.value();
+    spaceDesc.space_name_ref() = "single_space";
+    spaceDesc.replica_factor_ref() = 1;
+    ret = metaClient->createSpace(spaceDesc).get();
+    ASSERT_TRUE(ret.ok()) << ret.status();
+    singleSpace_ = ret.value();
+    sleep(FLAGS_heartbeat_interval_secs + 1);
+    ASSERT_TRUE(metaClient->refreshCache().ok());
+
+    ioThreadPool_ = std::make_shared<folly::IOThreadPoolExecutor>(1);
+    client_ = std::make_unique<HedgeStorageClient>(ioThreadPool_, metaClient);
+  }
+
+  void TearDown() override {
+    client_.reset();
+    ioThreadPool_.reset();
+    cluster_.stop();
+  }
+
+  folly::Future<StatusOr<cpp2::GetPropResponse>> hedgedGetProps(FakeRpc* rpc) {
+    cpp2::GetPropRequest req;
+    req.space_id_ref() = replicatedSpace_;
+    std::unordered_map<PartitionID, std::vector<Row>> parts;
+    parts[1] = {};
+    req.parts_ref() = std::move(parts);
+    return client_->getHedgedResponse(
+        nullptr, hosts_[0], req, [rpc](ThriftClientType*, const cpp2::GetPropRequest&) {
+          std::lock_guard<std::mutex> g(rpc->lock);
+          rpc->promises.emplace_back();
+          return rpc->promises.back().getFuture();
+        });
+  }
+
+  std::unique_ptr<fs::TempDir> rootPath_;
+  mock::MockCluster cluster_;
+  std::vector<HostAddr> hosts_;
+  GraphSpaceID replicatedSpace_;
+  GraphSpaceID singleSpace_;
+  std::shared_ptr<folly::IOThreadPoolExecutor> ioThreadPool_;
+  std::unique_ptr<HedgeStorageClient> client_;
+};
+
+TEST(HostLoadStatsTest, ScoreTest) {
+  auto& stats = HostLoadStats::instance();
+  HostAddr host("host_load_stats_test", 1);
+  // A host never seen is tried first
+  EXPECT_EQ(0, stats.score(host));
+  EXPECT_EQ(0, stats.p95LatencyUs(host));
+
+  stats.onSend(host);
+  stats.onSend(host);
+  stats.onReceive(host, 1000);
+  // The first latency initializes the average, and half of it the deviation
+  EXPECT_EQ(1000 * 2, stats.score(host));
+  EXPECT_EQ(1000 + 2 * 500, stats.p95LatencyUs(host));
+
+  stats.onReceive(host, 2000);
+  // deviation moves by 1/4 of the difference, the average by 1/8
+  EXPECT_EQ(1125, stats.score(host));
+  EXPECT_EQ(1125 + 2 * 625, stats.p95LatencyUs(host));
+
+  HostAddr idle("host_load_stats_test", 2);
+  stats.onSend(idle);
+  stats.onReceive(idle, 500);
+  EXPECT_LT(stats.score(idle), stats.score(host));
+}
+
+TEST_F(StorageClientHedgeTest, HedgeHostTest) {
+  std::vector<PartitionID> parts = {1, 2, 3};
+  {
+    auto ret = client_->getHedgeHost(replicatedSpace_, parts, hosts_[0]);
+    ASSERT_TRUE(ret.ok()) << ret.status();
+    EXPECT_NE(hosts_[0], ret.value());
+  }
+  {
+    // The least loaded replica is picked
+    auto& stats = HostLoadStats::instance();
+    stats.onSend(hosts_[1]);
+    stats.onReceive(hosts_[1], 100000);
+    stats.onSend(hosts_[2]);
+    stats.onReceive(hosts_[2], 100);
+    auto ret = client_->getHedgeHost(replicatedSpace_, parts, hosts_[0]);
+    ASSERT_TRUE(ret.ok()) << ret.status();
+    EXPECT_EQ(hosts_[2], ret.value());
+  }
+  {
+    // No other replica holds the parts
+    auto partHosts = cluster_.metaClient_->getPartHostsFromCache(singleSpace_, 1);
+    ASSERT_TRUE(partHosts.ok());
+    ASSERT_EQ(1, partHosts.value().hosts_.size());
+    auto ret = client_->getHedgeHost(singleSpace_, {1}, partHosts.value().hosts_[0]);
+    EXPECT_FALSE(ret.ok());
+  }
+}
+
+TEST_F(StorageClientHedgeTest, HedgedResponseTest) {
+  FLAGS_storage_client_read_policy = "random";
+  FLAGS_storage_client_hedge_reads = true;
+  FLAGS_storage_client_hedge_min_delay_ms = 10;
+  {
+    // The backup responds first
+    FakeRpc rpc;
+    auto f = hedgedGetProps(&rpc);
+    rpc.waitSent(2);
+    rpc.respond(1, mockResponse(1));
+    auto resp = std::move(f).get();
+    ASSERT_TRUE(resp.ok());
+    EXPECT_EQ(1, resp.value().get_result().get_latency_in_us());
+    rpc.respond(0, mockResponse(0));
+  }
+  {
+    // A response with failed parts does not win, the other attempt is waited for
+    FakeRpc rpc;
+    auto f = hedgedGetProps(&rpc);
+    rpc.waitSent(2);
+    rpc.respond(0, mockResponse(0, {1}));
+    usleep(50 * 1000);
+    EXPECT_FALSE(f.isReady());
+    rpc.respond(1, mockResponse(1));
+    auto resp = std::move(f).get();
+    ASSERT_TRUE(resp.ok());
+    EXPECT_EQ(1, resp.value().get_result().get_latency_in_us());
+    EXPECT_TRUE(resp.value().get_result().get_failed_parts().empty());
+  }
+  {
+    // Neither succeeds in all parts, the partial result is preferred to the rpc failure
+    FakeRpc rpc;
+    auto f = hedgedGetProps(&rpc);
+    rpc.waitSent(2);
+    rpc.respond(0, mockResponse(0, {1}));
+    rpc.fail(1);
+    auto resp = std::move(f).get();
+    ASSERT_TRUE(resp.ok());
+    EXPECT_EQ(0, resp.value().get_result().get_latency_in_us());
+    EXPECT_EQ(1, resp.value().get_result().get_failed_parts().size());
+  }
+  {
+    // Not hedged when the primary responds before the delay
+    FLAGS_storage_client_hedge_min_delay_ms = 60 * 1000;
+    FakeRpc rpc;
+    auto f = hedgedGetProps(&rpc);
+    rpc.waitSent(1);
+    rpc.respond(0, mockResponse(0));
+    auto resp = std::move(f).get();
+    ASSERT_TRUE(resp.ok());
+    EXPECT_EQ(0, resp.value().get_result().get_latency_in_us());
+    EXPECT_EQ(1, rpc.sent());
+  }
+  FLAGS_storage_client_hedge_min_delay_ms = 10;
+  FLAGS_storage_client_hedge_reads = false;
+  FLAGS_storage_client_read_policy = "leader";
+}
+
+TEST_F(StorageClientHedgeTest, HedgedGetPropsTest) {
+  FLAGS_storage_client_read_policy = "random";
+  FLAGS_storage_client_hedge_reads = true;
+  FLAGS_storage_client_hedge_min_delay_ms = 0;
+  // The read goes through the hedged rpc of the client, which fails on all replicas since no
+  // storage is running. It's deduplicated so not batched with others, which is not hedged.
+  DataSet input({"_vid"});
+  for (int i = 0; i < 10; i++) {
+    input.emplace_back(Row({std::to_string(i)}));
+  }
+  std::vector<cpp2::VertexProp> props(1);
+  props[0].tag_ref() = 1;
+  StorageClient::CommonRequestParam param(replicatedSpace_, 0, 0);
+  auto resp = client_->getProps(param, input, &props, nullptr, nullptr, true).get();
+  EXPECT_EQ(0, resp.completeness());
+  EXPECT_FALSE(resp.failedParts().empty());
+  FLAGS_storage_client_hedge_min_delay_ms = 10;
+  FLAGS_storage_client_hedge_reads = false;
+  FLAGS_storage_client_read_policy = "leader";
+}
+
+}  // namespace storage
+}  // namespace nebula
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  folly::init(&argc, &argv, true);
+  google::SetStderrLogging(google::INFO);
+  return RUN_ALL_TESTS();
+}
@@ -60,11 +60,38 @@ folly::SemiFuture<Code> ChainAddEdgesLocalProcessor::processRemote(Code code) {
     return rcPrepare_;
   }
   CHECK_EQ(req_.get_parts().size(), 1);
-  auto reversedRequest = reverseRequest(req_);
+  if (FLAGS_toss_group_inflight <= 0) {
+    return processRemoteGroup({this});
+  }
+  return env_->txnMan_->addEdgesRemoteGroups()->add(
+      groupKey(), this, FLAGS_toss_group_inflight, FLAGS_toss_group_max_edges);
+}
+
+// static
+folly::SemiFuture<Code> ChainAddEdgesLocalProcessor::processRemoteGroup(
+    std::vector<ChainAddEdgesLocalProcessor*>&& procs) {
+  auto* first = procs.front();
+  auto reversedRequest = first->reverseRequest(first->req_);
   CHECK_EQ(reversedRequest.get_parts().size(), 1);
+  auto& reversedEdges = (*reversedRequest.parts_ref())[first->remotePartId_];
+  for (size_t i = 1; i < procs.size(); ++i) {
+    auto other = procs[i]->reverseRequest(procs[i]->req_);
+    auto& edges = (*other.parts_ref())[first->remotePartId_];
+    std::move(edges.begin(), edges.end(), std::back_inserter(reversedEdges));
+  }
+  if (procs.size() > 1) {
+    VLOG(2) << first->uuid_ << " send " << reversedEdges.size() << " edges of " << procs.size()
+            << " requests in one rpc";
+  }
+
   auto [pro, fut] = folly::makePromiseContract<Code>();
-  doRpc(std::move(pro), std::move(reversedRequest));
-  return std::move(fut);
+  first->doRpc(std::move(pro), std::move(reversedRequest));
+  return std::move(fut).deferValue([procs = std::move(procs)](Code code) {
+    for (auto* proc : procs) {
+      proc->rcRemote_ = code;
+    }
+    return code;
+  });
 }
 
 folly::SemiFuture<Code> ChainAddEdgesLocalProcessor::processLocal(Code) {
@@ -112,24 +139,49 @@ bool ChainAddEdgesLocalProcessor::prepareRequest(const cpp2::AddEdgesRequest& re
 }
 
 folly::SemiFuture<Code> ChainAddEdgesLocalProcessor::commit() {
-  auto* proc = AddEdgesProcessor::instance(env_, nullptr);
-  proc->consistOp_ = [&](kvstore::BatchHolder& a, std::vector<kvstore::KV>* b) {
-    callbackOfChainOp(a, b);
+  if (FLAGS_toss_group_inflight <= 0) {
+    return commitGroup({this});
+  }
+  return env_->txnMan_->addEdgesCommitGroups()->add(
+      groupKey(), this, FLAGS_toss_group_inflight, FLAGS_toss_group_max_edges);
+}
+
+// static
+folly::SemiFuture<Code> ChainAddEdgesLocalProcessor::commitGroup(
+    std::vector<ChainAddEdgesLocalProcessor*>&& procs) {
+  auto* first = procs.front();
+  auto req = std::make_shared<cpp2::AddEdgesRequest>(first->req_);
+  auto& edges = (*req->parts_ref())[first->localPartId_];
+  for (size_t i = 1; i < procs.size(); ++i) {
+    auto& others = procs[i]->req_.get_parts().begin()->second;
+    edges.insert(edges.end(), others.begin(), others.end());
+  }
+
+  auto* proc = AddEdgesProcessor::instance(first->env_, nullptr);
+  proc->consistOp_ = [procs](kvstore::BatchHolder& a, std::vector<kvstore::KV>* b) {
+    // the edges are put once, and the (double)primes of every processor are put or removed
+    procs.front()->callbackOfChainOp(a, b);
+    for (size_t i = 1; i < procs.size(); ++i) {
+      procs[i]->callbackOfChainOp(a, nullptr);
+    }
   };
   auto futProc = proc->getFuture();
   auto [pro, fut] = folly::makePromiseContract<Code>();
-  std::move(futProc).thenTry([&, p = std::move(pro)](auto&& t) mutable {
-    execDesc_ += ", commit(), ";
+  std::move(futProc).thenTry([procs, req, p = std::move(pro)](auto&& t) mutable {
+    auto rc = Code::SUCCEEDED;
     if (t.hasException()) {
       LOG(INFO) << "catch ex: " << t.exception().what();
-      rcCommit_ = Code::E_UNKNOWN;
+      rc = Code::E_UNKNOWN;
     } else {
-      auto& resp = t.value();
-      rcCommit_ = extractRpcError(resp);
+      rc = procs.front()->extractRpcError(t.value());
+    }
+    for (auto* chainProc : procs) {
+      chainProc->execDesc_ += ", commit(), ";
+      chainProc->rcCommit_ = rc;
     }
-    p.setValue(rcCommit_);
+    p.setValue(rc);
   });
-  proc->process(req_);
+  proc->process(*req);
   return std::move(fut);
 }
 
@@ -261,10 +313,21 @@ bool ChainAddEdgesLocalProcessor::lockEdges(const cpp2::AddEdgesRequest& req) {
   for (auto& edge : req.get_parts().begin()->second) {
     keys.emplace_back(ConsistUtil::edgeKey(spaceVidLen_, partId, edge.get_key()));
   }
-  lk_ = std::make_unique<TransactionManager::LockGuard>(lkCore_.get(), keys);
+  lk_ = std::make_unique<TransactionManager::LockGuard>(
+      lkCore_.get(), keys, false, true, std::chrono::microseconds(FLAGS_memory_lock_wait_us));
   return lk_->isLocked();
 }
 
+std::string ChainAddEdgesLocalProcessor::groupKey() const {
+  return folly::sformat("{}:{}:{}:{}:{}:{}",
+                        spaceId_,
+                        localPartId_,
+                        remotePartId_,
+                        term_,
+                        req_.get_if_not_exists(),
+                        folly::join(",", req_.get_prop_names()));
+}
+
 std::vector<std::string> ChainAddEdgesLocalProcessor::toStrKeys(const cpp2::AddEdgesRequest& req) {
   std::vector<std::string> ret;
   for (auto& edgesOfPart : req.get_parts()) {
@@ -39,6 +39,23 @@ class ChainAddEdgesLocalProcessor : public BaseProcessor<cpp2::ExecResponse>,
 
   void finish() override;
 
+  size_t edgeNum() const {
+    return req_.get_parts().begin()->second.size();
+  }
+
+  /**
+   * @brief Send the reversed edges of a group of processors of the same (local part, remote part)
+   *        in one RPC, and set the remote result of each processor.
+   */
+  static folly::SemiFuture<Code> processRemoteGroup(
+      std::vector<ChainAddEdgesLocalProcessor*>&& procs);
+
+  /**
+   * @brief Commit the edges of a group of processors of the same (local part, remote part) in one
+   *        raft log, and set the commit result of each processor.
+   */
+  static folly::SemiFuture<Code> commitGroup(std::vector<ChainAddEdgesLocalProcessor*>&& procs);
+
  protected:
   explicit ChainAddEdgesLocalProcessor(StorageEnv* env) : BaseProcessor<cpp2::ExecResponse>(env) {}
 
@@ -54,6 +71,11 @@ class ChainAddEdgesLocalProcessor : public BaseProcessor<cpp2::ExecResponse>,
 
   bool lockEdges(const cpp2::AddEdgesRequest& req);
 
+  /**
+   * @brief processors with the same key could be grouped in remote phase and commit
+   */
+  std::string groupKey() const;
+
   /**
    * @brief This is a call back function, to let AddEdgesProcessor so some
    *        addition thing for chain operation
@@ -99,7 +121,8 @@ class ChainAddEdgesLocalProcessor : public BaseProcessor<cpp2::ExecResponse>,
   void eraseDoublePrime();
 
   /**
-   * @brief will call normal AddEdgesProcess to do real insert.
+   * @brief will call normal AddEdgesProcess to do real insert,
+   *        together with the other processors of the same group.
    *
    * @return folly::SemiFuture<Code>
    */
@@ -302,7 +302,8 @@ bool ChainDeleteEdgesLocalProcessor::lockEdges(const cpp2::DeleteEdgesRequest& r
     keys.emplace_back(std::move(eKey));
   }
   bool dedup = true;
-  lk_ = std::make_unique<TransactionManager::LockGuard>(lkCore_.get(), keys, dedup);
+  lk_ = std::make_unique<TransactionManager::LockGuard>(
+      lkCore_.get(), keys, dedup, true, std::chrono::microseconds(FLAGS_memory_lock_wait_us));
   if (!lk_->isLocked()) {
     VLOG(1) << txnId_ << "term=" << term_ << ", conflict key = "
             << ConsistUtil::readableKey(spaceVidLen_, isIntId_, lk_->conflictKey());
@@ -0,0 +1,138 @@
+/* Copyright (c) 2022 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef STORAGE_TRANSACTION_CHAINGROUPEXECUTOR_H
+#define STORAGE_TRANSACTION_CHAINGROUPEXECUTOR_H
+
+#include <folly/Executor.h>
+#include <folly/futures/Future.h>
+
+#include <deque>
+
+#include "common/base/Base.h"
+#include "interface/gen-cpp2/common_types.h"
+
+namespace nebula {
+namespace storage {
+
+/**
+ * @brief Execute the concurrent items of the same key in groups, e.g. the remote phase of chain
+ * processors of the same (local part, remote part). At most maxInflight groups of a key are
+ * executed at a time, the items added meanwhile wait and form the next group. So an idle key
+ * executes an item at once, and a busy key amortizes the cost of RPC and raft log over the group.
+ */
+template <class Item>
+class ChainGroupExecutor final {
+ public:
+  using Code = ::nebula::cpp2::ErrorCode;
+  // Execute a group of items, the result is the result of every item of the group
+  using ExecFunc = std::function<folly::SemiFuture<Code>(std::vector<Item>&&)>;
+  // The size of an item, e.g. the number of edges
+  using SizeFunc = std::function<size_t(const Item&)>;
+
+  ChainGroupExecutor(folly::Executor* executor, ExecFunc exec, SizeFunc size)
+      : executor_(executor), exec_(std::move(exec)), size_(std::move(size)) {}
+
+  /**
+   * @brief Add an item into the groups of key
+   *
+   * @param key
+   * @param item
+   * @param maxInflight Max number of groups of key executed at a time
+   * @param maxGroupSize Max total size of items of a group, a group has one item at least
+   * @return folly::SemiFuture<Code> Result of the group which contains item
+   */
+  folly::SemiFuture<Code> add(const std::string& key,
+                              Item item,
+                              size_t maxInflight,
+                              size_t maxGroupSize) {
+    auto [p, f] = folly::makePromiseContract<Code>();
+    std::vector<Pending> group;
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      auto& keyGroups = groups_[key];
+      keyGroups.pending.emplace_back(Pending{std::move(item), std::move(p)});
+      if (keyGroups.inflight >= std::max<size_t>(1, maxInflight)) {
+        return std::move(f);
+      }
+      group = takeGroup(keyGroups, maxGroupSize);
+    }
+    execute(key, std::move(group), maxInflight, maxGroupSize);
+    return std::move(f);
+  }
+
+ private:
+  struct Pending {
+    Item item;
+    folly::Promise<Code> promise;
+  };
+
+  struct KeyGroups {
+    size_t inflight{0};
+    std::deque<Pending> pending;
+  };
+
+  std::vector<Pending> takeGroup(KeyGroups& keyGroups, size_t maxGroupSize) {
+    std::vector<Pending> group;
+    size_t size = 0;
+    while (!keyGroups.pending.empty() &&
+           (group.empty() || size + size_(keyGroups.pending.front().item) <= maxGroupSize)) {
+      size += size_(keyGroups.pending.front().item);
+      group.emplace_back(std::move(keyGroups.pending.front()));
+      keyGroups.pending.pop_front();
+    }
+    keyGroups.inflight++;
+    return group;
+  }
+
+  void execute(const std::string& key,
+               std::vector<Pending>&& group,
+               size_t maxInflight,
+               size_t maxGroupSize) {
+    std::vector<Item> items;
+    items.reserve(group.size());
+    for (auto& pending : group) {
+      items.emplace_back(pending.item);
+    }
+    VLOG(3) << "Execute a group of " << items.size() << " items of " << key;
+    exec_(std::move(items))
+        .via(executor_)
+        .thenTry([this, key, group = std::move(group), maxInflight, maxGroupSize](
+                     folly::Try<Code>&& t) mutable {
+          auto code = t.hasException() ? Code::E_UNKNOWN : t.value();
+          for (auto& pending : group) {
+            pending.promise.setValue(code);
+          }
+
+          std::vector<Pending> next;
+          {
+            std::lock_guard<std::mutex> guard(lock_);
+            auto iter = groups_.find(key);
+            DCHECK(iter != groups_.end());
+            auto& keyGroups = iter->second;
+            keyGroups.inflight--;
+            if (!keyGroups.pending.empty()) {
+              next = takeGroup(keyGroups, maxGroupSize);
+            } else if (keyGroups.inflight == 0) {
+              groups_.erase(iter);
+            }
+          }
+          if (!next.empty()) {
+            execute(key, std::move(next), maxInflight, maxGroupSize);
+          }
+        });
+  }
+
+  folly::Executor* executor_{nullptr};
+  ExecFunc exec_;
+  SizeFunc size_;
+
+  std::mutex lock_;
+  std::unordered_map<std::string, KeyGroups> groups_;
+};
+
+}  // namespace storage
+}  // namespace nebula
+#endif
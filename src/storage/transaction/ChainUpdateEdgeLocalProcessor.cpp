@@ -258,7 +258,8 @@ bool ChainUpdateEdgeLocalProcessor::setLock() {
     return false;
   }
   auto key = ConsistUtil::edgeKey(spaceVidLen_, req_.get_part_id(), req_.get_edge_key());
-  lk_ = std::make_unique<MemoryLockGuard<std::string>>(lkCore_.get(), key);
+  lk_ = std::make_unique<MemoryLockGuard<std::string>>(
+      lkCore_.get(), key, std::chrono::microseconds(FLAGS_memory_lock_wait_us));
   return lk_->isLocked();
 }
 
@@ -12,6 +12,7 @@
 #include "kvstore/NebulaStore.h"
 #include "storage/CommonUtils.h"
 #include "storage/StorageFlags.h"
+#include "storage/transaction/ChainAddEdgesLocalProcessor.h"
 #include "storage/transaction/ChainProcessorFactory.h"
 
 namespace nebula {
@@ -19,11 +20,21 @@ namespace storage {
 
 DEFINE_int32(resume_interval_secs, 10, "Resume interval");
 DEFINE_int32(toss_worker_num, 16, "Resume interval");
+DEFINE_int32(toss_group_inflight,
+             4,
+             "Max number of in-flight groups of chain edge writes of a (local part, remote part), "
+             "0 means no grouping");
+DEFINE_int32(toss_group_max_edges, 1024, "Max number of edges of a group of chain edge writes");
 
 TransactionManager::TransactionManager(StorageEnv* env) : env_(env) {
   LOG(INFO) << "TransactionManager ctor()";
   worker_ = std::make_shared<folly::IOThreadPoolExecutor>(FLAGS_toss_worker_num);
   controller_ = std::make_shared<folly::IOThreadPoolExecutor>(1);
+  auto edgeNum = [](ChainAddEdgesLocalProcessor* const& proc) { return proc->edgeNum(); };
+  addEdgesRemoteGroups_ = std::make_unique<AddEdgesGroups>(
+      worker_.get(), &ChainAddEdgesLocalProcessor::processRemoteGroup, edgeNum);
+  addEdgesCommitGroups_ = std::make_unique<AddEdgesGroups>(
+      worker_.get(), &ChainAddEdgesLocalProcessor::commitGroup, edgeNum);
 }
 
 bool TransactionManager::start() {
@@ -249,11 +260,12 @@ void TransactionManager::scanPrimes(GraphSpaceID spaceId, PartitionID partId, Te
         if (!hasUnfinishedTask()) {
           addPrime(spaceId, partId, termId, edgeKey, resumeVec[i]);
         } else {
+          // resume the edge after the task of previous term released its lock
           folly::Promise<folly::Unit> pro;
           auto fut = pro.getFuture();
           std::move(fut).thenValue(
               [=](auto&&) { addPrime(spaceId, partId, termId, edgeKey, resumeVec[i]); });
-          waitUntil(std::move(hasUnfinishedTask), std::move(pro));
+          waitUntil([hasUnfinishedTask] { return !hasUnfinishedTask(); }, std::move(pro));
         }
       }
     } else {
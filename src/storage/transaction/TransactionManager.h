@@ -19,10 +19,17 @@
 #include "kvstore/KVStore.h"
 #include "kvstore/Part.h"
 #include "storage/CommonUtils.h"
+#include "storage/transaction/ChainGroupExecutor.h"
 #include "storage/transaction/ConsistUtil.h"
 
+DECLARE_int32(toss_group_inflight);
+DECLARE_int32(toss_group_max_edges);
+
 namespace nebula {
 namespace storage {
+
+class ChainAddEdgesLocalProcessor;
+
 class TransactionManager {
  public:
   FRIEND_TEST(ChainUpdateEdgeTest, updateTest1);
@@ -31,6 +38,7 @@ class TransactionManager {
   using LockGuard = MemoryLockGuard<std::string>;
   using LockCore = MemoryLockCore<std::string>;
   using SPtrLock = std::shared_ptr<LockCore>;
+  using AddEdgesGroups = ChainGroupExecutor<ChainAddEdgesLocalProcessor*>;
 
  public:
   explicit TransactionManager(storage::StorageEnv* env);
@@ -109,6 +117,22 @@ class TransactionManager {
    */
   folly::EventBase* getEventBase();
 
+  /**
+   * @brief The remote phase of chain add edges processors of the same (local part, remote part)
+   *        are executed in groups, the reversed edges of a group are sent in one RPC.
+   */
+  AddEdgesGroups* addEdgesRemoteGroups() {
+    return addEdgesRemoteGroups_.get();
+  }
+
+  /**
+   * @brief The commit of chain add edges processors of the same (local part, remote part)
+   *        are executed in groups, the edges of a group are written in one raft log.
+   */
+  AddEdgesGroups* addEdgesCommitGroups() {
+    return addEdgesCommitGroups_.get();
+  }
+
   /**
    * @brief stat thread, used for debug
    */
@@ -140,6 +164,9 @@ class TransactionManager {
   // only used for waiting some job stop.
   std::shared_ptr<folly::IOThreadPoolExecutor> controller_;
 
+  std::unique_ptr<AddEdgesGroups> addEdgesRemoteGroups_;
+  std::unique_ptr<AddEdgesGroups> addEdgesCommitGroups_;
+
   /**
    * @brief used for a remote processor to record the term of its "local Processor"
    */